@@ -0,0 +1,53 @@
+// ============================================================================
+// Benchmark: numeric parsing against strtod
+// ============================================================================
+// Compares impl::parse_numeric_char (std::from_chars, locale independent)
+// with the std::strtod baseline it replaced, on decimal strings with an
+// exponent. Correctness is covered by ParseFromCharsTest.matches_strtod.
+//
+//   pkr_units_bench_parse_numeric [rounds]
+
+#include <pkr_units/impl/parsing/parse.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+template <typename Fn>
+double run(const char* name, const std::vector<std::string>& inputs, std::size_t rounds, Fn&& fn)
+{
+    double sum = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < rounds; ++r)
+    {
+        for (const auto& text : inputs)
+        {
+            sum += fn(text);
+        }
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-24s %8.1f ns/value  (sum %.17g)\n", name, elapsed.count() / static_cast<double>(inputs.size() * rounds), sum);
+    return sum;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace pkr::units;
+    const std::size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2'000;
+
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 1000; ++i)
+    {
+        inputs.push_back(std::to_string(static_cast<double>(i) * 1.125e-3) + "e2");
+    }
+
+    const double from_chars = run("parse_numeric_char", inputs, rounds, [](const std::string& text) { return impl::parse_numeric_char<double>(text).value_or(0.0); });
+    const double baseline = run("strtod", inputs, rounds, [](const std::string& text) { return std::strtod(text.c_str(), nullptr); });
+    return from_chars == baseline ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+// ============================================================================
+// Benchmark: streaming measurements and units to an ostream
+// ============================================================================
+// Compares operator<< (stack buffer rendered with std::to_chars, one sputn per
+// value) with the previous implementation, std::format_to through an
+// ostreambuf_iterator (spec parsed per call, one streambuf call per character).
+// The formatters now take the fast path for "{}" as well, so the previous
+// path is reproduced here: the value formatter writes each number through the
+// iterator and the separator and symbol are copied after it.
+// The stream writes into a counting streambuf so only formatting is measured.
+//
+//   pkr_units_bench_stream_output [count]
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/measurements.h>
+#include <pkr_units/format/si.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <iterator>
+#include <ostream>
+#include <string_view>
+#include <streambuf>
+#include <vector>
+
+namespace
+{
+
+class counting_streambuf : public std::streambuf
+{
+public:
+    std::size_t count = 0;
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        ++count;
+        return ch;
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize n) override
+    {
+        count += static_cast<std::size_t>(n);
+        return n;
+    }
+};
+
+template <typename Fn>
+void run(const char* name, std::size_t count, Fn&& fn)
+{
+    counting_streambuf sink;
+    std::ostream os(&sink);
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        fn(os, i);
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-40s %8.1f ns/value  (%zu bytes)\n", name, elapsed.count() / static_cast<double>(count), sink.count);
+}
+
+// The formatters before the fast path: value formatter, then the symbol copied
+// through the same ostreambuf_iterator
+constexpr std::string_view length_symbol = "m";
+
+void previous_unit_output(std::ostream& os, const pkr::units::meter_t<double>& unit)
+{
+    auto out = std::format_to(std::ostreambuf_iterator<char>(os), "{}", unit.value());
+    *out++ = ' ';
+    std::copy(length_symbol.begin(), length_symbol.end(), out);
+}
+
+void previous_measurement_output(std::ostream& os, const pkr::units::measurement_lin_t<pkr::units::meter_t<double>>& measurement)
+{
+    constexpr std::string_view separator = " +/- ";
+    auto out = std::format_to(std::ostreambuf_iterator<char>(os), "{}", measurement.value());
+    out = std::copy(separator.begin(), separator.end(), out);
+    out = std::format_to(out, "{}", measurement.uncertainty());
+    *out++ = ' ';
+    std::copy(length_symbol.begin(), length_symbol.end(), out);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace pkr::units;
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2'000'000;
+
+    std::vector<measurement_lin_t<meter_t<double>>> measurements;
+    std::vector<meter_t<double>> lengths;
+    measurements.reserve(count);
+    lengths.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const double x = std::sin(static_cast<double>(i)) * 1e3;
+        measurements.emplace_back(x, std::abs(x) * 1e-3);
+        lengths.emplace_back(x);
+    }
+
+    run("measurement: previous format_to(ostreambuf)", count, [&](std::ostream& os, std::size_t i) { previous_measurement_output(os, measurements[i]); });
+    run("measurement: std::format_to(ostreambuf)",
+        count,
+        [&](std::ostream& os, std::size_t i) { std::format_to(std::ostreambuf_iterator<char>(os), "{}", measurements[i]); });
+    run("measurement: operator<<", count, [&](std::ostream& os, std::size_t i) { os << measurements[i]; });
+    run("unit: previous format_to(ostreambuf)", count, [&](std::ostream& os, std::size_t i) { previous_unit_output(os, lengths[i]); });
+    run("unit: std::format_to(ostreambuf)", count, [&](std::ostream& os, std::size_t i) { std::format_to(std::ostreambuf_iterator<char>(os), "{}", lengths[i]); });
+    run("unit: operator<<", count, [&](std::ostream& os, std::size_t i) { os << lengths[i]; });
+    return 0;
+}
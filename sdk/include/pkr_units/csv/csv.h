@@ -0,0 +1,500 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pkr_units/expected.h>
+#include <pkr_units/csv/mapped_file.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+#include <pkr_units/impl/parsing/unit_expression.h>
+#include <pkr_units/impl/parsing/unit_registry.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
+
+// ============================================================================
+// Bulk CSV/TSV ingest into unit-typed columns
+// ============================================================================
+//
+// read() binds header columns by name to unit types and converts every cell
+// straight into a std::vector of that unit type:
+//
+//   timestamp,pressure [kPa],temperature [degC]
+//   0.0,101.3,20.5
+//
+//   auto table = csv::read(text, csv::column<second_t<double>>{"timestamp"},
+//                                csv::column<pascal_t<double>>{"pressure"},
+//                                csv::column<kelvin_t<double>>{"temperature"});
+//
+// The source unit of a column comes from the binding, else from a "[unit]" or
+// "(unit)" suffix of its header, else it is the target unit itself. It may be
+// any registered symbol or unit expression of the target's dimension; the
+// conversion is folded into one multiply-add per cell.
+//
+// The body is cut into chunks at line boundaries. A first pass counts the rows
+// of every chunk, so the columns are allocated once; a second pass parses each
+// chunk into its own rows. Both passes run on the shared work-stealing pool.
+// Fields are found with a 16-byte SIMD scan for the delimiter and newline
+// (SSE2; scalar elsewhere) and numbers are read with std::from_chars.
+//
+// Cells may be surrounded by spaces or double quotes, but quoted cells cannot
+// contain the delimiter or a newline. Empty cells of floating-point columns
+// become quiet NaN. Blank lines are skipped; unbound columns are never parsed.
+
+namespace PKR_UNITS_NAMESPACE::csv
+{
+
+enum class error_code
+{
+    missing_column,      // No header field has the requested name
+    unknown_unit,        // Source unit is neither registered nor a valid unit expression
+    dimension_mismatch,  // Source unit has another dimension than the target unit
+    numeric_parse_error, // Cell is not a number
+    missing_field,       // Row ends before a bound column
+};
+
+struct error
+{
+    error_code code;
+    std::size_t line;   // 1-based; the header is line 1
+    std::size_t column; // 0-based field index
+};
+
+struct options
+{
+    char delimiter = ',';                   // '\t' for TSV
+    std::size_t chunk_bytes = 1 << 20;      // unit of parallel work
+    bool parallel = true;                   // false parses on the calling thread
+};
+
+/// Binds the header column `name` to UnitT; `unit` overrides the header's unit annotation
+template <is_pkr_unit_c UnitT>
+struct column
+{
+    std::string_view name;
+    std::string_view unit{};
+};
+
+template <is_pkr_unit_c... Units>
+using columns_t = std::tuple<std::vector<Units>...>;
+
+namespace details
+{
+
+inline constexpr std::size_t unbound = std::numeric_limits<std::size_t>::max();
+
+constexpr std::string_view trim_cell(std::string_view cell) noexcept
+{
+    while (!cell.empty() && (cell.front() == ' ' || cell.front() == '\t'))
+    {
+        cell.remove_prefix(1);
+    }
+    while (!cell.empty() && (cell.back() == ' ' || cell.back() == '\t' || cell.back() == '\r'))
+    {
+        cell.remove_suffix(1);
+    }
+    if (cell.size() >= 2 && cell.front() == '"' && cell.back() == '"')
+    {
+        cell = cell.substr(1, cell.size() - 2);
+    }
+    return cell;
+}
+
+// "pressure [kPa]" -> ("pressure", "kPa"); "(kPa)" works as well
+struct header_field
+{
+    std::string_view text;
+    std::string_view name;
+    std::string_view unit;
+};
+
+constexpr header_field split_header_field(std::string_view text) noexcept
+{
+    text = trim_cell(text);
+    header_field field{text, text, {}};
+    if (text.empty() || (text.back() != ']' && text.back() != ')'))
+    {
+        return field;
+    }
+    const char open = text.back() == ']' ? '[' : '(';
+    const std::size_t pos = text.rfind(open);
+    if (pos == std::string_view::npos)
+    {
+        return field;
+    }
+    field.name = trim_cell(text.substr(0, pos));
+    field.unit = trim_cell(text.substr(pos + 1, text.size() - pos - 2));
+    return field;
+}
+
+inline std::vector<header_field> split_header(std::string_view line, char delimiter)
+{
+    std::vector<header_field> fields;
+    for (std::size_t start = 0;;)
+    {
+        const std::size_t end = line.find(delimiter, start);
+        fields.push_back(split_header_field(line.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start)));
+        if (end == std::string_view::npos)
+        {
+            return fields;
+        }
+        start = end + 1;
+    }
+}
+
+using linear_map = impl::linear_conversion;
+
+template <is_pkr_unit_c UnitT>
+auto resolve_unit(std::string_view unit) -> expected_t<linear_map, error_code>
+{
+    if (unit.empty())
+    {
+        return expected_t<linear_map, error_code>{linear_map{}};
+    }
+    const auto conversion = impl::resolve_linear_conversion<UnitT>(unit);
+    if (!conversion)
+    {
+        return expected_t<linear_map, error_code>{conversion.error() == parse_error::symbol_mismatch ? error_code::dimension_mismatch : error_code::unknown_unit};
+    }
+    return expected_t<linear_map, error_code>{*conversion};
+}
+
+// First delimiter or newline in [first, last), or last
+inline const char* find_field_end(const char* first, const char* last, char delimiter) noexcept
+{
+#if defined(PKR_UNITS_SIMD_SSE2)
+    const __m128i delimiters = _mm_set1_epi8(delimiter);
+    const __m128i newlines = _mm_set1_epi8('\n');
+    while (last - first >= 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, delimiters), _mm_cmpeq_epi8(block, newlines)));
+        if (mask != 0)
+        {
+            return first + std::countr_zero(static_cast<unsigned>(mask));
+        }
+        first += 16;
+    }
+#endif
+    while (first != last && *first != delimiter && *first != '\n')
+    {
+        ++first;
+    }
+    return first;
+}
+
+inline const char* find_newline(const char* first, const char* last) noexcept
+{
+    const void* found = std::memchr(first, '\n', static_cast<std::size_t>(last - first));
+    return found == nullptr ? last : static_cast<const char*>(found);
+}
+
+// Whitespace only and no delimiter: skipped by both passes alike
+inline bool is_blank_line(const char* first, const char* last, char delimiter) noexcept
+{
+    for (; first != last; ++first)
+    {
+        if (*first == delimiter || (*first != ' ' && *first != '\t' && *first != '\r'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename value_t>
+bool parse_cell(std::string_view cell, value_t& value) noexcept
+{
+    cell = trim_cell(cell);
+    if (cell.empty())
+    {
+        if constexpr (std::numeric_limits<value_t>::has_quiet_NaN)
+        {
+            value = std::numeric_limits<value_t>::quiet_NaN();
+            return true;
+        }
+        return false;
+    }
+    if (cell.front() == '+')
+    {
+        cell.remove_prefix(1);
+    }
+    const auto [ptr, ec] = std::from_chars(cell.data(), cell.data() + cell.size(), value);
+    return ec == std::errc{} && ptr == cell.data() + cell.size();
+}
+
+struct chunk
+{
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::size_t lines = 0;
+    std::size_t rows = 0;
+    std::size_t first_line = 0;
+    std::size_t first_row = 0;
+    std::optional<error> failure;
+};
+
+// Chunks of about chunk_bytes, each ending just after a newline (or at the end)
+inline std::vector<chunk> split_chunks(std::string_view body, std::size_t chunk_bytes)
+{
+    std::vector<chunk> chunks;
+    chunk_bytes = chunk_bytes == 0 ? 1 : chunk_bytes;
+    for (std::size_t begin = 0; begin < body.size();)
+    {
+        std::size_t end = body.size();
+        if (body.size() - begin > chunk_bytes)
+        {
+            const std::size_t newline = body.find('\n', begin + chunk_bytes - 1);
+            end = newline == std::string_view::npos ? body.size() : newline + 1;
+        }
+        chunk c{};
+        c.begin = begin;
+        c.end = end;
+        chunks.push_back(c);
+        begin = end;
+    }
+    return chunks;
+}
+
+inline void count_rows(std::string_view body, char delimiter, chunk& c) noexcept
+{
+    const char* last = body.data() + c.end;
+    for (const char* line = body.data() + c.begin; line < last;)
+    {
+        const char* newline = find_newline(line, last);
+        ++c.lines;
+        if (!is_blank_line(line, newline, delimiter))
+        {
+            ++c.rows;
+        }
+        line = newline + 1;
+    }
+}
+
+template <typename range_fn>
+void for_each_chunk(std::vector<chunk>& chunks, bool parallel, range_fn&& fn)
+{
+    auto run = [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t c = begin; c < end; ++c)
+        {
+            fn(chunks[c]);
+        }
+    };
+    if (parallel && chunks.size() > 1)
+    {
+        PKR_UNITS_NAMESPACE::parallel_for(0, chunks.size(), 1, run);
+    }
+    else
+    {
+        run(0, chunks.size());
+    }
+}
+
+} // namespace details
+
+/// Parse CSV/TSV text into one vector per bound column
+///
+/// @return the columns in binding order, or the first error (by line)
+template <is_pkr_unit_c... Units>
+auto read(std::string_view text, const options& opts, const column<Units>&... columns) -> expected_t<columns_t<Units...>, error>
+{
+    using result_t = expected_t<columns_t<Units...>, error>;
+    using unit_list = std::tuple<Units...>;
+    constexpr std::size_t bound_count = sizeof...(Units);
+
+    if (text.starts_with("\xEF\xBB\xBF"))
+    {
+        text.remove_prefix(3);
+    }
+    const std::size_t header_end = text.find('\n');
+    const std::vector<details::header_field> header = details::split_header(text.substr(0, header_end), opts.delimiter);
+    const std::string_view body = header_end == std::string_view::npos ? std::string_view{} : text.substr(header_end + 1);
+
+    // Bind columns to header fields and fold each unit conversion into a multiply-add
+    const std::array<std::string_view, bound_count> names{columns.name...};
+    const std::array<std::string_view, bound_count> units{columns.unit...};
+    std::array<std::size_t, bound_count> field_of{};
+    std::array<details::linear_map, bound_count> maps{};
+    std::vector<std::size_t> binding_of(header.size(), details::unbound);
+    std::size_t last_field = 0;
+    std::optional<error> bind_error;
+    for (std::size_t b = 0; b < bound_count && !bind_error; ++b)
+    {
+        field_of[b] = details::unbound;
+        for (std::size_t f = 0; f < header.size() && field_of[b] == details::unbound; ++f)
+        {
+            if (header[f].name == names[b] || header[f].text == names[b])
+            {
+                field_of[b] = f;
+            }
+        }
+        if (field_of[b] == details::unbound)
+        {
+            bind_error = error{error_code::missing_column, 1, header.size()};
+            break;
+        }
+        binding_of[field_of[b]] = b;
+        last_field = std::max(last_field, field_of[b]);
+    }
+    if (bind_error)
+    {
+        return result_t{*bind_error};
+    }
+    [&]<std::size_t... index_v>(std::index_sequence<index_v...>)
+    {
+        (
+            [&]
+            {
+                if (bind_error)
+                {
+                    return;
+                }
+                const std::string_view unit = units[index_v].empty() ? header[field_of[index_v]].unit : units[index_v];
+                auto map = details::resolve_unit<std::tuple_element_t<index_v, unit_list>>(unit);
+                if (!map)
+                {
+                    bind_error = error{map.error(), 1, field_of[index_v]};
+                    return;
+                }
+                maps[index_v] = *map;
+            }(),
+            ...);
+    }(std::index_sequence_for<Units...>{});
+    if (bind_error)
+    {
+        return result_t{*bind_error};
+    }
+
+    // Pass 1: rows per chunk, so that every column is allocated once
+    std::vector<details::chunk> chunks = details::split_chunks(body, opts.chunk_bytes);
+    details::for_each_chunk(chunks, opts.parallel, [&](details::chunk& c) { details::count_rows(body, opts.delimiter, c); });
+    std::size_t rows = 0;
+    std::size_t lines = 0;
+    for (details::chunk& c : chunks)
+    {
+        c.first_row = rows;
+        c.first_line = lines;
+        rows += c.rows;
+        lines += c.lines;
+    }
+    columns_t<Units...> out{std::vector<Units>(rows, Units{typename PKR_UNITS_NAMESPACE::details::is_pkr_unit<Units>::value_type{}})...};
+
+    // Pass 2: parse every chunk into its own rows
+    const char delimiter = opts.delimiter;
+    details::for_each_chunk(
+        chunks,
+        opts.parallel,
+        [&](details::chunk& c)
+        {
+            const char* p = body.data() + c.begin;
+            const char* const last = body.data() + c.end;
+            std::size_t row = c.first_row;
+            std::size_t line = c.first_line + 2;
+            while (p < last)
+            {
+                std::size_t field = 0;
+                bool blank = false;
+                for (;;)
+                {
+                    const char* const end = details::find_field_end(p, last, delimiter);
+                    const std::string_view cell{p, static_cast<std::size_t>(end - p)};
+                    const bool row_done = end == last || *end == '\n';
+                    if (field == 0 && row_done && details::is_blank_line(cell.data(), end, delimiter))
+                    {
+                        blank = true;
+                    }
+                    else if (field < binding_of.size() && binding_of[field] != details::unbound)
+                    {
+                        const std::size_t b = binding_of[field];
+                        bool parsed = true;
+                        [&]<std::size_t... index_v>(std::index_sequence<index_v...>)
+                        {
+                            (
+                                [&]
+                                {
+                                    if (b != index_v)
+                                    {
+                                        return;
+                                    }
+                                    using target_t = std::tuple_element_t<index_v, unit_list>;
+                                    using value_t = typename PKR_UNITS_NAMESPACE::details::is_pkr_unit<target_t>::value_type;
+                                    value_t value{};
+                                    parsed = details::parse_cell(cell, value);
+                                    if (maps[index_v].scale != 1.0 || maps[index_v].offset != 0.0)
+                                    {
+                                        value = static_cast<value_t>((static_cast<double>(value) * maps[index_v].scale) + maps[index_v].offset);
+                                    }
+                                    std::get<index_v>(out)[row] = target_t{value};
+                                }(),
+                                ...);
+                        }(std::index_sequence_for<Units...>{});
+                        if (!parsed)
+                        {
+                            c.failure = error{error_code::numeric_parse_error, line, field};
+                            return;
+                        }
+                    }
+                    p = end + 1;
+                    if (row_done)
+                    {
+                        break;
+                    }
+                    ++field;
+                }
+                if (!blank)
+                {
+                    if (field < last_field)
+                    {
+                        c.failure = error{error_code::missing_field, line, field + 1};
+                        return;
+                    }
+                    ++row;
+                }
+                ++line;
+            }
+        });
+
+    for (const details::chunk& c : chunks)
+    {
+        if (c.failure)
+        {
+            return result_t{*c.failure};
+        }
+    }
+    return result_t{std::move(out)};
+}
+
+/// read() with default options
+template <is_pkr_unit_c... Units>
+auto read(std::string_view text, const column<Units>&... columns) -> expected_t<columns_t<Units...>, error>
+{
+    return read(text, options{}, columns...);
+}
+
+/// Map a file and read() it; throws std::system_error when the file cannot be opened
+template <is_pkr_unit_c... Units>
+auto read_file(const std::filesystem::path& path, const options& opts, const column<Units>&... columns) -> expected_t<columns_t<Units...>, error>
+{
+    const mapped_file file{path};
+    return read(file.text(), opts, columns...);
+}
+
+/// read_file() with default options
+template <is_pkr_unit_c... Units>
+auto read_file(const std::filesystem::path& path, const column<Units>&... columns) -> expected_t<columns_t<Units...>, error>
+{
+    return read_file(path, options{}, columns...);
+}
+
+} // namespace PKR_UNITS_NAMESPACE::csv
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PKR_UNITS_CSV_MMAP 1
+#endif
+
+namespace PKR_UNITS_NAMESPACE::csv
+{
+
+// ============================================================================
+// Read-only file mapping
+// ============================================================================
+//
+// On POSIX systems the file is mapped with mmap, so a multi-hundred-megabyte
+// file is paged in by the kernel as the reader touches it and never copied.
+// Other platforms read the file into memory once. Either way text() stays
+// valid for the lifetime of the object. Opening failures throw std::system_error.
+
+class mapped_file
+{
+public:
+    explicit mapped_file(const std::filesystem::path& path)
+    {
+#if defined(PKR_UNITS_CSV_MMAP)
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "mapped_file: cannot open " + path.string());
+        }
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "mapped_file: cannot stat " + path.string());
+        }
+        m_size = static_cast<std::size_t>(info.st_size);
+        if (m_size > 0)
+        {
+            void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "mapped_file: cannot map " + path.string());
+            }
+            ::madvise(data, m_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char*>(data);
+        }
+        ::close(fd);
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+        {
+            throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), "mapped_file: cannot open " + path.string());
+        }
+        m_buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+#endif
+    }
+
+    ~mapped_file()
+    {
+#if defined(PKR_UNITS_CSV_MMAP)
+        if (m_data != nullptr)
+        {
+            ::munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+#if defined(PKR_UNITS_CSV_MMAP)
+    mapped_file(mapped_file&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+    {
+    }
+#else
+    mapped_file(mapped_file&&) noexcept = default;
+#endif
+
+    mapped_file& operator=(mapped_file&&) = delete;
+
+    [[nodiscard]] std::string_view text() const noexcept
+    {
+#if defined(PKR_UNITS_CSV_MMAP)
+        return m_data == nullptr ? std::string_view{} : std::string_view{m_data, m_size};
+#else
+        return m_buffer;
+#endif
+    }
+
+private:
+#if defined(PKR_UNITS_CSV_MMAP)
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+#else
+    std::string m_buffer;
+#endif
+};
+
+} // namespace PKR_UNITS_NAMESPACE::csv
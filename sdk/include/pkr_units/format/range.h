@@ -0,0 +1,458 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/formatting/unit_formatting_traits.h>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+
+// ============================================================================
+// Bulk formatting of unit arrays and series
+// ============================================================================
+//
+// std::format("{}", q) per element parses the format spec on every call and,
+// for base units, rebuilds the symbol. format_range parses the spec once,
+// resolves the symbol once, renders numbers with std::to_chars (shortest
+// round-trip unless a precision is given) and hands the text to the sink in
+// chunks of about chunk_bytes. In parallel mode the chunks are rendered on the
+// shared work_stealing_pool and still delivered to the sink in order.
+//
+// The spec is the floating-point subset of std::format: "", ".3", "f", ".3f",
+// "e", ".6e", "g", ".4g" (uppercase F/E/G too), with std::format's meaning:
+// a type without precision uses precision 6. Integral values ignore the spec.
+// Anything else throws std::invalid_argument.
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+enum class symbol_placement
+{
+    per_element, // "1.5 m\n2 m\n"
+    once,        // "m\n1.5\n2\n": the symbol, then the separator, then bare values
+    none,        // "1.5\n2\n"
+};
+
+struct range_format_options
+{
+    std::string_view spec{};                                  // std::format floating-point spec, parsed once
+    std::string_view separator = "\n";                        // after every element or row
+    std::string_view column_separator = ",";                  // between time and value in series
+    symbol_placement symbol = symbol_placement::per_element;
+    std::size_t chunk_bytes = 1 << 16;                        // size of the pieces handed to the sink
+    bool parallel = false;                                    // render chunks on the shared pool
+};
+
+namespace details
+{
+
+struct number_format
+{
+    bool shortest = true;
+    std::chars_format format = std::chars_format::general;
+    int precision = 0;
+};
+
+inline number_format parse_number_spec(std::string_view spec)
+{
+    number_format result;
+    std::size_t pos = 0;
+    if (pos < spec.size() && spec[pos] == '.')
+    {
+        ++pos;
+        const auto* begin = spec.data() + pos;
+        auto [ptr, ec] = std::from_chars(begin, spec.data() + spec.size(), result.precision);
+        if (ec != std::errc() || ptr == begin || result.precision > 1000)
+        {
+            throw std::invalid_argument("format_range: invalid precision in format spec");
+        }
+        pos += static_cast<std::size_t>(ptr - begin);
+        result.shortest = false;
+    }
+    if (pos < spec.size())
+    {
+        switch (spec[pos])
+        {
+        case 'f':
+        case 'F':
+            result.format = std::chars_format::fixed;
+            break;
+        case 'e':
+        case 'E':
+            result.format = std::chars_format::scientific;
+            break;
+        case 'g':
+        case 'G':
+            result.format = std::chars_format::general;
+            break;
+        default:
+            throw std::invalid_argument("format_range: unsupported format spec");
+        }
+        if (result.shortest)
+        {
+            result.shortest = false;
+            result.precision = 6;
+        }
+        ++pos;
+    }
+    if (pos != spec.size())
+    {
+        throw std::invalid_argument("format_range: unsupported format spec");
+    }
+    return result;
+}
+
+// Upper bound on the characters to_chars writes for one value of ValueT
+template <typename ValueT>
+constexpr std::size_t number_capacity(const number_format& format) noexcept
+{
+    using limits = std::numeric_limits<ValueT>;
+    if constexpr (std::is_integral_v<ValueT>)
+    {
+        return static_cast<std::size_t>(limits::digits10) + 3; // sign and a partial leading digit
+    }
+    else
+    {
+        // Sign, point, "e+" and up to five exponent digits
+        constexpr std::size_t overhead = 10;
+        if (format.shortest)
+        {
+            return static_cast<std::size_t>(limits::max_digits10) + overhead;
+        }
+        const auto precision = static_cast<std::size_t>(format.precision);
+        if (format.format == std::chars_format::fixed)
+        {
+            return static_cast<std::size_t>(limits::max_exponent10) + 1 + precision + overhead;
+        }
+        return precision + overhead;
+    }
+}
+
+template <typename ValueT>
+char* write_number(char* first, char* last, ValueT value, const number_format& format)
+{
+    std::to_chars_result result{};
+    if constexpr (std::is_integral_v<ValueT>)
+    {
+        result = std::to_chars(first, last, value);
+    }
+    else if (format.shortest)
+    {
+        result = std::to_chars(first, last, value);
+    }
+    else
+    {
+        result = std::to_chars(first, last, value, format.format, format.precision);
+    }
+    if (result.ec != std::errc{})
+    {
+        throw std::length_error("format_range: value does not fit the row buffer");
+    }
+    return result.ptr;
+}
+
+inline char* write_text(char* out, std::string_view text)
+{
+    return std::copy(text.begin(), text.end(), out);
+}
+
+template <is_pkr_unit_c UnitT>
+constexpr std::string_view unit_symbol() noexcept
+{
+    if constexpr (is_derived_pkr_unit_c<UnitT>)
+    {
+        return UnitT::symbol;
+    }
+    else
+    {
+        return impl::dimension_symbol_v<char, PKR_UNITS_NAMESPACE::details::is_pkr_unit<UnitT>::value_dimension>;
+    }
+}
+
+// Output buffer that is flushed to the sink once it holds chunk_bytes and grows
+// only if a single row does not fit into what is left
+class chunk_buffer
+{
+public:
+    explicit chunk_buffer(std::size_t capacity)
+        : m_data(capacity)
+    {
+    }
+
+    char* reserve(std::size_t bytes)
+    {
+        if (m_data.size() - m_used < bytes)
+        {
+            m_data.resize(m_used + bytes);
+        }
+        return m_data.data() + m_used;
+    }
+
+    void commit(const char* end) noexcept
+    {
+        m_used = static_cast<std::size_t>(end - m_data.data());
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_used;
+    }
+
+    std::string_view view() const noexcept
+    {
+        return std::string_view(m_data.data(), m_used);
+    }
+
+    void clear() noexcept
+    {
+        m_used = 0;
+    }
+
+private:
+    std::vector<char> m_data;
+    std::size_t m_used = 0;
+};
+
+// One row: [time column_separator] value, with symbols per element if asked
+struct row_layout
+{
+    number_format format;
+    std::string_view separator;
+    std::string_view column_separator;
+    std::string_view time_symbol;
+    std::string_view value_symbol;
+    bool per_element_symbol = false;
+    std::size_t capacity = 0; // upper bound on one row's size
+};
+
+template <typename ValueT>
+char* write_column(char* out, char* last, ValueT value, std::string_view symbol, const row_layout& layout)
+{
+    out = write_number(out, last, value, layout.format);
+    if (layout.per_element_symbol && !symbol.empty())
+    {
+        *out++ = ' ';
+        out = write_text(out, symbol);
+    }
+    return out;
+}
+
+// Renders rows [begin, end) with row_fn(out, last, index) -> new out
+template <typename row_fn, typename sink_fn>
+void render_rows(std::size_t begin, std::size_t end, const row_layout& layout, std::size_t chunk_bytes, row_fn&& write_row, sink_fn&& sink)
+{
+    chunk_buffer buffer(chunk_bytes + layout.capacity);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        char* first = buffer.reserve(layout.capacity);
+        buffer.commit(write_row(first, first + layout.capacity, i));
+        if (buffer.size() >= chunk_bytes)
+        {
+            sink(buffer.view());
+            buffer.clear();
+        }
+    }
+    if (buffer.size() != 0)
+    {
+        sink(buffer.view());
+    }
+}
+
+template <typename row_fn, typename sink_fn>
+void format_rows(std::size_t count, const row_layout& layout, const range_format_options& options, row_fn&& write_row, sink_fn&& sink)
+{
+    const std::size_t chunk_bytes = std::max<std::size_t>(options.chunk_bytes, 1);
+    if (!options.parallel || count * layout.capacity <= chunk_bytes)
+    {
+        render_rows(0, count, layout, chunk_bytes, write_row, sink);
+        return;
+    }
+
+    // Rows per chunk from the bound on a row's size, so each chunk renders
+    // into one allocation; a wave of chunks is rendered in parallel and then
+    // handed to the sink in order, which bounds the memory held at once
+    const std::size_t rows_per_chunk = std::max<std::size_t>(chunk_bytes / layout.capacity, 1);
+    const std::size_t chunk_count = (count + rows_per_chunk - 1) / rows_per_chunk;
+    const std::size_t wave = 4 * work_stealing_pool::shared().thread_count();
+    std::vector<std::string> rendered(std::min(wave, chunk_count));
+
+    for (std::size_t first_chunk = 0; first_chunk < chunk_count; first_chunk += rendered.size())
+    {
+        const std::size_t chunks = std::min(rendered.size(), chunk_count - first_chunk);
+        PKR_UNITS_NAMESPACE::parallel_for(0,
+                                          chunks,
+                                          1,
+                                          [&](std::size_t begin, std::size_t end)
+                                          {
+                                              for (std::size_t c = begin; c < end; ++c)
+                                              {
+                                                  const std::size_t row_begin = (first_chunk + c) * rows_per_chunk;
+                                                  const std::size_t row_end = std::min(row_begin + rows_per_chunk, count);
+                                                  std::string& text = rendered[c];
+                                                  text.resize((row_end - row_begin) * layout.capacity);
+                                                  char* out = text.data();
+                                                  for (std::size_t i = row_begin; i < row_end; ++i)
+                                                  {
+                                                      out = write_row(out, out + layout.capacity, i);
+                                                  }
+                                                  text.resize(static_cast<std::size_t>(out - text.data()));
+                                              }
+                                          });
+        for (std::size_t c = 0; c < chunks; ++c)
+        {
+            sink(std::string_view(rendered[c]));
+        }
+    }
+}
+
+template <typename sink_fn>
+void write_symbol_header(std::string_view symbol, const range_format_options& options, sink_fn&& sink)
+{
+    if (options.symbol == symbol_placement::once)
+    {
+        sink(symbol);
+        sink(options.separator);
+    }
+}
+
+// Hands each chunk to the stream buffer with one sputn; a short write sets
+// badbit and the remaining chunks are dropped. Constructed under a sentry.
+struct ostream_sink
+{
+    std::ostream& os;
+
+    void operator()(std::string_view text) const
+    {
+        if (os.good() && os.rdbuf()->sputn(text.data(), static_cast<std::streamsize>(text.size())) != static_cast<std::streamsize>(text.size()))
+        {
+            os.setstate(std::ios_base::badbit);
+        }
+    }
+};
+
+// Formatted output: one sentry for the whole call, as put_text does for a single value
+template <typename format_fn>
+void format_to_stream(std::ostream& os, format_fn&& format)
+{
+    std::ostream::sentry guard(os);
+    if (guard)
+    {
+        format(ostream_sink{os});
+    }
+}
+
+} // namespace details
+
+/// Format every element of units, handing the text to sink(std::string_view) in chunks
+///
+/// @example
+/// ```cpp
+/// range_format_options options;
+/// options.spec = ".3f";
+/// format_range(std::span<const meter_t<double>>(samples), [&](std::string_view text) { file.write(text.data(), text.size()); }, options);
+/// ```
+template <is_pkr_unit_c UnitT, typename sink_fn>
+    requires std::is_invocable_v<sink_fn&, std::string_view>
+void format_range(std::span<const UnitT> units, sink_fn&& sink, const range_format_options& options = {})
+{
+    using value_type = typename UnitT::value_type;
+    constexpr std::string_view symbol = details::unit_symbol<UnitT>();
+
+    details::row_layout layout{details::parse_number_spec(options.spec), options.separator, options.column_separator, {}, symbol};
+    layout.per_element_symbol = options.symbol == symbol_placement::per_element;
+    layout.capacity = details::number_capacity<value_type>(layout.format) + 1 + symbol.size() + options.separator.size();
+
+    details::write_symbol_header(symbol, options, sink);
+    details::format_rows(units.size(),
+                         layout,
+                         options,
+                         [&](char* out, char* last, std::size_t i)
+                         {
+                             out = details::write_column(out, last, units[i].value(), layout.value_symbol, layout);
+                             return details::write_text(out, layout.separator);
+                         },
+                         sink);
+}
+
+/// Format a series as rows "time<column_separator>value"; time[i] belongs to values[i]
+///
+/// @throws std::invalid_argument if time and values differ in length
+template <is_pkr_unit_c TimeT, is_pkr_unit_c UnitT, typename sink_fn>
+    requires std::is_invocable_v<sink_fn&, std::string_view>
+void format_series(std::span<const TimeT> time, std::span<const UnitT> values, sink_fn&& sink, const range_format_options& options = {})
+{
+    if (time.size() != values.size())
+    {
+        throw std::invalid_argument("format_series: time and values differ in length");
+    }
+
+    constexpr std::string_view time_symbol = details::unit_symbol<TimeT>();
+    constexpr std::string_view value_symbol = details::unit_symbol<UnitT>();
+
+    details::row_layout layout{details::parse_number_spec(options.spec), options.separator, options.column_separator, time_symbol, value_symbol};
+    layout.per_element_symbol = options.symbol == symbol_placement::per_element;
+    layout.capacity = details::number_capacity<typename TimeT::value_type>(layout.format) + 1 + time_symbol.size() + options.column_separator.size() +
+                      details::number_capacity<typename UnitT::value_type>(layout.format) + 1 + value_symbol.size() + options.separator.size();
+
+    if (options.symbol == symbol_placement::once)
+    {
+        sink(time_symbol);
+        sink(options.column_separator);
+    }
+    details::write_symbol_header(value_symbol, options, sink);
+    details::format_rows(values.size(),
+                         layout,
+                         options,
+                         [&](char* out, char* last, std::size_t i)
+                         {
+                             out = details::write_column(out, last, time[i].value(), layout.time_symbol, layout);
+                             out = details::write_text(out, layout.column_separator);
+                             out = details::write_column(out, last, values[i].value(), layout.value_symbol, layout);
+                             return details::write_text(out, layout.separator);
+                         },
+                         sink);
+}
+
+/// Format into an ostream with one sputn per chunk; a failed write sets badbit
+template <is_pkr_unit_c UnitT>
+void format_range(std::span<const UnitT> units, std::ostream& os, const range_format_options& options = {})
+{
+    details::format_to_stream(os, [&](details::ostream_sink sink) { format_range(units, sink, options); });
+}
+
+/// Format into a string
+template <is_pkr_unit_c UnitT>
+std::string format_range_to_string(std::span<const UnitT> units, const range_format_options& options = {})
+{
+    std::string text;
+    format_range(units, [&](std::string_view chunk) { text.append(chunk); }, options);
+    return text;
+}
+
+/// Format a series into an ostream with one sputn per chunk; a failed write sets badbit
+template <is_pkr_unit_c TimeT, is_pkr_unit_c UnitT>
+void format_series(std::span<const TimeT> time, std::span<const UnitT> values, std::ostream& os, const range_format_options& options = {})
+{
+    details::format_to_stream(os, [&](details::ostream_sink sink) { format_series(time, values, sink, options); });
+}
+
+/// Format a series into a string
+template <is_pkr_unit_c TimeT, is_pkr_unit_c UnitT>
+std::string format_series_to_string(std::span<const TimeT> time, std::span<const UnitT> values, const range_format_options& options = {})
+{
+    std::string text;
+    format_series(time, values, [&](std::string_view chunk) { text.append(chunk); }, options);
+    return text;
+}
+
+} // namespace PKR_UNITS_NAMESPACE
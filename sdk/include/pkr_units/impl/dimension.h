@@ -70,4 +70,60 @@ inline constexpr dimension_t josephson_dimension{-2, -1, 2, 1, 0, 0, 0, 0, 0};
 // [NON-STANDARD SI EXTENSION]
 inline constexpr dimension_t solid_angle_dimension{0, 0, 0, 0, 0, 0, 0, 0, 1};
 
+namespace details
+{
+
+// ============================================================================
+// Dimension arithmetic helpers (all nine exponents, including star_angle)
+// ============================================================================
+
+constexpr dimension_t add_dimensions(const dimension_t& lhs, const dimension_t& rhs) noexcept
+{
+    return dimension_t{
+        lhs.length + rhs.length,
+        lhs.mass + rhs.mass,
+        lhs.time + rhs.time,
+        lhs.current + rhs.current,
+        lhs.temperature + rhs.temperature,
+        lhs.amount + rhs.amount,
+        lhs.intensity + rhs.intensity,
+        lhs.angle + rhs.angle,
+        lhs.star_angle + rhs.star_angle};
+}
+
+constexpr dimension_t subtract_dimensions(const dimension_t& lhs, const dimension_t& rhs) noexcept
+{
+    return dimension_t{
+        lhs.length - rhs.length,
+        lhs.mass - rhs.mass,
+        lhs.time - rhs.time,
+        lhs.current - rhs.current,
+        lhs.temperature - rhs.temperature,
+        lhs.amount - rhs.amount,
+        lhs.intensity - rhs.intensity,
+        lhs.angle - rhs.angle,
+        lhs.star_angle - rhs.star_angle};
+}
+
+constexpr dimension_t negate_dimension(const dimension_t& dim) noexcept
+{
+    return subtract_dimensions(scalar_dimension, dim);
+}
+
+constexpr dimension_t scale_dimension(const dimension_t& dim, int factor) noexcept
+{
+    return dimension_t{
+        dim.length * factor,
+        dim.mass * factor,
+        dim.time * factor,
+        dim.current * factor,
+        dim.temperature * factor,
+        dim.amount * factor,
+        dim.intensity * factor,
+        dim.angle * factor,
+        dim.star_angle * factor};
+}
+
+} // namespace details
+
 } // namespace PKR_UNITS_NAMESPACE
@@ -8,6 +8,7 @@
 #include <pkr_units/impl/namespace_config.h>
 #include <pkr_units/impl/concepts/unit_concepts.h>
 #include <pkr_units/impl/formatting/unit_formatting_traits.h>
+#include <pkr_units/impl/formatting/text_output.h>
 
 // Forward declarations in the correct namespace
 namespace PKR_UNITS_NAMESPACE
@@ -30,16 +31,29 @@ struct formatter<PKR_UNITS_NAMESPACE::measurement_lin_t<UnitT>, CharT>
 {
 private:
     std::formatter<typename UnitT::value_type, CharT> value_formatter;
+    bool default_spec = false;
 
 public:
     constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
     {
+        default_spec = PKR_UNITS_NAMESPACE::impl::is_default_spec(ctx);
         return value_formatter.parse(ctx);
     }
 
     template <typename FormatContext>
     auto format(const PKR_UNITS_NAMESPACE::measurement_lin_t<UnitT>& m, FormatContext& ctx) const
     {
+        // "{}": to_chars and the compile-time symbol into a stack buffer, copied once
+        if constexpr (PKR_UNITS_NAMESPACE::impl::fast_text_v<CharT, typename UnitT::value_type>)
+        {
+            PKR_UNITS_NAMESPACE::impl::text_buffer<CharT> buffer;
+            if (default_spec && PKR_UNITS_NAMESPACE::impl::write_measurement_text<CharT, UnitT>(buffer, m.value(), m.uncertainty()))
+            {
+                const auto text = buffer.view();
+                return std::copy(text.begin(), text.end(), ctx.out());
+            }
+        }
+
         auto out = ctx.out();
 
         // Format value directly to output context
@@ -81,16 +95,29 @@ struct formatter<PKR_UNITS_NAMESPACE::measurement_rss_t<UnitT>, CharT>
 {
 private:
     std::formatter<typename UnitT::value_type, CharT> value_formatter;
+    bool default_spec = false;
 
 public:
     constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
     {
+        default_spec = PKR_UNITS_NAMESPACE::impl::is_default_spec(ctx);
         return value_formatter.parse(ctx);
     }
 
     template <typename FormatContext>
     auto format(const PKR_UNITS_NAMESPACE::measurement_rss_t<UnitT>& m, FormatContext& ctx) const
     {
+        // "{}": to_chars and the compile-time symbol into a stack buffer, copied once
+        if constexpr (PKR_UNITS_NAMESPACE::impl::fast_text_v<CharT, typename UnitT::value_type>)
+        {
+            PKR_UNITS_NAMESPACE::impl::text_buffer<CharT> buffer;
+            if (default_spec && PKR_UNITS_NAMESPACE::impl::write_measurement_text<CharT, UnitT>(buffer, m.value(), m.uncertainty()))
+            {
+                const auto text = buffer.view();
+                return std::copy(text.begin(), text.end(), ctx.out());
+            }
+        }
+
         auto out = ctx.out();
 
         // Format value directly to output context
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/formatting/unit_formatting_traits.h>
+
+// ============================================================================
+// Default text output without std::format
+// ============================================================================
+//
+// "{}" for a unit or measurement is fully determined by std::to_chars (the
+// shortest round-trip form std::format uses for an empty spec) plus strings
+// known at compile time. text_buffer renders that into a stack array, so
+// operator<< costs one sputn and no std::format spec parsing, and the
+// formatters skip their value formatter when the spec is empty. Only char and
+// wchar_t output of plain integer and floating-point values take this path;
+// everything else keeps using std::format.
+
+namespace PKR_UNITS_NAMESPACE::impl
+{
+
+template <typename CharT, typename ValueT>
+inline constexpr bool fast_text_v = (std::is_same_v<CharT, char> || std::is_same_v<CharT, wchar_t>) &&
+                                    (std::is_floating_point_v<ValueT> || std::is_same_v<ValueT, short> || std::is_same_v<ValueT, unsigned short> ||
+                                     std::is_same_v<ValueT, int> || std::is_same_v<ValueT, unsigned int> || std::is_same_v<ValueT, long> ||
+                                     std::is_same_v<ValueT, unsigned long> || std::is_same_v<ValueT, long long> || std::is_same_v<ValueT, unsigned long long>);
+
+// Symbol as the formatters write it: the derived unit's own symbol, or the
+// dimension symbol built at compile time for base units
+template <typename CharT, is_pkr_unit_c UnitT>
+constexpr std::basic_string_view<CharT> text_symbol() noexcept
+{
+    if constexpr (!is_derived_pkr_unit_c<UnitT>)
+    {
+        return dimension_symbol_v<CharT, details::is_pkr_unit<UnitT>::value_dimension>;
+    }
+    else if constexpr (std::is_same_v<CharT, wchar_t>)
+    {
+        return UnitT::w_symbol;
+    }
+    else
+    {
+        return UnitT::symbol;
+    }
+}
+
+template <typename CharT>
+class text_buffer
+{
+public:
+    static constexpr std::size_t capacity = 256;
+    static constexpr std::size_t number_capacity = 32; // to_chars shortest form of any double or int64
+
+    // False when the text could not fit; callers then fall back to std::format
+    bool fits(std::size_t numbers, std::size_t text_size) const noexcept
+    {
+        return m_size + (numbers * number_capacity) + text_size <= capacity;
+    }
+
+    template <typename ValueT>
+    void number(ValueT value) noexcept
+    {
+        if constexpr (std::is_same_v<CharT, char>)
+        {
+            m_size = static_cast<std::size_t>(std::to_chars(m_data.data() + m_size, m_data.data() + capacity, value).ptr - m_data.data());
+        }
+        else
+        {
+            std::array<char, number_capacity> digits{};
+            const char* end = std::to_chars(digits.data(), digits.data() + digits.size(), value).ptr;
+            for (const char* c = digits.data(); c != end; ++c)
+            {
+                m_data[m_size++] = static_cast<CharT>(*c);
+            }
+        }
+    }
+
+    void put(CharT c) noexcept
+    {
+        m_data[m_size++] = c;
+    }
+
+    void text(std::basic_string_view<CharT> value) noexcept
+    {
+        for (CharT c : value)
+        {
+            m_data[m_size++] = c;
+        }
+    }
+
+    std::basic_string_view<CharT> view() const noexcept
+    {
+        return std::basic_string_view<CharT>(m_data.data(), m_size);
+    }
+
+private:
+    std::array<CharT, capacity> m_data;
+    std::size_t m_size = 0;
+};
+
+// "value symbol"
+template <typename CharT, is_pkr_unit_c UnitT>
+bool write_unit_text(text_buffer<CharT>& buffer, typename UnitT::value_type value) noexcept
+{
+    constexpr std::basic_string_view<CharT> symbol = text_symbol<CharT, UnitT>();
+    if (!buffer.fits(1, 1 + symbol.size()))
+    {
+        return false;
+    }
+    buffer.number(value);
+    buffer.put(static_cast<CharT>(' '));
+    buffer.text(symbol);
+    return true;
+}
+
+// "value +/- uncertainty symbol" (" ± " for wchar_t)
+template <typename CharT, is_pkr_unit_c UnitT>
+bool write_measurement_text(text_buffer<CharT>& buffer, typename UnitT::value_type value, typename UnitT::value_type uncertainty) noexcept
+{
+    constexpr std::basic_string_view<CharT> separator = char_traits_dispatch<CharT>::plus_minus();
+    if (!buffer.fits(2, separator.size() + 1 + text_symbol<CharT, UnitT>().size()))
+    {
+        return false;
+    }
+    buffer.number(value);
+    buffer.text(separator);
+    return write_unit_text<CharT, UnitT>(buffer, uncertainty);
+}
+
+// Formatted output of the buffer in one sputn, honouring the stream's sentry
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>& put_text(std::basic_ostream<CharT, Traits>& os, std::basic_string_view<CharT> text)
+{
+    typename std::basic_ostream<CharT, Traits>::sentry guard(os);
+    if (guard && os.rdbuf()->sputn(text.data(), static_cast<std::streamsize>(text.size())) != static_cast<std::streamsize>(text.size()))
+    {
+        os.setstate(std::ios_base::badbit);
+    }
+    return os;
+}
+
+// True when a format spec is empty, i.e. "{}"
+template <typename ParseContext>
+constexpr bool is_default_spec(const ParseContext& ctx)
+{
+    return ctx.begin() == ctx.end() || *ctx.begin() == '}';
+}
+
+} // namespace PKR_UNITS_NAMESPACE::impl
@@ -9,6 +9,7 @@
 #include <pkr_units/impl/concepts/unit_concepts.h>
 #include <pkr_units/impl/dimension.h>
 #include <pkr_units/impl/formatting/unit_formatting_traits.h>
+#include <pkr_units/impl/formatting/text_output.h>
 
 namespace std
 {
@@ -18,28 +19,39 @@ template <PKR_UNITS_NAMESPACE::is_base_pkr_unit_c T, typename CharT>
 struct formatter<T, CharT>
 {
     std::formatter<typename T::value_type, CharT> value_formatter;
+    bool default_spec = false;
 
     template <typename ParseContext>
     constexpr auto parse(ParseContext& ctx)
     {
+        default_spec = PKR_UNITS_NAMESPACE::impl::is_default_spec(ctx);
         return value_formatter.parse(ctx);
     }
 
     template <typename FormatContext>
     auto format(const T& unit, FormatContext& ctx) const
     {
+        // "{}": to_chars and the compile-time symbol into a stack buffer, copied once
+        if constexpr (PKR_UNITS_NAMESPACE::impl::fast_text_v<CharT, typename T::value_type>)
+        {
+            PKR_UNITS_NAMESPACE::impl::text_buffer<CharT> buffer;
+            if (default_spec && PKR_UNITS_NAMESPACE::impl::write_unit_text<CharT, T>(buffer, unit.value()))
+            {
+                const auto text = buffer.view();
+                return std::copy(text.begin(), text.end(), ctx.out());
+            }
+        }
+
         auto out = ctx.out();
         out = value_formatter.format(unit.value(), ctx);
 
-        // Build dimension symbol into static buffer (no allocation)
-        PKR_UNITS_NAMESPACE::impl::format_buffer<CharT> buf;
-        buf.clear();
+        // Dimension symbol built at compile time, one copy per call
         constexpr auto dim = PKR_UNITS_NAMESPACE::details::is_pkr_unit<T>::value_dimension;
-        PKR_UNITS_NAMESPACE::impl::build_dimension_symbol_to_buffer(buf, dim);
+        constexpr std::basic_string_view<CharT> sym = PKR_UNITS_NAMESPACE::impl::dimension_symbol_v<CharT, dim>;
 
         // Space before symbol
         *out++ = static_cast<CharT>(' ');
-        return std::copy(buf.begin(), buf.end(), out);
+        return std::copy(sym.begin(), sym.end(), out);
     }
 };
 
@@ -48,16 +60,29 @@ template <PKR_UNITS_NAMESPACE::is_derived_pkr_unit_c T, typename CharT>
 struct formatter<T, CharT>
 {
     std::formatter<typename T::value_type, CharT> value_formatter;
+    bool default_spec = false;
 
     template <typename ParseContext>
     constexpr auto parse(ParseContext& ctx)
     {
+        default_spec = PKR_UNITS_NAMESPACE::impl::is_default_spec(ctx);
         return value_formatter.parse(ctx);
     }
 
     template <typename FormatContext>
     auto format(const T& unit, FormatContext& ctx) const
     {
+        // "{}": to_chars and the compile-time symbol into a stack buffer, copied once
+        if constexpr (PKR_UNITS_NAMESPACE::impl::fast_text_v<CharT, typename T::value_type>)
+        {
+            PKR_UNITS_NAMESPACE::impl::text_buffer<CharT> buffer;
+            if (default_spec && PKR_UNITS_NAMESPACE::impl::write_unit_text<CharT, T>(buffer, unit.value()))
+            {
+                const auto text = buffer.view();
+                return std::copy(text.begin(), text.end(), ctx.out());
+            }
+        }
+
         auto out = ctx.out();
         out = value_formatter.format(unit.value(), ctx);
 
@@ -92,6 +117,16 @@ template <typename CharT, typename Traits, typename T>
     requires PKR_UNITS_NAMESPACE::is_pkr_unit_c<T>
 std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const T& unit)
 {
+    // Fast path: render into a stack buffer and hand it to the stream with one sputn
+    if constexpr (PKR_UNITS_NAMESPACE::impl::fast_text_v<CharT, typename T::value_type>)
+    {
+        PKR_UNITS_NAMESPACE::impl::text_buffer<CharT> buffer;
+        if (PKR_UNITS_NAMESPACE::impl::write_unit_text<CharT, T>(buffer, unit.value()))
+        {
+            return PKR_UNITS_NAMESPACE::impl::put_text(os, buffer.view());
+        }
+    }
+
     // Use std::format_to with streambuf_iterator to avoid creating intermediate strings
     // This writes directly to the output stream without temporary allocations
     if constexpr (std::is_same_v<CharT, wchar_t>)
@@ -2,35 +2,40 @@
 
 #include <array>
 #include <string>
+#include <string_view>
+#include <pkr_units/impl/dimension.h>
 
 // Format buffer size configuration
 #ifndef PKR_UNITS_FORMAT_BUFFER_SIZE
 #define PKR_UNITS_FORMAT_BUFFER_SIZE 4096
 #endif
 
-namespace PKR_UNITS_NAMESPACE
-{
-// Forward declare dimension_t for use in function signatures
-struct dimension_t;
-} // namespace PKR_UNITS_NAMESPACE
-
 namespace PKR_UNITS_NAMESPACE::impl
 {
 
 // ============================================================================
-// Static buffer storage - shared across formatting, parsing, and other operations
+// Buffer storage - used by formatting, parsing, and other operations
 // ============================================================================
-// Non-templated base that holds the single unified byte buffer
+// Non-templated base that holds the unified byte buffer
 // This buffer is shared across all character types to minimize memory footprint
 // Configurable via PKR_UNITS_FORMAT_BUFFER_SIZE (default 4096 bytes)
-// Ideal for resource-constrained systems (embedded processors with limited stack/heap)
+//
+// By default every thread gets its own buffer, so formatting, parsing and JSON
+// serialization can run concurrently. Defining PKR_UNITS_SHARED_FORMAT_BUFFER
+// switches to a single process-wide buffer: no TLS and one fixed allocation,
+// ideal for resource-constrained single-threaded systems (embedded processors
+// with limited stack/heap), but then those calls must not overlap.
 struct format_buffer_storage
 {
     static constexpr std::size_t buffer_size = PKR_UNITS_FORMAT_BUFFER_SIZE;
 
     static std::array<std::byte, buffer_size>& get_data()
     {
+#if defined(PKR_UNITS_SHARED_FORMAT_BUFFER)
         static std::array<std::byte, buffer_size> s_data{};
+#else
+        thread_local std::array<std::byte, buffer_size> s_data{};
+#endif
         return s_data;
     }
 };
@@ -459,50 +464,112 @@ inline std::basic_string<CharT> build_dimension_symbol(const PKR_UNITS_NAMESPACE
     return result;
 }
 
-// Build dimension symbol into a format_buffer (no allocation, constexpr-compatible)
-template <typename CharT>
-constexpr void build_dimension_symbol_to_buffer(format_buffer<CharT>& buf, const PKR_UNITS_NAMESPACE::dimension_t& dim)
+// Append the dimension symbol to any sink with append(basic_string_view<CharT>)
+template <typename CharT, typename SinkT>
+constexpr void append_dimension_symbol(SinkT& sink, const PKR_UNITS_NAMESPACE::dimension_t& dim)
 {
     // Canonical dimension order: mass, length, time, current, temperature, amount, intensity, angle, star_angle
     const int dims[] = {dim.mass, dim.length, dim.time, dim.current, dim.temperature, dim.amount, dim.intensity, dim.angle, dim.star_angle};
     const auto& symbols = base_unit_symbols<CharT>;
+    bool first = true;
 
     // Process all dimensions in canonical order
     for (int i = 0; i < 9; ++i)
     {
         if (dims[i] != 0)
         {
-            if (buf.byte_length != 0)
+            if (!first)
             {
-                buf.append(char_traits_dispatch<CharT>::separator());
+                sink.append(char_traits_dispatch<CharT>::separator());
             }
+            first = false;
 
-            buf.append(symbols[i]);
+            sink.append(symbols[i]);
             if (dims[i] != 1)
             {
                 bool negative = dims[i] < 0;
                 int abs_exp = negative ? -dims[i] : dims[i];
 
                 // Add caret (empty for wchar_t)
-                buf.append(char_traits_dispatch<CharT>::superscript_caret());
+                sink.append(char_traits_dispatch<CharT>::superscript_caret());
 
                 // Add minus sign for negative exponents
                 if (negative)
                 {
-                    buf.append(char_traits_dispatch<CharT>::superscript_minus());
+                    sink.append(char_traits_dispatch<CharT>::superscript_minus());
                 }
 
                 // Convert digits using constexpr conversion (no std::to_string)
-                char digit_buffer[32];
+                char digit_buffer[32]{};
                 std::size_t digit_count = constexpr_uint_to_digits(static_cast<unsigned int>(abs_exp), digit_buffer, 32);
                 for (std::size_t j = 0; j < digit_count; ++j)
                 {
                     int digit_idx = digit_buffer[j] - '0';
-                    buf.append(superscript_digit_lookup<CharT>(digit_idx));
+                    sink.append(superscript_digit_lookup<CharT>(digit_idx));
                 }
             }
         }
     }
 }
 
+// Build dimension symbol into a format_buffer (no allocation, constexpr-compatible)
+template <typename CharT>
+constexpr void build_dimension_symbol_to_buffer(format_buffer<CharT>& buf, const PKR_UNITS_NAMESPACE::dimension_t& dim)
+{
+    append_dimension_symbol<CharT>(buf, dim);
+}
+
+// ============================================================================
+// Compile-time dimension symbols
+// ============================================================================
+// For a dimension known at compile time the symbol is built once, during
+// compilation, into a static array. Formatting then copies a string_view
+// instead of rebuilding the symbol on every call.
+
+template <typename CharT>
+struct symbol_length_sink
+{
+    std::size_t length = 0;
+
+    constexpr void append(std::basic_string_view<CharT> sv)
+    {
+        length += sv.size();
+    }
+};
+
+template <typename CharT, std::size_t length_v>
+struct symbol_array_sink
+{
+    std::array<CharT, length_v> chars{};
+    std::size_t length = 0;
+
+    constexpr void append(std::basic_string_view<CharT> sv)
+    {
+        for (CharT c : sv)
+        {
+            chars[length++] = c;
+        }
+    }
+};
+
+template <typename CharT, PKR_UNITS_NAMESPACE::dimension_t dim_v>
+inline constexpr std::size_t dimension_symbol_length = []
+{
+    symbol_length_sink<CharT> sink;
+    append_dimension_symbol<CharT>(sink, dim_v);
+    return sink.length;
+}();
+
+template <typename CharT, PKR_UNITS_NAMESPACE::dimension_t dim_v>
+inline constexpr std::array<CharT, dimension_symbol_length<CharT, dim_v>> dimension_symbol_chars = []
+{
+    symbol_array_sink<CharT, dimension_symbol_length<CharT, dim_v>> sink;
+    append_dimension_symbol<CharT>(sink, dim_v);
+    return sink.chars;
+}();
+
+// The symbol of dim_v, e.g. "kg*m^2*s^-2" or u8"kg·m²·s⁻²", in static storage
+template <typename CharT, PKR_UNITS_NAMESPACE::dimension_t dim_v>
+inline constexpr std::basic_string_view<CharT> dimension_symbol_v{dimension_symbol_chars<CharT, dim_v>.data(), dimension_symbol_chars<CharT, dim_v>.size()};
+
 } // namespace PKR_UNITS_NAMESPACE::impl
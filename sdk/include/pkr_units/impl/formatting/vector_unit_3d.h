@@ -56,9 +56,9 @@ struct formatter<PKR_UNITS_NAMESPACE::vec_3d_units_t<T>, CharT>
         *out++ = static_cast<CharT>(']');
         *out++ = static_cast<CharT>(' ');
 
-        // Add unit symbol using static buffer (no allocation)
+        // Add unit symbol built at compile time (no allocation)
         constexpr auto dim = PKR_UNITS_NAMESPACE::details::is_pkr_unit<T>::value_dimension;
-        out = PKR_UNITS_NAMESPACE::impl::vector_formatting::write_unit_symbol<CharT>(out, dim);
+        out = PKR_UNITS_NAMESPACE::impl::vector_formatting::write_unit_symbol<CharT, dim>(out);
 
         return out;
     }
@@ -28,6 +28,14 @@ inline OutputIt write_unit_symbol(OutputIt out, const dimension_t& dim)
     return std::copy(buf.begin(), buf.end(), out);
 }
 
+// Same for a dimension known at compile time: copies the prebuilt symbol
+template <typename CharT, dimension_t dim_v, typename OutputIt>
+constexpr OutputIt write_unit_symbol(OutputIt out)
+{
+    constexpr std::basic_string_view<CharT> sym = PKR_UNITS_NAMESPACE::impl::dimension_symbol_v<CharT, dim_v>;
+    return std::copy(sym.begin(), sym.end(), out);
+}
+
 // Helper to write a comma and space separator (constexpr-compatible)
 template <typename CharT, typename OutputIt>
 constexpr OutputIt write_separator(OutputIt out)
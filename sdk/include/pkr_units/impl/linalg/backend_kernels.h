@@ -0,0 +1,149 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
+
+// ============================================================================
+// Optional linear algebra backend
+// ============================================================================
+//
+// Large dimensioned products and the trailing updates of the LU solver can run
+// on an external BLAS-3 implementation. The backend only ever sees raw SI
+// values; dimensions stay in the pkr_units types and are checked at compile
+// time as before. Select one by defining
+//
+//   PKR_UNITS_LINALG_EIGEN   Eigen 3.3+ (header-only, Eigen::Map over our buffers)
+//   PKR_UNITS_LINALG_BLAS    any CBLAS (OpenBLAS, MKL, Accelerate); link it yourself
+//
+// or, in this repository, configure with -DPKR_UNITS_LINALG_BACKEND=eigen|blas.
+// Without either, the built-in cache-blocked kernel from matrix_kernels.h is used.
+#if defined(PKR_UNITS_LINALG_EIGEN) && defined(PKR_UNITS_LINALG_BLAS)
+#error "Define at most one of PKR_UNITS_LINALG_EIGEN and PKR_UNITS_LINALG_BLAS"
+#endif
+
+#if defined(PKR_UNITS_LINALG_EIGEN)
+#include <Eigen/Core>
+#elif defined(PKR_UNITS_LINALG_BLAS)
+#include <cblas.h>
+#endif
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+#if defined(PKR_UNITS_LINALG_EIGEN)
+inline constexpr std::string_view linalg_backend_name = "eigen";
+#elif defined(PKR_UNITS_LINALG_BLAS)
+inline constexpr std::string_view linalg_backend_name = "blas";
+#else
+inline constexpr std::string_view linalg_backend_name = "builtin";
+#endif
+
+namespace details
+{
+
+// Backends only handle float and double
+template <typename type_t>
+inline constexpr bool linalg_backend_enabled_v = linalg_backend_name != "builtin" && (std::is_same_v<type_t, float> || std::is_same_v<type_t, double>);
+
+// Products with fewer multiply-adds than this stay on the built-in kernel, where call overhead dominates
+inline constexpr std::size_t linalg_backend_min_work = 32 * 32 * 32;
+
+// C (n x m, row stride ldc) += alpha * A (n x p, row stride lda) * B (p x m, row stride ldb), row-major
+template <typename type_t>
+void backend_gemm(
+    const type_t* a, std::size_t lda, const type_t* b, std::size_t ldb, type_t* c, std::size_t ldc, std::size_t n, std::size_t p, std::size_t m, type_t alpha) noexcept
+{
+#if defined(PKR_UNITS_LINALG_EIGEN)
+    if constexpr (linalg_backend_enabled_v<type_t>)
+    {
+        using matrix_t = Eigen::Matrix<type_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+        using stride_t = Eigen::OuterStride<>;
+        const auto rows = static_cast<Eigen::Index>(n);
+        const auto inner = static_cast<Eigen::Index>(p);
+        const auto cols = static_cast<Eigen::Index>(m);
+        const Eigen::Map<const matrix_t, Eigen::Unaligned, stride_t> map_a(a, rows, inner, stride_t(static_cast<Eigen::Index>(lda)));
+        const Eigen::Map<const matrix_t, Eigen::Unaligned, stride_t> map_b(b, inner, cols, stride_t(static_cast<Eigen::Index>(ldb)));
+        Eigen::Map<matrix_t, Eigen::Unaligned, stride_t> map_c(c, rows, cols, stride_t(static_cast<Eigen::Index>(ldc)));
+        map_c.noalias() += alpha * (map_a * map_b);
+        return;
+    }
+#elif defined(PKR_UNITS_LINALG_BLAS)
+    if constexpr (std::is_same_v<type_t, double>)
+    {
+        cblas_dgemm(
+            CblasRowMajor,
+            CblasNoTrans,
+            CblasNoTrans,
+            static_cast<int>(n),
+            static_cast<int>(m),
+            static_cast<int>(p),
+            alpha,
+            a,
+            static_cast<int>(lda),
+            b,
+            static_cast<int>(ldb),
+            1.0,
+            c,
+            static_cast<int>(ldc));
+        return;
+    }
+    else if constexpr (std::is_same_v<type_t, float>)
+    {
+        cblas_sgemm(
+            CblasRowMajor,
+            CblasNoTrans,
+            CblasNoTrans,
+            static_cast<int>(n),
+            static_cast<int>(m),
+            static_cast<int>(p),
+            alpha,
+            a,
+            static_cast<int>(lda),
+            b,
+            static_cast<int>(ldb),
+            1.0f,
+            c,
+            static_cast<int>(ldc));
+        return;
+    }
+#endif
+    // Built-in: same k/j tiling as gemm_blocked, on strided rows
+    for (std::size_t k0 = 0; k0 < p; k0 += gemm_block_inner)
+    {
+        const std::size_t k1 = k0 + gemm_block_inner < p ? k0 + gemm_block_inner : p;
+        for (std::size_t j0 = 0; j0 < m; j0 += gemm_block_cols)
+        {
+            const std::size_t width = j0 + gemm_block_cols < m ? gemm_block_cols : m - j0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                type_t* c_row = c + (i * ldc) + j0;
+                for (std::size_t k = k0; k < k1; ++k)
+                {
+                    axpy_row(alpha * a[(i * lda) + k], b + (k * ldb) + j0, c_row, width);
+                }
+            }
+        }
+    }
+}
+
+// C += A B for contiguous row-major matrices: the backend for large floating-point
+// products at run time, otherwise gemm_blocked (bit-exact, usable in constant expressions)
+template <typename type_t>
+constexpr void gemm_dispatch(const type_t* a, const type_t* b, type_t* c, std::size_t n, std::size_t p, std::size_t m) noexcept
+{
+    if constexpr (linalg_backend_enabled_v<type_t>)
+    {
+        if (!std::is_constant_evaluated() && n * p * m >= linalg_backend_min_work)
+        {
+            backend_gemm(a, p, b, m, c, m, n, p, m, static_cast<type_t>(1));
+            return;
+        }
+    }
+    gemm_blocked(a, b, c, n, p, m);
+}
+
+} // namespace details
+
+} // namespace PKR_UNITS_NAMESPACE
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pkr_units/impl/namespace_config.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Work-stealing thread pool for data-parallel loops
+// ============================================================================
+//
+// parallel_for(begin, end, grain, fn) calls fn(chunk_begin, chunk_end) for
+// disjoint chunks of at most `grain` indices covering [begin, end). The range
+// is first split evenly across all participants (the worker threads plus the
+// calling thread). Each participant consumes its own range from the front;
+// when it runs dry it steals the upper half of another participant's
+// remaining range. This balances irregular work (e.g. tree walks of varying
+// depth) without a central queue.
+//
+// Only one loop runs at a time per pool. A parallel_for issued from inside a
+// running chunk of any pool, this one or another, executes serially on the
+// calling thread. Nesting across pools would otherwise deadlock: a loop on A
+// whose chunk runs a loop on B, whose chunk runs a loop on A, waits for A's
+// submit lock held by the outer loop. The first exception thrown by fn is
+// rethrown on the calling thread once all chunks have stopped.
+
+class work_stealing_pool
+{
+public:
+    // thread_count is the total number of participants including the calling thread
+    explicit work_stealing_pool(std::size_t thread_count = default_thread_count())
+        : m_slots(std::max<std::size_t>(thread_count, 1))
+    {
+        m_workers.reserve(m_slots.size() - 1);
+        for (std::size_t p = 1; p < m_slots.size(); ++p)
+        {
+            m_workers.emplace_back([this, p]() { worker_loop(p); });
+        }
+    }
+
+    ~work_stealing_pool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_start_cv.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    work_stealing_pool(const work_stealing_pool&) = delete;
+    work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+    [[nodiscard]] std::size_t thread_count() const noexcept
+    {
+        return m_slots.size();
+    }
+
+    static std::size_t default_thread_count() noexcept
+    {
+        return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    // Process-wide pool sized to the hardware
+    static work_stealing_pool& shared()
+    {
+        static work_stealing_pool pool;
+        return pool;
+    }
+
+    template <typename range_fn>
+        requires std::is_invocable_v<range_fn&, std::size_t, std::size_t>
+    void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, range_fn&& fn)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        if (m_workers.empty() || end - begin <= grain || t_inside_pool)
+        {
+            for (std::size_t chunk = begin; chunk < end; chunk += grain)
+            {
+                fn(chunk, std::min(chunk + grain, end));
+            }
+            return;
+        }
+
+        std::lock_guard submit_lock(m_submit_mutex);
+
+        const std::size_t participants = m_slots.size();
+        const std::size_t count = end - begin;
+        for (std::size_t p = 0; p < participants; ++p)
+        {
+            std::lock_guard slot_lock(m_slots[p].mutex);
+            m_slots[p].begin = begin + ((count * p) / participants);
+            m_slots[p].end = begin + ((count * (p + 1)) / participants);
+        }
+
+        m_grain = grain;
+        m_context = &fn;
+        m_invoke = [](void* context, std::size_t chunk_begin, std::size_t chunk_end)
+        { (*static_cast<std::remove_reference_t<range_fn>*>(context))(chunk_begin, chunk_end); };
+        m_exception = nullptr;
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_pending = m_workers.size();
+            ++m_generation;
+        }
+        m_start_cv.notify_all();
+
+        run_participant(0);
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_done_cv.wait(lock, [this]() { return m_pending == 0; });
+        }
+
+        m_context = nullptr;
+        m_invoke = nullptr;
+        if (m_exception)
+        {
+            std::rethrow_exception(std::exchange(m_exception, nullptr));
+        }
+    }
+
+private:
+    struct alignas(64) slot_t
+    {
+        std::mutex mutex;
+        std::size_t begin{0};
+        std::size_t end{0};
+    };
+
+    bool take_own(std::size_t p, std::size_t& chunk_begin, std::size_t& chunk_end)
+    {
+        slot_t& own = m_slots[p];
+        std::lock_guard lock(own.mutex);
+        if (own.begin >= own.end)
+        {
+            return false;
+        }
+        chunk_begin = own.begin;
+        chunk_end = std::min(own.begin + m_grain, own.end);
+        own.begin = chunk_end;
+        return true;
+    }
+
+    // Move the upper half of some other participant's remaining range into slot p
+    bool steal(std::size_t p)
+    {
+        const std::size_t participants = m_slots.size();
+        for (std::size_t offset = 1; offset < participants; ++offset)
+        {
+            slot_t& victim = m_slots[(p + offset) % participants];
+            std::size_t stolen_begin = 0;
+            std::size_t stolen_end = 0;
+            {
+                std::lock_guard lock(victim.mutex);
+                const std::size_t remaining = victim.end - victim.begin;
+                if (victim.begin >= victim.end)
+                {
+                    continue;
+                }
+                stolen_end = victim.end;
+                stolen_begin = remaining > m_grain ? victim.begin + (remaining / 2) : victim.begin;
+                victim.end = stolen_begin;
+            }
+            std::lock_guard lock(m_slots[p].mutex);
+            m_slots[p].begin = stolen_begin;
+            m_slots[p].end = stolen_end;
+            return true;
+        }
+        return false;
+    }
+
+    void run_participant(std::size_t p) noexcept
+    {
+        t_inside_pool = true;
+        try
+        {
+            std::size_t chunk_begin = 0;
+            std::size_t chunk_end = 0;
+            do
+            {
+                while (take_own(p, chunk_begin, chunk_end))
+                {
+                    m_invoke(m_context, chunk_begin, chunk_end);
+                }
+            } while (steal(p));
+        }
+        catch (...)
+        {
+            std::lock_guard lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = std::current_exception();
+            }
+            // Drain every range so the other participants stop early
+            for (auto& other : m_slots)
+            {
+                std::lock_guard slot_lock(other.mutex);
+                other.begin = other.end;
+            }
+        }
+        t_inside_pool = false;
+    }
+
+    void worker_loop(std::size_t p)
+    {
+        std::size_t seen_generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                m_start_cv.wait(lock, [&]() { return m_stop || m_generation != seen_generation; });
+                if (m_stop)
+                {
+                    return;
+                }
+                seen_generation = m_generation;
+            }
+
+            run_participant(p);
+
+            {
+                std::lock_guard lock(m_mutex);
+                if (--m_pending == 0)
+                {
+                    m_done_cv.notify_one();
+                }
+            }
+        }
+    }
+
+    // Shared by all pools: set while this thread runs a chunk of any pool
+    static inline thread_local bool t_inside_pool = false;
+
+    std::vector<slot_t> m_slots;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_submit_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_start_cv;
+    std::condition_variable m_done_cv;
+    std::size_t m_generation{0};
+    std::size_t m_pending{0};
+    bool m_stop{false};
+
+    std::size_t m_grain{1};
+    void* m_context{nullptr};
+    void (*m_invoke)(void*, std::size_t, std::size_t){nullptr};
+    std::exception_ptr m_exception;
+};
+
+// Convenience wrapper over the shared pool
+template <typename range_fn>
+    requires std::is_invocable_v<range_fn&, std::size_t, std::size_t>
+void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, range_fn&& fn)
+{
+    work_stealing_pool::shared().parallel_for(begin, end, grain, std::forward<range_fn>(fn));
+}
+
+} // namespace PKR_UNITS_NAMESPACE
@@ -6,6 +6,8 @@
 #include <pkr_units/impl/parsing/parse_error.h>
 #include <pkr_units/impl/parsing/parse_impl.h>
 #include <pkr_units/impl/parsing/parse_measurement_impl.h>
+#include <pkr_units/impl/parsing/unit_expression.h>
+#include <pkr_units/impl/parsing/unit_registry.h>
 #include <pkr_units/impl/concepts/unit_concepts.h>
 #include <pkr_units/measurements/decl/measurement_lin_decl.h>
 #include <pkr_units/measurements/decl/measurement_rss_decl.h>
@@ -21,6 +23,11 @@ namespace pkr::units
 ///
 /// Parses input in the form "numeric_value symbol" and converts to the target unit.
 /// Automatically detects float vs double from the numeric suffix (f/F for float).
+/// Any registered unit of the same dimension is accepted and converted through
+/// the runtime unit registry ("5 km" into meter_t gives 5000 m), as is a compound
+/// unit expression of the same dimension ("9.81 kg·m/s²" into newton_t, see
+/// unit_expression.h). A malformed expression or unknown symbol reports the
+/// expression's own error; a valid one of another dimension is symbol_mismatch.
 ///
 /// @tparam TargetUnit The target unit type to parse into
 /// @tparam CharT Character type (char or wchar_t)
@@ -46,6 +53,13 @@ namespace pkr::units
 /// if (result) {
 ///     std::wcout << result->value() << L" m\n";
 /// }
+///
+/// // Other units of the same dimension are converted
+/// auto result = parse<meter_t<double>>("1.5 km");  // 1500 m
+///
+/// // Compound unit expressions
+/// auto result = parse<meter_per_second_t<double>>("36 km/h");    // 10 m/s
+/// auto result = parse<newton_t<double>>("2 kg m s^-2");          // 2 N
 /// ```
 template <is_pkr_unit_c TargetUnit, typename CharT = char>
 auto parse(std::basic_string_view<CharT> input) -> expected_t<TargetUnit, parse_error>
@@ -74,7 +88,31 @@ auto parse(std::basic_string_view<CharT> input) -> expected_t<TargetUnit, parse_
     // If no symbol is provided, default to the target unit type
     if (!symbol_part.empty() && !impl::symbol_matches<TargetUnit, CharT>(symbol_part))
     {
-        return expected_t<TargetUnit, parse_error>{parse_error::symbol_mismatch};
+        // Another unit of the same dimension: convert through the registry
+        constexpr dimension_t target_dimension = details::is_pkr_unit<TargetUnit>::value_dimension;
+        bool ambiguous = false;
+        const unit_info* source = impl::find_registered_unit(symbol_part, &target_dimension, &ambiguous);
+        if (source != nullptr)
+        {
+            return expected_t<TargetUnit, parse_error>{TargetUnit{impl::convert_registered<TargetUnit>(*source, static_cast<double>(*numeric_value))}};
+        }
+        if (ambiguous)
+        {
+            return expected_t<TargetUnit, parse_error>{parse_error::ambiguous_symbol};
+        }
+
+        // A compound expression of the same dimension ("kg·m/s²" into newton_t)
+        const auto expression = impl::evaluate_unit_expression(symbol_part);
+        if (!expression.valid)
+        {
+            return expected_t<TargetUnit, parse_error>{expression.error};
+        }
+        if (expression.unit.dimension != target_dimension)
+        {
+            return expected_t<TargetUnit, parse_error>{parse_error::symbol_mismatch};
+        }
+        return expected_t<TargetUnit, parse_error>{
+            TargetUnit{impl::convert_registered<TargetUnit>(impl::expression_unit_info(expression.unit), static_cast<double>(*numeric_value))}};
     }
 
     // Construct the unit with the parsed value
@@ -88,6 +126,67 @@ inline auto parse(const CharT* input) -> expected_t<TargetUnit, parse_error>
     return parse<TargetUnit, CharT>(std::basic_string_view<CharT>{input});
 }
 
+// ============================================================================
+// Parse function for units only known at run time
+// ============================================================================
+
+/// Parse a string whose unit is not known at compile time
+///
+/// Looks the symbol (or unit name) up in the runtime unit registry and returns
+/// the value together with the unit it was written in. A bare number is
+/// dimensionless.
+///
+/// @tparam CharT Character type (char or wchar_t)
+/// @param input Input string in format "numeric_value symbol"
+/// @return expected_t containing the quantity, or parse_error::unknown_symbol
+///         when the symbol is not registered
+///
+/// @example
+/// ```cpp
+/// auto q = parse_any("12 ft");
+/// if (q && q->dimension() == length_dimension) {
+///     std::cout << q->coherent_value() << " m\n";  // 3.6576 m
+///     auto m = q->as<meter_t<double>>();
+/// }
+/// ```
+template <typename CharT = char>
+auto parse_any(std::basic_string_view<CharT> input) -> expected_t<any_quantity_t, parse_error>
+{
+    while (!input.empty() && (input.front() == static_cast<CharT>(' ') || input.front() == static_cast<CharT>('\t')))
+    {
+        input.remove_prefix(1);
+    }
+    input = impl::trim_right(input);
+
+    auto [numeric_part, symbol_part] = impl::split_value_symbol<CharT>(input);
+    numeric_part = impl::trim_right(numeric_part);
+
+    auto numeric_value = impl::parse_numeric<CharT, double>(numeric_part);
+    if (!numeric_value)
+    {
+        return expected_t<any_quantity_t, parse_error>{parse_error::numeric_parse_error};
+    }
+
+    if (symbol_part.empty())
+    {
+        return expected_t<any_quantity_t, parse_error>{any_quantity_t{*numeric_value, &impl::dimensionless_unit}};
+    }
+
+    const unit_info* unit = impl::find_registered_unit(symbol_part);
+    if (unit == nullptr)
+    {
+        return expected_t<any_quantity_t, parse_error>{parse_error::unknown_symbol};
+    }
+    return expected_t<any_quantity_t, parse_error>{any_quantity_t{*numeric_value, unit}};
+}
+
+/// Overload for const CharT* strings
+template <typename CharT = char>
+inline auto parse_any(const CharT* input) -> expected_t<any_quantity_t, parse_error>
+{
+    return parse_any<CharT>(std::basic_string_view<CharT>{input});
+}
+
 // ============================================================================
 // Parse function for measurement_lin_t (linear uncertainty)
 // ============================================================================
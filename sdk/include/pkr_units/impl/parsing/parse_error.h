@@ -9,6 +9,8 @@ enum class parse_error
     numeric_parse_error, // Invalid floating point format
     symbol_mismatch,     // Wrong dimension (e.g., parsed feet, expected meters)
     unknown_symbol,      // Unrecognized unit symbol
+    invalid_expression,  // Malformed compound unit expression (e.g. "m/", "kg^", "(m")
+    ambiguous_symbol,    // Symbol names several units of the target dimension (e.g. "m": hms and dms arcminutes)
 };
 
 } // namespace pkr::units
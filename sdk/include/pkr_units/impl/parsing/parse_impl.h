@@ -3,9 +3,12 @@
 #include <string_view>
 #include <optional>
 #include <string>
+#include <array>
 #include <cctype>
-#include <cstdlib>
+#include <charconv>
+#include <cstddef>
 #include <stdexcept>
+#include <system_error>
 #include <algorithm>
 #include <pkr_units/impl/concepts/unit_concepts.h>
 #include <pkr_units/impl/formatting/unit_formatting_traits.h>
@@ -97,14 +100,20 @@ struct split_result
 template <typename CharT>
 constexpr split_result<CharT> split_value_symbol(std::basic_string_view<CharT> input)
 {
-    // Find last space separator
-    auto pos = input.rfind(static_cast<CharT>(' '));
+    // Numbers contain no spaces, so the first space ends the numeric part; the
+    // symbol may contain further spaces ("kg m/s^2", "fl oz")
+    auto pos = input.find(static_cast<CharT>(' '));
     if (pos == std::basic_string_view<CharT>::npos)
     {
         // No space found - treat entire string as numeric part
         return {input, std::basic_string_view<CharT>{}};
     }
-    return {input.substr(0, pos), input.substr(pos + 1)};
+    auto symbol = input.substr(pos + 1);
+    while (!symbol.empty() && (symbol.front() == static_cast<CharT>(' ') || symbol.front() == static_cast<CharT>('\t')))
+    {
+        symbol.remove_prefix(1);
+    }
+    return {input.substr(0, pos), symbol};
 }
 
 // Trim whitespace from right
@@ -141,137 +150,85 @@ constexpr std::basic_string_view<CharT> remove_float_suffix(std::basic_string_vi
 }
 } // namespace
 
+// Numbers are read with std::from_chars: locale-independent ('.' is always the
+// decimal point), allocation-free and exception-free. As with strtod, leading
+// whitespace and a leading '+' are accepted and parsing stops at the first
+// character that cannot continue the number, so an 'f'/'F' float suffix needs
+// no special handling. Values outside the range of double are rejected.
 template <typename ValueType>
-std::optional<ValueType> parse_numeric_char(std::string_view numeric_str)
+std::optional<ValueType> parse_numeric_range(const char* first, const char* last) noexcept
 {
-    try
+    while (first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r'))
     {
-        // Use a stack buffer for small strings to avoid heap allocation in the common case
-        // Most numeric literals are much less than 64 bytes
-        std::array<char, 64> buffer{};
-        std::string_view to_parse = numeric_str;
-
-        if (numeric_str.size() < buffer.size())
-        {
-            // Copy to buffer and remove suffix in-place if needed
-            std::copy(numeric_str.begin(), numeric_str.end(), buffer.begin());
-            buffer[numeric_str.size()] = '\0';
-
-            // Check and remove float suffix
-            std::size_t actual_len = numeric_str.size();
-            if (!numeric_str.empty() && (numeric_str.back() == 'f' || numeric_str.back() == 'F'))
-            {
-                actual_len--;
-                buffer[actual_len] = '\0';
-            }
-            to_parse = std::string_view(buffer.data(), actual_len);
-        }
-        else
+        ++first;
+    }
+    if (first != last && *first == '+')
+    {
+        ++first;
+        if (first != last && *first == '-')
         {
-            // Fallback to std::string only for oversized input (edge case)
-            std::string num_str(numeric_str);
-            if (!num_str.empty() && (num_str.back() == 'f' || num_str.back() == 'F'))
-            {
-                num_str.pop_back();
-            }
-            to_parse = num_str;
+            return std::nullopt;
         }
+    }
 
-        if constexpr (std::is_floating_point_v<ValueType>)
-        {
-            char* endptr = nullptr;
-            double value = std::strtod(to_parse.data(), &endptr);
-            if (endptr == to_parse.data() || endptr == nullptr)
-            {
-                return std::nullopt;
-            }
-            return static_cast<ValueType>(value);
-        }
-        else
+    if constexpr (std::is_floating_point_v<ValueType>)
+    {
+        double value{};
+        const auto [ptr, ec] = std::from_chars(first, last, value);
+        if (ec != std::errc{})
         {
-            // For non-floating point types, attempt conversion
-            char* endptr = nullptr;
-            long value = std::strtol(to_parse.data(), &endptr, 10);
-            if (endptr == to_parse.data() || endptr == nullptr)
-            {
-                return std::nullopt;
-            }
-            return static_cast<ValueType>(value);
+            return std::nullopt;
         }
+        return static_cast<ValueType>(value);
     }
-    catch (...)
+    else
     {
-        return std::nullopt;
+        long value{};
+        const auto [ptr, ec] = std::from_chars(first, last, value);
+        if (ec != std::errc{})
+        {
+            return std::nullopt;
+        }
+        return static_cast<ValueType>(value);
     }
 }
 
+template <typename ValueType>
+std::optional<ValueType> parse_numeric_char(std::string_view numeric_str) noexcept
+{
+    return parse_numeric_range<ValueType>(numeric_str.data(), numeric_str.data() + numeric_str.size());
+}
+
+// Wide input is narrowed into a stack buffer first. Only ASCII can be part of a
+// number, so narrowing stops at the first wider character.
 template <typename ValueType>
 std::optional<ValueType> parse_numeric_wchar(std::wstring_view numeric_str)
 {
-    try
+    constexpr std::size_t buffer_size = 128;
+    std::array<char, buffer_size> buffer{};
+    std::size_t length = 0;
+    while (length < numeric_str.size() && length < buffer_size && static_cast<unsigned long>(numeric_str[length]) < 0x80UL)
     {
-        // Use shared static buffer for string conversion
-        // Avoids stack allocation, suitable for resource-constrained systems
-        auto* buffer = shared_buffer<wchar_t>::data();
-        const std::size_t capacity = shared_buffer<wchar_t>::capacity();
-
-        const wchar_t* c_str;
-
-        if (numeric_str.size() < capacity - 1) // -1 for null terminator
-        {
-            // Copy to shared buffer
-            std::copy(numeric_str.begin(), numeric_str.end(), buffer);
-            buffer[numeric_str.size()] = L'\0';
-            c_str = buffer;
-        }
-        else
-        {
-            // Fallback to heap only for oversized strings (exceptional case)
-            static thread_local std::wstring overflow_str;
-            overflow_str = std::wstring(numeric_str);
-            c_str = overflow_str.c_str();
-        }
-
-        // Create a view to remove the float suffix before parsing
-        std::wstring_view to_parse{c_str};
-        size_t parse_len = to_parse.size();
-        if (!to_parse.empty() && (to_parse.back() == L'f' || to_parse.back() == L'F'))
-        {
-            parse_len--;
-        }
-
-        if constexpr (std::is_floating_point_v<ValueType>)
-        {
-            wchar_t* endptr = nullptr;
-            double value = std::wcstod(c_str, &endptr);
+        buffer[length] = static_cast<char>(numeric_str[length]);
+        ++length;
+    }
+    if (length < buffer_size)
+    {
+        return parse_numeric_range<ValueType>(buffer.data(), buffer.data() + length);
+    }
 
-            // Verify we consumed at least some characters before any suffix
-            size_t consumed = static_cast<size_t>(endptr - c_str);
-            if (consumed == 0 || consumed > parse_len)
-            {
-                return std::nullopt;
-            }
-            return static_cast<ValueType>(value);
-        }
-        else
+    // Oversized numeric text (exceptional case)
+    std::string narrow;
+    narrow.reserve(numeric_str.size());
+    for (const wchar_t c : numeric_str)
+    {
+        if (static_cast<unsigned long>(c) >= 0x80UL)
         {
-            // For non-floating point types, attempt conversion
-            wchar_t* endptr = nullptr;
-            long value = std::wcstol(c_str, &endptr, 10);
-
-            // Verify we consumed at least some characters
-            size_t consumed = static_cast<size_t>(endptr - c_str);
-            if (consumed == 0 || consumed > parse_len)
-            {
-                return std::nullopt;
-            }
-            return static_cast<ValueType>(value);
+            break;
         }
+        narrow.push_back(static_cast<char>(c));
     }
-    catch (...)
-    {
-        return std::nullopt;
-    }
+    return parse_numeric_char<ValueType>(narrow);
 }
 
 template <typename CharT, typename ValueType>
@@ -0,0 +1,742 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <pkr_units/expected.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/parsing/parse_error.h>
+#include <pkr_units/impl/parsing/unit_info.h>
+#include <pkr_units/impl/parsing/unit_registry.h>
+
+// ============================================================================
+// Compound unit expressions
+// ============================================================================
+//
+// Reduces unit expressions such as "kg·m/s²", "W/(m²·K)" or "m s-1" to a
+// dimension and a scale onto coherent SI units. Grammar:
+//
+//   expression := term { ( '*' | '·' | '⋅' | '×' | '.' | spaces | '/' ) term }
+//   term       := ( '(' expression ')' | '1' | symbol ) [ exponent ]
+//   exponent   := '^' integer | '^(' integer [ '/' integer ] ')'
+//               | superscript integer ("²", "⁻¹") | integer right after a symbol ("m2", "s-1")
+//
+// Operators are left associative, so "J/kg·K" is (J/kg)·K; write "J/(kg·K)"
+// for the other reading. Symbols are looked up in the runtime unit registry,
+// then as an SI prefix ("k", "µ", "da", ...) in front of a registered symbol.
+// Rational powers are allowed as long as the result has whole exponents
+// ("(m^2)^(1/2)"). Affine temperature units contribute their scale only, that
+// is they read as temperature differences inside an expression.
+//
+// Everything is constexpr: checked_unit_expression_t validates a literal against
+// its target unit during compilation and keeps only the conversion factor.
+
+namespace pkr::units
+{
+
+/// Dimension and scale of a compound unit expression
+struct unit_expression_t
+{
+    dimension_t dimension;
+    double scale; // coherent SI value = value * scale
+
+    constexpr bool operator==(const unit_expression_t&) const = default;
+};
+
+} // namespace pkr::units
+
+namespace pkr::units::impl
+{
+
+// ============================================================================
+// Exponent arithmetic
+// ============================================================================
+
+struct rational_exponent
+{
+    int num = 0;
+    int den = 1;
+};
+
+constexpr rational_exponent make_exponent(int num, int den) noexcept
+{
+    if (den < 0)
+    {
+        num = -num;
+        den = -den;
+    }
+    const int divisor = std::gcd(num, den);
+    return divisor > 1 ? rational_exponent{num / divisor, den / divisor} : rational_exponent{num, den};
+}
+
+inline constexpr std::array<int dimension_t::*, 9> dimension_members{
+    &dimension_t::length,
+    &dimension_t::mass,
+    &dimension_t::time,
+    &dimension_t::current,
+    &dimension_t::temperature,
+    &dimension_t::amount,
+    &dimension_t::intensity,
+    &dimension_t::angle,
+    &dimension_t::star_angle};
+
+// An intermediate result; exponents may be fractional until the expression is complete
+struct expression_value
+{
+    std::array<rational_exponent, dimension_members.size()> exponents{};
+    double scale = 1.0;
+};
+
+constexpr expression_value expression_from_unit(const unit_info& unit, double factor = 1.0) noexcept
+{
+    expression_value value{};
+    for (std::size_t d = 0; d < dimension_members.size(); ++d)
+    {
+        value.exponents[d] = rational_exponent{unit.dimension.*dimension_members[d], 1};
+    }
+    value.scale = unit.scale * factor;
+    return value;
+}
+
+constexpr expression_value multiply_expressions(const expression_value& lhs, const expression_value& rhs, int sign) noexcept
+{
+    expression_value value{};
+    for (std::size_t d = 0; d < dimension_members.size(); ++d)
+    {
+        const rational_exponent& a = lhs.exponents[d];
+        const rational_exponent& b = rhs.exponents[d];
+        value.exponents[d] = make_exponent((a.num * b.den) + (sign * b.num * a.den), a.den * b.den);
+    }
+    value.scale = sign > 0 ? lhs.scale * rhs.scale : lhs.scale / rhs.scale;
+    return value;
+}
+
+constexpr double integer_power(double base, int exponent) noexcept
+{
+    double result = 1.0;
+    for (int n = exponent < 0 ? -exponent : exponent; n > 0; n >>= 1)
+    {
+        if ((n & 1) != 0)
+        {
+            result *= base;
+        }
+        base *= base;
+    }
+    return exponent < 0 ? 1.0 / result : result;
+}
+
+// Newton iteration from above; unit scales are always positive
+constexpr double positive_root(double value, int degree) noexcept
+{
+    if (degree == 1 || value == 1.0)
+    {
+        return value;
+    }
+    const double n = static_cast<double>(degree);
+    double x = value > 1.0 ? value : 1.0;
+    for (int i = 0; i < 4096; ++i)
+    {
+        const double next = (((n - 1.0) * x) + (value / integer_power(x, degree - 1))) / n;
+        if (next >= x)
+        {
+            break;
+        }
+        x = next;
+    }
+    return x;
+}
+
+constexpr expression_value power_expression(const expression_value& base, rational_exponent exponent) noexcept
+{
+    expression_value value{};
+    for (std::size_t d = 0; d < dimension_members.size(); ++d)
+    {
+        value.exponents[d] = make_exponent(base.exponents[d].num * exponent.num, base.exponents[d].den * exponent.den);
+    }
+    value.scale = integer_power(positive_root(base.scale, exponent.den), exponent.num);
+    return value;
+}
+
+// ============================================================================
+// SI prefixes
+// ============================================================================
+
+struct si_prefix
+{
+    std::string_view narrow; // UTF-8
+    std::wstring_view wide;
+    double factor;
+};
+
+// "da" precedes "d"; micro is accepted as "u", micro sign and Greek mu
+inline constexpr std::array<si_prefix, 26> si_prefixes{{
+    {"Q", L"Q", 1e30},
+    {"R", L"R", 1e27},
+    {"Y", L"Y", 1e24},
+    {"Z", L"Z", 1e21},
+    {"E", L"E", 1e18},
+    {"P", L"P", 1e15},
+    {"T", L"T", 1e12},
+    {"G", L"G", 1e9},
+    {"M", L"M", 1e6},
+    {"k", L"k", 1e3},
+    {"h", L"h", 1e2},
+    {"da", L"da", 1e1},
+    {"d", L"d", 1e-1},
+    {"c", L"c", 1e-2},
+    {"m", L"m", 1e-3},
+    {"u", L"u", 1e-6},
+    {"\u00B5", L"\u00B5", 1e-6},
+    {"\u03BC", L"\u03BC", 1e-6},
+    {"n", L"n", 1e-9},
+    {"p", L"p", 1e-12},
+    {"f", L"f", 1e-15},
+    {"a", L"a", 1e-18},
+    {"z", L"z", 1e-21},
+    {"y", L"y", 1e-24},
+    {"r", L"r", 1e-27},
+    {"q", L"q", 1e-30},
+}};
+
+template <typename CharT>
+constexpr auto prefix_text(const si_prefix& prefix) noexcept
+{
+    if constexpr (std::is_same_v<CharT, char>)
+    {
+        return prefix.narrow;
+    }
+    else
+    {
+        return prefix.wide;
+    }
+}
+
+// ============================================================================
+// Tokenizer
+// ============================================================================
+
+// Narrow input is UTF-8; wide input is taken a code unit at a time (every
+// operator and superscript is in the BMP)
+struct code_point
+{
+    char32_t value;
+    std::size_t size;
+};
+
+constexpr code_point decode_code_point(std::string_view text, std::size_t pos) noexcept
+{
+    const auto lead = static_cast<unsigned char>(text[pos]);
+    const std::size_t size = lead < 0x80 ? 1 : lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 0;
+    if (size == 0 || pos + size > text.size())
+    {
+        return {U'\uFFFD', 1};
+    }
+    if (size == 1)
+    {
+        return {lead, 1};
+    }
+    char32_t value = lead & (0x7Fu >> size);
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        const auto next = static_cast<unsigned char>(text[pos + i]);
+        if ((next & 0xC0u) != 0x80u)
+        {
+            return {U'\uFFFD', 1};
+        }
+        value = (value << 6) | (next & 0x3Fu);
+    }
+    return {value, size};
+}
+
+constexpr code_point decode_code_point(std::wstring_view text, std::size_t pos) noexcept
+{
+    return {static_cast<char32_t>(text[pos]), 1};
+}
+
+constexpr bool is_expression_space(char32_t c) noexcept
+{
+    return c == U' ' || c == U'\t';
+}
+
+constexpr bool is_product_operator(char32_t c) noexcept
+{
+    return c == U'*' || c == U'.' || c == U'\u00B7' || c == U'\u22C5' || c == U'\u00D7';
+}
+
+constexpr bool is_ascii_digit(char32_t c) noexcept
+{
+    return c >= U'0' && c <= U'9';
+}
+
+// Value of a superscript digit, or -1
+constexpr int superscript_digit(char32_t c) noexcept
+{
+    switch (c)
+    {
+    case U'\u2070': // ⁰
+        return 0;
+    case U'\u00B9': // ¹
+        return 1;
+    case U'\u00B2': // ²
+        return 2;
+    case U'\u00B3': // ³
+        return 3;
+    default:
+        return c >= U'\u2074' && c <= U'\u2079' ? static_cast<int>(c - U'\u2070') : -1;
+    }
+}
+
+constexpr bool is_superscript(char32_t c) noexcept
+{
+    return superscript_digit(c) >= 0 || c == U'\u207B' || c == U'\u207A';
+}
+
+constexpr bool is_symbol_char(char32_t c) noexcept
+{
+    return !is_expression_space(c) && !is_product_operator(c) && !is_ascii_digit(c) && !is_superscript(c) && c != U'/' && c != U'^' && c != U'(' &&
+           c != U')' && c != U'+' && c != U'-';
+}
+
+// ============================================================================
+// Recursive-descent parser
+// ============================================================================
+
+template <typename CharT>
+struct expression_parser
+{
+    static constexpr int max_depth = 16;
+    static constexpr int max_exponent = 1000;
+    static constexpr int max_exponent_term = 1'000'000; // keeps nested powers clear of int overflow
+
+    std::basic_string_view<CharT> text;
+    std::size_t pos = 0;
+    bool failed = false;
+    parse_error error = parse_error::invalid_expression;
+
+    constexpr expression_value fail(parse_error reason) noexcept
+    {
+        if (!failed)
+        {
+            failed = true;
+            error = reason;
+        }
+        return {};
+    }
+
+    constexpr bool at_end() const noexcept
+    {
+        return pos >= text.size();
+    }
+
+    constexpr char32_t peek() const noexcept
+    {
+        return at_end() ? U'\0' : decode_code_point(text, pos).value;
+    }
+
+    constexpr void advance() noexcept
+    {
+        pos += decode_code_point(text, pos).size;
+    }
+
+    constexpr bool skip_spaces() noexcept
+    {
+        bool skipped = false;
+        while (!at_end() && is_expression_space(peek()))
+        {
+            advance();
+            skipped = true;
+        }
+        return skipped;
+    }
+
+    // expression := term { operator term }
+    constexpr expression_value parse_expression(int depth) noexcept
+    {
+        skip_spaces();
+        expression_value result = parse_term(depth);
+        while (!failed)
+        {
+            const bool spaced = skip_spaces();
+            if (at_end() || peek() == U')')
+            {
+                break;
+            }
+            const char32_t c = peek();
+            int sign = 1;
+            if (is_product_operator(c) || c == U'/')
+            {
+                sign = c == U'/' ? -1 : 1;
+                advance();
+                skip_spaces();
+            }
+            else if (!spaced)
+            {
+                return fail(parse_error::invalid_expression);
+            }
+            const expression_value rhs = parse_term(depth);
+            result = bounded(multiply_expressions(result, rhs, sign));
+        }
+        return result;
+    }
+
+    // term := primary [ exponent ]
+    constexpr expression_value parse_term(int depth) noexcept
+    {
+        expression_value base{};
+        bool symbol = false;
+        const char32_t c = peek();
+        if (c == U'(')
+        {
+            if (depth >= max_depth)
+            {
+                return fail(parse_error::invalid_expression);
+            }
+            advance();
+            base = parse_expression(depth + 1);
+            if (failed || peek() != U')')
+            {
+                return fail(parse_error::invalid_expression);
+            }
+            advance();
+        }
+        else if (c == U'1')
+        {
+            // "1/s"
+            advance();
+            if (is_ascii_digit(peek()))
+            {
+                return fail(parse_error::invalid_expression);
+            }
+        }
+        else if (!at_end() && is_symbol_char(c))
+        {
+            const std::size_t start = pos;
+            while (!at_end() && is_symbol_char(peek()))
+            {
+                advance();
+            }
+            base = resolve_symbol(text.substr(start, pos - start));
+            symbol = true;
+        }
+        else
+        {
+            return fail(parse_error::invalid_expression);
+        }
+
+        const char32_t next = peek();
+        if (failed || at_end())
+        {
+            return base;
+        }
+        if (next == U'^')
+        {
+            advance();
+            return bounded(power_expression(base, parse_caret_exponent()));
+        }
+        if (is_superscript(next))
+        {
+            return bounded(power_expression(base, parse_superscript_exponent()));
+        }
+        if (symbol && (is_ascii_digit(next) || next == U'-' || next == U'+'))
+        {
+            return bounded(power_expression(base, rational_exponent{parse_integer(), 1}));
+        }
+        return base;
+    }
+
+    constexpr expression_value bounded(const expression_value& value) noexcept
+    {
+        for (const rational_exponent& exponent : value.exponents)
+        {
+            if (exponent.num > max_exponent_term || exponent.num < -max_exponent_term || exponent.den > max_exponent_term)
+            {
+                return fail(parse_error::invalid_expression);
+            }
+        }
+        return value;
+    }
+
+    // A registered symbol or name, or an SI prefix in front of one
+    constexpr expression_value resolve_symbol(std::basic_string_view<CharT> symbol) noexcept
+    {
+        if (const unit_info* unit = find_registered_unit(symbol))
+        {
+            return expression_from_unit(*unit);
+        }
+        for (const si_prefix& prefix : si_prefixes)
+        {
+            const auto spelled = prefix_text<CharT>(prefix);
+            if (symbol.size() > spelled.size() && same_code_units(symbol.substr(0, spelled.size()), spelled))
+            {
+                if (const unit_info* unit = find_registered_unit(symbol.substr(spelled.size())))
+                {
+                    return expression_from_unit(*unit, prefix.factor);
+                }
+            }
+        }
+        return fail(parse_error::unknown_symbol);
+    }
+
+    // [ '+' | '-' ] digits
+    constexpr int parse_integer() noexcept
+    {
+        int sign = 1;
+        if (peek() == U'-' || peek() == U'+')
+        {
+            sign = peek() == U'-' ? -1 : 1;
+            advance();
+        }
+        if (!is_ascii_digit(peek()))
+        {
+            fail(parse_error::invalid_expression);
+            return 0;
+        }
+        int value = 0;
+        while (is_ascii_digit(peek()) && value <= max_exponent)
+        {
+            value = (value * 10) + static_cast<int>(peek() - U'0');
+            advance();
+        }
+        if (value > max_exponent)
+        {
+            fail(parse_error::invalid_expression);
+            return 0;
+        }
+        return sign * value;
+    }
+
+    // integer | '(' integer [ '/' integer ] ')'
+    constexpr rational_exponent parse_caret_exponent() noexcept
+    {
+        if (peek() != U'(')
+        {
+            return rational_exponent{parse_integer(), 1};
+        }
+        advance();
+        skip_spaces();
+        const int num = parse_integer();
+        int den = 1;
+        skip_spaces();
+        if (peek() == U'/')
+        {
+            advance();
+            skip_spaces();
+            den = parse_integer();
+            skip_spaces();
+        }
+        if (failed || den == 0 || peek() != U')')
+        {
+            fail(parse_error::invalid_expression);
+            return rational_exponent{1, 1};
+        }
+        advance();
+        return make_exponent(num, den);
+    }
+
+    // [ '⁻' | '⁺' ] superscript digits
+    constexpr rational_exponent parse_superscript_exponent() noexcept
+    {
+        int sign = 1;
+        if (peek() == U'\u207B' || peek() == U'\u207A')
+        {
+            sign = peek() == U'\u207B' ? -1 : 1;
+            advance();
+        }
+        int value = 0;
+        bool any = false;
+        while (superscript_digit(peek()) >= 0 && value <= max_exponent)
+        {
+            value = (value * 10) + superscript_digit(peek());
+            advance();
+            any = true;
+        }
+        if (!any || value > max_exponent)
+        {
+            fail(parse_error::invalid_expression);
+            return rational_exponent{1, 1};
+        }
+        return rational_exponent{sign * value, 1};
+    }
+};
+
+struct unit_expression_result
+{
+    unit_expression_t unit;
+    parse_error error;
+    bool valid;
+};
+
+template <typename CharT>
+constexpr unit_expression_result evaluate_unit_expression(std::basic_string_view<CharT> text) noexcept
+{
+    constexpr unit_expression_t none{scalar_dimension, 1.0};
+    expression_parser<CharT> parser{text};
+    const expression_value value = parser.parse_expression(0);
+    parser.skip_spaces();
+    if (!parser.failed && !parser.at_end())
+    {
+        // A ')' without its '('
+        parser.fail(parse_error::invalid_expression);
+    }
+    if (parser.failed)
+    {
+        return {none, parser.error, false};
+    }
+
+    unit_expression_t unit{scalar_dimension, value.scale};
+    for (std::size_t d = 0; d < dimension_members.size(); ++d)
+    {
+        if (value.exponents[d].den != 1)
+        {
+            return {none, parse_error::invalid_expression, false};
+        }
+        unit.dimension.*dimension_members[d] = value.exponents[d].num;
+    }
+    return {unit, parse_error::invalid_expression, true};
+}
+
+// The registry view of an expression, for convert_registered
+constexpr unit_info expression_unit_info(const unit_expression_t& expression) noexcept
+{
+    return unit_info{{}, {}, {}, expression.dimension, expression.scale, 0.0};
+}
+
+// target value = source value * scale + offset
+struct linear_conversion
+{
+    double scale = 1.0;
+    double offset = 0.0;
+};
+
+// Spellings of the temperature scales found in data files ("degC", "°F")
+constexpr std::string_view temperature_alias(std::string_view unit) noexcept
+{
+    for (std::string_view prefix : {std::string_view{"deg"}, std::string_view{"\u00B0"}})
+    {
+        if (unit.size() == prefix.size() + 1 && unit.substr(0, prefix.size()) == prefix)
+        {
+            return unit.substr(prefix.size());
+        }
+    }
+    return unit;
+}
+
+// How values written in `symbol` convert into TargetUnit, for data files and
+// streams that name the unit once. A registered symbol of the target dimension is
+// used first, so affine temperatures keep their offset; anything else is read as a
+// compound expression. Errors are those of evaluate_unit_expression,
+// parse_error::ambiguous_symbol when several registered units of TargetUnit's
+// dimension share the spelling, or parse_error::symbol_mismatch when the dimension
+// differs from TargetUnit's.
+template <is_pkr_unit_c TargetUnit, typename CharT>
+auto resolve_linear_conversion(std::basic_string_view<CharT> symbol) -> expected_t<linear_conversion, parse_error>
+{
+    if constexpr (std::is_same_v<CharT, char>)
+    {
+        symbol = temperature_alias(symbol);
+    }
+    using ratio_type = typename PKR_UNITS_NAMESPACE::details::is_pkr_unit<TargetUnit>::ratio_type;
+    constexpr dimension_t target_dimension = PKR_UNITS_NAMESPACE::details::is_pkr_unit<TargetUnit>::value_dimension;
+    constexpr double target_scale = registry_scale<ratio_type, unit_tag_t<TargetUnit>>();
+    constexpr double target_offset = registry_offset<unit_tag_t<TargetUnit>>();
+
+    unit_info source{};
+    bool ambiguous = false;
+    if (const unit_info* registered = find_registered_unit(symbol, &target_dimension, &ambiguous))
+    {
+        source = *registered;
+    }
+    else if (ambiguous)
+    {
+        return expected_t<linear_conversion, parse_error>{parse_error::ambiguous_symbol};
+    }
+    else
+    {
+        const auto expression = evaluate_unit_expression(symbol);
+        if (!expression.valid)
+        {
+            return expected_t<linear_conversion, parse_error>{expression.error};
+        }
+        if (expression.unit.dimension != target_dimension)
+        {
+            return expected_t<linear_conversion, parse_error>{parse_error::symbol_mismatch};
+        }
+        source = expression_unit_info(expression.unit);
+    }
+    return expected_t<linear_conversion, parse_error>{linear_conversion{source.scale / target_scale, (source.offset - target_offset) / target_scale}};
+}
+
+} // namespace pkr::units::impl
+
+namespace pkr::units
+{
+
+/// Reduce a compound unit expression ("kg·m/s²", L"W/(m²·K)") to its dimension and scale
+///
+/// @return the expression, parse_error::unknown_symbol for a symbol that is neither
+///         registered nor a prefixed registered symbol, or parse_error::invalid_expression
+template <impl::registry_text_c text_t>
+auto parse_unit_expression(const text_t& text) -> expected_t<unit_expression_t, parse_error>
+{
+    const auto result = impl::evaluate_unit_expression(std::basic_string_view<impl::registry_char_t<text_t>>{text});
+    if (!result.valid)
+    {
+        return expected_t<unit_expression_t, parse_error>{result.error};
+    }
+    return expected_t<unit_expression_t, parse_error>{result.unit};
+}
+
+/// A unit expression checked against TargetUnit during compilation
+///
+/// The constructor is consteval: a malformed expression, an unknown symbol or
+/// a dimension other than TargetUnit's fails to compile. Only the conversion
+/// factor remains at run time.
+///
+/// @example
+/// ```cpp
+/// constexpr checked_unit_expression_t<newton_t<double>> force_unit{"kg·m/s²"};
+/// newton_t<double> f = force_unit.convert(9.81);  // 9.81 N
+///
+/// constexpr checked_unit_expression_t<meter_t<double>> bad{"m/s"};  // error: not a constant expression
+/// ```
+template <is_pkr_unit_c TargetUnit>
+class checked_unit_expression_t
+{
+    unit_expression_t m_expression;
+
+public:
+    using value_type = typename details::is_pkr_unit<TargetUnit>::value_type;
+
+    template <impl::registry_text_c text_t>
+    consteval checked_unit_expression_t(const text_t& text)
+        : m_expression{}
+    {
+        const auto result = impl::evaluate_unit_expression(std::basic_string_view<impl::registry_char_t<text_t>>{text});
+        if (!result.valid)
+        {
+            throw std::invalid_argument("unit expression: malformed expression or unknown symbol");
+        }
+        if (result.unit.dimension != details::is_pkr_unit<TargetUnit>::value_dimension)
+        {
+            throw std::invalid_argument("unit expression: dimension differs from the target unit");
+        }
+        m_expression = result.unit;
+    }
+
+    constexpr const unit_expression_t& expression() const noexcept
+    {
+        return m_expression;
+    }
+
+    /// A value written in the expression's unit, as TargetUnit
+    constexpr TargetUnit convert(value_type value) const noexcept
+    {
+        return TargetUnit{impl::convert_registered<TargetUnit>(impl::expression_unit_info(m_expression), static_cast<double>(value))};
+    }
+};
+
+} // namespace pkr::units
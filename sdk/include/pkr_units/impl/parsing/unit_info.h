@@ -0,0 +1,77 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/units/temperature/temperature_cast.h>
+
+namespace pkr::units
+{
+
+/// Runtime description of a registered unit (see unit_registry.h)
+struct unit_info
+{
+    std::string_view name;
+    std::string_view symbol;
+    std::wstring_view w_symbol;
+    dimension_t dimension;
+    double scale;  // coherent SI value = value * scale + offset
+    double offset; // non-zero only for the affine temperature scales
+
+    constexpr double to_coherent(double value) const noexcept
+    {
+        return (value * scale) + offset;
+    }
+
+    constexpr double from_coherent(double value) const noexcept
+    {
+        return (value - offset) / scale;
+    }
+
+    constexpr bool operator==(const unit_info&) const = default;
+};
+
+} // namespace pkr::units
+
+namespace pkr::units::impl
+{
+
+// Celsius and Fahrenheit carry ratio 1 and a tag; their affine map lives here
+template <typename ratio_t, typename tag_t = void>
+constexpr double registry_scale() noexcept
+{
+    if constexpr (std::is_same_v<tag_t, fahrenheit_tag_t>)
+    {
+        return 5.0 / 9.0;
+    }
+    else
+    {
+        return static_cast<double>(ratio_t::num) / static_cast<double>(ratio_t::den);
+    }
+}
+
+template <typename tag_t = void>
+constexpr double registry_offset() noexcept
+{
+    if constexpr (std::is_same_v<tag_t, celsius_tag_t>)
+    {
+        return KELVIN_OFFSET;
+    }
+    else if constexpr (std::is_same_v<tag_t, fahrenheit_tag_t>)
+    {
+        return KELVIN_OFFSET - (32.0 * 5.0 / 9.0);
+    }
+    else
+    {
+        return 0.0;
+    }
+}
+
+// One row of the generated unit table
+template <typename ratio_t, typename tag_t = void>
+constexpr unit_info registered_unit(std::string_view name, std::string_view symbol, std::wstring_view w_symbol, dimension_t dimension) noexcept
+{
+    return unit_info{name, symbol, w_symbol, dimension, registry_scale<ratio_t, tag_t>(), registry_offset<tag_t>()};
+}
+
+} // namespace pkr::units::impl
@@ -0,0 +1,432 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <pkr_units/expected.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/parsing/parse_error.h>
+#include <pkr_units/impl/parsing/unit_info.h>
+#include <pkr_units/impl/parsing/unit_registry_table.h>
+
+// ============================================================================
+// Runtime unit registry
+// ============================================================================
+//
+// Maps every unit symbol, wide symbol and name to the unit's dimension and its
+// affine map onto coherent SI units, so that text with a unit only known at run
+// time ("5 km", "300 K", "12 foot") can be converted or inspected. The unit list
+// comes from unit_registry_table.h (generated by tools/generate_unit_registry.py);
+// the tables and the hash index are built in constant expressions, so a lookup
+// is one hash, one probe and one string compare, without allocation.
+//
+// Symbols are not unique ("m" is meter and the hour-angle arcminute, "F" farad
+// and Fahrenheit). Units sharing a symbol are chained in the table's precedence
+// order, SI first; lookups with a dimension take the first unit that has it.
+
+namespace pkr::units::impl
+{
+
+// ============================================================================
+// Unit descriptions
+// ============================================================================
+
+// The registry row a unit type would generate; the tests compare it with unit_table
+template <is_pkr_unit_c unit_u>
+constexpr unit_info make_unit_info() noexcept
+{
+    using ratio_type = typename details::is_pkr_unit<unit_u>::ratio_type;
+    unit_info info = registered_unit<ratio_type, unit_tag_t<unit_u>>({}, unit_u::symbol, {}, details::is_pkr_unit<unit_u>::value_dimension);
+    if constexpr (requires { unit_u::name; })
+    {
+        info.name = unit_u::name;
+    }
+    if constexpr (requires { unit_u::w_symbol; })
+    {
+        info.w_symbol = unit_u::w_symbol;
+    }
+    return info;
+}
+
+// A bare number parsed by parse_any
+inline constexpr unit_info dimensionless_unit{"scalar", "", L"", scalar_dimension, 1.0, 0.0};
+
+// Convert a value given in a registered unit to the target unit type
+template <is_pkr_unit_c TargetUnit>
+constexpr auto convert_registered(const unit_info& source, double value) noexcept
+{
+    using value_type = typename details::is_pkr_unit<TargetUnit>::value_type;
+    using ratio_type = typename details::is_pkr_unit<TargetUnit>::ratio_type;
+    constexpr double target_scale = registry_scale<ratio_type, unit_tag_t<TargetUnit>>();
+    constexpr double target_offset = registry_offset<unit_tag_t<TargetUnit>>();
+    if (source.offset == 0.0 && target_offset == 0.0)
+    {
+        return static_cast<value_type>(value * (source.scale / target_scale));
+    }
+    return static_cast<value_type>((source.to_coherent(value) - target_offset) / target_scale);
+}
+
+// ============================================================================
+// Perfect hash index (hash and displace)
+// ============================================================================
+//
+// Keys are hashed once with FNV-1a over code units, so a narrow key and a wide
+// input spelling the same ASCII text hash alike. Each key's bucket owns a
+// displacement chosen at compile time such that every distinct key text lands
+// in its own slot; a lookup therefore probes exactly one slot.
+
+struct registry_key
+{
+    std::string_view narrow;
+    std::wstring_view wide;
+    std::uint16_t unit = 0;
+};
+
+constexpr std::uint32_t code_unit(char c) noexcept
+{
+    return static_cast<unsigned char>(c);
+}
+
+constexpr std::uint32_t code_unit(wchar_t c) noexcept
+{
+    return static_cast<std::uint32_t>(c);
+}
+
+template <typename CharT>
+constexpr std::uint32_t registry_hash(std::basic_string_view<CharT> text) noexcept
+{
+    std::uint32_t hash = 2166136261u;
+    for (const CharT c : text)
+    {
+        hash ^= code_unit(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+constexpr std::uint32_t registry_hash(const registry_key& key) noexcept
+{
+    return key.wide.empty() ? registry_hash(key.narrow) : registry_hash(key.wide);
+}
+
+constexpr std::uint32_t registry_mix(std::uint32_t hash, std::uint32_t displacement) noexcept
+{
+    std::uint32_t x = hash ^ (displacement * 0x9E3779B9u);
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    return x;
+}
+
+template <typename LhsChar, typename RhsChar>
+constexpr bool same_code_units(std::basic_string_view<LhsChar> lhs, std::basic_string_view<RhsChar> rhs) noexcept
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        if (code_unit(lhs[i]) != code_unit(rhs[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename CharT>
+constexpr bool key_matches(const registry_key& key, std::basic_string_view<CharT> text) noexcept
+{
+    return key.wide.empty() ? same_code_units(key.narrow, text) : same_code_units(key.wide, text);
+}
+
+constexpr bool key_matches(const registry_key& key, const registry_key& other) noexcept
+{
+    return other.wide.empty() ? key_matches(key, other.narrow) : key_matches(key, other.wide);
+}
+
+template <std::size_t key_count_v>
+struct registry_index
+{
+    static constexpr std::size_t slot_count = std::bit_ceil(key_count_v * 2);
+    static constexpr std::size_t bucket_count = slot_count / 8;
+    static constexpr std::uint16_t none = 0xFFFF;
+    static constexpr std::size_t max_bucket_keys = 32;
+
+    std::array<registry_key, key_count_v> keys{};
+    std::array<std::uint16_t, key_count_v> next{};         // next key with the same text, or none
+    std::array<std::uint16_t, bucket_count> displacement{}; // per bucket
+    std::array<std::uint16_t, slot_count> slots{};          // first key with the slot's text, or none
+
+    static constexpr std::size_t bucket_of(std::uint32_t hash) noexcept
+    {
+        return hash & (bucket_count - 1);
+    }
+
+    constexpr std::size_t slot_of(std::uint32_t hash) const noexcept
+    {
+        return registry_mix(hash, displacement[bucket_of(hash)]) & (slot_count - 1);
+    }
+
+    // First key with this text, or none
+    template <typename CharT>
+    constexpr std::uint16_t find(std::basic_string_view<CharT> text) const noexcept
+    {
+        const std::uint16_t key = slots[slot_of(registry_hash(text))];
+        return key != none && key_matches(keys[key], text) ? key : none;
+    }
+};
+
+// Narrow lookups match symbol and name; wide lookups also accept w_symbol
+template <typename CharT>
+constexpr auto build_registry_index()
+{
+    constexpr std::size_t keys_per_unit = std::is_same_v<CharT, char> ? 2 : 3;
+    using index_t = registry_index<unit_table.size() * keys_per_unit>;
+    constexpr std::size_t key_count = unit_table.size() * keys_per_unit;
+    constexpr std::uint16_t none = index_t::none;
+    static_assert(key_count < none, "unit registry: too many keys for 16-bit indices");
+
+    index_t index{};
+    std::size_t count = 0;
+    for (std::size_t u = 0; u < unit_table.size(); ++u)
+    {
+        const auto unit = static_cast<std::uint16_t>(u);
+        index.keys[count++] = registry_key{unit_table[u].symbol, {}, unit};
+        index.keys[count++] = registry_key{unit_table[u].name, {}, unit};
+        if constexpr (keys_per_unit == 3)
+        {
+            index.keys[count++] = registry_key{{}, unit_table[u].w_symbol, unit};
+        }
+    }
+
+    // Group keys by bucket, preserving table order within each bucket
+    std::array<std::uint32_t, key_count> hashes{};
+    std::array<std::size_t, index_t::bucket_count + 1> bucket_start{};
+    for (std::size_t k = 0; k < key_count; ++k)
+    {
+        hashes[k] = registry_hash(index.keys[k]);
+        ++bucket_start[index_t::bucket_of(hashes[k]) + 1];
+    }
+    for (std::size_t b = 0; b < index_t::bucket_count; ++b)
+    {
+        bucket_start[b + 1] += bucket_start[b];
+    }
+    std::array<std::uint16_t, key_count> members{};
+    std::array<std::size_t, index_t::bucket_count> fill{};
+    for (std::size_t k = 0; k < key_count; ++k)
+    {
+        const std::size_t b = index_t::bucket_of(hashes[k]);
+        members[bucket_start[b] + fill[b]++] = static_cast<std::uint16_t>(k);
+    }
+
+    // Chain equal texts behind their first key; only the first keys ("heads") get slots
+    std::array<bool, key_count> head{};
+    std::array<std::uint16_t, key_count> tail{};
+    std::array<std::size_t, index_t::bucket_count> head_count{};
+    std::size_t largest_bucket = 0;
+    index.next.fill(none);
+    for (std::size_t b = 0; b < index_t::bucket_count; ++b)
+    {
+        for (std::size_t m = bucket_start[b]; m < bucket_start[b + 1]; ++m)
+        {
+            const std::uint16_t k = members[m];
+            if (index.keys[k].narrow.empty() && index.keys[k].wide.empty())
+            {
+                continue;
+            }
+            bool chained = false;
+            for (std::size_t p = bucket_start[b]; p < m && !chained; ++p)
+            {
+                const std::uint16_t h = members[p];
+                if (head[h] && key_matches(index.keys[h], index.keys[k]))
+                {
+                    if (index.keys[tail[h]].unit != index.keys[k].unit)
+                    {
+                        index.next[tail[h]] = k;
+                        tail[h] = k;
+                    }
+                    chained = true;
+                }
+            }
+            if (!chained)
+            {
+                head[k] = true;
+                tail[k] = k;
+                ++head_count[b];
+            }
+        }
+        largest_bucket = head_count[b] > largest_bucket ? head_count[b] : largest_bucket;
+    }
+    if (largest_bucket > index_t::max_bucket_keys)
+    {
+        throw std::logic_error("unit registry: hash bucket overflow");
+    }
+
+    // Place the fullest buckets first, searching each for a collision-free displacement
+    index.slots.fill(none);
+    for (std::size_t size = largest_bucket; size > 0; --size)
+    {
+        for (std::size_t b = 0; b < index_t::bucket_count; ++b)
+        {
+            if (head_count[b] != size)
+            {
+                continue;
+            }
+            for (std::uint32_t d = 0;; ++d)
+            {
+                if (d == none)
+                {
+                    throw std::logic_error("unit registry: no perfect hash displacement found");
+                }
+                std::array<std::size_t, index_t::max_bucket_keys> candidate{};
+                std::size_t placed = 0;
+                bool fits = true;
+                for (std::size_t m = bucket_start[b]; m < bucket_start[b + 1] && fits; ++m)
+                {
+                    if (!head[members[m]])
+                    {
+                        continue;
+                    }
+                    const std::size_t slot = registry_mix(hashes[members[m]], d) & (index_t::slot_count - 1);
+                    fits = index.slots[slot] == none;
+                    for (std::size_t c = 0; c < placed && fits; ++c)
+                    {
+                        fits = candidate[c] != slot;
+                    }
+                    candidate[placed++] = slot;
+                }
+                if (fits)
+                {
+                    index.displacement[b] = static_cast<std::uint16_t>(d);
+                    placed = 0;
+                    for (std::size_t m = bucket_start[b]; m < bucket_start[b + 1]; ++m)
+                    {
+                        if (head[members[m]])
+                        {
+                            index.slots[candidate[placed++]] = members[m];
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    return index;
+}
+
+// A variable template, so that only the character types actually parsed pay for the build
+template <typename CharT>
+inline constexpr auto registry_index_v = build_registry_index<CharT>();
+
+// Registered unit spelled `text` (symbol or name). Without a dimension the first unit in
+// precedence order wins. With a dimension the conversion must be unique: when units of that
+// dimension share the spelling but convert differently ("m" is both the hms and the dms
+// arcminute) the result is nullptr and *ambiguous, if given, is set, so that the table order
+// never picks one silently. Aliases with the same conversion ("um": micrometer and micron)
+// resolve to the first.
+template <typename CharT>
+constexpr const unit_info* find_registered_unit(std::basic_string_view<CharT> text, const dimension_t* dimension = nullptr, bool* ambiguous = nullptr) noexcept
+{
+    const auto& index = registry_index_v<CharT>;
+    const unit_info* found = nullptr;
+    for (std::uint16_t key = index.find(text); key != index.none; key = index.next[key])
+    {
+        const unit_info& unit = unit_table[index.keys[key].unit];
+        if (dimension == nullptr)
+        {
+            return &unit;
+        }
+        if (unit.dimension == *dimension)
+        {
+            if (found != nullptr && (found->scale != unit.scale || found->offset != unit.offset))
+            {
+                if (ambiguous != nullptr)
+                {
+                    *ambiguous = true;
+                }
+                return nullptr;
+            }
+            if (found == nullptr)
+            {
+                found = &unit;
+            }
+        }
+    }
+    return found;
+}
+
+// Narrow or wide text (literals, strings, string views); templates, so that an index is
+// only built for a character type somebody looks up
+template <typename text_t>
+concept registry_text_c = std::is_convertible_v<const text_t&, std::string_view> || std::is_convertible_v<const text_t&, std::wstring_view>;
+
+template <typename text_t>
+using registry_char_t = std::conditional_t<std::is_convertible_v<const text_t&, std::string_view>, char, wchar_t>;
+
+} // namespace pkr::units::impl
+
+namespace pkr::units
+{
+
+/// All registered units, in lookup precedence order
+constexpr std::span<const unit_info> registered_units() noexcept
+{
+    return impl::unit_table;
+}
+
+/// Look up a unit by symbol or name ("km", "kilometer", L"µm"); nullptr when unknown
+template <impl::registry_text_c text_t>
+constexpr const unit_info* find_unit(const text_t& text) noexcept
+{
+    return impl::find_registered_unit(std::basic_string_view<impl::registry_char_t<text_t>>{text});
+}
+
+/// Look up a unit of the given dimension by symbol or name; nullptr when none matches or matching units convert differently
+template <impl::registry_text_c text_t>
+constexpr const unit_info* find_unit(const text_t& text, const dimension_t& dimension) noexcept
+{
+    return impl::find_registered_unit(std::basic_string_view<impl::registry_char_t<text_t>>{text}, &dimension);
+}
+
+// ============================================================================
+// Runtime-dimensioned quantity
+// ============================================================================
+
+/// A quantity whose unit is only known at run time (see parse_any)
+struct any_quantity_t
+{
+    double value;           // in `unit`
+    const unit_info* unit; // never null
+
+    constexpr dimension_t dimension() const noexcept
+    {
+        return unit->dimension;
+    }
+
+    /// The value in coherent SI units (kelvin for temperatures)
+    constexpr double coherent_value() const noexcept
+    {
+        return unit->to_coherent(value);
+    }
+
+    /// Convert to a unit type; parse_error::symbol_mismatch when the dimensions differ
+    template <is_pkr_unit_c TargetUnit>
+    auto as() const -> expected_t<TargetUnit, parse_error>
+    {
+        if (unit->dimension != details::is_pkr_unit<TargetUnit>::value_dimension)
+        {
+            return expected_t<TargetUnit, parse_error>{parse_error::symbol_mismatch};
+        }
+        return expected_t<TargetUnit, parse_error>{TargetUnit{impl::convert_registered<TargetUnit>(*unit, value)}};
+    }
+};
+
+} // namespace pkr::units
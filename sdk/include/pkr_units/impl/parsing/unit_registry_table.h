@@ -0,0 +1,764 @@
+#pragma once
+
+// Auto-generated by tools/generate_unit_registry.py. Do not edit.
+// Re-run the script after adding, removing or renaming a unit type.
+
+#include <array>
+#include <ratio>
+#include <tuple>
+#include <pkr_units/impl/parsing/unit_info.h>
+#include <pkr_units/units/base/amount.h>
+#include <pkr_units/units/base/angle.h>
+#include <pkr_units/units/base/current.h>
+#include <pkr_units/units/base/intensity.h>
+#include <pkr_units/units/base/length.h>
+#include <pkr_units/units/base/mass.h>
+#include <pkr_units/units/base/solid_angle.h>
+#include <pkr_units/units/base/temperature.h>
+#include <pkr_units/units/base/time.h>
+#include <pkr_units/units/derived/acceleration.h>
+#include <pkr_units/units/derived/area/area_units.h>
+#include <pkr_units/units/derived/concentration.h>
+#include <pkr_units/units/derived/density.h>
+#include <pkr_units/units/derived/electrical/capacitance.h>
+#include <pkr_units/units/derived/electrical/charge.h>
+#include <pkr_units/units/derived/electrical/conductance.h>
+#include <pkr_units/units/derived/electrical/inductance.h>
+#include <pkr_units/units/derived/electrical/josephson.h>
+#include <pkr_units/units/derived/electrical/potential.h>
+#include <pkr_units/units/derived/electrical/resistance.h>
+#include <pkr_units/units/derived/magnetic_flux.h>
+#include <pkr_units/units/derived/mechanical/energy.h>
+#include <pkr_units/units/derived/mechanical/force.h>
+#include <pkr_units/units/derived/mechanical/power.h>
+#include <pkr_units/units/derived/mechanical/pressure.h>
+#include <pkr_units/units/derived/photometry/luminous_exitance.h>
+#include <pkr_units/units/derived/photometry/luminous_flux.h>
+#include <pkr_units/units/derived/radiometry/irradiance.h>
+#include <pkr_units/units/derived/radiometry/radiance.h>
+#include <pkr_units/units/derived/radiometry/radiant_intensity.h>
+#include <pkr_units/units/derived/thermal/specific_heat_capacity.h>
+#include <pkr_units/units/derived/thermal/thermal_conductivity.h>
+#include <pkr_units/units/derived/velocity.h>
+#include <pkr_units/units/derived/viscosity.h>
+#include <pkr_units/units/derived/volume/volume_units.h>
+#include <pkr_units/units/temperature/celsius.h>
+#include <pkr_units/units/temperature/fahrenheit.h>
+#include <pkr_units/units/dimensionless/percentage.h>
+#include <pkr_units/units/dimensionless/ratio.h>
+#include <pkr_units/units/cgs/acceleration.h>
+#include <pkr_units/units/cgs/electrical/charge.h>
+#include <pkr_units/units/cgs/magnetic/gauss.h>
+#include <pkr_units/units/cgs/magnetic/maxwell.h>
+#include <pkr_units/units/cgs/magnetic/oersted.h>
+#include <pkr_units/units/cgs/mechanical/energy.h>
+#include <pkr_units/units/cgs/mechanical/force.h>
+#include <pkr_units/units/cgs/mechanical/pressure.h>
+#include <pkr_units/units/cgs/viscosity.h>
+#include <pkr_units/units/imperial/acceleration.h>
+#include <pkr_units/units/imperial/density.h>
+#include <pkr_units/units/imperial/length.h>
+#include <pkr_units/units/imperial/mass.h>
+#include <pkr_units/units/imperial/mechanical/force.h>
+#include <pkr_units/units/imperial/mechanical/power.h>
+#include <pkr_units/units/imperial/mechanical/pressure.h>
+#include <pkr_units/units/imperial/velocity.h>
+#include <pkr_units/units/astronomical/angle.h>
+#include <pkr_units/units/astronomical/length.h>
+#include <pkr_units/units/computer_science/bits.h>
+#include <pkr_units/units/computer_science/bytes.h>
+#include <pkr_units/units/computer_science/flop.h>
+#include <pkr_units/units/computer_science/neural.h>
+
+namespace pkr::units::impl
+{
+
+// Every unit with a symbol, in lookup precedence order
+inline constexpr std::array<unit_info, 341> unit_table{
+    registered_unit<std::ratio<1, 1>>("mole", "mol", L"mol", amount_dimension),
+    registered_unit<std::atto>("attomole", "amol", L"amol", amount_dimension),
+    registered_unit<std::femto>("femtomole", "fmol", L"fmol", amount_dimension),
+    registered_unit<std::pico>("picomole", "pmol", L"pmol", amount_dimension),
+    registered_unit<std::nano>("nanomole", "nmol", L"nmol", amount_dimension),
+    registered_unit<std::micro>("micromole", "umol", L"\u00b5mol", amount_dimension),
+    registered_unit<std::milli>("millimole", "mmol", L"mmol", amount_dimension),
+    registered_unit<std::centi>("centimole", "cmol", L"cmol", amount_dimension),
+    registered_unit<std::deci>("decimole", "dmol", L"dmol", amount_dimension),
+    registered_unit<std::deca>("decamole", "damol", L"damol", amount_dimension),
+    registered_unit<std::hecto>("hectomole", "hmol", L"hmol", amount_dimension),
+    registered_unit<std::kilo>("kilomole", "kmol", L"kmol", amount_dimension),
+    registered_unit<std::mega>("megamole", "Mmol", L"Mmol", amount_dimension),
+    registered_unit<std::giga>("gigamole", "Gmol", L"Gmol", amount_dimension),
+    registered_unit<std::tera>("teramole", "Tmol", L"Tmol", amount_dimension),
+    registered_unit<std::peta>("petamole", "Pmol", L"Pmol", amount_dimension),
+    registered_unit<std::exa>("examole", "Emol", L"Emol", amount_dimension),
+    registered_unit<std::ratio<1, 1>>("radian", "rad", L"rad", angle_dimension),
+    registered_unit<std::ratio<1745329, 100000000>>("degree", "deg", L"\u00B0", angle_dimension),
+    registered_unit<std::ratio<1570796, 100000000>>("gradian", "grad", L"gon", angle_dimension),
+    registered_unit<std::ratio<1, 1>>("ampere", "A", L"A", current_dimension),
+    registered_unit<std::atto>("attoampere", "aA", L"aA", current_dimension),
+    registered_unit<std::femto>("femtoampere", "fA", L"fA", current_dimension),
+    registered_unit<std::deci>("deciampere", "dA", L"dA", current_dimension),
+    registered_unit<std::deca>("decaampere", "daA", L"daA", current_dimension),
+    registered_unit<std::hecto>("hectoampere", "hA", L"hA", current_dimension),
+    registered_unit<std::kilo>("kiloampere", "kA", L"kA", current_dimension),
+    registered_unit<std::mega>("megaampere", "MA", L"MA", current_dimension),
+    registered_unit<std::giga>("gigaampere", "GA", L"GA", current_dimension),
+    registered_unit<std::tera>("teraampere", "TA", L"TA", current_dimension),
+    registered_unit<std::peta>("petaampere", "PA", L"PA", current_dimension),
+    registered_unit<std::exa>("exaampere", "EA", L"EA", current_dimension),
+    registered_unit<std::pico>("picoampere", "pA", L"pA", current_dimension),
+    registered_unit<std::nano>("nanoampere", "nA", L"nA", current_dimension),
+    registered_unit<std::micro>("microampere", "uA", L"\u00b5A", current_dimension),
+    registered_unit<std::milli>("milliampere", "mA", L"mA", current_dimension),
+    registered_unit<std::centi>("centiampere", "cA", L"cA", current_dimension),
+    registered_unit<std::ratio<1, 1>>("candela", "cd", L"cd", intensity_dimension),
+    registered_unit<std::atto>("attocandela", "acd", L"acd", intensity_dimension),
+    registered_unit<std::femto>("femtocandela", "fcd", L"fcd", intensity_dimension),
+    registered_unit<std::pico>("picocandela", "pcd", L"pcd", intensity_dimension),
+    registered_unit<std::nano>("nanocandela", "ncd", L"ncd", intensity_dimension),
+    registered_unit<std::micro>("microcandela", "ucd", L"\u00b5cd", intensity_dimension),
+    registered_unit<std::milli>("millicandela", "mcd", L"mcd", intensity_dimension),
+    registered_unit<std::centi>("centicandela", "ccd", L"ccd", intensity_dimension),
+    registered_unit<std::deci>("decicandela", "dcd", L"dcd", intensity_dimension),
+    registered_unit<std::deca>("decacandela", "dacd", L"dacd", intensity_dimension),
+    registered_unit<std::hecto>("hectocandela", "hcd", L"hcd", intensity_dimension),
+    registered_unit<std::kilo>("kilocandela", "kcd", L"kcd", intensity_dimension),
+    registered_unit<std::mega>("megacandela", "Mcd", L"Mcd", intensity_dimension),
+    registered_unit<std::giga>("gigacandela", "Gcd", L"Gcd", intensity_dimension),
+    registered_unit<std::tera>("teracandela", "Tcd", L"Tcd", intensity_dimension),
+    registered_unit<std::peta>("petacandela", "Pcd", L"Pcd", intensity_dimension),
+    registered_unit<std::exa>("exacandela", "Ecd", L"Ecd", intensity_dimension),
+    registered_unit<std::ratio<1, 1>>("meter", "m", L"m", length_dimension),
+    registered_unit<std::atto>("attometer", "am", L"am", length_dimension),
+    registered_unit<std::femto>("femtometer", "fm", L"fm", length_dimension),
+    registered_unit<std::pico>("picometer", "pm", L"pm", length_dimension),
+    registered_unit<std::nano>("nanometer", "nm", L"nm", length_dimension),
+    registered_unit<std::micro>("micrometer", "um", L"\u00b5m", length_dimension),
+    registered_unit<std::milli>("millimeter", "mm", L"mm", length_dimension),
+    registered_unit<std::centi>("centimeter", "cm", L"cm", length_dimension),
+    registered_unit<std::deci>("decimeter", "dm", L"dm", length_dimension),
+    registered_unit<std::deca>("decameter", "dam", L"dam", length_dimension),
+    registered_unit<std::hecto>("hectometer", "hm", L"hm", length_dimension),
+    registered_unit<std::kilo>("kilometer", "km", L"km", length_dimension),
+    registered_unit<std::mega>("megameter", "Mm", L"Mm", length_dimension),
+    registered_unit<std::giga>("gigameter", "Gm", L"Gm", length_dimension),
+    registered_unit<std::tera>("terameter", "Tm", L"Tm", length_dimension),
+    registered_unit<std::peta>("petameter", "Pm", L"Pm", length_dimension),
+    registered_unit<std::exa>("exameter", "Em", L"Em", length_dimension),
+    registered_unit<std::ratio<1, 1>>("kilogram", "kg", L"kg", mass_dimension),
+    registered_unit<std::femto>("picogram", "pg", L"pg", mass_dimension),
+    registered_unit<std::pico>("nanogram", "ng", L"ng", mass_dimension),
+    registered_unit<std::nano>("microgram", "ug", L"\u00b5g", mass_dimension),
+    registered_unit<std::micro>("milligram", "mg", L"mg", mass_dimension),
+    registered_unit<std::ratio<1, 100000>>("centigram", "cg", L"cg", mass_dimension),
+    registered_unit<std::ratio<1, 10000>>("decigram", "dg", L"dg", mass_dimension),
+    registered_unit<std::milli>("gram", "g", L"g", mass_dimension),
+    registered_unit<std::centi>("decagram", "dag", L"dag", mass_dimension),
+    registered_unit<std::deci>("hectogram", "hg", L"hg", mass_dimension),
+    registered_unit<std::mega>("gigagram", "Gg", L"Gg", mass_dimension),
+    registered_unit<std::giga>("teragram", "Tg", L"Tg", mass_dimension),
+    registered_unit<std::tera>("petagram", "Pg", L"Pg", mass_dimension),
+    registered_unit<std::peta>("exagram", "Eg", L"Eg", mass_dimension),
+    registered_unit<std::kilo>("metric ton", "t", L"t", mass_dimension),
+    registered_unit<std::ratio<1, 1>>("steradian", "sr", L"sr", solid_angle_dimension),
+    registered_unit<std::ratio<1, 1>>("kelvin", "K", L"K", temperature_dimension),
+    registered_unit<std::atto>("attokelvin", "aK", L"aK", temperature_dimension),
+    registered_unit<std::femto>("femtokelvin", "fK", L"fK", temperature_dimension),
+    registered_unit<std::pico>("picokelvin", "pK", L"pK", temperature_dimension),
+    registered_unit<std::nano>("nanokelvin", "nK", L"nK", temperature_dimension),
+    registered_unit<std::micro>("microkelvin", "uK", L"\u00b5K", temperature_dimension),
+    registered_unit<std::milli>("millikelvin", "mK", L"mK", temperature_dimension),
+    registered_unit<std::centi>("centikelvin", "cK", L"cK", temperature_dimension),
+    registered_unit<std::deci>("decikelvin", "dK", L"dK", temperature_dimension),
+    registered_unit<std::deca>("decakelvin", "daK", L"daK", temperature_dimension),
+    registered_unit<std::hecto>("hectokelvin", "hK", L"hK", temperature_dimension),
+    registered_unit<std::kilo>("kilokelvin", "kK", L"kK", temperature_dimension),
+    registered_unit<std::mega>("megakelvin", "MK", L"MK", temperature_dimension),
+    registered_unit<std::giga>("gigakelvin", "GK", L"GK", temperature_dimension),
+    registered_unit<std::tera>("terakelvin", "TK", L"TK", temperature_dimension),
+    registered_unit<std::peta>("petakelvin", "PK", L"PK", temperature_dimension),
+    registered_unit<std::exa>("exakelvin", "EK", L"EK", temperature_dimension),
+    registered_unit<std::ratio<1, 1>>("second", "s", L"s", time_dimension),
+    registered_unit<std::atto>("attosecond", "as", L"as", time_dimension),
+    registered_unit<std::femto>("femtosecond", "fs", L"fs", time_dimension),
+    registered_unit<std::pico>("picosecond", "ps", L"ps", time_dimension),
+    registered_unit<std::nano>("nanosecond", "ns", L"ns", time_dimension),
+    registered_unit<std::micro>("microsecond", "us", L"\u00b5s", time_dimension),
+    registered_unit<std::milli>("millisecond", "ms", L"ms", time_dimension),
+    registered_unit<std::centi>("centisecond", "cs", L"cs", time_dimension),
+    registered_unit<std::deci>("decisecond", "ds", L"ds", time_dimension),
+    registered_unit<std::deca>("decasecond", "das", L"das", time_dimension),
+    registered_unit<std::hecto>("hectosecond", "hs", L"hs", time_dimension),
+    registered_unit<std::kilo>("kilosecond", "ks", L"ks", time_dimension),
+    registered_unit<std::mega>("megasecond", "Ms", L"Ms", time_dimension),
+    registered_unit<std::giga>("gigasecond", "Gs", L"Gs", time_dimension),
+    registered_unit<std::tera>("terasecond", "Ts", L"Ts", time_dimension),
+    registered_unit<std::peta>("petasecond", "Ps", L"Ps", time_dimension),
+    registered_unit<std::exa>("exasecond", "Es", L"Es", time_dimension),
+    registered_unit<std::ratio<60, 1>>("minute", "min", L"min", time_dimension),
+    registered_unit<std::ratio<3600, 1>>("hour", "h", L"h", time_dimension),
+    registered_unit<std::ratio<86400, 1>>("day", "d", L"d", time_dimension),
+    registered_unit<std::ratio<604800, 1>>("week", "wk", L"wk", time_dimension),
+    registered_unit<std::ratio<2629800, 1>>("month", "mo", L"mo", time_dimension),
+    registered_unit<std::ratio<31557600, 1>>("year", "yr", L"yr", time_dimension),
+    registered_unit<std::ratio<1, 1>>("meter per second squared", "m/sÂ²", L"m\u00B7s\u207B\u00B2", acceleration_v),
+    registered_unit<std::ratio<1, 100>>("centimeter per second squared", "cm/sÂ²", L"cm\u00B7s\u207B\u00B2", acceleration_v),
+    registered_unit<std::ratio<1, 1000>>("millimeter per second squared", "mm/sÂ²", L"mm\u00B7s\u207B\u00B2", acceleration_v),
+    registered_unit<std::ratio<1000, 1>>("kilometer per second squared", "km/sÂ²", L"km\u00B7s\u207B\u00B2", acceleration_v),
+    registered_unit<std::ratio<980665, 100000>>("standard gravity", "g", L"g", acceleration_v),
+    registered_unit<std::ratio<1, 1>>("square meter", "m^2", L"m\u00b2", area_dimension),
+    registered_unit<std::ratio<1000000, 1>>("square kilometer", "km^2", L"km\u00b2", area_dimension),
+    registered_unit<std::ratio<1, 10000>>("square centimeter", "cm^2", L"cm\u00b2", area_dimension),
+    registered_unit<std::ratio<1, 1000000>>("square millimeter", "mm^2", L"mm\u00b2", area_dimension),
+    registered_unit<std::ratio<1, 1>>("mole_per_cubic_meter_concentration", "mol/m^3", L"mol\u00B7m\u207B\u00B3", molar_concentration_v),
+    registered_unit<std::ratio<1000, 1>>("mole_per_liter_concentration", "mol/L", L"mol\u00B7L\u207B\u00B9", molar_concentration_v),
+    registered_unit<std::ratio<1000, 1>>("molar_concentration", "M", L"M", molar_concentration_v),
+    registered_unit<std::ratio<1, 1>>("millimolar_concentration", "mM", L"mM", molar_concentration_v),
+    registered_unit<std::ratio<1, 1000>>("micromolar_concentration", "uM", L"\u00b5M", molar_concentration_v),
+    registered_unit<std::ratio<1, 1000000>>("nanomolar_concentration", "nM", L"nM", molar_concentration_v),
+    registered_unit<std::ratio<1, 1000000000>>("picomolar_concentration", "pM", L"pM", molar_concentration_v),
+    registered_unit<std::ratio<1000000, 1>>("mole_per_cubic_centimeter_concentration", "mol/cm^3", L"mol\u00B7cm\u207B\u00B3", molar_concentration_v),
+    registered_unit<std::ratio<1000000, 1>>("mole_per_milliliter_concentration", "mol/mL", L"mol\u00B7mL\u207B\u00B9", molar_concentration_v),
+    registered_unit<std::ratio<1000, 1>>("osmole_per_liter_concentration", "Osm/L", L"Osm\u00B7L\u207B\u00B9", molar_concentration_v),
+    registered_unit<std::ratio<1, 1>>("milliosmole_per_liter_concentration", "mOsm/L", L"mOsm\u00B7L\u207B\u00B9", molar_concentration_v),
+    registered_unit<std::ratio<1, 1>>("kilogram per cubic meter", "kg/m^3", L"kg\u00B7m\u207B\u00B3", density_dimension),
+    registered_unit<std::ratio<1, 1000>>("gram_per_cubic_meter", "g/m^3", L"g\u00B7m\u207B\u00B3", density_dimension),
+    registered_unit<std::ratio<1000000, 1>>("gram_per_cubic_centimeter", "g/cm^3", L"g\u00B7cm\u207B\u00B3", density_dimension),
+    registered_unit<std::ratio<1000000, 1>>("gram_per_milliliter", "g/mL", L"g\u00B7mL\u207B\u00B9", density_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilogram_per_liter", "kg/L", L"kg\u00B7L\u207B\u00B9", density_dimension),
+    registered_unit<std::ratio<1, 1>>("gram_per_liter", "g/L", L"g\u00B7L\u207B\u00B9", density_dimension),
+    registered_unit<std::ratio<1000, 1>>("milligram_per_cubic_centimeter", "mg/cm^3", L"mg\u00B7cm\u207B\u00B3", density_dimension),
+    registered_unit<std::ratio<1000, 1>>("milligram_per_milliliter", "mg/mL", L"mg\u00B7mL\u207B\u00B9", density_dimension),
+    registered_unit<std::ratio<1000000, 1>>("ton_per_cubic_meter", "t/m^3", L"t\u00B7m\u207B\u00B3", density_dimension),
+    registered_unit<std::ratio<166054, 1>>("atomic_mass_unit_per_cubic_angstrom", "u/A^3", L"u\u00B7\u00C5\u207B\u00B3", density_dimension),
+    registered_unit<std::ratio<1, 1>>("farad", "F", L"F", capacitance_v),
+    registered_unit<std::ratio<1, 1000>>("millifarad", "mF", L"mF", capacitance_v),
+    registered_unit<std::ratio<1, 1000000>>("microfarad", "uF", L"\u00b5F", capacitance_v),
+    registered_unit<std::ratio<1, 1000000000>>("nanofarad", "nF", L"nF", capacitance_v),
+    registered_unit<std::ratio<1, 1000000000000>>("picofarad", "pF", L"pF", capacitance_v),
+    registered_unit<std::ratio<1, 1>>("coulomb", "C", L"C", electric_charge_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilocoulomb", "kC", L"kC", electric_charge_dimension),
+    registered_unit<std::ratio<1, 1000>>("millicoulomb", "mC", L"mC", electric_charge_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microcoulomb", "uC", L"\u00b5C", electric_charge_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanocoulomb", "nC", L"nC", electric_charge_dimension),
+    registered_unit<std::ratio<1, 1000000000000>>("picocoulomb", "pC", L"pC", electric_charge_dimension),
+    registered_unit<std::ratio<1, 1>>("siemens", "S", L"S", conductance_dimension),
+    registered_unit<std::ratio<1, 1000>>("millisiemens", "mS", L"mS", conductance_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microsiemens", "uS", L"\u00b5S", conductance_dimension),
+    registered_unit<std::ratio<1, 1>>("henry", "H", L"H", inductance_dimension),
+    registered_unit<std::ratio<1, 1000>>("millihenry", "mH", L"mH", inductance_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microhenry", "uH", L"\u00b5H", inductance_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanohenry", "nH", L"nH", inductance_dimension),
+    registered_unit<std::ratio<1, 1>>("josephson", "K_J", L"K_J", josephson_dimension),
+    registered_unit<std::ratio<1, 1>>("volt", "V", L"V", electric_potential_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilovolt", "kV", L"kV", electric_potential_dimension),
+    registered_unit<std::ratio<1000000, 1>>("megavolt", "MV", L"MV", electric_potential_dimension),
+    registered_unit<std::ratio<1, 1000>>("millivolt", "mV", L"mV", electric_potential_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microvolt", "uV", L"\u00b5V", electric_potential_dimension),
+    registered_unit<std::ratio<1, 1>>("ohm", "ohm", L"\u03a9", electric_resistance_dimension),
+    registered_unit<std::ratio<1000, 1>>("kiloohm", "kohm", L"k\u03a9", electric_resistance_dimension),
+    registered_unit<std::ratio<1000000, 1>>("megaohm", "Mohm", L"M\u03a9", electric_resistance_dimension),
+    registered_unit<std::ratio<1000000000, 1>>("gigaohm", "Gohm", L"G\u03a9", electric_resistance_dimension),
+    registered_unit<std::ratio<1, 1000>>("milliohm", "mohm", L"m\u03a9", electric_resistance_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microohm", "uohm", L"\u00b5\u03a9", electric_resistance_dimension),
+    registered_unit<std::ratio<1, 1>>("weber", "Wb", L"Wb", magnetic_flux_dimension),
+    registered_unit<std::ratio<1, 1000>>("milliweber", "mWb", L"mWb", magnetic_flux_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microweber", "uWb", L"\u00b5Wb", magnetic_flux_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanoweber", "nWb", L"nWb", magnetic_flux_dimension),
+    registered_unit<std::ratio<1000, 1>>("kiloweber", "kWb", L"kWb", magnetic_flux_dimension),
+    registered_unit<std::ratio<1, 1>>("tesla", "T", L"T", magnetic_flux_density_dimension),
+    registered_unit<std::ratio<1, 1000>>("millitesla", "mT", L"mT", magnetic_flux_density_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microtesla", "uT", L"\u00b5T", magnetic_flux_density_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanotesla", "nT", L"nT", magnetic_flux_density_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilotesla", "kT", L"kT", magnetic_flux_density_dimension),
+    registered_unit<std::ratio<1000000, 1>>("megatesla", "MT", L"MT", magnetic_flux_density_dimension),
+    registered_unit<std::ratio<1, 1>>("joule", "J", L"J", energy_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilojoule", "kJ", L"kJ", energy_dimension),
+    registered_unit<std::ratio<1000000, 1>>("megajoule", "MJ", L"MJ", energy_dimension),
+    registered_unit<std::ratio<1000000000, 1>>("gigajoule", "GJ", L"GJ", energy_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microjoule", "uJ", L"\u00b5J", energy_dimension),
+    registered_unit<std::ratio<1, 1000>>("millijoule", "mJ", L"mJ", energy_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanojoule", "nJ", L"nJ", energy_dimension),
+    registered_unit<std::ratio<4184, 1000>>("calorie", "cal", L"cal", energy_dimension),
+    registered_unit<std::ratio<4184, 1>>("kilocalorie", "kcal", L"kcal", energy_dimension),
+    registered_unit<std::ratio<3600, 1>>("watt_hour", "Wh", L"Wh", energy_dimension),
+    registered_unit<std::ratio<3600000, 1>>("kilowatt_hour", "kWh", L"kWh", energy_dimension),
+    registered_unit<std::ratio<1, 6241509074460762607>>("electronvolt", "eV", L"eV", energy_dimension),
+    registered_unit<std::ratio<1000, 6241509074460762607>>("kiloelectronvolt", "keV", L"keV", energy_dimension),
+    registered_unit<std::ratio<1000000, 6241509074460762607>>("megaelectronvolt", "MeV", L"MeV", energy_dimension),
+    registered_unit<std::ratio<1000000000, 6241509074460762607>>("gigaelectronvolt", "GeV", L"GeV", energy_dimension),
+    registered_unit<std::ratio<1, 1>>("newton", "N", L"N", force_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilonewton", "kN", L"kN", force_dimension),
+    registered_unit<std::ratio<1000000, 1>>("meganewton", "MN", L"MN", force_dimension),
+    registered_unit<std::ratio<1, 1000000>>("micronewton", "uN", L"\u00b5N", force_dimension),
+    registered_unit<std::ratio<1, 1000>>("millinewton", "mN", L"mN", force_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanonewton", "nN", L"nN", force_dimension),
+    registered_unit<std::ratio<1, 1>>("watt", "W", L"W", power_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilowatt", "kW", L"kW", power_dimension),
+    registered_unit<std::ratio<1000000, 1>>("megawatt", "MW", L"MW", power_dimension),
+    registered_unit<std::ratio<1000000000, 1>>("gigawatt", "GW", L"GW", power_dimension),
+    registered_unit<std::ratio<1, 1000000>>("microwatt", "uW", L"\u00b5W", power_dimension),
+    registered_unit<std::ratio<1, 1000>>("milliwatt", "mW", L"mW", power_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanowatt", "nW", L"nW", power_dimension),
+    registered_unit<std::ratio<1, 1>>("pascal", "Pa", L"Pa", pressure_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilopascal", "kPa", L"kPa", pressure_dimension),
+    registered_unit<std::ratio<100, 1>>("hectopascal", "hPa", L"hPa", pressure_dimension),
+    registered_unit<std::ratio<1000000, 1>>("megapascal", "MPa", L"MPa", pressure_dimension),
+    registered_unit<std::ratio<1, 1000000>>("micropascal", "uPa", L"\u00b5Pa", pressure_dimension),
+    registered_unit<std::ratio<1, 1000>>("millipascal", "mPa", L"mPa", pressure_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("nanopascal", "nPa", L"nPa", pressure_dimension),
+    registered_unit<std::ratio<100000, 1>>("bar", "bar", L"bar", pressure_dimension),
+    registered_unit<std::ratio<101325, 1>>("atmosphere", "atm", L"atm", pressure_dimension),
+    registered_unit<std::ratio<1, 1>>("lux", "lx", L"cd\u00b7sr\u00b7m\u207b\u00b2", dimension_t{-2, 0, 0, 0, 0, 0, 1, 0, 1}),
+    registered_unit<std::ratio<1, 1>>("lumen", "lm", L"cd\u00b7sr", dimension_t{0, 0, 0, 0, 0, 0, 1, 0, 1}),
+    registered_unit<std::ratio<1, 1>>("watt_per_square_meter", "W/m2", L"W\u00b7m\u207b\u00b2", dimension_t{1, -2, -3, 0, 0, 0, 0, 0, 0}),
+    registered_unit<std::ratio<1, 1>>("irradiance", "W/m2", L"W\u00b7m\u207b\u00b2", dimension_t{1, -2, -3, 0, 0, 0, 0, 0, 0}),
+    registered_unit<std::ratio<1, 1>>("watt_per_square_meter_per_steradian", "W/(m2Â·sr)", L"W\u00b7m\u207b\u00b2\u00b7sr\u207b\u00b9", dimension_t{1, -2, -3, 0, 0, 0, 0, 0, -1}),
+    registered_unit<std::ratio<1, 1>>("radiance", "W/(m2Â·sr)", L"W\u00b7m\u207b\u00b2\u00b7sr\u207b\u00b9", dimension_t{1, -2, -3, 0, 0, 0, 0, 0, -1}),
+    registered_unit<std::ratio<1, 1>>("watt_per_steradian", "W/sr", L"W\u00B7sr\u207B\u00B9", dimension_t{1, 2, -3, 0, 0, 0, 0, 0, -1}),
+    registered_unit<std::ratio<1, 1>>("specific_heat_capacity", "J/(kg*K)", L"J\u00B7kg\u207B\u00B9\u00B7K\u207B\u00B9", specific_heat_capacity_dimension),
+    registered_unit<std::ratio<1, 1>>("thermal_conductivity", "W/(m*K)", L"W\u00B7m\u207B\u00B9\u00B7K\u207B\u00B9", thermal_conductivity_dimension),
+    registered_unit<std::ratio<1, 1>>("meter per second", "m/s", L"m\u00B7s\u207B\u00B9", velocity_dimension),
+    registered_unit<std::ratio<5, 18>>("kilometer per hour", "km/h", L"km\u00B7h\u207B\u00B9", velocity_dimension),
+    registered_unit<std::ratio<1, 100>>("centimeter per second", "cm/s", L"cm\u00B7s\u207B\u00B9", velocity_dimension),
+    registered_unit<std::ratio<1, 1000>>("millimeter per second", "mm/s", L"mm\u00B7s\u207B\u00B9", velocity_dimension),
+    registered_unit<std::ratio<1000, 1>>("kilometer per second", "km/s", L"km\u00B7s\u207B\u00B9", velocity_dimension),
+    registered_unit<std::ratio<1, 1>>("pascal_second", "Pa*s", L"Pa\u00B7s", dynamic_viscosity_dimension),
+    registered_unit<std::ratio<1, 1>>("square_meter_per_second", "m^2/s", L"m\u00B2\u00B7s\u207B\u00B9", kinematic_viscosity_dimension),
+    registered_unit<std::ratio<1, 1>>("cubic meter", "m\u00b3", L"m\u00b3", volume_dimension),
+    registered_unit<std::ratio<1000000000, 1>>("cubic kilometer", "km\u00b3", L"km\u00b3", volume_dimension),
+    registered_unit<std::ratio<1, 1000000>>("cubic centimeter", "cm\u00b3", L"cm\u00b3", volume_dimension),
+    registered_unit<std::ratio<1, 1000000000>>("cubic millimeter", "mm\u00b3", L"mm\u00b3", volume_dimension),
+    registered_unit<std::ratio<1, 1000>>("liter", "L", L"L", volume_dimension),
+    registered_unit<std::ratio<1, 1000000>>("milliliter", "mL", L"mL", volume_dimension),
+    registered_unit<std::ratio<1, 1>, celsius_tag_t>("celsius", "C", L"\u00b0C", temperature_dimension),
+    registered_unit<std::ratio<1, 1>, fahrenheit_tag_t>("fahrenheit", "F", L"\u00b0F", temperature_dimension),
+    registered_unit<std::ratio<1, 100>>("percent", "%", L"%", scalar_dimension),
+    registered_unit<std::ratio<1, 1>>("ratio", "ratio", L"ratio", scalar_dimension),
+    registered_unit<std::ratio<1, 100>>("gal", "Gal", L"Gal", acceleration_v),
+    registered_unit<std::ratio<1, 2997924580>>("statcoulomb", "statC", L"statC", electric_charge_dimension),
+    registered_unit<std::ratio<1, 10000>>("gauss", "G", L"G", magnetic_flux_density_dimension),
+    registered_unit<std::ratio<1, 100000000>>("maxwell", "Mx", L"Mx", magnetic_flux_dimension),
+    registered_unit<std::ratio<795774715459477, 10000000000000>>("oersted", "Oe", L"Oe", magnetic_field_strength_dimension),
+    registered_unit<std::ratio<1, 10000000>>("erg", "erg", L"erg", energy_dimension),
+    registered_unit<std::ratio<1, 100000>>("dyne", "dyn", L"dyn", force_dimension),
+    registered_unit<std::ratio<1, 10>>("barye", "Ba", L"Ba", pressure_dimension),
+    registered_unit<std::ratio<1, 10>>("poise", "P", L"P", dynamic_viscosity_dimension),
+    registered_unit<std::ratio<1, 10000>>("stokes", "St", L"St", kinematic_viscosity_dimension),
+    registered_unit<std::ratio<3048, 10000>>("feet per second squared", "ft/s^2", L"ft\u00b7s\u207b\u00b2", acceleration_v),
+    registered_unit<std::ratio<27679904, 1000000>>("pound_per_cubic_inch", "lb/in^3", L"lb\u00b7in\u207b\u00b3", density_dimension),
+    registered_unit<std::ratio<16018, 1000000>>("pound_per_cubic_foot", "lb/ft^3", L"lb\u00b7ft\u207b\u00b3", density_dimension),
+    registered_unit<std::ratio<119826, 1000000>>("pound_per_gallon", "lb/gal", L"lb\u00b7gal\u207b\u00b9", density_dimension),
+    registered_unit<std::ratio<1729994, 1000000>>("ounce_per_cubic_inch", "oz/in^3", L"oz\u00b7in\u207b\u00b3", density_dimension),
+    registered_unit<std::ratio<33814, 1000>>("ounce_per_fluid_ounce", "oz/fl oz", L"oz\u00b7fl oz\u207b\u00b9", density_dimension),
+    registered_unit<std::ratio<254, 10000>>("inch", "in", L"in", length_dimension),
+    registered_unit<std::ratio<254, 10000000>>("mil", "mil", L"mil", length_dimension),
+    registered_unit<std::ratio<3048, 10000>>("foot", "ft", L"ft", length_dimension),
+    registered_unit<std::ratio<9144, 10000>>("yard", "yd", L"yd", length_dimension),
+    registered_unit<std::ratio<18288, 10000>>("fathom", "ftm", L"ftm", length_dimension),
+    registered_unit<std::ratio<50292, 10000>>("rod", "rd", L"rd", length_dimension),
+    registered_unit<std::ratio<201168, 10000>>("chain", "ch", L"ch", length_dimension),
+    registered_unit<std::ratio<201168, 1000>>("furlong", "fur", L"fur", length_dimension),
+    registered_unit<std::ratio<1609344, 1000>>("mile", "mi", L"mi", length_dimension),
+    registered_unit<std::ratio<1852, 1>>("nautical_mile", "nmi", L"nmi", length_dimension),
+    registered_unit<std::ratio<64799, 1000000000>>("grain", "gr", L"gr", mass_dimension),
+    registered_unit<std::ratio<1771845, 1000000000>>("dram", "dr", L"dr", mass_dimension),
+    registered_unit<std::ratio<28349523, 1000000000>>("ounce", "oz", L"oz", mass_dimension),
+    registered_unit<std::ratio<453592370, 1000000000>>("pound", "lb", L"lb", mass_dimension),
+    registered_unit<std::ratio<6350293180, 1000000000>>("stone", "st", L"st", mass_dimension),
+    registered_unit<std::ratio<50802345, 1000000>>("hundredweight", "cwt", L"cwt", mass_dimension),
+    registered_unit<std::ratio<907184740, 1000000000>>("us_ton", "ton", L"ton", mass_dimension),
+    registered_unit<std::ratio<1016046909, 1000000000>>("long_ton", "long ton", L"long ton", mass_dimension),
+    registered_unit<std::ratio<45359237, 1000000000>>("poundal", "pdl", L"pdl", force_dimension),
+    registered_unit<std::ratio<4448222, 1000000>>("pound_force", "lbf", L"lbf", force_dimension),
+    registered_unit<std::ratio<745700, 1000>>("horsepower", "hp", L"hp", power_dimension),
+    registered_unit<std::ratio<6894757, 1000>>("psi", "psi", L"psi", pressure_dimension),
+    registered_unit<std::ratio<1609344, 3600000>>("miles per hour", "mph", L"mph", velocity_dimension),
+    registered_unit<std::ratio<3048, 10000>>("feet per second", "ft/s", L"ft\u00b7s\u207b\u00b9", velocity_dimension),
+    registered_unit<std::ratio<254, 10000>>("inches per second", "in/s", L"in\u00b7s\u207b\u00b9", velocity_dimension),
+    registered_unit<std::ratio<1852, 3600>>("knots", "kn", L"kn", velocity_dimension),
+    registered_unit<std::ratio<26179935, 100000000>>("hms_archour", "h", L"\u02B0", angle_dimension),
+    registered_unit<std::ratio<26179935, 6000000000>>("hms_arcminute", "m", L"\u1D50", angle_dimension),
+    registered_unit<std::ratio<26179935, 360000000000>>("hms_arcsecond", "s", L"\u02E2", angle_dimension),
+    registered_unit<std::ratio<1745329, 100000000>>("dms_degree", "deg", L"\u00B0", angle_dimension),
+    registered_unit<std::ratio<1745329, 6000000000>>("dms_arcminute", "m", L"\u1D50", angle_dimension),
+    registered_unit<std::ratio<1745329, 360000000000>>("dms_arcsecond", "s", L"\u02E2", angle_dimension),
+    registered_unit<std::micro>("micron", "um", L"\u00b5m", length_dimension),
+    registered_unit<std::ratio<1, 10000000000>>("angstrom", "A", L"\u00C5", length_dimension),
+    registered_unit<std::ratio<149597870700, 1>>("astronomical_unit", "au", L"au", length_dimension),
+    registered_unit<std::ratio<94607304725808000, 1>>("light_year", "ly", L"ly", length_dimension),
+    registered_unit<std::ratio<30856775814913673, 1>>("parsec", "pc", L"pc", length_dimension),
+    registered_unit<std::ratio<1, 8>, bit_tag>("bit", "b", L"", amount_dimension),
+    registered_unit<std::ratio<1000, 8>, bit_tag>("kilobit", "kb", L"", amount_dimension),
+    registered_unit<std::ratio<1000000, 8>, bit_tag>("megabit", "Mb", L"", amount_dimension),
+    registered_unit<std::ratio<1000000000, 8>, bit_tag>("gigabit", "Gb", L"", amount_dimension),
+    registered_unit<std::ratio<1, 8>, bit_tag>("bit per second", "b/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1000, 8>, bit_tag>("kilobit per second", "kb/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1000000, 8>, bit_tag>("megabit per second", "Mb/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1000000000, 8>, bit_tag>("gigabit per second", "Gb/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1, 1>, byte_tag>("byte", "B", L"B", amount_dimension),
+    registered_unit<std::ratio<1024, 1>, byte_tag>("kilobyte", "kB", L"kB", amount_dimension),
+    registered_unit<std::mega, byte_tag>("megabyte", "MB", L"MB", amount_dimension),
+    registered_unit<std::ratio<1000000000, 1>, byte_tag>("gigabyte", "GB", L"GB", amount_dimension),
+    registered_unit<std::ratio<1, 1>, byte_tag>("byte per second", "B/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1024, 1>, byte_tag>("kilobyte per second", "kB/s", L"", amount_rate_dimension),
+    registered_unit<std::mega, byte_tag>("megabyte per second", "MB/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1000000000, 1>, byte_tag>("gigabyte per second", "GB/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1024, 1>, byte_tag>("kibibyte", "KiB", L"KiB", amount_dimension),
+    registered_unit<std::ratio<1048576, 1>, byte_tag>("mebibyte", "MiB", L"MiB", amount_dimension),
+    registered_unit<std::ratio<1073741824, 1>, byte_tag>("gibibyte", "GiB", L"GiB", amount_dimension),
+    registered_unit<std::ratio<1, 1>, flop_amount_tag>("floating-point operation", "FLOP", L"", amount_dimension),
+    registered_unit<std::mega, flop_amount_tag>("megaflop", "MFLOP", L"", amount_dimension),
+    registered_unit<std::ratio<1, 1>, flop_rate_tag>("flop per second", "flop/s", L"", amount_rate_dimension),
+    registered_unit<std::mega, flop_rate_tag>("megaflop per second", "MFLOP/s", L"", amount_rate_dimension),
+    registered_unit<std::ratio<1, 1>, neural_amount_tag>("neural operation", "NOP", L"", amount_dimension),
+    registered_unit<std::mega, neural_amount_tag>("meganeural operation", "MNOP", L"", amount_dimension),
+    registered_unit<std::ratio<1, 1>, neural_rate_tag>("neural ops per second", "NOP/s", L"", amount_rate_dimension),
+    registered_unit<std::mega, neural_rate_tag>("meganeural ops per second", "MNOP/s", L"", amount_rate_dimension)};
+
+// The unit types behind unit_table, entry for entry
+using registered_unit_types = std::tuple<
+    mole_t<double>,
+    attomole_t<double>,
+    femtomole_t<double>,
+    picomole_t<double>,
+    nanomole_t<double>,
+    micromole_t<double>,
+    millimole_t<double>,
+    centimole_t<double>,
+    decimole_t<double>,
+    decamole_t<double>,
+    hectomole_t<double>,
+    kilomole_t<double>,
+    megamole_t<double>,
+    gigamole_t<double>,
+    teramole_t<double>,
+    petamole_t<double>,
+    examole_t<double>,
+    radian_t<double>,
+    degree_t<double>,
+    gradian_t<double>,
+    ampere_t<double>,
+    attoampere_t<double>,
+    femtoampere_t<double>,
+    deciampere_t<double>,
+    decaampere_t<double>,
+    hectoampere_t<double>,
+    kiloampere_t<double>,
+    megaampere_t<double>,
+    gigaampere_t<double>,
+    teraampere_t<double>,
+    petaampere_t<double>,
+    exaampere_t<double>,
+    picoampere_t<double>,
+    nanoampere_t<double>,
+    microampere_t<double>,
+    milliampere_t<double>,
+    centiampere_t<double>,
+    candela_t<double>,
+    attocandela_t<double>,
+    femtocandela_t<double>,
+    picocandela_t<double>,
+    nanocandela_t<double>,
+    microcandela_t<double>,
+    millicandela_t<double>,
+    centicandela_t<double>,
+    decicandela_t<double>,
+    decacandela_t<double>,
+    hectocandela_t<double>,
+    kilocandela_t<double>,
+    megacandela_t<double>,
+    gigacandela_t<double>,
+    teracandela_t<double>,
+    petacandela_t<double>,
+    exacandela_t<double>,
+    meter_t<double>,
+    attometer_t<double>,
+    femtometer_t<double>,
+    picometer_t<double>,
+    nanometer_t<double>,
+    micrometer_t<double>,
+    millimeter_t<double>,
+    centimeter_t<double>,
+    decimeter_t<double>,
+    decameter_t<double>,
+    hectometer_t<double>,
+    kilometer_t<double>,
+    megameter_t<double>,
+    gigameter_t<double>,
+    terameter_t<double>,
+    petameter_t<double>,
+    exameter_t<double>,
+    kilogram_t<double>,
+    picogram_t<double>,
+    nanogram_t<double>,
+    microgram_t<double>,
+    milligram_t<double>,
+    centigram_t<double>,
+    decigram_t<double>,
+    gram_t<double>,
+    decagram_t<double>,
+    hectogram_t<double>,
+    gigagram_t<double>,
+    teragram_t<double>,
+    petagram_t<double>,
+    exagram_t<double>,
+    metric_ton_t<double>,
+    steradian_t<double>,
+    kelvin_t<double>,
+    attokelvin_t<double>,
+    femtokelvin_t<double>,
+    picokelvin_t<double>,
+    nanokelvin_t<double>,
+    microkelvin_t<double>,
+    millikelvin_t<double>,
+    centikelvin_t<double>,
+    decikelvin_t<double>,
+    decakelvin_t<double>,
+    hectokelvin_t<double>,
+    kilokelvin_t<double>,
+    megakelvin_t<double>,
+    gigakelvin_t<double>,
+    terakelvin_t<double>,
+    petakelvin_t<double>,
+    exakelvin_t<double>,
+    second_t<double>,
+    attosecond_t<double>,
+    femtosecond_t<double>,
+    picosecond_t<double>,
+    nanosecond_t<double>,
+    microsecond_t<double>,
+    millisecond_t<double>,
+    centisecond_t<double>,
+    decisecond_t<double>,
+    decasecond_t<double>,
+    hectosecond_t<double>,
+    kilosecond_t<double>,
+    megasecond_t<double>,
+    gigasecond_t<double>,
+    terasecond_t<double>,
+    petasecond_t<double>,
+    exasecond_t<double>,
+    minute_t<double>,
+    hour_t<double>,
+    day_t<double>,
+    week_t<double>,
+    month_t<double>,
+    year_t<double>,
+    meter_per_second_squared_t<double>,
+    centimeter_per_second_squared_t<double>,
+    millimeter_per_second_squared_t<double>,
+    kilometer_per_second_squared_t<double>,
+    standard_gravity_t<double>,
+    square_meter_t<double>,
+    square_kilometer_t<double>,
+    square_centimeter_t<double>,
+    square_millimeter_t<double>,
+    mole_per_cubic_meter_concentration_t<double>,
+    mole_per_liter_concentration_t<double>,
+    molar_concentration_t<double>,
+    millimolar_concentration_t<double>,
+    micromolar_concentration_t<double>,
+    nanomolar_concentration_t<double>,
+    picomolar_concentration_t<double>,
+    mole_per_cubic_centimeter_concentration_t<double>,
+    mole_per_milliliter_concentration_t<double>,
+    osmole_per_liter_concentration_t<double>,
+    milliosmole_per_liter_concentration_t<double>,
+    kilogram_per_cubic_meter_t<double>,
+    gram_per_cubic_meter_t<double>,
+    gram_per_cubic_centimeter_t<double>,
+    gram_per_milliliter_t<double>,
+    kilogram_per_liter_t<double>,
+    gram_per_liter_t<double>,
+    milligram_per_cubic_centimeter_t<double>,
+    milligram_per_milliliter_t<double>,
+    ton_per_cubic_meter_t<double>,
+    atomic_mass_unit_per_cubic_angstrom_t<double>,
+    farad_t<double>,
+    millifarad_t<double>,
+    microfarad_t<double>,
+    nanofarad_t<double>,
+    picofarad_t<double>,
+    coulomb_t<double>,
+    kilocoulomb_t<double>,
+    millicoulomb_t<double>,
+    microcoulomb_t<double>,
+    nanocoulomb_t<double>,
+    picocoulomb_t<double>,
+    siemens_t<double>,
+    millisiemens_t<double>,
+    microsiemens_t<double>,
+    henry_t<double>,
+    millihenry_t<double>,
+    microhenry_t<double>,
+    nanohenry_t<double>,
+    josephson_t<double>,
+    volt_t<double>,
+    kilovolt_t<double>,
+    megavolt_t<double>,
+    millivolt_t<double>,
+    microvolt_t<double>,
+    ohm_t<double>,
+    kiloohm_t<double>,
+    megaohm_t<double>,
+    gigaohm_t<double>,
+    milliohm_t<double>,
+    microohm_t<double>,
+    weber_t<double>,
+    milliweber_t<double>,
+    microweber_t<double>,
+    nanoweber_t<double>,
+    kiloweber_t<double>,
+    tesla_t<double>,
+    millitesla_t<double>,
+    microtesla_t<double>,
+    nanotesla_t<double>,
+    kilotesla_t<double>,
+    megatesla_t<double>,
+    joule_t<double>,
+    kilojoule_t<double>,
+    megajoule_t<double>,
+    gigajoule_t<double>,
+    microjoule_t<double>,
+    millijoule_t<double>,
+    nanojoule_t<double>,
+    calorie_t<double>,
+    kilocalorie_t<double>,
+    watt_hour_t<double>,
+    kilowatt_hour_t<double>,
+    electronvolt_t<double>,
+    kiloelectronvolt_t<double>,
+    megaelectronvolt_t<double>,
+    gigaelectronvolt_t<double>,
+    newton_t<double>,
+    kilonewton_t<double>,
+    meganewton_t<double>,
+    micronewton_t<double>,
+    millinewton_t<double>,
+    nanonewton_t<double>,
+    watt_t<double>,
+    kilowatt_t<double>,
+    megawatt_t<double>,
+    gigawatt_t<double>,
+    microwatt_t<double>,
+    milliwatt_t<double>,
+    nanowatt_t<double>,
+    pascal_t<double>,
+    kilopascal_t<double>,
+    hectopascal_t<double>,
+    megapascal_t<double>,
+    micropascal_t<double>,
+    millipascal_t<double>,
+    nanopascal_t<double>,
+    bar_t<double>,
+    atmosphere_t<double>,
+    lux_t<double>,
+    lumen_t<double>,
+    watt_per_square_meter_t<double>,
+    irradiance_t<double>,
+    watt_per_square_meter_per_steradian_t<double>,
+    radiance_t<double>,
+    watt_per_steradian_t<double>,
+    specific_heat_capacity_t<double>,
+    thermal_conductivity_t<double>,
+    meter_per_second_t<double>,
+    kilometer_per_hour_t<double>,
+    centimeter_per_second_t<double>,
+    millimeter_per_second_t<double>,
+    kilometer_per_second_t<double>,
+    pascal_second_t<double>,
+    square_meter_per_second_t<double>,
+    cubic_meter_t<double>,
+    cubic_kilometer_t<double>,
+    cubic_centimeter_t<double>,
+    cubic_millimeter_t<double>,
+    liter_t<double>,
+    milliliter_t<double>,
+    celsius_t<double>,
+    fahrenheit_t<double>,
+    percentage_t<double>,
+    ratio_t<double>,
+    gal_t<double>,
+    statcoulomb_t<double>,
+    gauss_t<double>,
+    maxwell_t<double>,
+    oersted_t<double>,
+    erg_t<double>,
+    dyne_t<double>,
+    barye_t<double>,
+    poise_t<double>,
+    stokes_t<double>,
+    feet_per_second_squared_t<double>,
+    pound_per_cubic_inch_t<double>,
+    pound_per_cubic_foot_t<double>,
+    pound_per_gallon_t<double>,
+    ounce_per_cubic_inch_t<double>,
+    ounce_per_fluid_ounce_t<double>,
+    inch_t<double>,
+    mil_t<double>,
+    foot_t<double>,
+    yard_t<double>,
+    fathom_t<double>,
+    rod_t<double>,
+    chain_t<double>,
+    furlong_t<double>,
+    mile_t<double>,
+    nautical_mile_t<double>,
+    grain_t<double>,
+    dram_t<double>,
+    ounce_t<double>,
+    pound_t<double>,
+    stone_t<double>,
+    hundredweight_t<double>,
+    us_ton_t<double>,
+    long_ton_t<double>,
+    poundal_t<double>,
+    pound_force_t<double>,
+    horsepower_t<double>,
+    psi_t<double>,
+    miles_per_hour_t<double>,
+    feet_per_second_t<double>,
+    inches_per_second_t<double>,
+    knots_t<double>,
+    hms_archour_t<double>,
+    hms_arcminute_t<double>,
+    hms_arcsecond_t<double>,
+    dms_degree_t<double>,
+    dms_arcminute_t<double>,
+    dms_arcsecond_t<double>,
+    micron_t<double>,
+    angstrom_t<double>,
+    au_t<double>,
+    light_year_t<double>,
+    parsec_t<double>,
+    bit_t<double>,
+    kilobit_t<double>,
+    megabit_t<double>,
+    gigabit_t<double>,
+    bit_per_second_t<double>,
+    kilobit_per_second_t<double>,
+    megabit_per_second_t<double>,
+    gigabit_per_second_t<double>,
+    byte_t<double>,
+    kilobyte_t<double>,
+    megabyte_t<double>,
+    gigabyte_t<double>,
+    byte_per_second_t<double>,
+    kilobyte_per_second_t<double>,
+    megabyte_per_second_t<double>,
+    gigabyte_per_second_t<double>,
+    kibibyte_t<double>,
+    mebibyte_t<double>,
+    gibibyte_t<double>,
+    flop_t<double>,
+    megaflop_t<double>,
+    flop_per_second_t<double>,
+    megaflop_per_second_t<double>,
+    neural_op_t<double>,
+    meganeural_op_t<double>,
+    neural_op_per_second_t<double>,
+    meganeural_op_per_second_t<double>>;
+
+} // namespace pkr::units::impl
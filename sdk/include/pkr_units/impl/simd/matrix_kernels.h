@@ -0,0 +1,647 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/unit_t.h>
+
+// ============================================================================
+// SIMD instruction set detection
+// ============================================================================
+// Kernels pick the widest instruction set the translation unit is compiled for
+// (-mavx, -msse2, ARM NEON). Define PKR_UNITS_NO_SIMD to force the scalar code,
+// e.g. to compare results bit for bit across platforms.
+#if !defined(PKR_UNITS_NO_SIMD)
+#if defined(__AVX__)
+#define PKR_UNITS_SIMD_AVX 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PKR_UNITS_SIMD_SSE2 1
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PKR_UNITS_SIMD_NEON 1
+#endif
+#endif
+
+#if defined(PKR_UNITS_SIMD_AVX) || defined(PKR_UNITS_SIMD_SSE2)
+#include <immintrin.h>
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace PKR_UNITS_NAMESPACE
+{
+namespace details
+{
+
+// ============================================================================
+// Small dense matrix kernels on raw row-major values
+// ============================================================================
+//
+// The unit matrix types unpack to coherent SI values, call one of these
+// kernels and repack; dimensions are handled entirely at compile time. All
+// kernels are constexpr: constant evaluation always takes the scalar path, at
+// run time the 4x4 product and matrix-vector kernels use AVX or SSE2 for
+// double and SSE or NEON for float.
+
+template <typename type_t, std::size_t n_v>
+using square_values = std::array<type_t, n_v * n_v>;
+
+template <typename type_t, std::size_t n_v>
+constexpr square_values<type_t, n_v> multiply_scalar(const square_values<type_t, n_v>& a, const square_values<type_t, n_v>& b) noexcept
+{
+    square_values<type_t, n_v> c{};
+    for (std::size_t i = 0; i < n_v; ++i)
+    {
+        for (std::size_t k = 0; k < n_v; ++k)
+        {
+            const type_t aik = a[(i * n_v) + k];
+            for (std::size_t j = 0; j < n_v; ++j)
+            {
+                c[(i * n_v) + j] += aik * b[(k * n_v) + j];
+            }
+        }
+    }
+    return c;
+}
+
+template <typename type_t, std::size_t n_v>
+constexpr square_values<type_t, n_v> transpose_values(const square_values<type_t, n_v>& a) noexcept
+{
+    square_values<type_t, n_v> t{};
+    for (std::size_t i = 0; i < n_v; ++i)
+    {
+        for (std::size_t j = 0; j < n_v; ++j)
+        {
+            t[(j * n_v) + i] = a[(i * n_v) + j];
+        }
+    }
+    return t;
+}
+
+// Row i of C is the sum over k of a[i][k] * (row k of B): one broadcast and one
+// multiply-add per element of A, four lanes at a time.
+template <typename type_t>
+constexpr square_values<type_t, 4> multiply_4x4(const square_values<type_t, 4>& a, const square_values<type_t, 4>& b) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            square_values<double, 4> c;
+            const __m256d b0 = _mm256_loadu_pd(&b[0]);
+            const __m256d b1 = _mm256_loadu_pd(&b[4]);
+            const __m256d b2 = _mm256_loadu_pd(&b[8]);
+            const __m256d b3 = _mm256_loadu_pd(&b[12]);
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                __m256d row = _mm256_mul_pd(_mm256_broadcast_sd(&a[(i * 4) + 0]), b0);
+                row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(&a[(i * 4) + 1]), b1));
+                row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(&a[(i * 4) + 2]), b2));
+                row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(&a[(i * 4) + 3]), b3));
+                _mm256_storeu_pd(&c[i * 4], row);
+            }
+            return c;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            square_values<double, 4> c;
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                __m128d lo = _mm_setzero_pd();
+                __m128d hi = _mm_setzero_pd();
+                for (std::size_t k = 0; k < 4; ++k)
+                {
+                    const __m128d aik = _mm_set1_pd(a[(i * 4) + k]);
+                    lo = _mm_add_pd(lo, _mm_mul_pd(aik, _mm_loadu_pd(&b[k * 4])));
+                    hi = _mm_add_pd(hi, _mm_mul_pd(aik, _mm_loadu_pd(&b[(k * 4) + 2])));
+                }
+                _mm_storeu_pd(&c[i * 4], lo);
+                _mm_storeu_pd(&c[(i * 4) + 2], hi);
+            }
+            return c;
+        }
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            square_values<float, 4> c;
+            const __m128 b0 = _mm_loadu_ps(&b[0]);
+            const __m128 b1 = _mm_loadu_ps(&b[4]);
+            const __m128 b2 = _mm_loadu_ps(&b[8]);
+            const __m128 b3 = _mm_loadu_ps(&b[12]);
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                __m128 row = _mm_mul_ps(_mm_set1_ps(a[(i * 4) + 0]), b0);
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[(i * 4) + 1]), b1));
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[(i * 4) + 2]), b2));
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[(i * 4) + 3]), b3));
+                _mm_storeu_ps(&c[i * 4], row);
+            }
+            return c;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            square_values<float, 4> c;
+            const float32x4_t b0 = vld1q_f32(&b[0]);
+            const float32x4_t b1 = vld1q_f32(&b[4]);
+            const float32x4_t b2 = vld1q_f32(&b[8]);
+            const float32x4_t b3 = vld1q_f32(&b[12]);
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                float32x4_t row = vmulq_n_f32(b0, a[(i * 4) + 0]);
+                row = vmlaq_n_f32(row, b1, a[(i * 4) + 1]);
+                row = vmlaq_n_f32(row, b2, a[(i * 4) + 2]);
+                row = vmlaq_n_f32(row, b3, a[(i * 4) + 3]);
+                vst1q_f32(&c[i * 4], row);
+            }
+            return c;
+        }
+#endif
+    }
+    return multiply_scalar<type_t, 4>(a, b);
+}
+
+// y = M x for a 4x4 M: the columns of M are scaled by the components of x and summed.
+// The scalar form keeps the pairwise summation order of matrix_vector_multiply.
+template <typename type_t>
+constexpr std::array<type_t, 4> multiply_4x4_vector(const square_values<type_t, 4>& m, const std::array<type_t, 4>& x) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            // Load the rows and transpose in registers so each column is one vector
+            const __m256d r0 = _mm256_loadu_pd(&m[0]);
+            const __m256d r1 = _mm256_loadu_pd(&m[4]);
+            const __m256d r2 = _mm256_loadu_pd(&m[8]);
+            const __m256d r3 = _mm256_loadu_pd(&m[12]);
+            const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+            const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+            const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+            const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+            const __m256d c0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+            const __m256d c1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+            const __m256d c2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+            const __m256d c3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+            const __m256d lo = _mm256_add_pd(_mm256_mul_pd(c0, _mm256_set1_pd(x[0])), _mm256_mul_pd(c1, _mm256_set1_pd(x[1])));
+            const __m256d hi = _mm256_add_pd(_mm256_mul_pd(c2, _mm256_set1_pd(x[2])), _mm256_mul_pd(c3, _mm256_set1_pd(x[3])));
+            std::array<double, 4> y;
+            _mm256_storeu_pd(y.data(), _mm256_add_pd(lo, hi));
+            return y;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            const __m128 r0 = _mm_loadu_ps(&m[0]);
+            const __m128 r1 = _mm_loadu_ps(&m[4]);
+            const __m128 r2 = _mm_loadu_ps(&m[8]);
+            const __m128 r3 = _mm_loadu_ps(&m[12]);
+            const __m128 t0 = _mm_unpacklo_ps(r0, r1);
+            const __m128 t1 = _mm_unpacklo_ps(r2, r3);
+            const __m128 t2 = _mm_unpackhi_ps(r0, r1);
+            const __m128 t3 = _mm_unpackhi_ps(r2, r3);
+            const __m128 c0 = _mm_movelh_ps(t0, t1);
+            const __m128 c1 = _mm_movehl_ps(t1, t0);
+            const __m128 c2 = _mm_movelh_ps(t2, t3);
+            const __m128 c3 = _mm_movehl_ps(t3, t2);
+            const __m128 lo = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(x[0])), _mm_mul_ps(c1, _mm_set1_ps(x[1])));
+            const __m128 hi = _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(x[2])), _mm_mul_ps(c3, _mm_set1_ps(x[3])));
+            std::array<float, 4> y;
+            _mm_storeu_ps(y.data(), _mm_add_ps(lo, hi));
+            return y;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            const float32x4x4_t c = vld4q_f32(m.data()); // de-interleaves rows into columns
+            const float32x4_t lo = vmlaq_n_f32(vmulq_n_f32(c.val[0], x[0]), c.val[1], x[1]);
+            const float32x4_t hi = vmlaq_n_f32(vmulq_n_f32(c.val[2], x[2]), c.val[3], x[3]);
+            std::array<float, 4> y;
+            vst1q_f32(y.data(), vaddq_f32(lo, hi));
+            return y;
+        }
+#endif
+    }
+    std::array<type_t, 4> y{};
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        y[i] = ((m[(i * 4) + 0] * x[0]) + (m[(i * 4) + 1] * x[1])) + ((m[(i * 4) + 2] * x[2]) + (m[(i * 4) + 3] * x[3]));
+    }
+    return y;
+}
+
+template <typename type_t>
+constexpr type_t determinant_3x3(const square_values<type_t, 3>& a) noexcept
+{
+    return (a[0] * ((a[4] * a[8]) - (a[5] * a[7]))) - (a[1] * ((a[3] * a[8]) - (a[5] * a[6]))) + (a[2] * ((a[3] * a[7]) - (a[4] * a[6])));
+}
+
+// Adjugate of a 3x3 matrix (inverse times determinant)
+template <typename type_t>
+constexpr square_values<type_t, 3> adjugate_3x3(const square_values<type_t, 3>& a) noexcept
+{
+    return square_values<type_t, 3>{
+        (a[4] * a[8]) - (a[5] * a[7]),
+        (a[2] * a[7]) - (a[1] * a[8]),
+        (a[1] * a[5]) - (a[2] * a[4]),
+        (a[5] * a[6]) - (a[3] * a[8]),
+        (a[0] * a[8]) - (a[2] * a[6]),
+        (a[2] * a[3]) - (a[0] * a[5]),
+        (a[3] * a[7]) - (a[4] * a[6]),
+        (a[1] * a[6]) - (a[0] * a[7]),
+        (a[0] * a[4]) - (a[1] * a[3])};
+}
+
+// 2x2 minors of rows 0-1 (s) and rows 2-3 (c) shared by the 4x4 determinant and
+// adjugate (Laplace expansion along the first two rows)
+template <typename type_t>
+struct minors_4x4
+{
+    std::array<type_t, 6> s;
+    std::array<type_t, 6> c;
+};
+
+template <typename type_t>
+constexpr minors_4x4<type_t> compute_minors_4x4(const square_values<type_t, 4>& a) noexcept
+{
+    return minors_4x4<type_t>{
+        {(a[0] * a[5]) - (a[4] * a[1]),
+         (a[0] * a[6]) - (a[4] * a[2]),
+         (a[0] * a[7]) - (a[4] * a[3]),
+         (a[1] * a[6]) - (a[5] * a[2]),
+         (a[1] * a[7]) - (a[5] * a[3]),
+         (a[2] * a[7]) - (a[6] * a[3])},
+        {(a[8] * a[13]) - (a[12] * a[9]),
+         (a[8] * a[14]) - (a[12] * a[10]),
+         (a[8] * a[15]) - (a[12] * a[11]),
+         (a[9] * a[14]) - (a[13] * a[10]),
+         (a[9] * a[15]) - (a[13] * a[11]),
+         (a[10] * a[15]) - (a[14] * a[11])}};
+}
+
+template <typename type_t>
+constexpr type_t determinant_4x4(const minors_4x4<type_t>& m) noexcept
+{
+    return (m.s[0] * m.c[5]) - (m.s[1] * m.c[4]) + (m.s[2] * m.c[3]) + (m.s[3] * m.c[2]) - (m.s[4] * m.c[1]) + (m.s[5] * m.c[0]);
+}
+
+template <typename type_t>
+constexpr square_values<type_t, 4> adjugate_4x4(const square_values<type_t, 4>& a, const minors_4x4<type_t>& m) noexcept
+{
+    const auto& s = m.s;
+    const auto& c = m.c;
+    return square_values<type_t, 4>{
+        (a[5] * c[5]) - (a[6] * c[4]) + (a[7] * c[3]),
+        (-a[1] * c[5]) + (a[2] * c[4]) - (a[3] * c[3]),
+        (a[13] * s[5]) - (a[14] * s[4]) + (a[15] * s[3]),
+        (-a[9] * s[5]) + (a[10] * s[4]) - (a[11] * s[3]),
+
+        (-a[4] * c[5]) + (a[6] * c[2]) - (a[7] * c[1]),
+        (a[0] * c[5]) - (a[2] * c[2]) + (a[3] * c[1]),
+        (-a[12] * s[5]) + (a[14] * s[2]) - (a[15] * s[1]),
+        (a[8] * s[5]) - (a[10] * s[2]) + (a[11] * s[1]),
+
+        (a[4] * c[4]) - (a[5] * c[2]) + (a[7] * c[0]),
+        (-a[0] * c[4]) + (a[1] * c[2]) - (a[3] * c[0]),
+        (a[12] * s[4]) - (a[13] * s[2]) + (a[15] * s[0]),
+        (-a[8] * s[4]) + (a[9] * s[2]) - (a[11] * s[0]),
+
+        (-a[4] * c[3]) + (a[5] * c[1]) - (a[6] * c[0]),
+        (a[0] * c[3]) - (a[1] * c[1]) + (a[2] * c[0]),
+        (-a[12] * s[3]) + (a[13] * s[1]) - (a[14] * s[0]),
+        (a[8] * s[3]) - (a[9] * s[1]) + (a[10] * s[0])};
+}
+
+// Solve A x = b by Gaussian elimination with partial pivoting. Returns false when
+// a pivot is exactly zero (singular matrix); x is unspecified in that case.
+template <typename type_t, std::size_t n_v>
+constexpr bool solve_values(square_values<type_t, n_v> a, std::array<type_t, n_v> b, std::array<type_t, n_v>& x) noexcept
+{
+    for (std::size_t col = 0; col < n_v; ++col)
+    {
+        std::size_t pivot = col;
+        type_t best = a[(col * n_v) + col] < type_t{0} ? -a[(col * n_v) + col] : a[(col * n_v) + col];
+        for (std::size_t r = col + 1; r < n_v; ++r)
+        {
+            const type_t v = a[(r * n_v) + col] < type_t{0} ? -a[(r * n_v) + col] : a[(r * n_v) + col];
+            if (v > best)
+            {
+                best = v;
+                pivot = r;
+            }
+        }
+        if (best == type_t{0})
+        {
+            return false;
+        }
+        if (pivot != col)
+        {
+            for (std::size_t j = 0; j < n_v; ++j)
+            {
+                const type_t tmp = a[(col * n_v) + j];
+                a[(col * n_v) + j] = a[(pivot * n_v) + j];
+                a[(pivot * n_v) + j] = tmp;
+            }
+            const type_t tmp = b[col];
+            b[col] = b[pivot];
+            b[pivot] = tmp;
+        }
+        for (std::size_t r = col + 1; r < n_v; ++r)
+        {
+            const type_t factor = a[(r * n_v) + col] / a[(col * n_v) + col];
+            for (std::size_t j = col; j < n_v; ++j)
+            {
+                a[(r * n_v) + j] -= factor * a[(col * n_v) + j];
+            }
+            b[r] -= factor * b[col];
+        }
+    }
+    for (std::size_t i = n_v; i-- > 0;)
+    {
+        type_t sum = b[i];
+        for (std::size_t j = i + 1; j < n_v; ++j)
+        {
+            sum -= a[(i * n_v) + j] * x[j];
+        }
+        x[i] = sum / a[(i * n_v) + i];
+    }
+    return true;
+}
+
+// ============================================================================
+// Streaming 4x4 transform over structure-of-arrays columns
+// ============================================================================
+// out = M (x, y, z, w) for n points held as four separate columns. Each SIMD
+// lane holds one point, so no shuffles are needed: the matrix entries are
+// broadcast once and the loop is a stream of multiplies and adds in the same
+// pairwise order as multiply_4x4_vector. With affine_v the last row of M is
+// (0, 0, 0, 1) and ow is not touched; the caller copies w if it needs to.
+// Output columns may alias the matching input columns (in-place transform).
+template <bool affine_v, typename type_t>
+void transform_4x4_columns(
+    const square_values<type_t, 4>& m,
+    const type_t* x,
+    const type_t* y,
+    const type_t* z,
+    const type_t* w,
+    type_t* ox,
+    type_t* oy,
+    type_t* oz,
+    type_t* ow,
+    std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#if defined(PKR_UNITS_SIMD_AVX)
+    if constexpr (std::is_same_v<type_t, double>)
+    {
+        const auto row = [&m](std::size_t r, __m256d vx, __m256d vy, __m256d vz, __m256d vw)
+        {
+            const __m256d lo = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(m[(r * 4) + 0]), vx), _mm256_mul_pd(_mm256_set1_pd(m[(r * 4) + 1]), vy));
+            const __m256d hi = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(m[(r * 4) + 2]), vz), _mm256_mul_pd(_mm256_set1_pd(m[(r * 4) + 3]), vw));
+            return _mm256_add_pd(lo, hi);
+        };
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m256d vx = _mm256_loadu_pd(x + i);
+            const __m256d vy = _mm256_loadu_pd(y + i);
+            const __m256d vz = _mm256_loadu_pd(z + i);
+            const __m256d vw = _mm256_loadu_pd(w + i);
+            _mm256_storeu_pd(ox + i, row(0, vx, vy, vz, vw));
+            _mm256_storeu_pd(oy + i, row(1, vx, vy, vz, vw));
+            _mm256_storeu_pd(oz + i, row(2, vx, vy, vz, vw));
+            if constexpr (!affine_v)
+            {
+                _mm256_storeu_pd(ow + i, row(3, vx, vy, vz, vw));
+            }
+        }
+    }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+    if constexpr (std::is_same_v<type_t, double>)
+    {
+        const auto row = [&m](std::size_t r, __m128d vx, __m128d vy, __m128d vz, __m128d vw)
+        {
+            const __m128d lo = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(m[(r * 4) + 0]), vx), _mm_mul_pd(_mm_set1_pd(m[(r * 4) + 1]), vy));
+            const __m128d hi = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(m[(r * 4) + 2]), vz), _mm_mul_pd(_mm_set1_pd(m[(r * 4) + 3]), vw));
+            return _mm_add_pd(lo, hi);
+        };
+        for (; i + 2 <= n; i += 2)
+        {
+            const __m128d vx = _mm_loadu_pd(x + i);
+            const __m128d vy = _mm_loadu_pd(y + i);
+            const __m128d vz = _mm_loadu_pd(z + i);
+            const __m128d vw = _mm_loadu_pd(w + i);
+            _mm_storeu_pd(ox + i, row(0, vx, vy, vz, vw));
+            _mm_storeu_pd(oy + i, row(1, vx, vy, vz, vw));
+            _mm_storeu_pd(oz + i, row(2, vx, vy, vz, vw));
+            if constexpr (!affine_v)
+            {
+                _mm_storeu_pd(ow + i, row(3, vx, vy, vz, vw));
+            }
+        }
+    }
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        const auto row = [&m](std::size_t r, __m128 vx, __m128 vy, __m128 vz, __m128 vw)
+        {
+            const __m128 lo = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[(r * 4) + 0]), vx), _mm_mul_ps(_mm_set1_ps(m[(r * 4) + 1]), vy));
+            const __m128 hi = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[(r * 4) + 2]), vz), _mm_mul_ps(_mm_set1_ps(m[(r * 4) + 3]), vw));
+            return _mm_add_ps(lo, hi);
+        };
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 vx = _mm_loadu_ps(x + i);
+            const __m128 vy = _mm_loadu_ps(y + i);
+            const __m128 vz = _mm_loadu_ps(z + i);
+            const __m128 vw = _mm_loadu_ps(w + i);
+            _mm_storeu_ps(ox + i, row(0, vx, vy, vz, vw));
+            _mm_storeu_ps(oy + i, row(1, vx, vy, vz, vw));
+            _mm_storeu_ps(oz + i, row(2, vx, vy, vz, vw));
+            if constexpr (!affine_v)
+            {
+                _mm_storeu_ps(ow + i, row(3, vx, vy, vz, vw));
+            }
+        }
+    }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        const auto row = [&m](std::size_t r, float32x4_t vx, float32x4_t vy, float32x4_t vz, float32x4_t vw)
+        {
+            const float32x4_t lo = vaddq_f32(vmulq_n_f32(vx, m[(r * 4) + 0]), vmulq_n_f32(vy, m[(r * 4) + 1]));
+            const float32x4_t hi = vaddq_f32(vmulq_n_f32(vz, m[(r * 4) + 2]), vmulq_n_f32(vw, m[(r * 4) + 3]));
+            return vaddq_f32(lo, hi);
+        };
+        for (; i + 4 <= n; i += 4)
+        {
+            const float32x4_t vx = vld1q_f32(x + i);
+            const float32x4_t vy = vld1q_f32(y + i);
+            const float32x4_t vz = vld1q_f32(z + i);
+            const float32x4_t vw = vld1q_f32(w + i);
+            vst1q_f32(ox + i, row(0, vx, vy, vz, vw));
+            vst1q_f32(oy + i, row(1, vx, vy, vz, vw));
+            vst1q_f32(oz + i, row(2, vx, vy, vz, vw));
+            if constexpr (!affine_v)
+            {
+                vst1q_f32(ow + i, row(3, vx, vy, vz, vw));
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        const type_t px = x[i];
+        const type_t py = y[i];
+        const type_t pz = z[i];
+        const type_t pw = w[i];
+        ox[i] = ((m[0] * px) + (m[1] * py)) + ((m[2] * pz) + (m[3] * pw));
+        oy[i] = ((m[4] * px) + (m[5] * py)) + ((m[6] * pz) + (m[7] * pw));
+        oz[i] = ((m[8] * px) + (m[9] * py)) + ((m[10] * pz) + (m[11] * pw));
+        if constexpr (!affine_v)
+        {
+            ow[i] = ((m[12] * px) + (m[13] * py)) + ((m[14] * pz) + (m[15] * pw));
+        }
+    }
+}
+
+// ============================================================================
+// Cache-blocked GEMM for N x M matrices
+// ============================================================================
+//
+// C += A B on raw row-major values of any size. The k and j loops are tiled so
+// one gemm_block_inner x gemm_block_cols panel of B (256 KiB of double) stays
+// in L2 while every row of A streams past it; the innermost loop is a row
+// update c[j..] += a_ik * b[k, j..] with unit stride in B and C. Within each
+// C element the k contributions are still added in increasing k, so the
+// result matches the plain triple loop bit for bit.
+
+inline constexpr std::size_t gemm_block_inner = 128;
+inline constexpr std::size_t gemm_block_cols = 256;
+
+// y[0, n) += alpha * x[0, n)
+template <typename type_t>
+constexpr void axpy_row(type_t alpha, const type_t* x, type_t* y, std::size_t n) noexcept
+{
+    std::size_t j = 0;
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            const __m256d va = _mm256_set1_pd(alpha);
+            for (; j + 4 <= n; j += 4)
+            {
+                _mm256_storeu_pd(y + j, _mm256_add_pd(_mm256_loadu_pd(y + j), _mm256_mul_pd(va, _mm256_loadu_pd(x + j))));
+            }
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            const __m128d va = _mm_set1_pd(alpha);
+            for (; j + 2 <= n; j += 2)
+            {
+                _mm_storeu_pd(y + j, _mm_add_pd(_mm_loadu_pd(y + j), _mm_mul_pd(va, _mm_loadu_pd(x + j))));
+            }
+        }
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            const __m128 va = _mm_set1_ps(alpha);
+            for (; j + 4 <= n; j += 4)
+            {
+                _mm_storeu_ps(y + j, _mm_add_ps(_mm_loadu_ps(y + j), _mm_mul_ps(va, _mm_loadu_ps(x + j))));
+            }
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            for (; j + 4 <= n; j += 4)
+            {
+                vst1q_f32(y + j, vaddq_f32(vld1q_f32(y + j), vmulq_n_f32(vld1q_f32(x + j), alpha)));
+            }
+        }
+#endif
+    }
+    for (; j < n; ++j)
+    {
+        y[j] += alpha * x[j];
+    }
+}
+
+// C (n x m) += A (n x p) * B (p x m)
+template <typename type_t>
+constexpr void gemm_blocked(const type_t* a, const type_t* b, type_t* c, std::size_t n, std::size_t p, std::size_t m) noexcept
+{
+    for (std::size_t k0 = 0; k0 < p; k0 += gemm_block_inner)
+    {
+        const std::size_t k1 = k0 + gemm_block_inner < p ? k0 + gemm_block_inner : p;
+        for (std::size_t j0 = 0; j0 < m; j0 += gemm_block_cols)
+        {
+            const std::size_t width = j0 + gemm_block_cols < m ? gemm_block_cols : m - j0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                type_t* c_row = c + (i * m) + j0;
+                for (std::size_t k = k0; k < k1; ++k)
+                {
+                    axpy_row(a[(i * p) + k], b + (k * m) + j0, c_row, width);
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Packing between unit matrices and raw SI values
+// ============================================================================
+// matrix_t is any square unit matrix with operator()(row, col)
+template <std::size_t n_v, typename matrix_t>
+constexpr auto unpack_si_values(const matrix_t& m) noexcept
+{
+    using unit_u = std::remove_cvref_t<decltype(m(0, 0))>;
+    using traits = is_pkr_unit<unit_u>;
+    using type_t = typename traits::value_type;
+    square_values<type_t, n_v> v{};
+    for (std::size_t i = 0; i < n_v; ++i)
+    {
+        for (std::size_t j = 0; j < n_v; ++j)
+        {
+            v[(i * n_v) + j] = convert_ratio_to<type_t, typename traits::ratio_type, std::ratio<1, 1>>(m(i, j).value());
+        }
+    }
+    return v;
+}
+
+template <typename unit_u, std::size_t n_v, typename type_t, std::size_t... col_v>
+constexpr std::array<unit_u, n_v> pack_si_row(const square_values<type_t, n_v>& v, std::size_t row, std::index_sequence<col_v...>) noexcept
+{
+    using traits = is_pkr_unit<unit_u>;
+    return std::array<unit_u, n_v>{unit_u{convert_ratio_to<type_t, std::ratio<1, 1>, typename traits::ratio_type>(v[(row * n_v) + col_v])}...};
+}
+
+template <typename unit_u, std::size_t n_v, typename type_t, std::size_t... row_v>
+constexpr std::array<std::array<unit_u, n_v>, n_v> pack_si_rows(const square_values<type_t, n_v>& v, std::index_sequence<row_v...>) noexcept
+{
+    return std::array<std::array<unit_u, n_v>, n_v>{pack_si_row<unit_u, n_v>(v, row_v, std::make_index_sequence<n_v>{})...};
+}
+
+// Row-major SI values to the nested element array of a unit matrix
+template <typename unit_u, std::size_t n_v, typename type_t>
+constexpr std::array<std::array<unit_u, n_v>, n_v> pack_si_values(const square_values<type_t, n_v>& v) noexcept
+{
+    return pack_si_rows<unit_u, n_v>(v, std::make_index_sequence<n_v>{});
+}
+
+} // namespace details
+} // namespace PKR_UNITS_NAMESPACE
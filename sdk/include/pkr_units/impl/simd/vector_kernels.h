@@ -0,0 +1,417 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cmath>
+#include <concepts>
+#include <type_traits>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+namespace details
+{
+
+// ============================================================================
+// Four-lane vector kernels
+// ============================================================================
+//
+// simd_lanes holds one small vector in a single register-sized, register-aligned
+// block: 32 bytes for double (one AVX register or two SSE2 registers) and 16
+// bytes for float (one SSE or NEON register). 3D vectors keep lane 3 at zero so
+// the same four-lane add, scale and dot serve both sizes. Horizontal sums are
+// always (l0 + l2) + (l1 + l3), the order the SIMD reductions produce, so every
+// path returns the same bits.
+
+template <std::floating_point type_t>
+struct alignas(4 * sizeof(type_t)) simd_lanes
+{
+    std::array<type_t, 4> v;
+};
+
+template <std::floating_point type_t>
+constexpr simd_lanes<type_t> lanes_add(const simd_lanes<type_t>& a, const simd_lanes<type_t>& b) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            _mm256_store_pd(r.v.data(), _mm256_add_pd(_mm256_load_pd(a.v.data()), _mm256_load_pd(b.v.data())));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            _mm_store_pd(&r.v[0], _mm_add_pd(_mm_load_pd(&a.v[0]), _mm_load_pd(&b.v[0])));
+            _mm_store_pd(&r.v[2], _mm_add_pd(_mm_load_pd(&a.v[2]), _mm_load_pd(&b.v[2])));
+            return r;
+        }
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            _mm_store_ps(r.v.data(), _mm_add_ps(_mm_load_ps(a.v.data()), _mm_load_ps(b.v.data())));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            vst1q_f32(r.v.data(), vaddq_f32(vld1q_f32(a.v.data()), vld1q_f32(b.v.data())));
+            return r;
+        }
+#endif
+    }
+    return simd_lanes<type_t>{{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+}
+
+template <std::floating_point type_t>
+constexpr simd_lanes<type_t> lanes_sub(const simd_lanes<type_t>& a, const simd_lanes<type_t>& b) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            _mm256_store_pd(r.v.data(), _mm256_sub_pd(_mm256_load_pd(a.v.data()), _mm256_load_pd(b.v.data())));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            _mm_store_pd(&r.v[0], _mm_sub_pd(_mm_load_pd(&a.v[0]), _mm_load_pd(&b.v[0])));
+            _mm_store_pd(&r.v[2], _mm_sub_pd(_mm_load_pd(&a.v[2]), _mm_load_pd(&b.v[2])));
+            return r;
+        }
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            _mm_store_ps(r.v.data(), _mm_sub_ps(_mm_load_ps(a.v.data()), _mm_load_ps(b.v.data())));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            vst1q_f32(r.v.data(), vsubq_f32(vld1q_f32(a.v.data()), vld1q_f32(b.v.data())));
+            return r;
+        }
+#endif
+    }
+    return simd_lanes<type_t>{{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+}
+
+template <std::floating_point type_t>
+constexpr simd_lanes<type_t> lanes_scale(const simd_lanes<type_t>& a, type_t s) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            _mm256_store_pd(r.v.data(), _mm256_mul_pd(_mm256_load_pd(a.v.data()), _mm256_set1_pd(s)));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            const __m128d vs = _mm_set1_pd(s);
+            _mm_store_pd(&r.v[0], _mm_mul_pd(_mm_load_pd(&a.v[0]), vs));
+            _mm_store_pd(&r.v[2], _mm_mul_pd(_mm_load_pd(&a.v[2]), vs));
+            return r;
+        }
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            _mm_store_ps(r.v.data(), _mm_mul_ps(_mm_load_ps(a.v.data()), _mm_set1_ps(s)));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            vst1q_f32(r.v.data(), vmulq_n_f32(vld1q_f32(a.v.data()), s));
+            return r;
+        }
+#endif
+    }
+    return simd_lanes<type_t>{{a.v[0] * s, a.v[1] * s, a.v[2] * s, a.v[3] * s}};
+}
+
+template <std::floating_point type_t>
+constexpr type_t lanes_dot(const simd_lanes<type_t>& a, const simd_lanes<type_t>& b) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            const __m256d p = _mm256_mul_pd(_mm256_load_pd(a.v.data()), _mm256_load_pd(b.v.data()));
+            const __m128d s = _mm_add_pd(_mm256_castpd256_pd128(p), _mm256_extractf128_pd(p, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            const __m128d lo = _mm_mul_pd(_mm_load_pd(&a.v[0]), _mm_load_pd(&b.v[0]));
+            const __m128d hi = _mm_mul_pd(_mm_load_pd(&a.v[2]), _mm_load_pd(&b.v[2]));
+            const __m128d s = _mm_add_pd(lo, hi);
+            return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            const __m128 p = _mm_mul_ps(_mm_load_ps(a.v.data()), _mm_load_ps(b.v.data()));
+            const __m128 s = _mm_add_ps(p, _mm_movehl_ps(p, p));
+            return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            const float32x4_t p = vmulq_f32(vld1q_f32(a.v.data()), vld1q_f32(b.v.data()));
+            const float32x2_t s = vadd_f32(vget_low_f32(p), vget_high_f32(p));
+            return vget_lane_f32(vpadd_f32(s, s), 0);
+        }
+#endif
+    }
+    return ((a.v[0] * b.v[0]) + (a.v[2] * b.v[2])) + ((a.v[1] * b.v[1]) + (a.v[3] * b.v[3]));
+}
+
+template <std::floating_point type_t>
+constexpr simd_lanes<type_t> lanes_mul(const simd_lanes<type_t>& a, const simd_lanes<type_t>& b) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_AVX)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            _mm256_store_pd(r.v.data(), _mm256_mul_pd(_mm256_load_pd(a.v.data()), _mm256_load_pd(b.v.data())));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, double>)
+        {
+            simd_lanes<double> r;
+            _mm_store_pd(&r.v[0], _mm_mul_pd(_mm_load_pd(&a.v[0]), _mm_load_pd(&b.v[0])));
+            _mm_store_pd(&r.v[2], _mm_mul_pd(_mm_load_pd(&a.v[2]), _mm_load_pd(&b.v[2])));
+            return r;
+        }
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            _mm_store_ps(r.v.data(), _mm_mul_ps(_mm_load_ps(a.v.data()), _mm_load_ps(b.v.data())));
+            return r;
+        }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            simd_lanes<float> r;
+            vst1q_f32(r.v.data(), vmulq_f32(vld1q_f32(a.v.data()), vld1q_f32(b.v.data())));
+            return r;
+        }
+#endif
+    }
+    return simd_lanes<type_t>{{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+}
+
+// sqrt(a^2 + b^2) per lane: the root-sum-square of two independent
+// uncertainties, one vector sqrt for all four components. Not constexpr
+// because std::sqrt is not.
+template <std::floating_point type_t>
+inline simd_lanes<type_t> lanes_rss(const simd_lanes<type_t>& a, const simd_lanes<type_t>& b) noexcept
+{
+#if defined(PKR_UNITS_SIMD_AVX)
+    if constexpr (std::is_same_v<type_t, double>)
+    {
+        const __m256d va = _mm256_load_pd(a.v.data());
+        const __m256d vb = _mm256_load_pd(b.v.data());
+        simd_lanes<double> r;
+        _mm256_store_pd(r.v.data(), _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(va, va), _mm256_mul_pd(vb, vb))));
+        return r;
+    }
+#endif
+#if defined(PKR_UNITS_SIMD_SSE2)
+    if constexpr (std::is_same_v<type_t, double>)
+    {
+        simd_lanes<double> r;
+        for (std::size_t k = 0; k < 4; k += 2)
+        {
+            const __m128d va = _mm_load_pd(&a.v[k]);
+            const __m128d vb = _mm_load_pd(&b.v[k]);
+            _mm_store_pd(&r.v[k], _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(va, va), _mm_mul_pd(vb, vb))));
+        }
+        return r;
+    }
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        const __m128 va = _mm_load_ps(a.v.data());
+        const __m128 vb = _mm_load_ps(b.v.data());
+        simd_lanes<float> r;
+        _mm_store_ps(r.v.data(), _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(va, va), _mm_mul_ps(vb, vb))));
+        return r;
+    }
+#endif
+    simd_lanes<type_t> r;
+    for (std::size_t k = 0; k < 4; ++k)
+    {
+        r.v[k] = std::sqrt((a.v[k] * a.v[k]) + (b.v[k] * b.v[k]));
+    }
+    return r;
+}
+
+// Lane rotations used by the cross product: (y, z, x, w) and (z, x, y, w)
+template <std::floating_point type_t>
+constexpr simd_lanes<type_t> lanes_yzx(const simd_lanes<type_t>& a) noexcept
+{
+    return simd_lanes<type_t>{{a.v[1], a.v[2], a.v[0], a.v[3]}};
+}
+
+template <std::floating_point type_t>
+constexpr simd_lanes<type_t> lanes_zxy(const simd_lanes<type_t>& a) noexcept
+{
+    return simd_lanes<type_t>{{a.v[2], a.v[0], a.v[1], a.v[3]}};
+}
+
+// Cross product of the first three lanes; lane 3 of the result is zero when
+// lane 3 of both inputs is zero. For double the shuffles would cross the two
+// 128-bit halves, which costs more than the six scalar multiplies.
+template <std::floating_point type_t>
+constexpr simd_lanes<type_t> lanes_cross(const simd_lanes<type_t>& a, const simd_lanes<type_t>& b) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+#if defined(PKR_UNITS_SIMD_SSE2)
+        if constexpr (std::is_same_v<type_t, float>)
+        {
+            // a x b = (a * b.yzx - a.yzx * b).yzx
+            constexpr int yzx = _MM_SHUFFLE(3, 0, 2, 1);
+            const __m128 va = _mm_load_ps(a.v.data());
+            const __m128 vb = _mm_load_ps(b.v.data());
+            const __m128 c = _mm_sub_ps(_mm_mul_ps(va, _mm_shuffle_ps(vb, vb, yzx)), _mm_mul_ps(_mm_shuffle_ps(va, va, yzx), vb));
+            simd_lanes<float> r;
+            _mm_store_ps(r.v.data(), _mm_shuffle_ps(c, c, yzx));
+            return r;
+        }
+#endif
+    }
+    return simd_lanes<type_t>{
+        {(a.v[1] * b.v[2]) - (a.v[2] * b.v[1]), (a.v[2] * b.v[0]) - (a.v[0] * b.v[2]), (a.v[0] * b.v[1]) - (a.v[1] * b.v[0]), type_t{0}}};
+}
+
+// 1 / sqrt(s). For float the hardware estimate (about 12 bits) is refined with
+// one Newton step, y' = y (1.5 - 0.5 s y^2), to within a few ulp of the exact
+// value; double uses the correctly rounded sqrt and a divide. The estimate
+// flushes denormals and yields garbage for 0, inf and NaN, so only a normal s
+// takes it; anything else goes through std::sqrt.
+template <std::floating_point type_t>
+inline type_t reciprocal_sqrt(type_t s) noexcept
+{
+#if defined(PKR_UNITS_SIMD_SSE2)
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        if (std::isnormal(s))
+        {
+            const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(s)));
+            return y * (1.5f - (0.5f * s * y * y));
+        }
+    }
+#endif
+#if defined(PKR_UNITS_SIMD_NEON)
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        if (std::isnormal(s))
+        {
+            const float32x2_t vs = vdup_n_f32(s);
+            float32x2_t y = vrsqrte_f32(vs);
+            y = vmul_f32(y, vrsqrts_f32(vmul_f32(vs, y), y));
+            return vget_lane_f32(y, 0);
+        }
+    }
+#endif
+    return type_t{1} / std::sqrt(s);
+}
+
+// sqrt(s) as s / sqrt(s) for a normal float, so it shares the rsqrt estimate;
+// zero, denormal, inf and NaN use std::sqrt
+template <std::floating_point type_t>
+inline type_t fast_sqrt(type_t s) noexcept
+{
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        if (std::isnormal(s))
+        {
+            return s * reciprocal_sqrt(s);
+        }
+    }
+    return std::sqrt(s);
+}
+
+// Sum of squares of float lanes in double, where the square of any finite float
+// is normal and finite
+inline double wide_dot(const simd_lanes<float>& a) noexcept
+{
+    double s = 0.0;
+    for (float x : a.v)
+    {
+        s += static_cast<double>(x) * static_cast<double>(x);
+    }
+    return s;
+}
+
+// |a| over all four lanes. A float sum of squares that underflowed to a
+// denormal or overflowed to inf while the components are finite is redone in
+// double; NaN stays NaN.
+template <std::floating_point type_t>
+inline type_t lanes_length(const simd_lanes<type_t>& a) noexcept
+{
+    const type_t s = lanes_dot(a, a);
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        if (s != 0.0f && !std::isnormal(s))
+        {
+            return static_cast<float>(std::sqrt(wide_dot(a)));
+        }
+    }
+    return fast_sqrt(s);
+}
+
+// a / |a| given s = lanes_dot(a, a) != 0, with the same double fallback for a
+// float s that is not normal
+template <std::floating_point type_t>
+inline simd_lanes<type_t> lanes_normalized(const simd_lanes<type_t>& a, type_t s) noexcept
+{
+    if constexpr (std::is_same_v<type_t, float>)
+    {
+        if (!std::isnormal(s))
+        {
+            const double inverse = 1.0 / std::sqrt(wide_dot(a));
+            simd_lanes<float> r;
+            for (std::size_t i = 0; i < r.v.size(); ++i)
+            {
+                r.v[i] = static_cast<float>(static_cast<double>(a.v[i]) * inverse);
+            }
+            return r;
+        }
+    }
+    return lanes_scale(a, reciprocal_sqrt(s));
+}
+
+} // namespace details
+} // namespace PKR_UNITS_NAMESPACE
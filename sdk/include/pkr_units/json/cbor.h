@@ -0,0 +1,1121 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pkr_units/expected.h>
+#include <pkr_units/json/json_stream.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/parsing/unit_info.h>
+
+// ============================================================================
+// CBOR encoding for arrays and series (RFC 8949, typed arrays per RFC 8746)
+// ============================================================================
+//
+// The binary counterpart of json_stream.h. A document is one CBOR map. The
+// unit is described once, and all samples follow as one packed typed array:
+//
+//   {
+//     "dim":    [9 exponents, dimension_t member order],
+//     "ratio":  [num, den],
+//     "scale":  coherent SI value = value * scale + offset  (carries the unit tag,
+//     "offset": e.g. the celsius / fahrenheit offsets)
+//     "symbol": "m",
+//     "layout": "interleaved" | "columnar"      measurements only
+//     "time":   { dim, ratio, scale, offset, symbol, values }    series only
+//     "values": typed array (float32/float64/sint32/sint64, LE or native)
+//     "uncertainties": typed array              columnar measurements only
+//   }
+//
+// Interleaved measurements store value,uncertainty pairs in "values". Every
+// typed array is preceded by a short padding entry so that its payload starts
+// 8-byte aligned relative to the start of the document. With an aligned buffer,
+// native byte order and the target's own unit, view() then returns the samples
+// in place without copying.
+//
+// Decoding validates the dimension against the target type and converts from
+// the stored scale and offset. Unknown map entries are skipped.
+
+namespace PKR_UNITS_NAMESPACE::cbor
+{
+
+enum class byte_order
+{
+    little, // Portable: little-endian regardless of the host
+    native, // Host byte order; no swapping on either side of a same-endian link
+};
+
+enum class measurement_layout
+{
+    interleaved, // value0, uncertainty0, value1, uncertainty1, ...
+    columnar,    // all values, then all uncertainties
+};
+
+struct options
+{
+    byte_order order = byte_order::little;
+    measurement_layout layout = measurement_layout::interleaved;
+};
+
+enum class error_code
+{
+    malformed,          // Not a well-formed document of this format
+    truncated,          // Input ends inside an item
+    unsupported,        // Valid CBOR that this decoder does not handle (indefinite lengths, other element types)
+    dimension_mismatch, // Stored dimension differs from the target type's
+    layout_mismatch,    // Unit data decoded as measurements or the other way round, or series without "time"
+    not_viewable,       // view(): buffer misaligned, foreign byte order, element type or unit differ
+};
+
+struct error
+{
+    error_code code;
+    std::size_t offset; // Byte offset of the offending item
+};
+
+/// Decoded series: one time and one sample per index
+template <typename TimeT, typename ElementT>
+struct series_t
+{
+    std::vector<TimeT> time;
+    std::vector<ElementT> values;
+};
+
+namespace details
+{
+
+using json::details::element_columns;
+using json::details::element_unit_t;
+using json::details::stream_element_c;
+
+inline constexpr std::size_t payload_alignment = 8;
+inline constexpr std::size_t max_nesting = 16;
+
+enum class major_type : std::uint8_t
+{
+    unsigned_integer = 0,
+    negative_integer = 1,
+    byte_string = 2,
+    text_string = 3,
+    array = 4,
+    map = 5,
+    tag = 6,
+    simple = 7,
+};
+
+// ----------------------------------------------------------------------------
+// Typed array element kinds (RFC 8746 tag = 0b010_f_s_e_ll)
+// ----------------------------------------------------------------------------
+
+enum class element_kind : std::uint8_t
+{
+    sint32,
+    sint64,
+    float32,
+    float64,
+};
+
+constexpr std::size_t element_size(element_kind kind) noexcept
+{
+    return kind == element_kind::sint32 || kind == element_kind::float32 ? 4 : 8;
+}
+
+constexpr std::uint64_t typed_array_tag(element_kind kind, bool little_endian) noexcept
+{
+    const std::uint64_t endian = little_endian ? 0b100 : 0;
+    switch (kind)
+    {
+    case element_kind::sint32:
+        return 0b0100'0000 | 0b1000 | endian | 2;
+    case element_kind::sint64:
+        return 0b0100'0000 | 0b1000 | endian | 3;
+    case element_kind::float32:
+        return 0b0100'0000 | 0b1'0000 | endian | 1;
+    case element_kind::float64:
+    default:
+        return 0b0100'0000 | 0b1'0000 | endian | 2;
+    }
+}
+
+struct typed_array_format
+{
+    element_kind kind;
+    bool little_endian;
+};
+
+constexpr bool decode_typed_array_tag(std::uint64_t tag, typed_array_format& format) noexcept
+{
+    if ((tag & ~std::uint64_t{0b1'1111}) != 0b0100'0000)
+    {
+        return false;
+    }
+    const bool is_float = (tag & 0b1'0000) != 0;
+    const bool is_signed = (tag & 0b1000) != 0;
+    const std::uint64_t size_code = tag & 0b11;
+    format.little_endian = (tag & 0b100) != 0;
+    if (is_float && !is_signed && size_code == 1)
+    {
+        format.kind = element_kind::float32;
+    }
+    else if (is_float && !is_signed && size_code == 2)
+    {
+        format.kind = element_kind::float64;
+    }
+    else if (!is_float && is_signed && size_code == 2)
+    {
+        format.kind = element_kind::sint32;
+    }
+    else if (!is_float && is_signed && size_code == 3)
+    {
+        format.kind = element_kind::sint64;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+template <typename ValueT>
+constexpr element_kind element_kind_of() noexcept
+{
+    static_assert(std::is_arithmetic_v<ValueT> && (sizeof(ValueT) == 4 || sizeof(ValueT) == 8), "cbor: unit value types must be 32 or 64 bit numbers");
+    if constexpr (std::is_floating_point_v<ValueT>)
+    {
+        return sizeof(ValueT) == 4 ? element_kind::float32 : element_kind::float64;
+    }
+    else
+    {
+        return sizeof(ValueT) == 4 ? element_kind::sint32 : element_kind::sint64;
+    }
+}
+
+template <typename UIntT>
+constexpr UIntT byte_swap(UIntT value) noexcept
+{
+    UIntT result = 0;
+    for (std::size_t i = 0; i < sizeof(UIntT); ++i)
+    {
+        result = static_cast<UIntT>((result << 8) | (value & 0xFF));
+        value = static_cast<UIntT>(value >> 8);
+    }
+    return result;
+}
+
+template <std::size_t size_v>
+using uint_of_size = std::conditional_t<size_v == 4, std::uint32_t, std::uint64_t>;
+
+// ----------------------------------------------------------------------------
+// Writer
+// ----------------------------------------------------------------------------
+
+template <typename OutputIt>
+struct byte_sink
+{
+    OutputIt out;
+    std::size_t size = 0;
+
+    void put(std::uint8_t byte)
+    {
+        *out++ = static_cast<std::byte>(byte);
+        ++size;
+    }
+
+    void head(major_type major, std::uint64_t argument)
+    {
+        const auto type_bits = static_cast<std::uint8_t>(static_cast<std::uint8_t>(major) << 5);
+        if (argument < 24)
+        {
+            put(static_cast<std::uint8_t>(type_bits | argument));
+            return;
+        }
+        int bytes = 8;
+        std::uint8_t additional = 27;
+        if (argument <= 0xFF)
+        {
+            bytes = 1;
+            additional = 24;
+        }
+        else if (argument <= 0xFFFF)
+        {
+            bytes = 2;
+            additional = 25;
+        }
+        else if (argument <= 0xFFFF'FFFF)
+        {
+            bytes = 4;
+            additional = 26;
+        }
+        put(static_cast<std::uint8_t>(type_bits | additional));
+        for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8)
+        {
+            put(static_cast<std::uint8_t>(argument >> shift));
+        }
+    }
+
+    void integer(std::int64_t value)
+    {
+        if (value >= 0)
+        {
+            head(major_type::unsigned_integer, static_cast<std::uint64_t>(value));
+        }
+        else
+        {
+            head(major_type::negative_integer, static_cast<std::uint64_t>(-1 - value));
+        }
+    }
+
+    void text(std::string_view value)
+    {
+        head(major_type::text_string, value.size());
+        for (char c : value)
+        {
+            put(static_cast<std::uint8_t>(c));
+        }
+    }
+
+    void float64(double value)
+    {
+        put(0xFB);
+        const auto bits = std::bit_cast<std::uint64_t>(value);
+        for (int shift = 56; shift >= 0; shift -= 8)
+        {
+            put(static_cast<std::uint8_t>(bits >> shift));
+        }
+    }
+
+    // A "_x": h'00..' entry sized so that the payload of the typed array written
+    // right after it, under key `key`, starts on payload_alignment
+    void padding(std::string_view pad_key, std::string_view key, std::size_t payload_bytes, bool tag_is_one_byte_argument)
+    {
+        const auto head_size = [](std::uint64_t argument) -> std::size_t
+        {
+            return argument < 24 ? 1 : argument <= 0xFF ? 2 : argument <= 0xFFFF ? 3 : argument <= 0xFFFF'FFFF ? 5 : 9;
+        };
+        const std::size_t after_pad = head_size(key.size()) + key.size() + (tag_is_one_byte_argument ? 2 : 1) + head_size(payload_bytes);
+        const std::size_t before_pad = size + head_size(pad_key.size()) + pad_key.size() + 1;
+        const std::size_t length = (payload_alignment - ((before_pad + after_pad) % payload_alignment)) % payload_alignment;
+        text(pad_key);
+        head(major_type::byte_string, length);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            put(0);
+        }
+    }
+
+    template <typename ValueT>
+    void element(ValueT value, bool little_endian)
+    {
+        using bits_t = uint_of_size<sizeof(ValueT)>;
+        auto bits = std::bit_cast<bits_t>(value);
+        if (little_endian != (std::endian::native == std::endian::little))
+        {
+            bits = byte_swap(bits);
+        }
+        std::array<std::uint8_t, sizeof(ValueT)> bytes{};
+        std::memcpy(bytes.data(), &bits, sizeof(ValueT));
+        for (std::uint8_t byte : bytes)
+        {
+            put(byte);
+        }
+    }
+
+    // "key": tag(typed array) h'...' with count values produced by value_at(i)
+    template <typename ValueT, typename ValueAt>
+    void typed_array(std::string_view pad_key, std::string_view key, std::size_t count, bool little_endian, ValueAt value_at)
+    {
+        const std::uint64_t tag = typed_array_tag(element_kind_of<ValueT>(), little_endian);
+        const std::size_t payload = count * sizeof(ValueT);
+        padding(pad_key, key, payload, tag >= 24);
+        text(key);
+        head(major_type::tag, tag);
+        head(major_type::byte_string, payload);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            element<ValueT>(value_at(i), little_endian);
+        }
+    }
+};
+
+inline bool little_endian_for(byte_order order) noexcept
+{
+    return order == byte_order::little || std::endian::native == std::endian::little;
+}
+
+// dim, ratio, scale, offset, symbol
+template <is_pkr_unit_c UnitT, typename OutputIt>
+void write_unit_header(byte_sink<OutputIt>& sink)
+{
+    using traits = PKR_UNITS_NAMESPACE::details::is_pkr_unit<UnitT>;
+    using ratio_type = typename traits::ratio_type;
+    constexpr dimension_t dimension = traits::value_dimension;
+
+    sink.text("dim");
+    sink.head(major_type::array, impl::dimension_members.size());
+    for (auto member : impl::dimension_members)
+    {
+        sink.integer(dimension.*member);
+    }
+    sink.text("ratio");
+    sink.head(major_type::array, 2);
+    sink.integer(static_cast<std::int64_t>(ratio_type::num));
+    sink.integer(static_cast<std::int64_t>(ratio_type::den));
+    sink.text("scale");
+    sink.float64(impl::registry_scale<ratio_type, unit_tag_t<UnitT>>());
+    sink.text("offset");
+    sink.float64(impl::registry_offset<unit_tag_t<UnitT>>());
+    sink.text("symbol");
+    sink.text(UnitT::symbol);
+}
+
+inline constexpr std::size_t unit_header_entries = 5;
+
+// ----------------------------------------------------------------------------
+// Reader
+// ----------------------------------------------------------------------------
+
+struct unit_header
+{
+    bool has_dimension = false;
+    dimension_t dimension{};
+    double scale = 1.0;
+    double offset = 0.0;
+};
+
+struct packed_array
+{
+    bool present = false;
+    typed_array_format format{};
+    const std::byte* data = nullptr;
+    std::size_t count = 0;
+    std::size_t offset = 0; // document offset of the entry, for errors
+};
+
+struct document
+{
+    unit_header unit;
+    packed_array values;
+    packed_array uncertainties;
+    std::string_view layout;
+    bool has_time = false;
+    unit_header time_unit;
+    packed_array time;
+};
+
+class reader
+{
+public:
+    explicit reader(std::span<const std::byte> bytes) noexcept
+        : m_bytes(bytes)
+    {
+    }
+
+    const std::optional<error>& failure() const noexcept
+    {
+        return m_error;
+    }
+
+    bool fail(error_code code)
+    {
+        if (!m_error)
+        {
+            m_error = error{code, m_position};
+        }
+        return false;
+    }
+
+    bool parse(document& doc)
+    {
+        std::size_t entries = 0;
+        if (!map_head(entries))
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < entries; ++i)
+        {
+            std::string_view key;
+            if (!text(key))
+            {
+                return false;
+            }
+            bool ok = true;
+            if (key == "layout")
+            {
+                ok = text(doc.layout);
+            }
+            else if (key == "uncertainties")
+            {
+                ok = typed_array(doc.uncertainties);
+            }
+            else if (key == "time")
+            {
+                doc.has_time = true;
+                ok = parse_time(doc);
+            }
+            else
+            {
+                ok = unit_entry(key, doc.unit, doc.values);
+            }
+            if (!ok)
+            {
+                return false;
+            }
+        }
+        if (m_position != m_bytes.size())
+        {
+            return fail(error_code::malformed);
+        }
+        return true;
+    }
+
+private:
+    bool parse_time(document& doc)
+    {
+        std::size_t entries = 0;
+        if (!map_head(entries))
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < entries; ++i)
+        {
+            std::string_view key;
+            if (!text(key) || !unit_entry(key, doc.time_unit, doc.time))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Entries shared by the document and its "time" map
+    bool unit_entry(std::string_view key, unit_header& unit, packed_array& values)
+    {
+        if (key == "dim")
+        {
+            return dimension(unit);
+        }
+        if (key == "scale")
+        {
+            return number(unit.scale);
+        }
+        if (key == "offset")
+        {
+            return number(unit.offset);
+        }
+        if (key == "values")
+        {
+            return typed_array(values);
+        }
+        return skip(0);
+    }
+
+    bool dimension(unit_header& unit)
+    {
+        std::size_t count = 0;
+        if (!head_of(major_type::array, count))
+        {
+            return false;
+        }
+        if (count != impl::dimension_members.size())
+        {
+            return fail(error_code::malformed);
+        }
+        for (auto member : impl::dimension_members)
+        {
+            std::int64_t exponent = 0;
+            if (!integer(exponent))
+            {
+                return false;
+            }
+            if (exponent < -1000 || exponent > 1000)
+            {
+                return fail(error_code::malformed);
+            }
+            unit.dimension.*member = static_cast<int>(exponent);
+        }
+        unit.has_dimension = true;
+        return true;
+    }
+
+    bool typed_array(packed_array& array)
+    {
+        array.offset = m_position;
+        major_type major{};
+        std::uint64_t tag = 0;
+        if (!head(major, tag))
+        {
+            return false;
+        }
+        if (major != major_type::tag || !decode_typed_array_tag(tag, array.format))
+        {
+            m_position = array.offset;
+            return fail(major == major_type::tag ? error_code::unsupported : error_code::malformed);
+        }
+        std::size_t length = 0;
+        if (!head_of(major_type::byte_string, length))
+        {
+            return false;
+        }
+        if (length > m_bytes.size() - m_position)
+        {
+            return fail(error_code::truncated);
+        }
+        if (length % element_size(array.format.kind) != 0)
+        {
+            return fail(error_code::malformed);
+        }
+        array.present = true;
+        array.data = m_bytes.data() + m_position;
+        array.count = length / element_size(array.format.kind);
+        m_position += length;
+        return true;
+    }
+
+    bool number(double& value)
+    {
+        if (m_position == m_bytes.size())
+        {
+            return fail(error_code::truncated);
+        }
+        const auto initial = std::to_integer<std::uint8_t>(m_bytes[m_position]);
+        if (initial == 0xFB || initial == 0xFA)
+        {
+            const std::size_t size = initial == 0xFB ? 8 : 4;
+            ++m_position;
+            std::uint64_t bits = 0;
+            if (!big_endian(size, bits))
+            {
+                return false;
+            }
+            value = size == 8 ? std::bit_cast<double>(bits) : static_cast<double>(std::bit_cast<float>(static_cast<std::uint32_t>(bits)));
+            return true;
+        }
+        std::int64_t integral = 0;
+        if (!integer(integral))
+        {
+            return false;
+        }
+        value = static_cast<double>(integral);
+        return true;
+    }
+
+    bool integer(std::int64_t& value)
+    {
+        const std::size_t start = m_position;
+        major_type major{};
+        std::uint64_t argument = 0;
+        if (!head(major, argument))
+        {
+            return false;
+        }
+        if ((major != major_type::unsigned_integer && major != major_type::negative_integer) || argument > 0x7FFF'FFFF'FFFF'FFFF)
+        {
+            m_position = start;
+            return fail(error_code::malformed);
+        }
+        value = major == major_type::unsigned_integer ? static_cast<std::int64_t>(argument) : -1 - static_cast<std::int64_t>(argument);
+        return true;
+    }
+
+    bool text(std::string_view& value)
+    {
+        std::size_t length = 0;
+        if (!head_of(major_type::text_string, length))
+        {
+            return false;
+        }
+        if (length > m_bytes.size() - m_position)
+        {
+            return fail(error_code::truncated);
+        }
+        value = std::string_view(reinterpret_cast<const char*>(m_bytes.data() + m_position), length);
+        m_position += length;
+        return true;
+    }
+
+    bool map_head(std::size_t& entries)
+    {
+        return head_of(major_type::map, entries);
+    }
+
+    bool head_of(major_type expected, std::size_t& argument)
+    {
+        const std::size_t start = m_position;
+        major_type major{};
+        std::uint64_t value = 0;
+        if (!head(major, value))
+        {
+            return false;
+        }
+        if (major != expected)
+        {
+            m_position = start;
+            return fail(error_code::malformed);
+        }
+        argument = static_cast<std::size_t>(value);
+        return true;
+    }
+
+    bool head(major_type& major, std::uint64_t& argument)
+    {
+        if (m_position == m_bytes.size())
+        {
+            return fail(error_code::truncated);
+        }
+        const auto initial = std::to_integer<std::uint8_t>(m_bytes[m_position]);
+        major = static_cast<major_type>(initial >> 5);
+        const std::uint8_t additional = initial & 0x1F;
+        if (additional == 31)
+        {
+            return fail(error_code::unsupported);
+        }
+        if (additional > 27)
+        {
+            return fail(error_code::malformed);
+        }
+        ++m_position;
+        if (additional < 24)
+        {
+            argument = additional;
+            return true;
+        }
+        return big_endian(std::size_t{1} << (additional - 24), argument);
+    }
+
+    bool big_endian(std::size_t size, std::uint64_t& value)
+    {
+        if (size > m_bytes.size() - m_position)
+        {
+            return fail(error_code::truncated);
+        }
+        value = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            value = (value << 8) | std::to_integer<std::uint8_t>(m_bytes[m_position++]);
+        }
+        return true;
+    }
+
+    bool skip(std::size_t depth)
+    {
+        if (depth > max_nesting)
+        {
+            return fail(error_code::unsupported);
+        }
+        major_type major{};
+        std::uint64_t argument = 0;
+        if (!head(major, argument))
+        {
+            return false;
+        }
+        switch (major)
+        {
+        case major_type::byte_string:
+        case major_type::text_string:
+            if (argument > m_bytes.size() - m_position)
+            {
+                return fail(error_code::truncated);
+            }
+            m_position += static_cast<std::size_t>(argument);
+            return true;
+        case major_type::array:
+        case major_type::map:
+        {
+            const std::uint64_t items = major == major_type::map ? argument * 2 : argument;
+            for (std::uint64_t i = 0; i < items; ++i)
+            {
+                if (!skip(depth + 1))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case major_type::tag:
+            return skip(depth + 1);
+        default:
+            return true;
+        }
+    }
+
+    std::span<const std::byte> m_bytes;
+    std::size_t m_position = 0;
+    std::optional<error> m_error;
+};
+
+template <typename ValueT>
+ValueT load(const std::byte* data, bool little_endian) noexcept
+{
+    using bits_t = uint_of_size<sizeof(ValueT)>;
+    bits_t bits = 0;
+    std::memcpy(&bits, data, sizeof(ValueT));
+    if (little_endian != (std::endian::native == std::endian::little))
+    {
+        bits = byte_swap(bits);
+    }
+    return std::bit_cast<ValueT>(bits);
+}
+
+inline double load_as_double(const packed_array& array, std::size_t index) noexcept
+{
+    const std::byte* element = array.data + (index * element_size(array.format.kind));
+    switch (array.format.kind)
+    {
+    case element_kind::float32:
+        return static_cast<double>(load<float>(element, array.format.little_endian));
+    case element_kind::sint32:
+        return static_cast<double>(load<std::int32_t>(element, array.format.little_endian));
+    case element_kind::sint64:
+        return static_cast<double>(load<std::int64_t>(element, array.format.little_endian));
+    case element_kind::float64:
+    default:
+        return load<double>(element, array.format.little_endian);
+    }
+}
+
+// The stored unit against TargetUnit: dimension check plus conversion
+template <is_pkr_unit_c TargetUnit>
+auto conversion_for(const unit_header& unit, std::size_t offset) -> expected_t<impl::linear_conversion, error>
+{
+    using traits = PKR_UNITS_NAMESPACE::details::is_pkr_unit<TargetUnit>;
+    constexpr double target_scale = impl::registry_scale<typename traits::ratio_type, unit_tag_t<TargetUnit>>();
+    constexpr double target_offset = impl::registry_offset<unit_tag_t<TargetUnit>>();
+    if (!unit.has_dimension)
+    {
+        return expected_t<impl::linear_conversion, error>{error{error_code::malformed, offset}};
+    }
+    if (unit.dimension != traits::value_dimension)
+    {
+        return expected_t<impl::linear_conversion, error>{error{error_code::dimension_mismatch, offset}};
+    }
+    return expected_t<impl::linear_conversion, error>{impl::linear_conversion{unit.scale / target_scale, (unit.offset - target_offset) / target_scale}};
+}
+
+constexpr bool is_identity(const impl::linear_conversion& map) noexcept
+{
+    return map.scale == 1.0 && map.offset == 0.0;
+}
+
+// Element i of array, in TargetUnit
+template <is_pkr_unit_c TargetUnit>
+TargetUnit load_unit(const packed_array& array, std::size_t index, const impl::linear_conversion& map) noexcept
+{
+    using value_type = typename TargetUnit::value_type;
+    if (is_identity(map) && array.format.kind == element_kind_of<value_type>())
+    {
+        return TargetUnit{load<value_type>(array.data + (index * sizeof(value_type)), array.format.little_endian)};
+    }
+    return TargetUnit{static_cast<value_type>((load_as_double(array, index) * map.scale) + map.offset)};
+}
+
+// Parsed document checked against ElementT: returns the sample count
+template <stream_element_c ElementT>
+auto check_layout(const document& doc, std::size_t document_size) -> expected_t<std::size_t, error>
+{
+    using result_t = expected_t<std::size_t, error>;
+    if (!doc.values.present)
+    {
+        return result_t{error{error_code::malformed, document_size}};
+    }
+    if constexpr (is_pkr_unit_c<ElementT>)
+    {
+        if (!doc.layout.empty())
+        {
+            return result_t{error{error_code::layout_mismatch, doc.values.offset}};
+        }
+        return result_t{doc.values.count};
+    }
+    else
+    {
+        if (doc.layout == "interleaved" && doc.values.count % 2 == 0)
+        {
+            return result_t{doc.values.count / 2};
+        }
+        if (doc.layout == "columnar" && doc.uncertainties.present && doc.uncertainties.count == doc.values.count)
+        {
+            return result_t{doc.values.count};
+        }
+        return result_t{error{doc.layout.empty() ? error_code::layout_mismatch : error_code::malformed, doc.values.offset}};
+    }
+}
+
+template <stream_element_c ElementT>
+auto decode_elements(const document& doc, std::size_t count, std::size_t document_size) -> expected_t<std::vector<ElementT>, error>
+{
+    using result_t = expected_t<std::vector<ElementT>, error>;
+    using unit_type = element_unit_t<ElementT>;
+    auto map = conversion_for<unit_type>(doc.unit, document_size);
+    if (!map)
+    {
+        return result_t{map.error()};
+    }
+
+    std::vector<ElementT> elements;
+    elements.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if constexpr (is_pkr_unit_c<ElementT>)
+        {
+            elements.push_back(load_unit<unit_type>(doc.values, i, *map));
+        }
+        else
+        {
+            // An uncertainty is a difference: it takes the scale but never the offset
+            const impl::linear_conversion spread{map->scale, 0.0};
+            const bool interleaved = doc.layout == "interleaved";
+            const packed_array& spreads = interleaved ? doc.values : doc.uncertainties;
+            elements.push_back(ElementT{load_unit<unit_type>(doc.values, interleaved ? 2 * i : i, *map),
+                                        load_unit<unit_type>(spreads, interleaved ? (2 * i) + 1 : i, spread)});
+        }
+    }
+    return result_t{std::move(elements)};
+}
+
+template <typename ElementT>
+inline constexpr bool viewable_v = [] {
+    using value_type = typename element_unit_t<ElementT>::value_type;
+    return std::is_standard_layout_v<ElementT> && sizeof(ElementT) == element_columns<ElementT> * sizeof(value_type);
+}();
+
+} // namespace details
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+namespace details
+{
+
+// The document map: unit header, layout, extra entries written by write_extra
+// (the series "time" map), then the packed samples
+template <stream_element_c ElementT, typename OutputIt, typename WriteExtra>
+void write_document(byte_sink<OutputIt>& sink, std::span<const ElementT> elements, const options& opts, std::size_t extra_entries, WriteExtra&& write_extra)
+{
+    using unit_type = element_unit_t<ElementT>;
+    using value_type = typename unit_type::value_type;
+    const bool little_endian = little_endian_for(opts.order);
+
+    if constexpr (is_pkr_unit_c<ElementT>)
+    {
+        sink.head(major_type::map, unit_header_entries + extra_entries + 2);
+        write_unit_header<unit_type>(sink);
+        write_extra(sink);
+        sink.template typed_array<value_type>("_v", "values", elements.size(), little_endian, [&](std::size_t i) { return elements[i].value(); });
+    }
+    else if (opts.layout == measurement_layout::columnar)
+    {
+        sink.head(major_type::map, unit_header_entries + extra_entries + 5);
+        write_unit_header<unit_type>(sink);
+        sink.text("layout");
+        sink.text("columnar");
+        write_extra(sink);
+        sink.template typed_array<value_type>("_v", "values", elements.size(), little_endian, [&](std::size_t i) { return elements[i].value(); });
+        sink.template typed_array<value_type>("_u", "uncertainties", elements.size(), little_endian, [&](std::size_t i) { return elements[i].uncertainty(); });
+    }
+    else
+    {
+        sink.head(major_type::map, unit_header_entries + extra_entries + 3);
+        write_unit_header<unit_type>(sink);
+        sink.text("layout");
+        sink.text("interleaved");
+        write_extra(sink);
+        sink.template typed_array<value_type>("_v",
+                                              "values",
+                                              2 * elements.size(),
+                                              little_endian,
+                                              [&](std::size_t i) { return i % 2 == 0 ? elements[i / 2].value() : elements[i / 2].uncertainty(); });
+    }
+}
+
+} // namespace details
+
+/// Encode units or measurements as one document on an output iterator of std::byte
+///
+/// @example
+/// ```cpp
+/// std::vector<std::byte> bytes;
+/// cbor::encode(std::back_inserter(bytes), std::span<const meter_t<double>>(samples));
+/// ```
+template <details::stream_element_c ElementT, typename OutputIt>
+    requires std::output_iterator<OutputIt, std::byte>
+auto encode(OutputIt out, std::span<const ElementT> elements, const options& opts = {}) -> OutputIt
+{
+    details::byte_sink<OutputIt> sink{out};
+    details::write_document(sink, elements, opts, 0, [](auto&) {});
+    return sink.out;
+}
+
+/// Encode into a new byte vector
+template <details::stream_element_c ElementT>
+std::vector<std::byte> encode(std::span<const ElementT> elements, const options& opts = {})
+{
+    std::vector<std::byte> bytes;
+    bytes.reserve(128 + (elements.size() * sizeof(ElementT)));
+    encode(std::back_inserter(bytes), elements, opts);
+    return bytes;
+}
+
+/// Encode a series: time[i] belongs to values[i]
+///
+/// @throws std::invalid_argument if time and values differ in length
+template <is_pkr_unit_c TimeT, details::stream_element_c ElementT, typename OutputIt>
+    requires std::output_iterator<OutputIt, std::byte>
+auto encode_series(OutputIt out, std::span<const TimeT> time, std::span<const ElementT> values, const options& opts = {}) -> OutputIt
+{
+    using time_value_type = typename TimeT::value_type;
+    if (time.size() != values.size())
+    {
+        throw std::invalid_argument("cbor::encode_series: time and values differ in length");
+    }
+    const std::size_t count = values.size();
+
+    details::byte_sink<OutputIt> sink{out};
+    details::write_document(sink,
+                            values.first(count),
+                            opts,
+                            1,
+                            [&](details::byte_sink<OutputIt>& time_sink)
+                            {
+                                time_sink.text("time");
+                                time_sink.head(details::major_type::map, details::unit_header_entries + 2);
+                                details::write_unit_header<TimeT>(time_sink);
+                                time_sink.template typed_array<time_value_type>(
+                                    "_t", "values", count, details::little_endian_for(opts.order), [&](std::size_t i) { return time[i].value(); });
+                            });
+    return sink.out;
+}
+
+/// Encode a series into a new byte vector
+template <is_pkr_unit_c TimeT, details::stream_element_c ElementT>
+std::vector<std::byte> encode_series(std::span<const TimeT> time, std::span<const ElementT> values, const options& opts = {})
+{
+    std::vector<std::byte> bytes;
+    bytes.reserve(192 + (values.size() * (sizeof(ElementT) + sizeof(TimeT))));
+    encode_series(std::back_inserter(bytes), time, values, opts);
+    return bytes;
+}
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+/// Decode a document into ElementT, converting from the stored unit
+///
+/// @return the samples, or an error with the byte offset of the offending item
+template <details::stream_element_c ElementT>
+auto decode(std::span<const std::byte> bytes) -> expected_t<std::vector<ElementT>, error>
+{
+    using result_t = expected_t<std::vector<ElementT>, error>;
+    details::document doc;
+    details::reader input{bytes};
+    if (!input.parse(doc))
+    {
+        return result_t{*input.failure()};
+    }
+    auto count = details::check_layout<ElementT>(doc, bytes.size());
+    if (!count)
+    {
+        return result_t{count.error()};
+    }
+    return details::decode_elements<ElementT>(doc, *count, bytes.size());
+}
+
+/// Decode a series document
+template <is_pkr_unit_c TimeT, details::stream_element_c ElementT>
+auto decode_series(std::span<const std::byte> bytes) -> expected_t<series_t<TimeT, ElementT>, error>
+{
+    using result_t = expected_t<series_t<TimeT, ElementT>, error>;
+    details::document doc;
+    details::reader input{bytes};
+    if (!input.parse(doc))
+    {
+        return result_t{*input.failure()};
+    }
+    if (!doc.has_time || !doc.time.present)
+    {
+        return result_t{error{error_code::layout_mismatch, bytes.size()}};
+    }
+    auto count = details::check_layout<ElementT>(doc, bytes.size());
+    if (!count)
+    {
+        return result_t{count.error()};
+    }
+    if (doc.time.count != *count)
+    {
+        return result_t{error{error_code::malformed, doc.time.offset}};
+    }
+    auto time_map = details::conversion_for<TimeT>(doc.time_unit, doc.time.offset);
+    if (!time_map)
+    {
+        return result_t{time_map.error()};
+    }
+    auto values = details::decode_elements<ElementT>(doc, *count, bytes.size());
+    if (!values)
+    {
+        return result_t{values.error()};
+    }
+
+    series_t<TimeT, ElementT> series{{}, std::move(*values)};
+    series.time.reserve(*count);
+    for (std::size_t i = 0; i < *count; ++i)
+    {
+        series.time.push_back(details::load_unit<TimeT>(doc.time, i, *time_map));
+    }
+    return result_t{std::move(series)};
+}
+
+/// Zero-copy decode: the samples in place inside bytes.
+///
+/// Succeeds when the stored unit is ElementT's own unit, the element type is
+/// ElementT's value type in native byte order, measurements are interleaved and
+/// the payload is suitably aligned (encode() aligns payloads relative to the
+/// start of the document, so an aligned buffer is enough). Otherwise returns
+/// error_code::not_viewable and decode() is the fallback. The span points into
+/// bytes and is valid as long as bytes is.
+template <details::stream_element_c ElementT>
+auto view(std::span<const std::byte> bytes) -> expected_t<std::span<const ElementT>, error>
+{
+    static_assert(details::viewable_v<ElementT>, "cbor::view: the element type must be a plain value wrapper");
+    using result_t = expected_t<std::span<const ElementT>, error>;
+    using unit_type = details::element_unit_t<ElementT>;
+    using value_type = typename unit_type::value_type;
+
+    details::document doc;
+    details::reader input{bytes};
+    if (!input.parse(doc))
+    {
+        return result_t{*input.failure()};
+    }
+    auto count = details::check_layout<ElementT>(doc, bytes.size());
+    if (!count)
+    {
+        return result_t{count.error()};
+    }
+    auto map = details::conversion_for<unit_type>(doc.unit, bytes.size());
+    if (!map)
+    {
+        return result_t{map.error()};
+    }
+
+    const bool native_order = doc.values.format.little_endian == (std::endian::native == std::endian::little);
+    const bool aligned = reinterpret_cast<std::uintptr_t>(doc.values.data) % alignof(ElementT) == 0;
+    const bool interleaved = is_pkr_unit_c<ElementT> || doc.layout == "interleaved";
+    if (!details::is_identity(*map) || doc.values.format.kind != details::element_kind_of<value_type>() || !native_order || !aligned || !interleaved)
+    {
+        return result_t{error{error_code::not_viewable, doc.values.offset}};
+    }
+    return result_t{std::span<const ElementT>(reinterpret_cast<const ElementT*>(doc.values.data), *count)};
+}
+
+} // namespace PKR_UNITS_NAMESPACE::cbor
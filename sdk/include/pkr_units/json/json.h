@@ -3,6 +3,12 @@
 #include <string_view>
 #include <array>
 #include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <pkr_units/expected.h>
 #include <pkr_units/impl/parsing/parse.h>
 #include <pkr_units/impl/parsing/parse_error.h>
@@ -13,129 +19,249 @@ namespace PKR_UNITS_NAMESPACE::json
 {
 
 // ============================================================================
-// JSON Serialization: Generate complete JSON objects in static buffer
+// JSON writers: one implementation shared by every output target
 // ============================================================================
 
-/// Serialize a unit to a JSON string representation.
-/// Generates a complete JSON object: {"value":X,"unit":"symbol"}
-///
-/// Uses the static format buffer for zero-allocation serialization.
-/// The returned string_view is valid until the next SDK call.
-///
-/// @tparam UnitT The unit type to serialize
-/// @tparam CharT The character type (char or wchar_t)
-/// @param unit The unit value to serialize
-/// @return string_view containing the JSON object, or empty view on error
-///
-/// @example
-/// ```cpp
-/// meter_t<double> m{5.0};
-/// auto json_str = json::serialize_unit_to_json_string(m);
-/// // Result: {"value":5.0,"unit":"m"}
-/// ```
-template <is_pkr_unit_c UnitT, typename CharT = char>
-auto serialize_unit_to_json_string(const UnitT& unit) -> std::basic_string_view<CharT>
+namespace details
 {
-    auto& buffer = impl::shared_buffer<CharT>::data();
-    auto capacity = impl::shared_buffer<CharT>::capacity();
 
-    auto symbol = impl::get_symbol_for_char<UnitT, CharT>::value();
+template <typename MeasT>
+concept json_measurement_c = is_measurement_lin_c<MeasT> || is_measurement_rss_c<MeasT>;
 
-    std::size_t offset = 0;
+template <typename MeasT>
+using measurement_unit_t = std::remove_cvref_t<decltype(std::declval<const MeasT&>().unit_value())>;
 
-    // Opening brace
-    if (offset + 1 > capacity)
-        return {};
-    buffer[offset++] = static_cast<CharT>('{');
+// Writes into a caller-owned range. Running out of room sets overflow and
+// stops writing; nothing is ever written past the end of the range.
+template <typename CharT>
+struct span_sink
+{
+    std::span<CharT> out;
+    std::size_t size = 0;
+    bool overflow = false;
 
-    // "value":
-    std::basic_string_view<CharT> value_key;
-    if constexpr (std::is_same_v<CharT, wchar_t>)
-    {
-        constexpr std::wstring_view value_key_wide = L"\"value\":";
-        value_key = value_key_wide;
-    }
-    else
+    constexpr void push_back(CharT c)
     {
-        constexpr std::string_view value_key_ascii = "\"value\":";
-        value_key = value_key_ascii;
+        if (size == out.size())
+        {
+            overflow = true;
+            return;
+        }
+        out[size++] = c;
     }
+};
 
-    if (offset + value_key.size() + 64 > capacity)
-        return {};
+// Forwards every character to an output iterator
+template <typename CharT, typename OutputIt>
+struct iterator_sink
+{
+    OutputIt out;
 
-    for (CharT c : value_key)
+    constexpr void push_back(CharT c)
     {
-        buffer[offset++] = c;
+        *out++ = c;
     }
+};
 
-    // Serialize numeric value using std::to_chars
-    std::array<CharT, 64> num_buf{};
-    auto [ptr, ec] = std::to_chars(num_buf.data(), num_buf.data() + num_buf.size(), unit.value());
-    if (ec != std::errc())
-        return {};
+// Deserialization rebuilds "value [+/- uncertainty] symbol" on the stack; a number
+// plus a symbol never comes close, and longer input is rejected as malformed
+inline constexpr std::size_t reconstruct_capacity = 256;
 
-    std::size_t num_len = ptr - num_buf.data();
-    if (offset + num_len > capacity)
-        return {};
+template <typename CharT, typename Sink>
+constexpr void write_ascii(Sink& sink, std::string_view text)
+{
+    for (char c : text)
+    {
+        sink.push_back(static_cast<CharT>(c));
+    }
+}
 
-    for (std::size_t i = 0; i < num_len; ++i)
+template <typename CharT, typename Sink>
+constexpr void write_symbol(Sink& sink, std::basic_string_view<CharT> symbol)
+{
+    for (CharT c : symbol)
     {
-        buffer[offset++] = num_buf[i];
+        sink.push_back(c);
     }
+}
 
-    // ,"unit":"symbol"
-    std::basic_string_view<CharT> unit_key;
-    if constexpr (std::is_same_v<CharT, wchar_t>)
+// Numbers are always rendered as ASCII with std::to_chars and widened per character,
+// so wchar_t output goes through the same shortest round-trip representation as char.
+// JSON has no NaN or infinity: non-finite values are written as null (to_chars would
+// produce the bare tokens nan and inf, which no JSON parser accepts).
+template <typename CharT, typename Sink, typename ValueT>
+bool write_number(Sink& sink, ValueT value)
+{
+    if constexpr (std::is_floating_point_v<ValueT>)
     {
-        constexpr std::wstring_view unit_key_wide = L",\"unit\":\"";
-        unit_key = unit_key_wide;
+        if (!std::isfinite(value))
+        {
+            write_ascii<CharT>(sink, "null");
+            return true;
+        }
     }
-    else
+    std::array<char, 64> digits{};
+    auto [ptr, ec] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    if (ec != std::errc())
     {
-        constexpr std::string_view unit_key_ascii = ",\"unit\":\"";
-        unit_key = unit_key_ascii;
+        return false;
     }
+    write_ascii<CharT>(sink, std::string_view(digits.data(), static_cast<std::size_t>(ptr - digits.data())));
+    return true;
+}
 
-    if (offset + unit_key.size() + symbol.size() + 2 > capacity)
-        return {};
-
-    for (CharT c : unit_key)
+template <typename CharT, typename UnitT, typename Sink>
+bool write_unit_json(Sink& sink, const UnitT& unit)
+{
+    write_ascii<CharT>(sink, "{\"value\":");
+    if (!write_number<CharT>(sink, unit.value()))
     {
-        buffer[offset++] = c;
+        return false;
     }
+    write_ascii<CharT>(sink, ",\"unit\":\"");
+    write_symbol<CharT>(sink, impl::get_symbol_for_char<UnitT, CharT>::value());
+    write_ascii<CharT>(sink, "\"}");
+    return true;
+}
 
-    for (CharT c : symbol)
+template <typename CharT, typename MeasT, typename Sink>
+bool write_measurement_json(Sink& sink, const MeasT& meas)
+{
+    write_ascii<CharT>(sink, "{\"value\":");
+    if (!write_number<CharT>(sink, meas.value()))
     {
-        buffer[offset++] = c;
+        return false;
     }
-
-    // Closing quote and brace
-    std::basic_string_view<CharT> close_obj;
-    if constexpr (std::is_same_v<CharT, wchar_t>)
+    write_ascii<CharT>(sink, ",\"uncertainty\":");
+    if (!write_number<CharT>(sink, meas.uncertainty()))
     {
-        constexpr std::wstring_view close_obj_wide = L"\"}";
-        close_obj = close_obj_wide;
+        return false;
     }
-    else
+    write_ascii<CharT>(sink, ",\"unit\":\"");
+    write_symbol<CharT>(sink, impl::get_symbol_for_char<measurement_unit_t<MeasT>, CharT>::value());
+    write_ascii<CharT>(sink, "\"}");
+    return true;
+}
+
+} // namespace details
+
+// ============================================================================
+// JSON Serialization into caller-provided storage (thread-safe, reentrant)
+// ============================================================================
+
+/// Serialize a unit into a caller-provided buffer.
+/// Generates a complete JSON object: {"value":X,"unit":"symbol"}
+/// A NaN or infinite value is written as null, since JSON has no such numbers.
+///
+/// Touches no shared state, so it is safe to call concurrently from any
+/// number of threads as long as each uses its own buffer.
+///
+/// @param out Destination buffer; the character type is deduced from it
+/// @param unit The unit value to serialize
+/// @return view of the written JSON inside out, or an empty view if out is too small
+///
+/// @example
+/// ```cpp
+/// std::array<char, 64> buffer;
+/// auto json_str = json::serialize_to(std::span<char>(buffer), meter_t<double>{5.0});
+/// // Result: {"value":5,"unit":"m"}
+/// ```
+template <typename CharT, is_pkr_unit_c UnitT>
+auto serialize_to(std::span<CharT> out, const UnitT& unit) -> std::basic_string_view<CharT>
+{
+    details::span_sink<CharT> sink{out};
+    if (!details::write_unit_json<CharT>(sink, unit) || sink.overflow)
     {
-        constexpr std::string_view close_obj_ascii = "\"}";
-        close_obj = close_obj_ascii;
+        return {};
     }
+    return std::basic_string_view<CharT>(out.data(), sink.size);
+}
 
-    for (CharT c : close_obj)
+/// Serialize a measurement into a caller-provided buffer.
+/// Generates a complete JSON object: {"value":X,"uncertainty":Y,"unit":"symbol"}
+/// A NaN or infinite value or uncertainty is written as null.
+///
+/// @param out Destination buffer; the character type is deduced from it
+/// @param meas The measurement value to serialize
+/// @return view of the written JSON inside out, or an empty view if out is too small
+template <typename CharT, details::json_measurement_c MeasT>
+auto serialize_to(std::span<CharT> out, const MeasT& meas) -> std::basic_string_view<CharT>
+{
+    details::span_sink<CharT> sink{out};
+    if (!details::write_measurement_json<CharT>(sink, meas) || sink.overflow)
     {
-        buffer[offset++] = c;
+        return {};
     }
+    return std::basic_string_view<CharT>(out.data(), sink.size);
+}
 
-    return std::basic_string_view<CharT>(buffer, offset);
+/// Write a unit as JSON to an output iterator, e.g. std::back_inserter(str)
+/// or an std::ostreambuf_iterator. Returns the iterator past the last
+/// character written.
+///
+/// @tparam CharT The character type written to the iterator (char or wchar_t)
+///
+/// @example
+/// ```cpp
+/// std::string body;
+/// json::format_to(std::back_inserter(body), meter_t<double>{5.0});
+/// ```
+template <typename CharT = char, typename OutputIt, is_pkr_unit_c UnitT>
+    requires std::output_iterator<OutputIt, CharT>
+auto format_to(OutputIt out, const UnitT& unit) -> OutputIt
+{
+    details::iterator_sink<CharT, OutputIt> sink{out};
+    details::write_unit_json<CharT>(sink, unit);
+    return sink.out;
+}
+
+/// Write a measurement as JSON to an output iterator.
+/// Returns the iterator past the last character written.
+template <typename CharT = char, typename OutputIt, details::json_measurement_c MeasT>
+    requires std::output_iterator<OutputIt, CharT>
+auto format_to(OutputIt out, const MeasT& meas) -> OutputIt
+{
+    details::iterator_sink<CharT, OutputIt> sink{out};
+    details::write_measurement_json<CharT>(sink, meas);
+    return sink.out;
+}
+
+// ============================================================================
+// JSON Serialization into the SDK format buffer
+// ============================================================================
+
+/// Serialize a unit to a JSON string representation.
+/// Generates a complete JSON object: {"value":X,"unit":"symbol"}
+///
+/// Writes into the SDK format buffer. By default that buffer is thread-local,
+/// so the returned string_view is valid until the next SDK call on the same
+/// thread. With PKR_UNITS_SHARED_FORMAT_BUFFER defined there is one buffer for
+/// the whole process; use serialize_to() or format_to() when serializing from
+/// several threads in that configuration.
+///
+/// @tparam UnitT The unit type to serialize
+/// @tparam CharT The character type (char or wchar_t)
+/// @param unit The unit value to serialize
+/// @return string_view containing the JSON object, or empty view on error
+///
+/// @example
+/// ```cpp
+/// meter_t<double> m{5.0};
+/// auto json_str = json::serialize_unit_to_json_string(m);
+/// // Result: {"value":5,"unit":"m"}
+/// ```
+template <is_pkr_unit_c UnitT, typename CharT = char>
+auto serialize_unit_to_json_string(const UnitT& unit) -> std::basic_string_view<CharT>
+{
+    using buffer = impl::shared_buffer<CharT>;
+    return serialize_to(std::span<CharT>(buffer::data(), buffer::capacity()), unit);
 }
 
 /// Serialize a measurement (with uncertainty) to a JSON string representation.
 /// Generates a complete JSON object: {"value":X,"uncertainty":Y,"unit":"symbol"}
 ///
-/// Uses the static format buffer for zero-allocation serialization.
-/// The returned string_view is valid until the next SDK call.
+/// Writes into the SDK format buffer; see serialize_unit_to_json_string()
+/// for the lifetime of the returned view.
 ///
 /// @tparam MeasT The measurement type to serialize
 /// @tparam CharT The character type (char or wchar_t)
@@ -146,141 +272,13 @@ auto serialize_unit_to_json_string(const UnitT& unit) -> std::basic_string_view<
 /// ```cpp
 /// measurement_lin_t<meter_t<double>> m{meter_t<double>{5.0}, 0.1};
 /// auto json_str = json::serialize_measurement_to_json_string(m);
-/// // Result: {"value":5.0,"uncertainty":0.1,"unit":"m"}
+/// // Result: {"value":5,"uncertainty":0.1,"unit":"m"}
 /// ```
 template <typename MeasT, typename CharT = char>
 auto serialize_measurement_to_json_string(const MeasT& meas) -> std::basic_string_view<CharT>
 {
-    auto& buffer = impl::shared_buffer<CharT>::data();
-    auto capacity = impl::shared_buffer<CharT>::capacity();
-
-    using unit_type = typename MeasT::unit_type;
-    auto symbol = impl::get_symbol_for_char<unit_type, CharT>::value();
-
-    std::size_t offset = 0;
-
-    // Opening brace
-    if (offset + 1 > capacity)
-        return {};
-    buffer[offset++] = static_cast<CharT>('{');
-
-    // "value":
-    std::basic_string_view<CharT> value_key;
-    if constexpr (std::is_same_v<CharT, wchar_t>)
-    {
-        constexpr std::wstring_view value_key_wide = L"\"value\":";
-        value_key = value_key_wide;
-    }
-    else
-    {
-        constexpr std::string_view value_key_ascii = "\"value\":";
-        value_key = value_key_ascii;
-    }
-
-    if (offset + value_key.size() + 64 > capacity)
-        return {};
-
-    for (CharT c : value_key)
-    {
-        buffer[offset++] = c;
-    }
-
-    // Serialize value
-    std::array<CharT, 64> val_buf{};
-    auto [ptr1, ec1] = std::to_chars(val_buf.data(), val_buf.data() + val_buf.size(), meas.value());
-    if (ec1 != std::errc())
-        return {};
-
-    std::size_t val_len = ptr1 - val_buf.data();
-    if (offset + val_len > capacity)
-        return {};
-
-    for (std::size_t i = 0; i < val_len; ++i)
-    {
-        buffer[offset++] = val_buf[i];
-    }
-
-    // ,"uncertainty":
-    std::basic_string_view<CharT> uncert_key;
-    if constexpr (std::is_same_v<CharT, wchar_t>)
-    {
-        constexpr std::wstring_view uncert_key_wide = L",\"uncertainty\":";
-        uncert_key = uncert_key_wide;
-    }
-    else
-    {
-        constexpr std::string_view uncert_key_ascii = ",\"uncertainty\":";
-        uncert_key = uncert_key_ascii;
-    }
-
-    if (offset + uncert_key.size() + 64 > capacity)
-        return {};
-
-    for (CharT c : uncert_key)
-    {
-        buffer[offset++] = c;
-    }
-
-    // Serialize uncertainty
-    std::array<CharT, 64> uncert_buf{};
-    auto [ptr2, ec2] = std::to_chars(uncert_buf.data(), uncert_buf.data() + uncert_buf.size(), meas.uncertainty());
-    if (ec2 != std::errc())
-        return {};
-
-    std::size_t uncert_len = ptr2 - uncert_buf.data();
-    if (offset + uncert_len > capacity)
-        return {};
-
-    for (std::size_t i = 0; i < uncert_len; ++i)
-    {
-        buffer[offset++] = uncert_buf[i];
-    }
-
-    // ,"unit":"symbol"
-    std::basic_string_view<CharT> unit_key;
-    if constexpr (std::is_same_v<CharT, wchar_t>)
-    {
-        constexpr std::wstring_view unit_key_wide = L",\"unit\":\"";
-        unit_key = unit_key_wide;
-    }
-    else
-    {
-        constexpr std::string_view unit_key_ascii = ",\"unit\":\"";
-        unit_key = unit_key_ascii;
-    }
-
-    if (offset + unit_key.size() + symbol.size() + 2 > capacity)
-        return {};
-
-    for (CharT c : unit_key)
-    {
-        buffer[offset++] = c;
-    }
-
-    for (CharT c : symbol)
-    {
-        buffer[offset++] = c;
-    }
-
-    // Closing quote and brace
-    std::basic_string_view<CharT> close_obj;
-    if constexpr (std::is_same_v<CharT, wchar_t>)
-    {
-        constexpr std::wstring_view close_obj_wide = L"\"}";
-        close_obj = close_obj_wide;
-    }
-    else
-    {
-        constexpr std::string_view close_obj_ascii = "\"}";
-        close_obj = close_obj_ascii;
-    }
-
-    for (CharT c : close_obj)
-    {
-        buffer[offset++] = c;
-    }
-
-    return std::basic_string_view<CharT>(buffer, offset);
+    using buffer = impl::shared_buffer<CharT>;
+    return serialize_to(std::span<CharT>(buffer::data(), buffer::capacity()), meas);
 }
 
 // ============================================================================
@@ -318,8 +316,9 @@ std::basic_string_view<CharT> extract_json_number(std::basic_string_view<CharT>
 
     auto value_start = key_pos + key.size();
 
-    // Skip whitespace
-    while (value_start < json.size() && (json[value_start] == static_cast<CharT>(' ') || json[value_start] == static_cast<CharT>('\t')))
+    // Skip whitespace and the key/value separator
+    while (value_start < json.size() && (json[value_start] == static_cast<CharT>(' ') || json[value_start] == static_cast<CharT>('\t') ||
+                                         json[value_start] == static_cast<CharT>(':')))
     {
         ++value_start;
     }
@@ -338,8 +337,9 @@ std::basic_string_view<CharT> extract_json_number(std::basic_string_view<CharT>
 /// Deserialize a JSON string to a unit.
 /// Parses JSON in the form: {"value":X,"unit":"symbol"}
 ///
-/// Uses the static format buffer to reconstruct "X symbol" and feeds
-/// it to the existing parse<TargetUnit>() for validation and conversion.
+/// Reconstructs "X symbol" in a stack buffer and feeds it to the existing
+/// parse<TargetUnit>() for validation and conversion. No shared state is
+/// touched, so concurrent calls are safe.
 ///
 /// @tparam TargetUnit The target unit type to deserialize into
 /// @tparam CharT The character type (char or wchar_t)
@@ -394,9 +394,9 @@ auto deserialize_unit_from_json_string(std::basic_string_view<CharT> json_str) -
         return expected_t<TargetUnit, parse_error>{parse_error::symbol_mismatch};
     }
 
-    // Reconstruct "value unit" in shared buffer
-    auto& buffer = impl::shared_buffer<CharT>::data();
-    auto capacity = impl::shared_buffer<CharT>::capacity();
+    // Reconstruct "value unit" in a local buffer
+    std::array<CharT, details::reconstruct_capacity> buffer{};
+    constexpr auto capacity = details::reconstruct_capacity;
 
     std::size_t offset = 0;
 
@@ -421,14 +421,21 @@ auto deserialize_unit_from_json_string(std::basic_string_view<CharT> json_str) -
     }
 
     // Use standard parse with reconstructed string
-    return parse<TargetUnit, CharT>(std::basic_string_view<CharT>(buffer, offset));
+    return parse<TargetUnit, CharT>(std::basic_string_view<CharT>(buffer.data(), offset));
+}
+
+/// Overload for const CharT* strings
+template <is_pkr_unit_c TargetUnit, typename CharT = char>
+inline auto deserialize_unit_from_json_string(const CharT* json_str) -> expected_t<TargetUnit, parse_error>
+{
+    return deserialize_unit_from_json_string<TargetUnit, CharT>(std::basic_string_view<CharT>{json_str});
 }
 
 /// Deserialize a JSON string to a measurement (with uncertainty).
 /// Parses JSON in the form: {"value":X,"uncertainty":Y,"unit":"symbol"}
 ///
-/// Uses the static format buffer to reconstruct "X +/- Y symbol" and feeds
-/// it to the existing parse_measurement<TargetMeasurement>().
+/// Reconstructs "X +/- Y symbol" in a stack buffer and feeds it to the
+/// existing parse_measurement<TargetMeasurement>().
 ///
 /// @tparam TargetMeasurement The target measurement type to deserialize into
 /// @tparam CharT The character type (char or wchar_t)
@@ -505,9 +512,9 @@ auto deserialize_measurement_from_json_string(std::basic_string_view<CharT> json
     // Get the separator for this character type
     auto separator = impl::char_traits_dispatch<CharT>::plus_minus();
 
-    // Reconstruct "value +/- uncertainty unit" in shared buffer
-    auto& buffer = impl::shared_buffer<CharT>::data();
-    auto capacity = impl::shared_buffer<CharT>::capacity();
+    // Reconstruct "value +/- uncertainty unit" in a local buffer
+    std::array<CharT, details::reconstruct_capacity> buffer{};
+    constexpr auto capacity = details::reconstruct_capacity;
 
     std::size_t offset = 0;
 
@@ -544,8 +551,23 @@ auto deserialize_measurement_from_json_string(std::basic_string_view<CharT> json
         buffer[offset++] = c;
     }
 
-    // Use standard parse_measurement with reconstructed string
-    return parse_measurement<TargetMeasurement, CharT>(std::basic_string_view<CharT>(buffer, offset));
+    // Use the standard measurement parser with the reconstructed string
+    const std::basic_string_view<CharT> text(buffer.data(), offset);
+    if constexpr (is_measurement_lin_c<TargetMeasurement>)
+    {
+        return parse_linear<TargetMeasurement, CharT>(text);
+    }
+    else
+    {
+        return parse_rss<TargetMeasurement, CharT>(text);
+    }
+}
+
+/// Overload for const CharT* strings
+template <typename TargetMeasurement, typename CharT = char>
+inline auto deserialize_measurement_from_json_string(const CharT* json_str) -> expected_t<TargetMeasurement, parse_error>
+{
+    return deserialize_measurement_from_json_string<TargetMeasurement, CharT>(std::basic_string_view<CharT>{json_str});
 }
 
 } // namespace PKR_UNITS_NAMESPACE::json
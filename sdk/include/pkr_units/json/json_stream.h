@@ -0,0 +1,944 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pkr_units/expected.h>
+#include <pkr_units/json/json.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/parsing/unit_expression.h>
+
+// ============================================================================
+// Streaming JSON for arrays and time series
+// ============================================================================
+//
+// The per-object form {"value":X,"unit":"m"} repeats the unit for every sample.
+// Arrays and series are written with the unit once in the header and the
+// samples in one compact numeric array:
+//
+//   {"unit":"m","values":[1.5,2,2.5]}                            units
+//   {"unit":"m","values":[[5,0.1],[6,0.2]]}                      measurements: [value,uncertainty]
+//   {"time_unit":"s","unit":"m","values":[[0,1.5],[0.1,2]]}      series: [time,value] or [time,value,uncertainty]
+//
+// Non-finite values are written as null and read back as NaN.
+//
+// stream_writer emits the document incrementally through any output iterator,
+// so nothing is materialized besides what the sink itself keeps. stream_reader
+// is a push parser: feed() it the document in chunks of any size (down to a
+// byte at a time) and it calls back once per sample, converting from the unit
+// named in the header into the requested type. "unit" and "time_unit" must come
+// before "values"; other members are skipped. The reader expects UTF-8 input.
+
+namespace PKR_UNITS_NAMESPACE::json
+{
+
+enum class stream_error_code
+{
+    malformed,           // Not the expected JSON structure
+    missing_unit,        // "values" started before "unit" (or "time_unit" for series)
+    unknown_unit,        // Header unit is neither registered nor a valid expression
+    dimension_mismatch,  // Header unit has a different dimension than the requested type
+    numeric_parse_error, // A sample is not a number or null
+    incomplete,          // finish() before the closing brace
+};
+
+struct stream_error
+{
+    stream_error_code code;
+    std::size_t offset; // Byte offset into the whole document
+};
+
+namespace details
+{
+
+template <typename ElementT>
+concept stream_element_c = is_pkr_unit_c<ElementT> || json_measurement_c<ElementT>;
+
+template <typename ElementT>
+auto element_unit_probe()
+{
+    if constexpr (is_pkr_unit_c<ElementT>)
+    {
+        return std::type_identity<ElementT>{};
+    }
+    else
+    {
+        return std::type_identity<measurement_unit_t<ElementT>>{};
+    }
+}
+
+template <typename ElementT>
+using element_unit_t = typename decltype(element_unit_probe<ElementT>())::type;
+
+template <typename ElementT>
+inline constexpr std::size_t element_columns = is_pkr_unit_c<ElementT> ? 1 : 2;
+
+template <typename CharT, typename Sink, typename ValueT>
+void write_sample(Sink& sink, ValueT value)
+{
+    if (!std::isfinite(value) || !write_number<CharT>(sink, value))
+    {
+        write_ascii<CharT>(sink, "null");
+    }
+}
+
+} // namespace details
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+/// Incremental writer for one array or series document.
+///
+/// The header is written on construction, each write() appends one sample and
+/// finish() closes the document. Use make_array_writer / make_series_writer.
+///
+/// @tparam ElementT unit or measurement type of the samples
+/// @tparam OutputIt output iterator receiving CharT
+/// @tparam CharT character type written (char or wchar_t)
+/// @tparam TimeT time unit of a series, or void for a plain array
+template <details::stream_element_c ElementT, typename OutputIt, typename CharT = char, typename TimeT = void>
+    requires std::output_iterator<OutputIt, CharT>
+class stream_writer
+{
+    using unit_type = details::element_unit_t<ElementT>;
+    static constexpr bool is_series = !std::is_void_v<TimeT>;
+    static constexpr bool is_row = is_series || details::element_columns<ElementT> > 1;
+
+public:
+    explicit stream_writer(OutputIt out)
+        : m_sink{out}
+    {
+        details::write_ascii<CharT>(m_sink, "{");
+        if constexpr (is_series)
+        {
+            details::write_ascii<CharT>(m_sink, "\"time_unit\":\"");
+            details::write_symbol<CharT>(m_sink, impl::get_symbol_for_char<TimeT, CharT>::value());
+            details::write_ascii<CharT>(m_sink, "\",");
+        }
+        details::write_ascii<CharT>(m_sink, "\"unit\":\"");
+        details::write_symbol<CharT>(m_sink, impl::get_symbol_for_char<unit_type, CharT>::value());
+        details::write_ascii<CharT>(m_sink, "\",\"values\":[");
+    }
+
+    /// Append one sample of a plain array
+    void write(const ElementT& element)
+        requires(!is_series)
+    {
+        begin_sample();
+        write_element(element);
+        end_sample();
+    }
+
+    /// Append one sample of a series
+    template <typename SeriesTimeT = TimeT>
+        requires(!std::is_void_v<SeriesTimeT>)
+    void write(const SeriesTimeT& time, const ElementT& element)
+    {
+        begin_sample();
+        details::write_sample<CharT>(m_sink, time.value());
+        details::write_ascii<CharT>(m_sink, ",");
+        write_element(element);
+        end_sample();
+    }
+
+    /// Append every sample of a range
+    template <std::ranges::input_range RangeT>
+        requires(!is_series)
+    void write_all(const RangeT& elements)
+    {
+        for (const auto& element : elements)
+        {
+            write(element);
+        }
+    }
+
+    /// Close the document and return the iterator past the last character
+    OutputIt finish()
+    {
+        details::write_ascii<CharT>(m_sink, "]}");
+        return m_sink.out;
+    }
+
+    /// Samples written so far
+    std::size_t size() const noexcept
+    {
+        return m_count;
+    }
+
+private:
+    void begin_sample()
+    {
+        if (m_count != 0)
+        {
+            details::write_ascii<CharT>(m_sink, ",");
+        }
+        if constexpr (is_row)
+        {
+            details::write_ascii<CharT>(m_sink, "[");
+        }
+    }
+
+    void end_sample()
+    {
+        if constexpr (is_row)
+        {
+            details::write_ascii<CharT>(m_sink, "]");
+        }
+        ++m_count;
+    }
+
+    void write_element(const ElementT& element)
+    {
+        details::write_sample<CharT>(m_sink, element.value());
+        if constexpr (!is_pkr_unit_c<ElementT>)
+        {
+            details::write_ascii<CharT>(m_sink, ",");
+            details::write_sample<CharT>(m_sink, element.uncertainty());
+        }
+    }
+
+    details::iterator_sink<CharT, OutputIt> m_sink;
+    std::size_t m_count = 0;
+};
+
+/// Start an array document of ElementT samples on out
+///
+/// @example
+/// ```cpp
+/// std::string body;
+/// auto writer = json::make_array_writer<meter_t<double>>(std::back_inserter(body));
+/// writer.write(meter_t<double>{1.5});
+/// writer.write(meter_t<double>{2.0});
+/// writer.finish();  // {"unit":"m","values":[1.5,2]}
+/// ```
+template <details::stream_element_c ElementT, typename CharT = char, typename OutputIt>
+auto make_array_writer(OutputIt out)
+{
+    return stream_writer<ElementT, OutputIt, CharT>{out};
+}
+
+/// Start a series document of (TimeT, ElementT) samples on out
+template <is_pkr_unit_c TimeT, details::stream_element_c ElementT, typename CharT = char, typename OutputIt>
+auto make_series_writer(OutputIt out)
+{
+    return stream_writer<ElementT, OutputIt, CharT, TimeT>{out};
+}
+
+/// Write a whole range of units or measurements as one array document
+template <typename CharT = char, typename OutputIt, std::ranges::input_range RangeT>
+    requires details::stream_element_c<std::ranges::range_value_t<RangeT>>
+auto write_array(OutputIt out, const RangeT& elements) -> OutputIt
+{
+    auto writer = make_array_writer<std::ranges::range_value_t<RangeT>, CharT>(out);
+    writer.write_all(elements);
+    return writer.finish();
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+/// Push parser for one array or series document.
+///
+/// feed() may be called with arbitrary pieces of the document; every complete
+/// sample is converted to ElementT (and TimeT) and passed to the callback, as
+/// on_sample(element) for arrays or on_sample(time, element) for series. The
+/// first error is sticky. finish() checks that the document was complete.
+///
+/// @example
+/// ```cpp
+/// json::stream_reader<meter_t<double>> reader;
+/// for (std::string_view chunk : chunks) {
+///     auto fed = reader.feed(chunk, [&](meter_t<double> m) { sum += m; });
+///     if (!fed) { report(fed.error()); break; }
+/// }
+/// auto total = reader.finish();
+/// ```
+template <details::stream_element_c ElementT, typename TimeT = void>
+class stream_reader
+{
+    using unit_type = details::element_unit_t<ElementT>;
+    using value_type = typename unit_type::value_type;
+    using result_t = expected_t<std::size_t, stream_error>;
+    static constexpr bool is_series = !std::is_void_v<TimeT>;
+    static constexpr std::size_t columns = (is_series ? 1 : 0) + details::element_columns<ElementT>;
+    static constexpr std::size_t max_token = 64;
+
+    enum class state
+    {
+        object_open,    // expect '{'
+        key_or_close,   // expect a key or '}'
+        key,            // expect a key
+        colon,          // expect ':'
+        member_value,   // expect the value of the current member
+        member_end,     // expect ',' or '}'
+        values_first,   // expect a sample or ']'
+        values_sample,  // expect a sample
+        values_next,    // expect ',' or ']'
+        row_number,     // expect a number inside a [..] sample
+        row_next,       // expect ',' or ']' inside a [..] sample
+        string,         // inside a string
+        token,          // inside a number or literal
+        skip,           // inside a member value that is ignored
+        done,
+    };
+
+    enum class member
+    {
+        unit,
+        time_unit,
+        values,
+        other,
+    };
+
+public:
+    /// Consume the next piece of the document.
+    ///
+    /// @return number of samples delivered from this piece, or the first error
+    template <typename Fn>
+    auto feed(std::string_view chunk, Fn&& on_sample) -> result_t
+    {
+        if (m_error)
+        {
+            return result_t{*m_error};
+        }
+        const std::size_t before = m_count;
+        const char* const first = chunk.data();
+        const char* p = first;
+        const char* const last = first + chunk.size();
+        while (p != last && !m_error)
+        {
+            m_position = m_consumed + static_cast<std::size_t>(p - first);
+            p = step(p, last, on_sample);
+        }
+        m_consumed += chunk.size();
+        if (m_error)
+        {
+            return result_t{*m_error};
+        }
+        return result_t{m_count - before};
+    }
+
+    /// Finish the document.
+    ///
+    /// @return total number of samples, the first error, or stream_error_code::incomplete
+    auto finish() const -> result_t
+    {
+        if (m_error)
+        {
+            return result_t{*m_error};
+        }
+        if (m_state != state::done)
+        {
+            return result_t{stream_error{stream_error_code::incomplete, m_consumed}};
+        }
+        return result_t{m_count};
+    }
+
+private:
+    static constexpr bool is_space(char c) noexcept
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static constexpr bool is_token_char(char c) noexcept
+    {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '-' || c == '+' || c == '.' || c == 'E';
+    }
+
+    void fail(stream_error_code code)
+    {
+        m_error = stream_error{code, m_position};
+    }
+
+    template <typename Fn>
+    const char* step(const char* p, const char* last, Fn& on_sample)
+    {
+        switch (m_state)
+        {
+        case state::string:
+            return read_string(p, last);
+        case state::token:
+            return read_token(p, last, on_sample);
+        case state::skip:
+            return skip_value(p, last);
+        default:
+            break;
+        }
+
+        const char c = *p;
+        if (is_space(c))
+        {
+            return p + 1;
+        }
+
+        switch (m_state)
+        {
+        case state::object_open:
+            expect(c, '{', state::key_or_close);
+            break;
+        case state::key_or_close:
+            if (c == '}')
+            {
+                close_object();
+                break;
+            }
+            [[fallthrough]];
+        case state::key:
+            start_string(c, member::other, true);
+            break;
+        case state::colon:
+            expect(c, ':', state::member_value);
+            break;
+        case state::member_value:
+            return start_member_value(p);
+        case state::member_end:
+            if (c == ',')
+            {
+                m_state = state::key;
+            }
+            else if (c == '}')
+            {
+                close_object();
+            }
+            else
+            {
+                fail(stream_error_code::malformed);
+            }
+            break;
+        case state::values_first:
+            if (c == ']')
+            {
+                m_state = state::member_end;
+                break;
+            }
+            [[fallthrough]];
+        case state::values_sample:
+            if constexpr (columns > 1)
+            {
+                m_row_size = 0;
+                expect(c, '[', state::row_number);
+                break;
+            }
+            else
+            {
+                return start_token(p, last, on_sample);
+            }
+        case state::row_number:
+            return start_token(p, last, on_sample);
+        case state::values_next:
+            if (c == ',')
+            {
+                m_state = state::values_sample;
+            }
+            else if (c == ']')
+            {
+                m_state = state::member_end;
+            }
+            else
+            {
+                fail(stream_error_code::malformed);
+            }
+            break;
+        case state::row_next:
+            if (c == ',' && m_row_size < columns)
+            {
+                m_state = state::row_number;
+            }
+            else if (c == ']' && m_row_size == columns)
+            {
+                emit(on_sample);
+                m_state = state::values_next;
+            }
+            else
+            {
+                fail(stream_error_code::malformed);
+            }
+            break;
+        case state::done:
+            fail(stream_error_code::malformed);
+            break;
+        default:
+            break;
+        }
+        return p + 1;
+    }
+
+    void expect(char c, char wanted, state next)
+    {
+        if (c == wanted)
+        {
+            m_state = next;
+        }
+        else
+        {
+            fail(stream_error_code::malformed);
+        }
+    }
+
+    void close_object()
+    {
+        if (!m_values_seen)
+        {
+            fail(stream_error_code::malformed);
+            return;
+        }
+        m_state = state::done;
+    }
+
+    // ------------------------------------------------------------------------
+    // Members
+    // ------------------------------------------------------------------------
+
+    const char* start_member_value(const char* p)
+    {
+        const char c = *p;
+        switch (m_member)
+        {
+        case member::unit:
+        case member::time_unit:
+            start_string(c, m_member, false);
+            return p + 1;
+        case member::values:
+            if (m_values_seen || !m_value_map || (is_series && !m_time_map))
+            {
+                fail(m_values_seen ? stream_error_code::malformed : stream_error_code::missing_unit);
+            }
+            else
+            {
+                expect(c, '[', state::values_first);
+                m_values_seen = true;
+            }
+            return p + 1;
+        case member::other:
+        default:
+            m_skip_depth = 0;
+            m_skip_in_string = false;
+            m_skip_escape = false;
+            m_skip_started = false;
+            m_state = state::skip;
+            return p;
+        }
+    }
+
+    void start_string(char c, member target, bool is_key)
+    {
+        if (c != '"')
+        {
+            fail(stream_error_code::malformed);
+            return;
+        }
+        m_text.clear();
+        m_string_target = target;
+        m_string_is_key = is_key;
+        m_escape = false;
+        m_unicode_digits = 0;
+        m_state = state::string;
+    }
+
+    const char* read_string(const char* p, const char* last)
+    {
+        for (; p != last; ++p)
+        {
+            const char c = *p;
+            if (m_unicode_digits > 0)
+            {
+                if (!append_hex_digit(c))
+                {
+                    fail(stream_error_code::malformed);
+                    return p;
+                }
+            }
+            else if (m_escape)
+            {
+                m_escape = false;
+                if (!append_escape(c))
+                {
+                    fail(stream_error_code::malformed);
+                    return p;
+                }
+            }
+            else if (c == '\\')
+            {
+                m_escape = true;
+            }
+            else if (c == '"')
+            {
+                end_string();
+                return p + 1;
+            }
+            else
+            {
+                m_text.push_back(c);
+            }
+        }
+        return p;
+    }
+
+    bool append_escape(char c)
+    {
+        switch (c)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            m_text.push_back(c);
+            return true;
+        case 'u':
+            m_unicode_digits = 4;
+            m_code_point = 0;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool append_hex_digit(char c)
+    {
+        std::uint32_t digit = 0;
+        if (c >= '0' && c <= '9')
+        {
+            digit = static_cast<std::uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<std::uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<std::uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+        m_code_point = (m_code_point << 4) | digit;
+        if (--m_unicode_digits > 0)
+        {
+            return true;
+        }
+        // Unit symbols live in the basic multilingual plane; surrogates are not expected
+        if (m_code_point >= 0xD800 && m_code_point <= 0xDFFF)
+        {
+            return false;
+        }
+        if (m_code_point < 0x80)
+        {
+            m_text.push_back(static_cast<char>(m_code_point));
+        }
+        else if (m_code_point < 0x800)
+        {
+            m_text.push_back(static_cast<char>(0xC0 | (m_code_point >> 6)));
+            m_text.push_back(static_cast<char>(0x80 | (m_code_point & 0x3F)));
+        }
+        else
+        {
+            m_text.push_back(static_cast<char>(0xE0 | (m_code_point >> 12)));
+            m_text.push_back(static_cast<char>(0x80 | ((m_code_point >> 6) & 0x3F)));
+            m_text.push_back(static_cast<char>(0x80 | (m_code_point & 0x3F)));
+        }
+        return true;
+    }
+
+    void end_string()
+    {
+        if (m_string_is_key)
+        {
+            m_member = member::other;
+            if (m_text == "unit")
+            {
+                m_member = member::unit;
+            }
+            else if (m_text == "values")
+            {
+                m_member = member::values;
+            }
+            else if (is_series && m_text == "time_unit")
+            {
+                m_member = member::time_unit;
+            }
+            m_state = state::colon;
+            return;
+        }
+
+        m_state = state::member_end;
+        if (m_string_target == member::unit)
+        {
+            m_value_map = resolve<unit_type>();
+        }
+        else if constexpr (is_series)
+        {
+            m_time_map = resolve<TimeT>();
+        }
+    }
+
+    template <typename TargetUnit>
+    std::optional<impl::linear_conversion> resolve()
+    {
+        const auto conversion = impl::resolve_linear_conversion<TargetUnit>(std::string_view{m_text});
+        if (!conversion)
+        {
+            fail(conversion.error() == parse_error::symbol_mismatch ? stream_error_code::dimension_mismatch : stream_error_code::unknown_unit);
+            return std::nullopt;
+        }
+        return *conversion;
+    }
+
+    const char* skip_value(const char* p, const char* last)
+    {
+        for (; p != last; ++p)
+        {
+            const char c = *p;
+            if (m_skip_in_string)
+            {
+                if (m_skip_escape)
+                {
+                    m_skip_escape = false;
+                }
+                else if (c == '\\')
+                {
+                    m_skip_escape = true;
+                }
+                else if (c == '"')
+                {
+                    m_skip_in_string = false;
+                    if (m_skip_depth == 0)
+                    {
+                        m_state = state::member_end;
+                        return p + 1;
+                    }
+                }
+                continue;
+            }
+            if (c == '"')
+            {
+                m_skip_in_string = true;
+            }
+            else if (c == '{' || c == '[')
+            {
+                ++m_skip_depth;
+            }
+            else if (c == '}' || c == ']')
+            {
+                if (m_skip_depth == 0)
+                {
+                    m_state = state::member_end;
+                    return p;
+                }
+                if (--m_skip_depth == 0)
+                {
+                    m_state = state::member_end;
+                    return p + 1;
+                }
+            }
+            else if (m_skip_depth == 0 && (c == ',' || (is_space(c) && m_skip_started)))
+            {
+                m_state = state::member_end;
+                return p;
+            }
+            m_skip_started = m_skip_started || !is_space(c);
+        }
+        return p;
+    }
+
+    // ------------------------------------------------------------------------
+    // Samples
+    // ------------------------------------------------------------------------
+
+    // Numbers that end inside the chunk are parsed in place; only a number cut
+    // by the end of a chunk is copied into the token buffer
+    template <typename Fn>
+    const char* start_token(const char* p, const char* last, Fn& on_sample)
+    {
+        const char* end = p;
+        while (end != last && is_token_char(*end))
+        {
+            ++end;
+        }
+        if (end == p)
+        {
+            fail(stream_error_code::malformed);
+            return p;
+        }
+        if (end == last)
+        {
+            m_token_size = 0;
+            m_token_state = m_state;
+            m_state = state::token;
+            return read_token(p, last, on_sample);
+        }
+        complete_token(std::string_view(p, static_cast<std::size_t>(end - p)), m_state, on_sample);
+        return end;
+    }
+
+    template <typename Fn>
+    const char* read_token(const char* p, const char* last, Fn& on_sample)
+    {
+        for (; p != last && is_token_char(*p); ++p)
+        {
+            if (m_token_size == max_token)
+            {
+                fail(stream_error_code::numeric_parse_error);
+                return p;
+            }
+            m_token[m_token_size++] = *p;
+        }
+        if (p != last)
+        {
+            complete_token(std::string_view(m_token.data(), m_token_size), m_token_state, on_sample);
+        }
+        return p;
+    }
+
+    template <typename Fn>
+    void complete_token(std::string_view token, state context, Fn& on_sample)
+    {
+        double value = std::numeric_limits<double>::quiet_NaN();
+        if (token != "null")
+        {
+            const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            if (ec != std::errc{} || ptr != token.data() + token.size())
+            {
+                fail(stream_error_code::numeric_parse_error);
+                return;
+            }
+        }
+
+        if (context == state::row_number)
+        {
+            m_row[m_row_size++] = value;
+            m_state = state::row_next;
+            return;
+        }
+        m_row[0] = value;
+        m_row_size = 1;
+        emit(on_sample);
+        m_state = state::values_next;
+    }
+
+    static value_type convert(double value, const impl::linear_conversion& map) noexcept
+    {
+        if (map.scale != 1.0 || map.offset != 0.0)
+        {
+            value = (value * map.scale) + map.offset;
+        }
+        return static_cast<value_type>(value);
+    }
+
+    template <typename Fn>
+    void emit(Fn& on_sample)
+    {
+        constexpr std::size_t value_column = is_series ? 1 : 0;
+        const unit_type value{convert(m_row[value_column], *m_value_map)};
+
+        auto element = [&]
+        {
+            if constexpr (is_pkr_unit_c<ElementT>)
+            {
+                return value;
+            }
+            else
+            {
+                // An uncertainty is a difference: it takes the scale but never the offset
+                return ElementT{value, unit_type{convert(m_row[value_column + 1], impl::linear_conversion{m_value_map->scale, 0.0})}};
+            }
+        }();
+
+        if constexpr (is_series)
+        {
+            using time_value_type = typename TimeT::value_type;
+            const double time = (m_row[0] * m_time_map->scale) + m_time_map->offset;
+            on_sample(TimeT{static_cast<time_value_type>(time)}, element);
+        }
+        else
+        {
+            on_sample(element);
+        }
+        ++m_count;
+    }
+
+    state m_state = state::object_open;
+    state m_token_state = state::values_sample;
+    member m_member = member::other;
+    member m_string_target = member::other;
+    bool m_string_is_key = false;
+    bool m_values_seen = false;
+
+    std::string m_text;
+    bool m_escape = false;
+    int m_unicode_digits = 0;
+    std::uint32_t m_code_point = 0;
+
+    std::size_t m_skip_depth = 0;
+    bool m_skip_in_string = false;
+    bool m_skip_escape = false;
+    bool m_skip_started = false;
+
+    std::array<char, max_token> m_token{};
+    std::size_t m_token_size = 0;
+    std::array<double, 3> m_row{};
+    std::size_t m_row_size = 0;
+
+    std::optional<impl::linear_conversion> m_value_map;
+    std::optional<impl::linear_conversion> m_time_map;
+    std::optional<stream_error> m_error;
+    std::size_t m_count = 0;
+    std::size_t m_consumed = 0;
+    std::size_t m_position = 0;
+};
+
+/// Read a complete array document into a vector
+///
+/// @example
+/// ```cpp
+/// auto samples = json::read_array<meter_t<double>>(R"({"unit":"km","values":[1,2.5]})");
+/// // samples->at(1) == 2500 m
+/// ```
+template <details::stream_element_c ElementT>
+auto read_array(std::string_view text) -> expected_t<std::vector<ElementT>, stream_error>
+{
+    using result_t = expected_t<std::vector<ElementT>, stream_error>;
+    std::vector<ElementT> samples;
+    stream_reader<ElementT> reader;
+    if (auto fed = reader.feed(text, [&](const ElementT& element) { samples.push_back(element); }); !fed)
+    {
+        return result_t{fed.error()};
+    }
+    if (auto finished = reader.finish(); !finished)
+    {
+        return result_t{finished.error()};
+    }
+    return result_t{std::move(samples)};
+}
+
+/// Read a complete series document into a vector of (time, sample) pairs
+template <is_pkr_unit_c TimeT, details::stream_element_c ElementT>
+auto read_series(std::string_view text) -> expected_t<std::vector<std::pair<TimeT, ElementT>>, stream_error>
+{
+    using result_t = expected_t<std::vector<std::pair<TimeT, ElementT>>, stream_error>;
+    std::vector<std::pair<TimeT, ElementT>> samples;
+    stream_reader<ElementT, TimeT> reader;
+    if (auto fed = reader.feed(text, [&](const TimeT& time, const ElementT& element) { samples.emplace_back(time, element); }); !fed)
+    {
+        return result_t{fed.error()};
+    }
+    if (auto finished = reader.finish(); !finished)
+    {
+        return result_t{finished.error()};
+    }
+    return result_t{std::move(samples)};
+}
+
+} // namespace PKR_UNITS_NAMESPACE::json
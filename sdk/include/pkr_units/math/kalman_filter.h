@@ -0,0 +1,561 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/units/math/dimensioned_matrix.h>
+#include <pkr_units/measurements/decl/measurement_rss_decl.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Unit-aware Kalman filters
+// ============================================================================
+//
+// State and measurement vectors are dimensioned vectors (see
+// dimensioned_matrix.h), so every model matrix has a fixed, compile-time
+// checked type:
+//
+//   F  transition_type          x_i / x_j
+//   Q  process_noise_type       x_i * x_j
+//   H  observation_type         z_i / x_j
+//   R  measurement_noise_type   z_i * z_j
+//
+// Passing a matrix built for a different state or measurement layout is a
+// compile error. All storage is fixed-size; the single-track filters never
+// allocate and are usable in constant expressions (except estimate(), which
+// takes a square root).
+//
+// Example:
+//   using state_t = unit_vector_t<meter_t<double>, meter_per_second_t<double>>;
+//   using meas_t = unit_vector_t<meter_t<double>>;
+//   kalman_filter_t<state_t, meas_t> kf{x0, p0};
+//   kf.predict(f, q);
+//   kf.update(z, h, r);
+//   measurement_rss_t<meter_t<double>> position = kf.estimate<0>();
+
+template <dimensioned_vector_c state_t, dimensioned_vector_c measurement_t>
+class kalman_filter_t
+{
+    static_assert(
+        std::is_same_v<typename state_t::value_type, typename measurement_t::value_type>,
+        "kalman_filter_t: state and measurement vectors must share a value type");
+    static_assert(std::is_floating_point_v<typename state_t::value_type>, "kalman_filter_t: value type must be a floating point type");
+
+public:
+    using value_type = typename state_t::value_type;
+    using state_type = state_t;
+    using measurement_type = measurement_t;
+    using state_dimensions = typename state_t::row_dimensions;
+    using measurement_dimensions = typename measurement_t::row_dimensions;
+
+    using covariance_type = covariance_matrix_t<value_type, state_dimensions>;
+    using transition_type = jacobian_matrix_t<value_type, state_dimensions, state_dimensions>;
+    using process_noise_type = covariance_type;
+    using observation_type = jacobian_matrix_t<value_type, measurement_dimensions, state_dimensions>;
+    using measurement_noise_type = covariance_matrix_t<value_type, measurement_dimensions>;
+    using innovation_covariance_type = measurement_noise_type;
+    using gain_type = jacobian_matrix_t<value_type, state_dimensions, measurement_dimensions>;
+
+    static constexpr std::size_t state_size = state_t::row_count;
+    static constexpr std::size_t measurement_size = measurement_t::row_count;
+
+    constexpr kalman_filter_t(const state_type& initial_state, const covariance_type& initial_covariance) noexcept
+        : m_state(initial_state)
+        , m_covariance(initial_covariance)
+    {
+    }
+
+    // Time update: x = F x, P = F P F^T + Q
+    constexpr void predict(const transition_type& transition, const process_noise_type& process_noise) noexcept
+    {
+        m_state = transition * m_state;
+        m_covariance = transition * m_covariance * transpose(transition) + process_noise;
+    }
+
+    // Measurement update with a linear observation model z = H x + v, v ~ N(0, R)
+    // Throws std::invalid_argument if the innovation covariance is singular.
+    constexpr void update(const measurement_type& measurement, const observation_type& observation, const measurement_noise_type& measurement_noise)
+    {
+        correct(measurement - observation * m_state, observation, measurement_noise);
+    }
+
+    [[nodiscard]] constexpr const state_type& state() const noexcept
+    {
+        return m_state;
+    }
+
+    [[nodiscard]] constexpr const covariance_type& covariance() const noexcept
+    {
+        return m_covariance;
+    }
+
+    [[nodiscard]] constexpr const measurement_type& innovation() const noexcept
+    {
+        return m_innovation;
+    }
+
+    [[nodiscard]] constexpr const innovation_covariance_type& innovation_covariance() const noexcept
+    {
+        return m_innovation_covariance;
+    }
+
+    // Normalized innovation squared y^T S^-1 y of the last update (dimensionless, chi-square gating)
+    [[nodiscard]] constexpr value_type normalized_innovation_squared() const
+    {
+        return (transpose(m_innovation) * inverse(m_innovation_covariance) * m_innovation).si_element(0, 0);
+    }
+
+    // State element index_v as a measurement with standard deviation sqrt(P_ii)
+    template <std::size_t index_v>
+    [[nodiscard]] auto estimate() const
+    {
+        static_assert(index_v < state_size, "kalman_filter_t::estimate: index out of range");
+        using unit_type = typename state_type::template element_type<index_v>;
+        return measurement_rss_t<unit_type>{m_state.template get<index_v>(), unit_type{std::sqrt(m_covariance.si_element(index_v, index_v))}};
+    }
+
+protected:
+    // Correction step shared by the linear and extended filters (Joseph form keeps P symmetric positive semi-definite)
+    constexpr void correct(const measurement_type& innovation, const observation_type& observation, const measurement_noise_type& measurement_noise)
+    {
+        const auto pht = m_covariance * transpose(observation);
+        const innovation_covariance_type s = observation * pht + measurement_noise;
+        const gain_type gain = pht * inverse(s);
+
+        m_state += gain * innovation;
+
+        const transition_type i_kh = transition_type::identity() - gain * observation;
+        m_covariance = i_kh * m_covariance * transpose(i_kh) + gain * measurement_noise * transpose(gain);
+
+        m_innovation = innovation;
+        m_innovation_covariance = s;
+    }
+
+    state_type m_state;
+    covariance_type m_covariance;
+    measurement_type m_innovation{};
+    innovation_covariance_type m_innovation_covariance{};
+};
+
+// ============================================================================
+// Extended Kalman filter
+// ============================================================================
+// Non-linear models f(x) and h(x) are passed as callables; their Jacobians are
+// either passed as matrices or as callables evaluated at the prior state.
+template <dimensioned_vector_c state_t, dimensioned_vector_c measurement_t>
+class extended_kalman_filter_t : public kalman_filter_t<state_t, measurement_t>
+{
+    using base_type = kalman_filter_t<state_t, measurement_t>;
+
+public:
+    using typename base_type::covariance_type;
+    using typename base_type::measurement_noise_type;
+    using typename base_type::measurement_type;
+    using typename base_type::observation_type;
+    using typename base_type::process_noise_type;
+    using typename base_type::state_type;
+    using typename base_type::transition_type;
+
+    using base_type::base_type;
+    using base_type::predict;
+    using base_type::update;
+
+    // x = f(x), P = F P F^T + Q with F = df/dx at the prior state
+    template <typename transition_fn, typename jacobian_fn>
+        requires std::is_invocable_r_v<state_type, transition_fn, const state_type&> &&
+                 std::is_invocable_r_v<transition_type, jacobian_fn, const state_type&>
+    constexpr void predict(transition_fn&& transition, jacobian_fn&& jacobian, const process_noise_type& process_noise)
+    {
+        const transition_type f = std::forward<jacobian_fn>(jacobian)(this->m_state);
+        this->m_state = std::forward<transition_fn>(transition)(this->m_state);
+        this->m_covariance = f * this->m_covariance * transpose(f) + process_noise;
+    }
+
+    // y = z - h(x), correction with H = dh/dx at the prior state
+    template <typename observation_fn, typename jacobian_fn>
+        requires std::is_invocable_r_v<measurement_type, observation_fn, const state_type&> &&
+                 std::is_invocable_r_v<observation_type, jacobian_fn, const state_type&>
+    constexpr void update(
+        const measurement_type& measurement, observation_fn&& observation, jacobian_fn&& jacobian, const measurement_noise_type& measurement_noise)
+    {
+        const observation_type h = std::forward<jacobian_fn>(jacobian)(this->m_state);
+        this->correct(measurement - std::forward<observation_fn>(observation)(this->m_state), h, measurement_noise);
+    }
+};
+
+// ============================================================================
+// Batched Kalman filter ("many small filters")
+// ============================================================================
+// Runs the same linear model over many independent tracks. Storage is
+// structure-of-arrays: component c of track t lives at [c * track_count + t],
+// so every step is a sequence of unit-stride loops over tracks that the
+// compiler vectorizes. The innovation covariance is factored with a lane-wise
+// Cholesky decomposition (no pivoting, no branches per track).
+//
+// All buffers, including the scratch workspace, are allocated once in the
+// constructor from the supplied memory resource; predict() and update() never
+// allocate.
+template <dimensioned_vector_c state_t, dimensioned_vector_c measurement_t>
+class kalman_filter_batch_t
+{
+    using filter_type = kalman_filter_t<state_t, measurement_t>;
+
+public:
+    using value_type = typename filter_type::value_type;
+    using state_type = typename filter_type::state_type;
+    using measurement_type = typename filter_type::measurement_type;
+    using covariance_type = typename filter_type::covariance_type;
+    using transition_type = typename filter_type::transition_type;
+    using process_noise_type = typename filter_type::process_noise_type;
+    using observation_type = typename filter_type::observation_type;
+    using measurement_noise_type = typename filter_type::measurement_noise_type;
+    using allocator_type = std::pmr::polymorphic_allocator<value_type>;
+
+    static constexpr std::size_t state_size = filter_type::state_size;
+    static constexpr std::size_t measurement_size = filter_type::measurement_size;
+
+    explicit kalman_filter_batch_t(std::size_t track_count, const allocator_type& alloc = allocator_type())
+        : m_track_count(track_count)
+        , m_state(state_size * track_count, value_type{0}, alloc)
+        , m_covariance(state_size * state_size * track_count, value_type{0}, alloc)
+        , m_workspace(workspace_lanes * track_count, value_type{0}, alloc)
+    {
+    }
+
+    [[nodiscard]] std::size_t track_count() const noexcept
+    {
+        return m_track_count;
+    }
+
+    void set_track(std::size_t track, const state_type& x, const covariance_type& p)
+    {
+        check_track(track);
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            m_state[(i * m_track_count) + track] = x.si_element(i, 0);
+            for (std::size_t j = 0; j < state_size; ++j)
+            {
+                m_covariance[(((i * state_size) + j) * m_track_count) + track] = p.si_element(i, j);
+            }
+        }
+    }
+
+    [[nodiscard]] state_type state(std::size_t track) const
+    {
+        check_track(track);
+        state_type x{};
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            x.si_element(i, 0) = m_state[(i * m_track_count) + track];
+        }
+        return x;
+    }
+
+    [[nodiscard]] covariance_type covariance(std::size_t track) const
+    {
+        check_track(track);
+        covariance_type p{};
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            for (std::size_t j = 0; j < state_size; ++j)
+            {
+                p.si_element(i, j) = m_covariance[(((i * state_size) + j) * m_track_count) + track];
+            }
+        }
+        return p;
+    }
+
+    template <std::size_t index_v>
+    [[nodiscard]] auto estimate(std::size_t track) const
+    {
+        static_assert(index_v < state_size, "kalman_filter_batch_t::estimate: index out of range");
+        check_track(track);
+        using unit_type = typename state_type::template element_type<index_v>;
+        const value_type variance = m_covariance[(((index_v * state_size) + index_v) * m_track_count) + track];
+        return measurement_rss_t<unit_type>{unit_type{m_state[(index_v * m_track_count) + track]}, unit_type{std::sqrt(variance)}};
+    }
+
+    // Time update for every track with a shared model (zero entries of F are skipped)
+    void predict(const transition_type& transition, const process_noise_type& process_noise) noexcept
+    {
+        const std::size_t n = m_track_count;
+        value_type* fp = m_workspace.data();
+        value_type* x_new = fp + (state_size * state_size * n);
+
+        // x' = F x
+        std::fill(x_new, x_new + (state_size * n), value_type{0});
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            for (std::size_t j = 0; j < state_size; ++j)
+            {
+                const value_type f_ij = transition.si_element(i, j);
+                if (f_ij == value_type{0})
+                {
+                    continue;
+                }
+                axpy(x_new + (i * n), f_ij, m_state.data() + (j * n), n);
+            }
+        }
+        std::copy(x_new, x_new + (state_size * n), m_state.begin());
+
+        // FP = F P
+        std::fill(fp, fp + (state_size * state_size * n), value_type{0});
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            for (std::size_t j = 0; j < state_size; ++j)
+            {
+                const value_type f_ij = transition.si_element(i, j);
+                if (f_ij == value_type{0})
+                {
+                    continue;
+                }
+                for (std::size_t k = 0; k < state_size; ++k)
+                {
+                    axpy(fp + (((i * state_size) + k) * n), f_ij, p_lane(j, k), n);
+                }
+            }
+        }
+
+        // P = FP F^T + Q
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            for (std::size_t l = 0; l < state_size; ++l)
+            {
+                value_type* out = p_lane(i, l);
+                std::fill(out, out + n, process_noise.si_element(i, l));
+                for (std::size_t k = 0; k < state_size; ++k)
+                {
+                    const value_type f_lk = transition.si_element(l, k);
+                    if (f_lk == value_type{0})
+                    {
+                        continue;
+                    }
+                    axpy(out, f_lk, fp + (((i * state_size) + k) * n), n);
+                }
+            }
+        }
+    }
+
+    // Measurement update, one measurement per track.
+    // Throws std::invalid_argument (leaving every track unchanged) if any innovation covariance is not positive definite.
+    void update(std::span<const measurement_type> measurements, const observation_type& observation, const measurement_noise_type& measurement_noise)
+    {
+        const std::size_t n = m_track_count;
+        if (measurements.size() != n)
+        {
+            throw std::invalid_argument("kalman_filter_batch_t::update: one measurement per track is required");
+        }
+
+        value_type* y = m_workspace.data();
+        value_type* pht = y + (measurement_size * n);
+        value_type* gain = pht + (state_size * measurement_size * n);
+        value_type* chol = gain + (state_size * measurement_size * n);
+
+        // y = z - H x
+        for (std::size_t a = 0; a < measurement_size; ++a)
+        {
+            value_type* y_a = y + (a * n);
+            for (std::size_t t = 0; t < n; ++t)
+            {
+                y_a[t] = measurements[t].si_element(a, 0);
+            }
+            for (std::size_t j = 0; j < state_size; ++j)
+            {
+                const value_type h_aj = observation.si_element(a, j);
+                if (h_aj == value_type{0})
+                {
+                    continue;
+                }
+                axpy(y_a, -h_aj, m_state.data() + (j * n), n);
+            }
+        }
+
+        // PH^T
+        std::fill(pht, pht + (state_size * measurement_size * n), value_type{0});
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            for (std::size_t a = 0; a < measurement_size; ++a)
+            {
+                for (std::size_t j = 0; j < state_size; ++j)
+                {
+                    const value_type h_aj = observation.si_element(a, j);
+                    if (h_aj == value_type{0})
+                    {
+                        continue;
+                    }
+                    axpy(pht + (((i * measurement_size) + a) * n), h_aj, p_lane(i, j), n);
+                }
+            }
+        }
+
+        // S = H P H^T + R (lower triangle), factored in place as S = L L^T
+        for (std::size_t a = 0; a < measurement_size; ++a)
+        {
+            for (std::size_t b = 0; b <= a; ++b)
+            {
+                value_type* s_ab = chol + (((a * measurement_size) + b) * n);
+                std::fill(s_ab, s_ab + n, measurement_noise.si_element(a, b));
+                for (std::size_t i = 0; i < state_size; ++i)
+                {
+                    const value_type h_ai = observation.si_element(a, i);
+                    if (h_ai == value_type{0})
+                    {
+                        continue;
+                    }
+                    axpy(s_ab, h_ai, pht + (((i * measurement_size) + b) * n), n);
+                }
+            }
+        }
+
+        bool positive_definite = true;
+        for (std::size_t a = 0; a < measurement_size; ++a)
+        {
+            for (std::size_t b = 0; b <= a; ++b)
+            {
+                value_type* l_ab = chol + (((a * measurement_size) + b) * n);
+                for (std::size_t c = 0; c < b; ++c)
+                {
+                    const value_type* l_ac = chol + (((a * measurement_size) + c) * n);
+                    const value_type* l_bc = chol + (((b * measurement_size) + c) * n);
+                    for (std::size_t t = 0; t < n; ++t)
+                    {
+                        l_ab[t] -= l_ac[t] * l_bc[t];
+                    }
+                }
+                if (a == b)
+                {
+                    for (std::size_t t = 0; t < n; ++t)
+                    {
+                        positive_definite = positive_definite && (l_ab[t] > value_type{0});
+                        l_ab[t] = std::sqrt(l_ab[t]);
+                    }
+                }
+                else
+                {
+                    const value_type* l_bb = chol + (((b * measurement_size) + b) * n);
+                    for (std::size_t t = 0; t < n; ++t)
+                    {
+                        l_ab[t] /= l_bb[t];
+                    }
+                }
+            }
+        }
+        if (!positive_definite)
+        {
+            throw std::invalid_argument("kalman_filter_batch_t::update: innovation covariance is not positive definite");
+        }
+
+        // K = PH^T S^-1: solve L L^T k_i = (PH^T)_i for every state row i
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            for (std::size_t a = 0; a < measurement_size; ++a)
+            {
+                value_type* w_a = gain + (((i * measurement_size) + a) * n);
+                const value_type* rhs = pht + (((i * measurement_size) + a) * n);
+                const value_type* l_aa = chol + (((a * measurement_size) + a) * n);
+                std::copy(rhs, rhs + n, w_a);
+                for (std::size_t c = 0; c < a; ++c)
+                {
+                    const value_type* l_ac = chol + (((a * measurement_size) + c) * n);
+                    const value_type* w_c = gain + (((i * measurement_size) + c) * n);
+                    for (std::size_t t = 0; t < n; ++t)
+                    {
+                        w_a[t] -= l_ac[t] * w_c[t];
+                    }
+                }
+                for (std::size_t t = 0; t < n; ++t)
+                {
+                    w_a[t] /= l_aa[t];
+                }
+            }
+            for (std::size_t a = measurement_size; a-- > 0;)
+            {
+                value_type* k_a = gain + (((i * measurement_size) + a) * n);
+                const value_type* l_aa = chol + (((a * measurement_size) + a) * n);
+                for (std::size_t c = a + 1; c < measurement_size; ++c)
+                {
+                    const value_type* l_ca = chol + (((c * measurement_size) + a) * n);
+                    const value_type* k_c = gain + (((i * measurement_size) + c) * n);
+                    for (std::size_t t = 0; t < n; ++t)
+                    {
+                        k_a[t] -= l_ca[t] * k_c[t];
+                    }
+                }
+                for (std::size_t t = 0; t < n; ++t)
+                {
+                    k_a[t] /= l_aa[t];
+                }
+            }
+        }
+
+        // x += K y, P -= K (PH^T)^T
+        for (std::size_t i = 0; i < state_size; ++i)
+        {
+            value_type* x_i = m_state.data() + (i * n);
+            for (std::size_t a = 0; a < measurement_size; ++a)
+            {
+                const value_type* k_ia = gain + (((i * measurement_size) + a) * n);
+                const value_type* y_a = y + (a * n);
+                for (std::size_t t = 0; t < n; ++t)
+                {
+                    x_i[t] += k_ia[t] * y_a[t];
+                }
+            }
+            for (std::size_t j = 0; j < state_size; ++j)
+            {
+                value_type* p_ij = p_lane(i, j);
+                for (std::size_t a = 0; a < measurement_size; ++a)
+                {
+                    const value_type* k_ia = gain + (((i * measurement_size) + a) * n);
+                    const value_type* pht_ja = pht + (((j * measurement_size) + a) * n);
+                    for (std::size_t t = 0; t < n; ++t)
+                    {
+                        p_ij[t] -= k_ia[t] * pht_ja[t];
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t predict_lanes = (state_size * state_size) + state_size;
+    static constexpr std::size_t update_lanes = measurement_size + (2 * state_size * measurement_size) + (measurement_size * measurement_size);
+    static constexpr std::size_t workspace_lanes = predict_lanes > update_lanes ? predict_lanes : update_lanes;
+
+    static void axpy(value_type* out, value_type factor, const value_type* in, std::size_t count) noexcept
+    {
+        for (std::size_t t = 0; t < count; ++t)
+        {
+            out[t] += factor * in[t];
+        }
+    }
+
+    value_type* p_lane(std::size_t row, std::size_t col) noexcept
+    {
+        return m_covariance.data() + (((row * state_size) + col) * m_track_count);
+    }
+
+    void check_track(std::size_t track) const
+    {
+        if (track >= m_track_count)
+        {
+            throw std::out_of_range("kalman_filter_batch_t: track index out of range");
+        }
+    }
+
+    std::size_t m_track_count;
+    std::pmr::vector<value_type> m_state;
+    std::pmr::vector<value_type> m_covariance;
+    std::pmr::vector<value_type> m_workspace;
+};
+
+} // namespace PKR_UNITS_NAMESPACE
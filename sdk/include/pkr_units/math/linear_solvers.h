@@ -0,0 +1,666 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/impl/linalg/backend_kernels.h>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
+#include <pkr_units/units/math/dimensioned_matrix.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Dimensioned linear solvers
+// ============================================================================
+//
+// Factorizations of dimensioned matrices (see dimensioned_matrix.h) that solve
+// A x = b with the unit type of x derived from A and b at compile time: x has
+// the type of inverse(A) * b, so a right-hand side whose rows do not match the
+// rows of A fails to compile. b may hold several right-hand sides as columns.
+//
+//   lu_decomposition_t        square A, blocked LU with partial pivoting
+//   cholesky_decomposition_t  symmetric positive definite A (covariances)
+//   qr_decomposition_t        rows >= cols, Householder QR for least squares
+//
+// The factorizations work on the SI values in place, row-major. LU and
+// Cholesky are right-looking and blocked by solver_block_size columns; the
+// trailing update is a sequence of row updates with the axpy_row kernel and is
+// split across a work_stealing_pool once it has solver_parallel_rows rows or
+// more; with an Eigen/BLAS backend selected (impl/linalg/backend_kernels.h)
+// the LU trailing update is a single backend GEMM instead. Smaller systems
+// (e.g. thousands of 50x50 solves per second) never touch the pool and, up to
+// 32x32, never allocate.
+//
+// Like inverse(), a pivot that is exactly zero throws std::invalid_argument.
+//
+// Example:
+//   using state_t = unit_vector_t<meter_t<double>, meter_per_second_t<double>>;
+//   covariance_matrix_t<double, state_t::row_dimensions> p = ...;
+//   cholesky_decomposition_t chol{p};
+//   auto x = chol.solve(b);               // P^-1 b, units checked
+//   auto d2 = chol.squared_mahalanobis(r); // r^T P^-1 r, dimensionless
+
+namespace details
+{
+
+inline constexpr std::size_t solver_block_size = 32;
+inline constexpr std::size_t solver_parallel_rows = 256;
+inline constexpr std::size_t solver_parallel_grain = 16;
+
+// Result of inverse(A) * b for A (rows_a, cols_a) and b (rows_b, cols_b): (cols_a + delta, cols_b)
+template <typename type_t, typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+using solve_result_t = typename dimensioned_product<type_t, cols_a_t, rows_a_t, rows_b_t, cols_b_t>::type;
+
+// Element (i, j) and (j, i) share a dimension when rows[i] + cols[i] is the same for every i
+template <typename row_dims_t, typename col_dims_t>
+constexpr bool symmetric_dimensions() noexcept
+{
+    if constexpr (row_dims_t::size != col_dims_t::size)
+    {
+        return false;
+    }
+    else
+    {
+        const dimension_t sum = add_dimensions(row_dims_t::values[0], col_dims_t::values[0]);
+        for (std::size_t i = 1; i < row_dims_t::size; ++i)
+        {
+            if (add_dimensions(row_dims_t::values[i], col_dims_t::values[i]) != sum)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+// Dimension of det(A): sum of rows[i] - cols[i]
+template <typename row_dims_t, typename col_dims_t>
+constexpr dimension_t determinant_dimension() noexcept
+{
+    dimension_t result{};
+    for (std::size_t i = 0; i < row_dims_t::size; ++i)
+    {
+        result = add_dimensions(result, subtract_dimensions(row_dims_t::values[i], col_dims_t::values[i]));
+    }
+    return result;
+}
+
+// Run fn(row_begin, row_end) over [begin, end), on the pool when the range is large enough
+template <typename fn_t>
+void for_each_row_block(std::size_t begin, std::size_t end, work_stealing_pool* pool, fn_t&& fn)
+{
+    if (pool != nullptr && end - begin >= solver_parallel_rows)
+    {
+        pool->parallel_for(begin, end, solver_parallel_grain, fn);
+    }
+    else if (begin < end)
+    {
+        fn(begin, end);
+    }
+}
+
+template <std::size_t n_v>
+work_stealing_pool* default_solver_pool() noexcept
+{
+    if constexpr (n_v >= solver_parallel_rows)
+    {
+        return &work_stealing_pool::shared();
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+// Copy b into the SI storage of a default-constructed result of the same shape
+template <typename result_t, typename matrix_t>
+result_t copy_si_elements(const matrix_t& b)
+{
+    static_assert(result_t::row_count == matrix_t::row_count && result_t::col_count == matrix_t::col_count);
+    result_t x{};
+    std::copy(b.si_elements().begin(), b.si_elements().end(), x.si_elements().begin());
+    return x;
+}
+
+} // namespace details
+
+// ============================================================================
+// LU decomposition with partial pivoting
+// ============================================================================
+//
+// P A = L U with unit lower triangular L and upper triangular U, both packed
+// into one n x n array. Row interchanges are applied to whole rows as they are
+// chosen, so pivots()[k] is the row swapped with row k at step k.
+template <is_unit_value_type_c type_t, typename row_dims_t, typename col_dims_t>
+    requires std::is_floating_point_v<type_t>
+class lu_decomposition_t
+{
+    static_assert(row_dims_t::size == col_dims_t::size, "lu_decomposition_t: matrix must be square");
+
+public:
+    using matrix_type = dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>;
+    using value_type = type_t;
+    static constexpr std::size_t size = row_dims_t::size;
+
+    using determinant_type = typename derived_unit_type_t<type_t, std::ratio<1, 1>, details::determinant_dimension<row_dims_t, col_dims_t>()>::type;
+
+    // Factorizes on the shared pool when the matrix has solver_parallel_rows rows or more.
+    // Throws std::invalid_argument when the matrix is singular.
+    explicit lu_decomposition_t(const matrix_type& a)
+        : lu_decomposition_t(a, details::default_solver_pool<size>())
+    {
+    }
+
+    lu_decomposition_t(const matrix_type& a, work_stealing_pool& pool)
+        : lu_decomposition_t(a, &pool)
+    {
+    }
+
+    // x with A x = b
+    template <typename rows_b_t, typename cols_b_t>
+    [[nodiscard]] auto solve(const dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& b) const
+    {
+        static_assert(rows_b_t::size == size, "lu_decomposition_t::solve: right-hand side must have one row per matrix row");
+        using result_t = details::solve_result_t<type_t, row_dims_t, col_dims_t, rows_b_t, cols_b_t>;
+        constexpr std::size_t m = cols_b_t::size;
+
+        result_t x = details::copy_si_elements<result_t>(b);
+        type_t* v = x.si_elements().data();
+        const type_t* lu = m_lu.data();
+        for (std::size_t k = 0; k < size; ++k)
+        {
+            if (m_pivots[k] != k)
+            {
+                std::swap_ranges(v + (k * m), v + ((k + 1) * m), v + (m_pivots[k] * m));
+            }
+        }
+        // L y = P b
+        for (std::size_t i = 1; i < size; ++i)
+        {
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                details::axpy_row(-lu[(i * size) + k], v + (k * m), v + (i * m), m);
+            }
+        }
+        // U x = y
+        for (std::size_t i = size; i-- > 0;)
+        {
+            for (std::size_t k = i + 1; k < size; ++k)
+            {
+                details::axpy_row(-lu[(i * size) + k], v + (k * m), v + (i * m), m);
+            }
+            const type_t inv_pivot = static_cast<type_t>(1) / lu[(i * size) + i];
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                v[(i * m) + j] *= inv_pivot;
+            }
+        }
+        return x;
+    }
+
+    [[nodiscard]] determinant_type determinant() const noexcept
+    {
+        type_t det = m_sign;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            det *= m_lu[(i * size) + i];
+        }
+        return determinant_type{det};
+    }
+
+    // Packed L (below the diagonal, unit diagonal implied) and U in SI units
+    [[nodiscard]] const typename matrix_type::array_type& si_factors() const noexcept
+    {
+        return m_lu;
+    }
+
+    [[nodiscard]] const std::array<std::size_t, size>& pivots() const noexcept
+    {
+        return m_pivots;
+    }
+
+private:
+    lu_decomposition_t(const matrix_type& a, work_stealing_pool* pool)
+        : m_lu(a.si_elements())
+    {
+        factorize(pool);
+    }
+
+    void factorize(work_stealing_pool* pool)
+    {
+        constexpr std::size_t n = size;
+        type_t* lu = m_lu.data();
+        for (std::size_t j0 = 0; j0 < n; j0 += details::solver_block_size)
+        {
+            const std::size_t j1 = std::min(j0 + details::solver_block_size, n);
+
+            // Panel: unblocked LU of columns [j0, j1) over rows [j0, n)
+            for (std::size_t j = j0; j < j1; ++j)
+            {
+                std::size_t pivot = j;
+                for (std::size_t i = j + 1; i < n; ++i)
+                {
+                    if (details::abs_value(lu[(i * n) + j]) > details::abs_value(lu[(pivot * n) + j]))
+                    {
+                        pivot = i;
+                    }
+                }
+                if (lu[(pivot * n) + j] == static_cast<type_t>(0))
+                {
+                    throw std::invalid_argument("lu_decomposition_t: matrix is singular");
+                }
+                m_pivots[j] = pivot;
+                if (pivot != j)
+                {
+                    std::swap_ranges(lu + (j * n), lu + ((j + 1) * n), lu + (pivot * n));
+                    m_sign = -m_sign;
+                }
+
+                const type_t inv_pivot = static_cast<type_t>(1) / lu[(j * n) + j];
+                for (std::size_t i = j + 1; i < n; ++i)
+                {
+                    lu[(i * n) + j] *= inv_pivot;
+                    details::axpy_row(-lu[(i * n) + j], lu + (j * n) + j + 1, lu + (i * n) + j + 1, j1 - j - 1);
+                }
+            }
+            if (j1 == n)
+            {
+                break;
+            }
+
+            // U12 = L11^-1 A12
+            for (std::size_t j = j0; j < j1; ++j)
+            {
+                for (std::size_t i = j + 1; i < j1; ++i)
+                {
+                    details::axpy_row(-lu[(i * n) + j], lu + (j * n) + j1, lu + (i * n) + j1, n - j1);
+                }
+            }
+
+            // A22 -= L21 U12, on the Eigen/BLAS backend when one is selected
+            if constexpr (details::linalg_backend_enabled_v<type_t>)
+            {
+                if ((n - j1) * (n - j1) * (j1 - j0) >= details::linalg_backend_min_work)
+                {
+                    details::backend_gemm(lu + (j1 * n) + j0, n, lu + (j0 * n) + j1, n, lu + (j1 * n) + j1, n, n - j1, j1 - j0, n - j1, static_cast<type_t>(-1));
+                    continue;
+                }
+            }
+            details::for_each_row_block(
+                j1,
+                n,
+                pool,
+                [lu, j0, j1](std::size_t row_begin, std::size_t row_end)
+                {
+                    for (std::size_t i = row_begin; i < row_end; ++i)
+                    {
+                        for (std::size_t k = j0; k < j1; ++k)
+                        {
+                            details::axpy_row(-lu[(i * n) + k], lu + (k * n) + j1, lu + (i * n) + j1, n - j1);
+                        }
+                    }
+                });
+        }
+    }
+
+    typename matrix_type::array_type m_lu;
+    std::array<std::size_t, size> m_pivots{};
+    type_t m_sign{1};
+};
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+lu_decomposition_t(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>&) -> lu_decomposition_t<type_t, row_dims_t, col_dims_t>;
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+lu_decomposition_t(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>&, work_stealing_pool&) -> lu_decomposition_t<type_t, row_dims_t, col_dims_t>;
+
+// ============================================================================
+// Cholesky decomposition
+// ============================================================================
+//
+// A = L L^T for symmetric positive definite A, L lower triangular. The matrix
+// must have symmetric dimensions (element (i, j) and (j, i) alike), which every
+// covariance_matrix_t has; only the lower triangle of A is read. Throws
+// std::invalid_argument when A is not positive definite.
+template <is_unit_value_type_c type_t, typename row_dims_t, typename col_dims_t>
+    requires std::is_floating_point_v<type_t>
+class cholesky_decomposition_t
+{
+    static_assert(row_dims_t::size == col_dims_t::size, "cholesky_decomposition_t: matrix must be square");
+    static_assert(details::symmetric_dimensions<row_dims_t, col_dims_t>(), "cholesky_decomposition_t: matrix dimensions must be symmetric");
+
+public:
+    using matrix_type = dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>;
+    using value_type = type_t;
+    static constexpr std::size_t size = row_dims_t::size;
+
+    explicit cholesky_decomposition_t(const matrix_type& a)
+        : cholesky_decomposition_t(a, details::default_solver_pool<size>())
+    {
+    }
+
+    cholesky_decomposition_t(const matrix_type& a, work_stealing_pool& pool)
+        : cholesky_decomposition_t(a, &pool)
+    {
+    }
+
+    // x with A x = b
+    template <typename rows_b_t, typename cols_b_t>
+    [[nodiscard]] auto solve(const dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& b) const
+    {
+        static_assert(rows_b_t::size == size, "cholesky_decomposition_t::solve: right-hand side must have one row per matrix row");
+        using result_t = details::solve_result_t<type_t, row_dims_t, col_dims_t, rows_b_t, cols_b_t>;
+        constexpr std::size_t m = cols_b_t::size;
+
+        result_t x = details::copy_si_elements<result_t>(b);
+        type_t* v = x.si_elements().data();
+        forward_substitute(v, m);
+        // L^T x = y, one row of L at a time
+        const type_t* l = m_l.data();
+        for (std::size_t i = size; i-- > 0;)
+        {
+            const type_t inv_diagonal = static_cast<type_t>(1) / l[(i * size) + i];
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                v[(i * m) + j] *= inv_diagonal;
+            }
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                details::axpy_row(-l[(i * size) + k], v + (i * m), v + (k * m), m);
+            }
+        }
+        return x;
+    }
+
+    // r^T A^-1 r as ||L^-1 r||^2; dimensionless when r has the dimensions A is the covariance of
+    template <typename rows_b_t>
+    [[nodiscard]] auto squared_mahalanobis(const dimensioned_matrix_t<type_t, rows_b_t, dimension_list<scalar_dimension>>& r) const
+    {
+        using r_type = dimensioned_matrix_t<type_t, rows_b_t, dimension_list<scalar_dimension>>;
+        using result_t = typename decltype(transpose(std::declval<const r_type&>()) * std::declval<const details::solve_result_t<type_t, row_dims_t, col_dims_t, rows_b_t, dimension_list<scalar_dimension>>&>())::template element_type<0, 0>;
+
+        auto y = r.si_elements();
+        forward_substitute(y.data(), 1);
+        type_t sum{0};
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            sum += y[i] * y[i];
+        }
+        return result_t{sum};
+    }
+
+    // L in SI units (upper triangle zero)
+    [[nodiscard]] const typename matrix_type::array_type& si_factor() const noexcept
+    {
+        return m_l;
+    }
+
+private:
+    cholesky_decomposition_t(const matrix_type& a, work_stealing_pool* pool)
+        : m_l(a.si_elements())
+    {
+        factorize(pool);
+    }
+
+    // L y = b in place on an n x m row-major block
+    void forward_substitute(type_t* v, std::size_t m) const noexcept
+    {
+        const type_t* l = m_l.data();
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                details::axpy_row(-l[(i * size) + k], v + (k * m), v + (i * m), m);
+            }
+            const type_t inv_diagonal = static_cast<type_t>(1) / l[(i * size) + i];
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                v[(i * m) + j] *= inv_diagonal;
+            }
+        }
+    }
+
+    void factorize(work_stealing_pool* pool)
+    {
+        constexpr std::size_t n = size;
+        type_t* l = m_l.data();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::fill(l + (i * n) + i + 1, l + ((i + 1) * n), static_cast<type_t>(0));
+        }
+
+        for (std::size_t j0 = 0; j0 < n; j0 += details::solver_block_size)
+        {
+            const std::size_t j1 = std::min(j0 + details::solver_block_size, n);
+
+            // Panel: columns [j0, j1) over rows [j0, n); earlier blocks are already subtracted
+            for (std::size_t j = j0; j < j1; ++j)
+            {
+                type_t d = l[(j * n) + j];
+                for (std::size_t k = j0; k < j; ++k)
+                {
+                    d -= l[(j * n) + k] * l[(j * n) + k];
+                }
+                if (!(d > static_cast<type_t>(0)))
+                {
+                    throw std::invalid_argument("cholesky_decomposition_t: matrix is not positive definite");
+                }
+                const type_t l_jj = std::sqrt(d);
+                l[(j * n) + j] = l_jj;
+                for (std::size_t i = j + 1; i < n; ++i)
+                {
+                    type_t s = l[(i * n) + j];
+                    for (std::size_t k = j0; k < j; ++k)
+                    {
+                        s -= l[(i * n) + k] * l[(j * n) + k];
+                    }
+                    l[(i * n) + j] = s / l_jj;
+                }
+            }
+
+            // Lower triangle of A22 -= L21 L21^T; both operands are contiguous row segments
+            details::for_each_row_block(
+                j1,
+                n,
+                pool,
+                [l, j0, j1](std::size_t row_begin, std::size_t row_end)
+                {
+                    for (std::size_t i = row_begin; i < row_end; ++i)
+                    {
+                        const type_t* l_i = l + (i * n) + j0;
+                        for (std::size_t c = j1; c <= i; ++c)
+                        {
+                            const type_t* l_c = l + (c * n) + j0;
+                            type_t s{0};
+                            for (std::size_t k = 0; k < j1 - j0; ++k)
+                            {
+                                s += l_i[k] * l_c[k];
+                            }
+                            l[(i * n) + c] -= s;
+                        }
+                    }
+                });
+        }
+    }
+
+    typename matrix_type::array_type m_l;
+};
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+cholesky_decomposition_t(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>&) -> cholesky_decomposition_t<type_t, row_dims_t, col_dims_t>;
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+cholesky_decomposition_t(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>&, work_stealing_pool&)
+    -> cholesky_decomposition_t<type_t, row_dims_t, col_dims_t>;
+
+// ============================================================================
+// Householder QR decomposition
+// ============================================================================
+//
+// A = Q R for A with at least as many rows as columns. R is stored on and above
+// the diagonal; below it each column holds its Householder vector with the
+// leading 1 implied, and taus() the matching scale factors. Reflectors are
+// applied with row updates, so the trailing matrix is walked in storage order.
+//
+// solve() returns the least-squares solution minimizing ||A x - b|| in SI
+// units. When rows carry different dimensions their residuals are weighed in
+// SI, so scale each row by its measurement uncertainty first if that matters.
+// Throws std::invalid_argument when A does not have full column rank.
+template <is_unit_value_type_c type_t, typename row_dims_t, typename col_dims_t>
+    requires std::is_floating_point_v<type_t>
+class qr_decomposition_t
+{
+    static_assert(row_dims_t::size >= col_dims_t::size, "qr_decomposition_t: matrix must have at least as many rows as columns");
+
+public:
+    using matrix_type = dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>;
+    using value_type = type_t;
+    static constexpr std::size_t row_count = row_dims_t::size;
+    static constexpr std::size_t col_count = col_dims_t::size;
+
+    explicit qr_decomposition_t(const matrix_type& a)
+        : m_qr(a.si_elements())
+    {
+        constexpr std::size_t m = row_count;
+        constexpr std::size_t n = col_count;
+        type_t* qr = m_qr.data();
+        std::array<type_t, n> w{};
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            type_t norm_sq{0};
+            for (std::size_t i = j; i < m; ++i)
+            {
+                norm_sq += qr[(i * n) + j] * qr[(i * n) + j];
+            }
+            if (norm_sq == static_cast<type_t>(0))
+            {
+                throw std::invalid_argument("qr_decomposition_t: matrix does not have full column rank");
+            }
+
+            // H = I - tau v v^T maps column j onto beta e_j, v_j = 1
+            const type_t x0 = qr[(j * n) + j];
+            const type_t norm = std::sqrt(norm_sq);
+            const type_t beta = x0 < static_cast<type_t>(0) ? norm : -norm;
+            const type_t inv_v0 = static_cast<type_t>(1) / (x0 - beta);
+            for (std::size_t i = j + 1; i < m; ++i)
+            {
+                qr[(i * n) + j] *= inv_v0;
+            }
+            m_tau[j] = (beta - x0) / beta;
+            qr[(j * n) + j] = beta;
+
+            // Trailing columns: w = v^T A, A -= tau v w
+            const std::size_t width = n - j - 1;
+            if (width == 0)
+            {
+                continue;
+            }
+            std::copy(qr + (j * n) + j + 1, qr + ((j + 1) * n), w.begin());
+            for (std::size_t i = j + 1; i < m; ++i)
+            {
+                details::axpy_row(qr[(i * n) + j], qr + (i * n) + j + 1, w.data(), width);
+            }
+            details::axpy_row(-m_tau[j], w.data(), qr + (j * n) + j + 1, width);
+            for (std::size_t i = j + 1; i < m; ++i)
+            {
+                details::axpy_row(-m_tau[j] * qr[(i * n) + j], w.data(), qr + (i * n) + j + 1, width);
+            }
+        }
+    }
+
+    // Least-squares x minimizing ||A x - b||; exact when A is square
+    template <typename rows_b_t, typename cols_b_t>
+    [[nodiscard]] auto solve(const dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& b) const
+    {
+        static_assert(rows_b_t::size == row_count, "qr_decomposition_t::solve: right-hand side must have one row per matrix row");
+        using result_t = details::solve_result_t<type_t, row_dims_t, col_dims_t, rows_b_t, cols_b_t>;
+        constexpr std::size_t m = row_count;
+        constexpr std::size_t n = col_count;
+        constexpr std::size_t k = cols_b_t::size;
+
+        // Q^T b on a copy of b, then back substitution with the top n rows
+        auto y = b.si_elements();
+        type_t* v = y.data();
+        const type_t* qr = m_qr.data();
+        std::array<type_t, k> w{};
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            std::copy(v + (j * k), v + ((j + 1) * k), w.begin());
+            for (std::size_t i = j + 1; i < m; ++i)
+            {
+                details::axpy_row(qr[(i * n) + j], v + (i * k), w.data(), k);
+            }
+            details::axpy_row(-m_tau[j], w.data(), v + (j * k), k);
+            for (std::size_t i = j + 1; i < m; ++i)
+            {
+                details::axpy_row(-m_tau[j] * qr[(i * n) + j], w.data(), v + (i * k), k);
+            }
+        }
+
+        result_t x{};
+        type_t* out = x.si_elements().data();
+        std::copy(v, v + (n * k), out);
+        for (std::size_t i = n; i-- > 0;)
+        {
+            for (std::size_t c = i + 1; c < n; ++c)
+            {
+                details::axpy_row(-qr[(i * n) + c], out + (c * k), out + (i * k), k);
+            }
+            const type_t inv_diagonal = static_cast<type_t>(1) / qr[(i * n) + i];
+            for (std::size_t j = 0; j < k; ++j)
+            {
+                out[(i * k) + j] *= inv_diagonal;
+            }
+        }
+        return x;
+    }
+
+    // Packed R and Householder vectors in SI units
+    [[nodiscard]] const typename matrix_type::array_type& si_factors() const noexcept
+    {
+        return m_qr;
+    }
+
+    [[nodiscard]] const std::array<type_t, col_count>& taus() const noexcept
+    {
+        return m_tau;
+    }
+
+private:
+    typename matrix_type::array_type m_qr;
+    std::array<type_t, col_count> m_tau{};
+};
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+qr_decomposition_t(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>&) -> qr_decomposition_t<type_t, row_dims_t, col_dims_t>;
+
+// ============================================================================
+// Convenience functions
+// ============================================================================
+
+// x with A x = b for square A (LU with partial pivoting)
+template <typename type_t, typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+    requires std::is_floating_point_v<type_t>
+auto solve(const dimensioned_matrix_t<type_t, rows_a_t, cols_a_t>& a, const dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& b)
+{
+    return lu_decomposition_t<type_t, rows_a_t, cols_a_t>{a}.solve(b);
+}
+
+// x minimizing ||A x - b|| for A with at least as many rows as columns (Householder QR)
+template <typename type_t, typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+    requires std::is_floating_point_v<type_t>
+auto least_squares(const dimensioned_matrix_t<type_t, rows_a_t, cols_a_t>& a, const dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& b)
+{
+    return qr_decomposition_t<type_t, rows_a_t, cols_a_t>{a}.solve(b);
+}
+
+} // namespace PKR_UNITS_NAMESPACE
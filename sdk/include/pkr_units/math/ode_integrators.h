@@ -0,0 +1,449 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/units/base/time.h>
+#include <pkr_units/units/math/dimensioned_matrix.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// ODE integrators over unit-typed state
+// ============================================================================
+//
+// The state of a system is a dimensioned vector (e.g.
+// unit_vector_t<meter_t<double>, meter_per_second_t<double>>). Its time
+// derivative is the same vector divided by second_t, so the right-hand side
+// f(t, x) of dx/dt = f(t, x) must return time_derivative_t<state_t>
+// (here unit_vector_t<meter_per_second_t<double>, meter_per_second_squared_t<double>>).
+//
+// All integrators keep their stage vectors as members; state vectors are
+// fixed-size, so no step ever allocates.
+//
+//   rk4_integrator_t              classic fixed-step Runge-Kutta (order 4)
+//   dormand_prince_integrator_t   adaptive RK45 (DOPRI5) with error control
+//   velocity_verlet_integrator_t  symplectic, order 2 (q'' = a(q))
+//   yoshida_integrator_t          symplectic, order 4 (q'' = a(q))
+
+template <dimensioned_vector_c state_t>
+using time_derivative_t = dimensioned_vector_t<
+    typename state_t::value_type,
+    typename details::shift_dimension_list<typename state_t::row_dimensions, details::negate_dimension(time_dimension)>::type>;
+
+// Right-hand side of dx/dt = f(t, x)
+template <typename fn_t, typename state_t>
+concept ode_system_c = dimensioned_vector_c<state_t> &&
+                       std::is_invocable_r_v<time_derivative_t<state_t>, fn_t, second_t<typename state_t::value_type>, const state_t&>;
+
+// Acceleration field of a separable second-order system q'' = a(q)
+template <typename fn_t, typename position_t>
+concept acceleration_field_c = dimensioned_vector_c<position_t> &&
+                               std::is_invocable_r_v<time_derivative_t<time_derivative_t<position_t>>, fn_t, const position_t&>;
+
+namespace details
+{
+
+// out = x + h * sum(coefficients[s] * k[s])
+template <typename type_t, std::size_t size_v, std::size_t stages_v>
+constexpr void ode_combine(
+    std::array<type_t, size_v>& out,
+    const std::array<type_t, size_v>& x,
+    type_t h,
+    const std::array<type_t, stages_v>& coefficients,
+    const std::array<const std::array<type_t, size_v>*, stages_v>& k) noexcept
+{
+    for (std::size_t i = 0; i < size_v; ++i)
+    {
+        type_t sum{0};
+        for (std::size_t s = 0; s < stages_v; ++s)
+        {
+            sum += coefficients[s] * (*k[s])[i];
+        }
+        out[i] = x[i] + (h * sum);
+    }
+}
+
+template <typename type_t, std::size_t size_v>
+constexpr void ode_axpy(std::array<type_t, size_v>& out, type_t h, const std::array<type_t, size_v>& k) noexcept
+{
+    for (std::size_t i = 0; i < size_v; ++i)
+    {
+        out[i] += h * k[i];
+    }
+}
+
+} // namespace details
+
+// ============================================================================
+// Fixed-step Runge-Kutta 4
+// ============================================================================
+template <dimensioned_vector_c state_t>
+class rk4_integrator_t
+{
+public:
+    using state_type = state_t;
+    using value_type = typename state_t::value_type;
+    using derivative_type = time_derivative_t<state_t>;
+    using time_type = second_t<value_type>;
+
+    // Advance x from t by dt
+    template <typename system_fn>
+        requires ode_system_c<system_fn, state_t>
+    constexpr state_type step(system_fn&& f, time_type t, const state_type& x, time_type dt)
+    {
+        const value_type h = dt.value();
+        const value_type half{static_cast<value_type>(0.5) * h};
+
+        m_k1 = f(t, x);
+        m_stage = x;
+        details::ode_axpy(m_stage.si_elements(), half, m_k1.si_elements());
+        m_k2 = f(time_type{t.value() + half}, m_stage);
+        m_stage = x;
+        details::ode_axpy(m_stage.si_elements(), half, m_k2.si_elements());
+        m_k3 = f(time_type{t.value() + half}, m_stage);
+        m_stage = x;
+        details::ode_axpy(m_stage.si_elements(), h, m_k3.si_elements());
+        m_k4 = f(time_type{t.value() + h}, m_stage);
+
+        state_type result{};
+        constexpr std::array<value_type, 4> weights{
+            static_cast<value_type>(1.0 / 6.0), static_cast<value_type>(1.0 / 3.0), static_cast<value_type>(1.0 / 3.0), static_cast<value_type>(1.0 / 6.0)};
+        details::ode_combine(
+            result.si_elements(),
+            x.si_elements(),
+            h,
+            weights,
+            std::array<const typename state_type::array_type*, 4>{&m_k1.si_elements(), &m_k2.si_elements(), &m_k3.si_elements(), &m_k4.si_elements()});
+        return result;
+    }
+
+    // Take step_count steps of size dt starting at t0
+    template <typename system_fn>
+        requires ode_system_c<system_fn, state_t>
+    constexpr state_type integrate(system_fn&& f, time_type t0, const state_type& x0, time_type dt, std::size_t step_count)
+    {
+        state_type x = x0;
+        for (std::size_t i = 0; i < step_count; ++i)
+        {
+            x = step(f, time_type{t0.value() + (static_cast<value_type>(i) * dt.value())}, x, dt);
+        }
+        return x;
+    }
+
+private:
+    derivative_type m_k1{};
+    derivative_type m_k2{};
+    derivative_type m_k3{};
+    derivative_type m_k4{};
+    state_type m_stage{};
+};
+
+// Single RK4 step without keeping an integrator around
+template <dimensioned_vector_c state_t, typename system_fn>
+    requires ode_system_c<system_fn, state_t>
+constexpr state_t runge_kutta_step(system_fn&& f, second_t<typename state_t::value_type> t, const state_t& x, second_t<typename state_t::value_type> dt)
+{
+    rk4_integrator_t<state_t> integrator;
+    return integrator.step(std::forward<system_fn>(f), t, x, dt);
+}
+
+// ============================================================================
+// Adaptive Dormand-Prince 5(4)
+// ============================================================================
+
+// Error control: a step is accepted when, for the RMS over all elements,
+//   |err_i| <= absolute_tolerance_i + relative_tolerance * max(|x_i|, |x_new_i|)
+// The absolute tolerance is a state vector, so every element is compared in its own unit.
+template <dimensioned_vector_c state_t>
+struct adaptive_step_options
+{
+    using value_type = typename state_t::value_type;
+
+    state_t absolute_tolerance;
+    value_type relative_tolerance{static_cast<value_type>(1e-6)};
+    value_type safety{static_cast<value_type>(0.9)};
+    value_type min_factor{static_cast<value_type>(0.2)};
+    value_type max_factor{static_cast<value_type>(5.0)};
+    std::size_t max_steps{100000};
+};
+
+struct adaptive_step_statistics
+{
+    std::size_t accepted_steps{0};
+    std::size_t rejected_steps{0};
+    std::size_t function_evaluations{0};
+};
+
+template <dimensioned_vector_c state_t>
+class dormand_prince_integrator_t
+{
+public:
+    using state_type = state_t;
+    using value_type = typename state_t::value_type;
+    using derivative_type = time_derivative_t<state_t>;
+    using time_type = second_t<value_type>;
+    using options_type = adaptive_step_options<state_t>;
+
+    static_assert(std::is_floating_point_v<value_type>, "dormand_prince_integrator_t: value type must be a floating point type");
+
+    explicit dormand_prince_integrator_t(const options_type& options) noexcept
+        : m_options(options)
+    {
+    }
+
+    // Integrate from t0 to t1, starting with initial_step and adapting it to the tolerances.
+    // Throws std::runtime_error if max_steps is exceeded or the step size underflows.
+    template <typename system_fn>
+        requires ode_system_c<system_fn, state_t>
+    state_type integrate(system_fn&& f, time_type t0, const state_type& x0, time_type t1, time_type initial_step)
+    {
+        const value_type direction = t1.value() >= t0.value() ? value_type{1} : value_type{-1};
+        value_type t = t0.value();
+        value_type h = direction * std::abs(initial_step.value());
+        if (h == value_type{0})
+        {
+            throw std::invalid_argument("dormand_prince_integrator_t::integrate: initial step must be non-zero");
+        }
+
+        state_type x = x0;
+        m_statistics = {};
+        m_k[0] = f(time_type{t}, x);
+        ++m_statistics.function_evaluations;
+
+        std::size_t steps = 0;
+        while (direction * (t1.value() - t) > value_type{0})
+        {
+            if (++steps > m_options.max_steps)
+            {
+                throw std::runtime_error("dormand_prince_integrator_t::integrate: maximum number of steps exceeded");
+            }
+            if (direction * (t + h - t1.value()) > value_type{0})
+            {
+                h = t1.value() - t;
+            }
+            if (t + h == t)
+            {
+                throw std::runtime_error("dormand_prince_integrator_t::integrate: step size underflow");
+            }
+
+            const value_type error = attempt(f, t, x, h);
+            if (error <= value_type{1})
+            {
+                t += h;
+                x = m_candidate;
+                m_k[0] = m_k[6]; // first same as last
+                ++m_statistics.accepted_steps;
+                h *= step_factor(error, m_options.max_factor);
+            }
+            else
+            {
+                ++m_statistics.rejected_steps;
+                h *= step_factor(error, value_type{1});
+            }
+        }
+
+        m_last_step = time_type{h};
+        return x;
+    }
+
+    [[nodiscard]] const adaptive_step_statistics& statistics() const noexcept
+    {
+        return m_statistics;
+    }
+
+    // Step size proposed after the last accepted step (useful to resume integration)
+    [[nodiscard]] time_type last_step() const noexcept
+    {
+        return m_last_step;
+    }
+
+private:
+    // One DOPRI5 step from (t, x) with m_k[0] = f(t, x); returns the scaled RMS error estimate
+    template <typename system_fn>
+    value_type attempt(system_fn& f, value_type t, const state_type& x, value_type h)
+    {
+        using array_type = typename state_type::array_type;
+        auto k = [this](std::size_t s) -> const array_type* { return &m_k[s].si_elements(); };
+
+        details::ode_combine(m_stage.si_elements(), x.si_elements(), h, std::array<value_type, 1>{v(1, 5)}, std::array<const array_type*, 1>{k(0)});
+        m_k[1] = f(time_type{t + (v(1, 5) * h)}, m_stage);
+
+        details::ode_combine(
+            m_stage.si_elements(), x.si_elements(), h, std::array<value_type, 2>{v(3, 40), v(9, 40)}, std::array<const array_type*, 2>{k(0), k(1)});
+        m_k[2] = f(time_type{t + (v(3, 10) * h)}, m_stage);
+
+        details::ode_combine(
+            m_stage.si_elements(),
+            x.si_elements(),
+            h,
+            std::array<value_type, 3>{v(44, 45), v(-56, 15), v(32, 9)},
+            std::array<const array_type*, 3>{k(0), k(1), k(2)});
+        m_k[3] = f(time_type{t + (v(4, 5) * h)}, m_stage);
+
+        details::ode_combine(
+            m_stage.si_elements(),
+            x.si_elements(),
+            h,
+            std::array<value_type, 4>{v(19372, 6561), v(-25360, 2187), v(64448, 6561), v(-212, 729)},
+            std::array<const array_type*, 4>{k(0), k(1), k(2), k(3)});
+        m_k[4] = f(time_type{t + (v(8, 9) * h)}, m_stage);
+
+        details::ode_combine(
+            m_stage.si_elements(),
+            x.si_elements(),
+            h,
+            std::array<value_type, 5>{v(9017, 3168), v(-355, 33), v(46732, 5247), v(49, 176), v(-5103, 18656)},
+            std::array<const array_type*, 5>{k(0), k(1), k(2), k(3), k(4)});
+        m_k[5] = f(time_type{t + h}, m_stage);
+
+        details::ode_combine(
+            m_candidate.si_elements(),
+            x.si_elements(),
+            h,
+            std::array<value_type, 6>{v(35, 384), value_type{0}, v(500, 1113), v(125, 192), v(-2187, 6784), v(11, 84)},
+            std::array<const array_type*, 6>{k(0), k(1), k(2), k(3), k(4), k(5)});
+        m_k[6] = f(time_type{t + h}, m_candidate);
+        m_statistics.function_evaluations += 6;
+
+        // Difference between the 5th and embedded 4th order solutions
+        constexpr std::array<value_type, 7> e{
+            static_cast<value_type>(71.0 / 57600.0),
+            value_type{0},
+            static_cast<value_type>(-71.0 / 16695.0),
+            static_cast<value_type>(71.0 / 1920.0),
+            static_cast<value_type>(-17253.0 / 339200.0),
+            static_cast<value_type>(22.0 / 525.0),
+            static_cast<value_type>(-1.0 / 40.0)};
+
+        const auto& x_old = x.si_elements();
+        const auto& x_new = m_candidate.si_elements();
+        const auto& atol = m_options.absolute_tolerance.si_elements();
+        value_type sum{0};
+        for (std::size_t i = 0; i < state_type::row_count; ++i)
+        {
+            value_type err{0};
+            for (std::size_t s = 0; s < 7; ++s)
+            {
+                err += e[s] * m_k[s].si_elements()[i];
+            }
+            err *= h;
+            const value_type scale = std::abs(atol[i]) + (m_options.relative_tolerance * std::max(std::abs(x_old[i]), std::abs(x_new[i])));
+            const value_type ratio = err / scale;
+            sum += ratio * ratio;
+        }
+        return std::sqrt(sum / static_cast<value_type>(state_type::row_count));
+    }
+
+    value_type step_factor(value_type error, value_type max_factor) const noexcept
+    {
+        if (error == value_type{0})
+        {
+            return max_factor;
+        }
+        const value_type factor = m_options.safety * std::pow(error, static_cast<value_type>(-0.2));
+        return std::clamp(factor, m_options.min_factor, max_factor);
+    }
+
+    static constexpr value_type v(int num, int den) noexcept
+    {
+        return static_cast<value_type>(num) / static_cast<value_type>(den);
+    }
+
+    options_type m_options;
+    std::array<derivative_type, 7> m_k{};
+    state_type m_stage{};
+    state_type m_candidate{};
+    adaptive_step_statistics m_statistics{};
+    time_type m_last_step{value_type{0}};
+};
+
+// ============================================================================
+// Symplectic integrators for q'' = a(q)
+// ============================================================================
+// Position q and velocity v = dq/dt are separate dimensioned vectors; the
+// acceleration field returns time_derivative_t<velocity>. Both integrators
+// conserve a modified energy, so long runs show bounded energy error instead
+// of the drift of non-symplectic schemes.
+
+// Velocity Verlet (kick-drift-kick). The acceleration at the end of a step is
+// reused at the start of the next one as long as q was not changed in between.
+template <dimensioned_vector_c position_t>
+class velocity_verlet_integrator_t
+{
+public:
+    using position_type = position_t;
+    using value_type = typename position_t::value_type;
+    using velocity_type = time_derivative_t<position_t>;
+    using acceleration_type = time_derivative_t<velocity_type>;
+    using time_type = second_t<value_type>;
+
+    template <typename acceleration_fn>
+        requires acceleration_field_c<acceleration_fn, position_t>
+    constexpr void step(acceleration_fn&& a, position_type& q, velocity_type& v, time_type dt)
+    {
+        const value_type h = dt.value();
+        const value_type half{static_cast<value_type>(0.5) * h};
+
+        if (!m_cached || !(q == m_cached_position))
+        {
+            m_acceleration = a(q);
+        }
+        details::ode_axpy(v.si_elements(), half, m_acceleration.si_elements());
+        details::ode_axpy(q.si_elements(), h, v.si_elements());
+        m_acceleration = a(q);
+        details::ode_axpy(v.si_elements(), half, m_acceleration.si_elements());
+
+        m_cached_position = q;
+        m_cached = true;
+    }
+
+private:
+    acceleration_type m_acceleration{};
+    position_type m_cached_position{};
+    bool m_cached{false};
+};
+
+// Yoshida 4th order composition of three leapfrog steps (drift-kick form, three force evaluations per step)
+template <dimensioned_vector_c position_t>
+class yoshida_integrator_t
+{
+public:
+    using position_type = position_t;
+    using value_type = typename position_t::value_type;
+    using velocity_type = time_derivative_t<position_t>;
+    using acceleration_type = time_derivative_t<velocity_type>;
+    using time_type = second_t<value_type>;
+
+    template <typename acceleration_fn>
+        requires acceleration_field_c<acceleration_fn, position_t>
+    constexpr void step(acceleration_fn&& a, position_type& q, velocity_type& v, time_type dt)
+    {
+        // w1 = 1 / (2 - 2^(1/3)), w0 = -2^(1/3) / (2 - 2^(1/3))
+        constexpr value_type w1 = static_cast<value_type>(1.3512071919596576340476878089715);
+        constexpr value_type w0 = static_cast<value_type>(-1.7024143839193152680953756179429);
+        constexpr std::array<value_type, 4> c{w1 / 2, (w0 + w1) / 2, (w0 + w1) / 2, w1 / 2};
+        constexpr std::array<value_type, 3> d{w1, w0, w1};
+
+        const value_type h = dt.value();
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            details::ode_axpy(q.si_elements(), c[i] * h, v.si_elements());
+            m_acceleration = a(q);
+            details::ode_axpy(v.si_elements(), d[i] * h, m_acceleration.si_elements());
+        }
+        details::ode_axpy(q.si_elements(), c[3] * h, v.si_elements());
+    }
+
+private:
+    acceleration_type m_acceleration{};
+};
+
+} // namespace PKR_UNITS_NAMESPACE
@@ -0,0 +1,481 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/impl/unit_t.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+#include <pkr_units/math/root_finding.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Unit-aware numerical quadrature
+// ============================================================================
+//
+// Every rule integrates a callable f: U -> V over [lower, upper] and returns
+// integral_t<V, U>, the unit with dimension V * U in coherent SI units:
+// power over time gives energy, pressure over area gives force, and so on.
+// As with the root finders, f may return any ratio of V; the rules work on
+// SI values internally.
+//
+//   gauss_kronrod_15      fixed 15-point Kronrod rule (constexpr, no allocation)
+//   composite_simpson     fixed composite Simpson rule (constexpr, no allocation)
+//   gauss_kronrod         adaptive G7-K15 bisection, smooth integrands
+//   simpson               adaptive Simpson with Richardson correction
+//   tanh_sinh             double-exponential rule, integrable endpoint singularities
+//   gauss_kronrod_batch   fixed rule over many intervals
+//   gauss_kronrod_parallel adaptive rule over many intervals on a work_stealing_pool
+//
+// The adaptive rules keep their interval list in a fixed-capacity array on the
+// stack and never allocate. Failure to reach the tolerance throws
+// std::runtime_error; the parallel form never throws per lane and returns the
+// number of lanes that missed the tolerance instead.
+
+template <is_pkr_unit_c value_u, is_pkr_unit_c arg_u>
+using integral_t = typename derived_unit_type_t<
+    typename details::is_pkr_unit<arg_u>::value_type,
+    std::ratio<1, 1>,
+    details::add_dimensions(details::is_pkr_unit<value_u>::value_dimension, details::is_pkr_unit<arg_u>::value_dimension)>::type;
+
+template <typename fn_t, typename arg_u>
+using unit_integral_result_t = integral_t<unit_function_result_t<fn_t, arg_u>, arg_u>;
+
+// Default relative tolerance: about the square root of the machine epsilon
+template <std::floating_point type_t>
+constexpr type_t default_quadrature_tolerance() noexcept
+{
+    return static_cast<type_t>(std::numeric_limits<type_t>::digits > 30 ? 1e-10 : 1e-5);
+}
+
+// Capacity of the interval list used by the adaptive Gauss-Kronrod rule
+inline constexpr std::size_t gauss_kronrod_max_intervals = 256;
+
+namespace details
+{
+
+// Gauss-Kronrod 7/15 abscissae and weights on [-1, 1] (QUADPACK qk15)
+template <typename type_t>
+inline constexpr std::array<type_t, 8> kronrod_15_nodes{
+    static_cast<type_t>(0.991455371120812639206854697526329),
+    static_cast<type_t>(0.949107912342758524526189684047851),
+    static_cast<type_t>(0.864864423359769072789712788640926),
+    static_cast<type_t>(0.741531185599394439863864773280788),
+    static_cast<type_t>(0.586087235467691130294144845693013),
+    static_cast<type_t>(0.405845151377397166906606412076961),
+    static_cast<type_t>(0.207784955007898467600689403773245),
+    static_cast<type_t>(0.0)};
+
+template <typename type_t>
+inline constexpr std::array<type_t, 8> kronrod_15_weights{
+    static_cast<type_t>(0.022935322010529224963732008058970),
+    static_cast<type_t>(0.063092092629978553290700663189204),
+    static_cast<type_t>(0.104790010322250183839876322541518),
+    static_cast<type_t>(0.140653259715525918745189590510238),
+    static_cast<type_t>(0.169004726639267902826583426598550),
+    static_cast<type_t>(0.190350578064785409913256402421014),
+    static_cast<type_t>(0.204432940075298892414161999234649),
+    static_cast<type_t>(0.209482141084727828012999174891714)};
+
+// Gauss 7-point weights for the odd Kronrod nodes 1, 3, 5 and the centre
+template <typename type_t>
+inline constexpr std::array<type_t, 4> gauss_7_weights{
+    static_cast<type_t>(0.129484966168869693270611432679082),
+    static_cast<type_t>(0.279705391489276667901467771423780),
+    static_cast<type_t>(0.381830050505118944950369775488975),
+    static_cast<type_t>(0.417959183673469387755102040816327)};
+
+template <typename type_t>
+struct quadrature_estimate
+{
+    type_t value;
+    type_t error;
+};
+
+// One G7-K15 panel on [a, b] in SI values. The error estimate is QUADPACK's
+// scaled |K15 - G7|, floored at the rounding level of the panel.
+template <typename arg_u, typename fn_t, typename type_t>
+constexpr quadrature_estimate<type_t> kronrod_15_panel(fn_t& f, type_t a, type_t b)
+{
+    const type_t centre = (a + b) / static_cast<type_t>(2);
+    const type_t half = (b - a) / static_cast<type_t>(2);
+    std::array<type_t, 15> fx{};
+    fx[14] = eval_si<fn_t, arg_u>(f, centre);
+    type_t kronrod = kronrod_15_weights<type_t>[7] * fx[14];
+    type_t gauss = gauss_7_weights<type_t>[3] * fx[14];
+    type_t absolute = kronrod_15_weights<type_t>[7] * root_abs(fx[14]);
+    for (std::size_t k = 0; k < 7; ++k)
+    {
+        const type_t dx = half * kronrod_15_nodes<type_t>[k];
+        fx[2 * k] = eval_si<fn_t, arg_u>(f, centre - dx);
+        fx[(2 * k) + 1] = eval_si<fn_t, arg_u>(f, centre + dx);
+        const type_t sum = fx[2 * k] + fx[(2 * k) + 1];
+        kronrod += kronrod_15_weights<type_t>[k] * sum;
+        absolute += kronrod_15_weights<type_t>[k] * (root_abs(fx[2 * k]) + root_abs(fx[(2 * k) + 1]));
+        if (k % 2 == 1)
+        {
+            gauss += gauss_7_weights<type_t>[k / 2] * sum;
+        }
+    }
+
+    // Mean absolute deviation from the panel mean, the scale of the estimate
+    const type_t mean = kronrod / static_cast<type_t>(2);
+    type_t deviation = kronrod_15_weights<type_t>[7] * root_abs(fx[14] - mean);
+    for (std::size_t k = 0; k < 7; ++k)
+    {
+        deviation += kronrod_15_weights<type_t>[k] * (root_abs(fx[2 * k] - mean) + root_abs(fx[(2 * k) + 1] - mean));
+    }
+
+    const type_t scale = root_abs(half);
+    type_t error = root_abs((kronrod - gauss) * half);
+    deviation *= scale;
+    if (deviation != type_t{0} && error != type_t{0})
+    {
+        const type_t ratio = static_cast<type_t>(200) * error / deviation;
+        const type_t factor = ratio * std::sqrt(ratio);
+        error = deviation * (factor < type_t{1} ? factor : type_t{1});
+    }
+    const type_t rounding = static_cast<type_t>(50) * std::numeric_limits<type_t>::epsilon() * absolute * scale;
+    return {kronrod * half, error > rounding ? error : rounding};
+}
+
+template <typename type_t>
+constexpr type_t quadrature_target(type_t absolute_tolerance, type_t relative_tolerance, type_t value) noexcept
+{
+    const type_t relative = root_abs(relative_tolerance * value);
+    return absolute_tolerance > relative ? absolute_tolerance : relative;
+}
+
+template <typename type_t>
+struct adaptive_result
+{
+    type_t value;
+    type_t error;
+    bool converged;
+};
+
+// Globally adaptive bisection: always split the panel with the largest error
+template <typename arg_u, typename fn_t, typename type_t>
+constexpr adaptive_result<type_t> gauss_kronrod_adaptive(
+    fn_t& f, type_t a, type_t b, type_t absolute_tolerance, type_t relative_tolerance, std::size_t max_subdivisions)
+{
+    struct panel_t
+    {
+        type_t a;
+        type_t b;
+        type_t value;
+        type_t error;
+    };
+    std::array<panel_t, gauss_kronrod_max_intervals> panels{};
+    std::size_t count = 1;
+    const auto first = kronrod_15_panel<arg_u>(f, a, b);
+    panels[0] = {a, b, first.value, first.error};
+    type_t total = first.value;
+    type_t total_error = first.error;
+
+    const std::size_t limit = max_subdivisions < gauss_kronrod_max_intervals ? max_subdivisions : gauss_kronrod_max_intervals;
+    while (total_error > quadrature_target(absolute_tolerance, relative_tolerance, total))
+    {
+        std::size_t worst = 0;
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            worst = panels[i].error > panels[worst].error ? i : worst;
+        }
+        const panel_t split = panels[worst];
+        const type_t mid = split.a + ((split.b - split.a) / static_cast<type_t>(2));
+        if (count >= limit || mid == split.a || mid == split.b)
+        {
+            return {total, total_error, false};
+        }
+        const auto left = kronrod_15_panel<arg_u>(f, split.a, mid);
+        const auto right = kronrod_15_panel<arg_u>(f, mid, split.b);
+        panels[worst] = {split.a, mid, left.value, left.error};
+        panels[count++] = {mid, split.b, right.value, right.error};
+        total += left.value + right.value - split.value;
+        total_error += left.error + right.error - split.error;
+    }
+    return {total, total_error, true};
+}
+
+template <typename arg_u, typename fn_t, typename type_t>
+constexpr type_t simpson_recursive(
+    fn_t& f, type_t a, type_t b, type_t fa, type_t fm, type_t fb, type_t whole, type_t tolerance, std::size_t depth, bool& converged)
+{
+    const type_t m = a + ((b - a) / static_cast<type_t>(2));
+    const type_t lm = a + ((m - a) / static_cast<type_t>(2));
+    const type_t rm = m + ((b - m) / static_cast<type_t>(2));
+    const type_t flm = eval_si<fn_t, arg_u>(f, lm);
+    const type_t frm = eval_si<fn_t, arg_u>(f, rm);
+    const type_t left = (m - a) * (fa + (static_cast<type_t>(4) * flm) + fm) / static_cast<type_t>(6);
+    const type_t right = (b - m) * (fm + (static_cast<type_t>(4) * frm) + fb) / static_cast<type_t>(6);
+    const type_t delta = left + right - whole;
+    if (root_abs(delta) <= static_cast<type_t>(15) * tolerance)
+    {
+        return left + right + (delta / static_cast<type_t>(15));
+    }
+    if (depth == 0 || lm == a || rm == b)
+    {
+        converged = false;
+        return left + right + (delta / static_cast<type_t>(15));
+    }
+    const type_t half_tolerance = tolerance / static_cast<type_t>(2);
+    return simpson_recursive<arg_u>(f, a, m, fa, flm, fm, left, half_tolerance, depth - 1, converged) +
+           simpson_recursive<arg_u>(f, m, b, fm, frm, fb, right, half_tolerance, depth - 1, converged);
+}
+
+} // namespace details
+
+// ============================================================================
+// Fixed-order rules
+// ============================================================================
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr unit_integral_result_t<value_fn, arg_u> gauss_kronrod_15(value_fn&& f, const arg_u& lower, const arg_u& upper)
+{
+    using result_u = unit_integral_result_t<value_fn, arg_u>;
+    return result_u{details::kronrod_15_panel<arg_u>(f, details::to_si_value(lower), details::to_si_value(upper)).value};
+}
+
+// Composite Simpson rule with an even number of subintervals (odd counts are rounded up)
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr unit_integral_result_t<value_fn, arg_u> composite_simpson(value_fn&& f, const arg_u& lower, const arg_u& upper, std::size_t intervals)
+{
+    using result_u = unit_integral_result_t<value_fn, arg_u>;
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    if (intervals == 0)
+    {
+        throw std::invalid_argument("composite_simpson: intervals must be positive");
+    }
+    const std::size_t n = intervals + (intervals % 2);
+    const type_t a = details::to_si_value(lower);
+    const type_t b = details::to_si_value(upper);
+    const type_t h = (b - a) / static_cast<type_t>(n);
+
+    type_t odd{0};
+    type_t even{0};
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        const type_t fx = details::eval_si<value_fn, arg_u>(f, a + (static_cast<type_t>(i) * h));
+        odd += (i % 2 == 1) ? fx : type_t{0};
+        even += (i % 2 == 0) ? fx : type_t{0};
+    }
+    const type_t ends = details::eval_si<value_fn, arg_u>(f, a) + details::eval_si<value_fn, arg_u>(f, b);
+    return result_u{h * (ends + (static_cast<type_t>(4) * odd) + (static_cast<type_t>(2) * even)) / static_cast<type_t>(3)};
+}
+
+// ============================================================================
+// Adaptive Gauss-Kronrod
+// ============================================================================
+// Stops when the summed |K15 - G7| estimate is below
+// max(absolute_tolerance, relative_tolerance * |integral|). max_subdivisions is
+// capped at gauss_kronrod_max_intervals.
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr unit_integral_result_t<value_fn, arg_u> gauss_kronrod(
+    value_fn&& f,
+    const arg_u& lower,
+    const arg_u& upper,
+    const std::type_identity_t<unit_integral_result_t<value_fn, arg_u>>& absolute_tolerance = unit_integral_result_t<value_fn, arg_u>{0},
+    typename details::is_pkr_unit<arg_u>::value_type relative_tolerance = default_quadrature_tolerance<typename details::is_pkr_unit<arg_u>::value_type>(),
+    std::size_t max_subdivisions = 100)
+{
+    using result_u = unit_integral_result_t<value_fn, arg_u>;
+    const auto result = details::gauss_kronrod_adaptive<arg_u>(
+        f, details::to_si_value(lower), details::to_si_value(upper), details::root_abs(absolute_tolerance.value()), relative_tolerance, max_subdivisions);
+    if (!result.converged)
+    {
+        throw std::runtime_error("gauss_kronrod: tolerance not reached within the subdivision limit");
+    }
+    return result_u{result.value};
+}
+
+// ============================================================================
+// Adaptive Simpson
+// ============================================================================
+// Recursive bisection with the Richardson-corrected (sixth order) panel value.
+// Cheaper than Gauss-Kronrod per evaluation on smooth, mildly varying integrands.
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr unit_integral_result_t<value_fn, arg_u> simpson(
+    value_fn&& f,
+    const arg_u& lower,
+    const arg_u& upper,
+    const std::type_identity_t<unit_integral_result_t<value_fn, arg_u>>& absolute_tolerance,
+    std::size_t max_depth = 50)
+{
+    using result_u = unit_integral_result_t<value_fn, arg_u>;
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    const type_t a = details::to_si_value(lower);
+    const type_t b = details::to_si_value(upper);
+    const type_t m = a + ((b - a) / static_cast<type_t>(2));
+    const type_t fa = details::eval_si<value_fn, arg_u>(f, a);
+    const type_t fm = details::eval_si<value_fn, arg_u>(f, m);
+    const type_t fb = details::eval_si<value_fn, arg_u>(f, b);
+    const type_t whole = (b - a) * (fa + (static_cast<type_t>(4) * fm) + fb) / static_cast<type_t>(6);
+
+    bool converged = true;
+    const type_t value = details::simpson_recursive<arg_u>(f, a, b, fa, fm, fb, whole, details::root_abs(absolute_tolerance.value()), max_depth, converged);
+    if (!converged)
+    {
+        throw std::runtime_error("simpson: tolerance not reached within the recursion depth");
+    }
+    return result_u{value};
+}
+
+// ============================================================================
+// Tanh-sinh (double exponential)
+// ============================================================================
+// x = c + h tanh(pi/2 sinh t) clusters the nodes doubly exponentially towards
+// both ends, so integrable endpoint singularities (1/sqrt(x), log x) converge
+// as fast as smooth integrands. f is never evaluated at lower or upper; nodes
+// near the ends are placed from the complement 1 - tanh(u) to keep their
+// distance from the endpoint exact. Each level halves the step and reuses all
+// previous nodes; the difference between levels is the error estimate.
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+unit_integral_result_t<value_fn, arg_u> tanh_sinh(
+    value_fn&& f,
+    const arg_u& lower,
+    const arg_u& upper,
+    const std::type_identity_t<unit_integral_result_t<value_fn, arg_u>>& absolute_tolerance = unit_integral_result_t<value_fn, arg_u>{0},
+    typename details::is_pkr_unit<arg_u>::value_type relative_tolerance = default_quadrature_tolerance<typename details::is_pkr_unit<arg_u>::value_type>(),
+    std::size_t max_levels = 10)
+{
+    using result_u = unit_integral_result_t<value_fn, arg_u>;
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    const type_t a = details::to_si_value(lower);
+    const type_t b = details::to_si_value(upper);
+    const type_t half = (b - a) / static_cast<type_t>(2);
+    const type_t half_pi = std::numbers::pi_v<type_t> / static_cast<type_t>(2);
+    const type_t absolute = details::root_abs(absolute_tolerance.value());
+
+    // Sum of w(t) * (f(c + h x(t)) + f(c - h x(t))) over t = k * step for k = 1, 1 + stride, ...
+    // until the nodes reach the endpoints or the weights underflow
+    auto level_sum = [&](type_t step, std::size_t stride)
+    {
+        type_t sum{0};
+        for (std::size_t k = 1;; k += stride)
+        {
+            const type_t t = static_cast<type_t>(k) * step;
+            const type_t u = half_pi * std::sinh(t);
+            const type_t cosh_u = std::cosh(u);
+            const type_t weight = half_pi * std::cosh(t) / (cosh_u * cosh_u);
+            // 1 - tanh(u) = 2 / (exp(2u) + 1), exact for large u
+            const type_t offset = half * static_cast<type_t>(2) / (std::exp(static_cast<type_t>(2) * u) + static_cast<type_t>(1));
+            if (weight == type_t{0} || (a + offset == a && b - offset == b))
+            {
+                break;
+            }
+            // Each side stops on its own once its nodes reach the endpoint
+            const type_t left = a + offset;
+            const type_t right = b - offset;
+            sum += left != a ? weight * details::eval_si<value_fn, arg_u>(f, left) : type_t{0};
+            sum += right != b ? weight * details::eval_si<value_fn, arg_u>(f, right) : type_t{0};
+        }
+        return sum;
+    };
+
+    type_t step{1};
+    type_t sum = half_pi * details::eval_si<value_fn, arg_u>(f, a + half) + level_sum(step, 1);
+    type_t estimate = half * step * sum;
+    for (std::size_t level = 1; level <= max_levels; ++level)
+    {
+        step /= static_cast<type_t>(2);
+        sum += level_sum(step, 2);
+        const type_t refined = half * step * sum;
+        const type_t error = details::root_abs(refined - estimate);
+        estimate = refined;
+        if (error <= details::quadrature_target(absolute, relative_tolerance, estimate))
+        {
+            return result_u{estimate};
+        }
+    }
+    throw std::runtime_error("tanh_sinh: tolerance not reached within the level limit");
+}
+
+// ============================================================================
+// Batched and parallel forms (many intervals, one per lane)
+// ============================================================================
+// Fixed G7-K15 rule on every [lower_i, upper_i]; no allocation, no adaptivity.
+// Suited to tabulating a smooth integrand on a fine grid.
+template <is_pkr_unit_c arg_u, is_pkr_unit_c result_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr void gauss_kronrod_batch(value_fn&& f, std::span<const arg_u> lower, std::span<const arg_u> upper, std::span<result_u> results)
+{
+    static_assert(
+        details::is_pkr_unit<result_u>::value_dimension == details::is_pkr_unit<unit_integral_result_t<value_fn, arg_u>>::value_dimension,
+        "gauss_kronrod_batch: results must have the dimension of f(x) * x");
+    if (lower.size() != results.size() || upper.size() != results.size())
+    {
+        throw std::invalid_argument("gauss_kronrod_batch: all spans must have the same size");
+    }
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto panel = details::kronrod_15_panel<arg_u>(f, details::to_si_value(lower[i]), details::to_si_value(upper[i]));
+        results[i] = details::from_si_value<result_u>(panel.value);
+    }
+}
+
+// Adaptive Gauss-Kronrod on every [lower_i, upper_i], lanes spread over the pool.
+// f is called concurrently and must be safe to call from several threads.
+// Lanes that miss the tolerance keep their best estimate; their count is returned.
+template <is_pkr_unit_c arg_u, is_pkr_unit_c result_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+std::size_t gauss_kronrod_parallel(
+    value_fn&& f,
+    std::span<const arg_u> lower,
+    std::span<const arg_u> upper,
+    std::span<result_u> results,
+    const std::type_identity_t<result_u>& absolute_tolerance = result_u{0},
+    typename details::is_pkr_unit<arg_u>::value_type relative_tolerance = default_quadrature_tolerance<typename details::is_pkr_unit<arg_u>::value_type>(),
+    std::size_t max_subdivisions = 100,
+    work_stealing_pool& pool = work_stealing_pool::shared())
+{
+    static_assert(
+        details::is_pkr_unit<result_u>::value_dimension == details::is_pkr_unit<unit_integral_result_t<value_fn, arg_u>>::value_dimension,
+        "gauss_kronrod_parallel: results must have the dimension of f(x) * x");
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    if (lower.size() != results.size() || upper.size() != results.size())
+    {
+        throw std::invalid_argument("gauss_kronrod_parallel: all spans must have the same size");
+    }
+
+    const type_t absolute = details::root_abs(details::to_si_value(absolute_tolerance));
+    std::atomic<std::size_t> failures{0};
+    pool.parallel_for(
+        0,
+        results.size(),
+        16,
+        [&](std::size_t begin, std::size_t end)
+        {
+            std::size_t chunk_failures = 0;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const auto lane = details::gauss_kronrod_adaptive<arg_u>(
+                    f, details::to_si_value(lower[i]), details::to_si_value(upper[i]), absolute, relative_tolerance, max_subdivisions);
+                results[i] = details::from_si_value<result_u>(lane.value);
+                chunk_failures += lane.converged ? 0u : 1u;
+            }
+            failures.fetch_add(chunk_failures, std::memory_order_relaxed);
+        });
+    return failures.load();
+}
+
+} // namespace PKR_UNITS_NAMESPACE
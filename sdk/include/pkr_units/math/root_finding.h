@@ -0,0 +1,680 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/impl/unit_t.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Unit-aware root finding and minimization
+// ============================================================================
+//
+// All solvers take a callable f: U -> V where U and V are pkr units. The
+// derivative of f has the type of V / U (derivative_t<V, U>); second
+// derivatives V / U^2. A derivative callable returning any unit with the
+// right dimension is accepted (ratios are converted), anything else is a
+// compile error.
+//
+// Internally the iteration runs on coherent SI values, so mixed ratios
+// (e.g. f returning kilopascal, f' returning pascal per kelvin) cost nothing
+// per iteration. Solvers are constexpr and never allocate.
+//
+// Failure to converge throws std::runtime_error; an invalid bracket throws
+// std::invalid_argument. The batch forms never throw per lane: they return the
+// number of lanes that did not converge.
+//
+//   newton_raphson       quadratic convergence, needs f'
+//   halley               cubic convergence, needs f' and f''
+//   bisection            bracketed, always converges
+//   brent                bracketed, inverse quadratic interpolation + bisection
+//   bracketed_newton     Newton safeguarded by a bracket (falls back to bisection)
+//   brent_minimize       1D minimization on a bracket (golden section + parabolic steps)
+
+template <is_pkr_unit_c value_u, is_pkr_unit_c arg_u>
+using derivative_t = typename derived_unit_type_t<
+    typename details::is_pkr_unit<arg_u>::value_type,
+    std::ratio<1, 1>,
+    details::subtract_dimensions(details::is_pkr_unit<value_u>::value_dimension, details::is_pkr_unit<arg_u>::value_dimension)>::type;
+
+template <typename fn_t, typename arg_u>
+concept unit_function_c = is_pkr_unit_c<arg_u> && std::is_invocable_v<fn_t, const arg_u&> && is_pkr_unit_c<std::invoke_result_t<fn_t, const arg_u&>>;
+
+template <typename fn_t, typename arg_u>
+using unit_function_result_t = std::remove_cvref_t<std::invoke_result_t<fn_t, const arg_u&>>;
+
+namespace details
+{
+
+template <is_pkr_unit_c unit_u>
+constexpr auto to_si_value(const unit_u& u) noexcept
+{
+    using traits = is_pkr_unit<unit_u>;
+    return convert_ratio_to<typename traits::value_type, typename traits::ratio_type, std::ratio<1, 1>>(u.value());
+}
+
+template <is_pkr_unit_c unit_u>
+constexpr unit_u from_si_value(typename is_pkr_unit<unit_u>::value_type si) noexcept
+{
+    using traits = is_pkr_unit<unit_u>;
+    return unit_u{convert_ratio_to<typename traits::value_type, std::ratio<1, 1>, typename traits::ratio_type>(si)};
+}
+
+template <typename fn_t, typename arg_u>
+constexpr auto eval_si(fn_t& f, typename is_pkr_unit<arg_u>::value_type x) noexcept(noexcept(f(std::declval<const arg_u&>())))
+{
+    return to_si_value(f(from_si_value<arg_u>(x)));
+}
+
+template <typename type_t>
+constexpr type_t root_abs(type_t v) noexcept
+{
+    return v < type_t{0} ? -v : v;
+}
+
+// Step tolerance: the user tolerance plus a few ulps of the iterate
+template <typename type_t>
+constexpr type_t step_tolerance(type_t tolerance, type_t x) noexcept
+{
+    return tolerance + (static_cast<type_t>(4) * std::numeric_limits<type_t>::epsilon() * root_abs(x));
+}
+
+template <typename type_t>
+constexpr bool opposite_signs(type_t a, type_t b) noexcept
+{
+    return (a < type_t{0}) != (b < type_t{0});
+}
+
+} // namespace details
+
+// ============================================================================
+// Newton-Raphson
+// ============================================================================
+template <is_pkr_unit_c arg_u, typename value_fn, typename derivative_fn>
+    requires unit_function_c<value_fn, arg_u> && unit_function_c<derivative_fn, arg_u>
+constexpr arg_u newton_raphson(const arg_u& initial_guess, value_fn&& f, derivative_fn&& df, const std::type_identity_t<arg_u>& tolerance = arg_u{0}, std::size_t max_iterations = 100)
+{
+    using value_u = unit_function_result_t<value_fn, arg_u>;
+    static_assert(
+        details::is_pkr_unit<unit_function_result_t<derivative_fn, arg_u>>::value_dimension ==
+            details::is_pkr_unit<derivative_t<value_u, arg_u>>::value_dimension,
+        "newton_raphson: derivative must have the dimension of f(x) / x");
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    const type_t tol = details::root_abs(details::to_si_value(tolerance));
+    type_t x = details::to_si_value(initial_guess);
+    for (std::size_t i = 0; i < max_iterations; ++i)
+    {
+        const type_t fx = details::eval_si<value_fn, arg_u>(f, x);
+        if (fx == type_t{0})
+        {
+            return details::from_si_value<arg_u>(x);
+        }
+        const type_t dfx = details::eval_si<derivative_fn, arg_u>(df, x);
+        if (dfx == type_t{0})
+        {
+            throw std::runtime_error("newton_raphson: derivative is zero");
+        }
+        const type_t dx = fx / dfx;
+        x -= dx;
+        if (details::root_abs(dx) <= details::step_tolerance(tol, x))
+        {
+            return details::from_si_value<arg_u>(x);
+        }
+    }
+    throw std::runtime_error("newton_raphson: no convergence within the iteration limit");
+}
+
+// ============================================================================
+// Halley
+// ============================================================================
+template <is_pkr_unit_c arg_u, typename value_fn, typename derivative_fn, typename second_derivative_fn>
+    requires unit_function_c<value_fn, arg_u> && unit_function_c<derivative_fn, arg_u> && unit_function_c<second_derivative_fn, arg_u>
+constexpr arg_u halley(
+    const arg_u& initial_guess,
+    value_fn&& f,
+    derivative_fn&& df,
+    second_derivative_fn&& d2f,
+    const std::type_identity_t<arg_u>& tolerance = arg_u{0},
+    std::size_t max_iterations = 100)
+{
+    using value_u = unit_function_result_t<value_fn, arg_u>;
+    using derivative_u = derivative_t<value_u, arg_u>;
+    static_assert(
+        details::is_pkr_unit<unit_function_result_t<derivative_fn, arg_u>>::value_dimension == details::is_pkr_unit<derivative_u>::value_dimension,
+        "halley: derivative must have the dimension of f(x) / x");
+    static_assert(
+        details::is_pkr_unit<unit_function_result_t<second_derivative_fn, arg_u>>::value_dimension ==
+            details::is_pkr_unit<derivative_t<derivative_u, arg_u>>::value_dimension,
+        "halley: second derivative must have the dimension of f(x) / x^2");
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    const type_t tol = details::root_abs(details::to_si_value(tolerance));
+    type_t x = details::to_si_value(initial_guess);
+    for (std::size_t i = 0; i < max_iterations; ++i)
+    {
+        const type_t fx = details::eval_si<value_fn, arg_u>(f, x);
+        if (fx == type_t{0})
+        {
+            return details::from_si_value<arg_u>(x);
+        }
+        const type_t dfx = details::eval_si<derivative_fn, arg_u>(df, x);
+        const type_t d2fx = details::eval_si<second_derivative_fn, arg_u>(d2f, x);
+        const type_t denominator = (static_cast<type_t>(2) * dfx * dfx) - (fx * d2fx);
+        if (denominator == type_t{0})
+        {
+            throw std::runtime_error("halley: zero denominator");
+        }
+        const type_t dx = (static_cast<type_t>(2) * fx * dfx) / denominator;
+        x -= dx;
+        if (details::root_abs(dx) <= details::step_tolerance(tol, x))
+        {
+            return details::from_si_value<arg_u>(x);
+        }
+    }
+    throw std::runtime_error("halley: no convergence within the iteration limit");
+}
+
+// ============================================================================
+// Bisection
+// ============================================================================
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr arg_u bisection(value_fn&& f, const arg_u& lower, const arg_u& upper, const std::type_identity_t<arg_u>& tolerance = arg_u{0}, std::size_t max_iterations = 200)
+{
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    type_t a = details::to_si_value(lower);
+    type_t b = details::to_si_value(upper);
+    type_t fa = details::eval_si<value_fn, arg_u>(f, a);
+    const type_t fb = details::eval_si<value_fn, arg_u>(f, b);
+    if (fa == type_t{0})
+    {
+        return lower;
+    }
+    if (fb == type_t{0})
+    {
+        return upper;
+    }
+    if (!details::opposite_signs(fa, fb))
+    {
+        throw std::invalid_argument("bisection: f(lower) and f(upper) must have opposite signs");
+    }
+
+    const type_t tol = details::root_abs(details::to_si_value(tolerance));
+    for (std::size_t i = 0; i < max_iterations; ++i)
+    {
+        const type_t mid = a + ((b - a) / static_cast<type_t>(2));
+        if (details::root_abs(b - a) <= static_cast<type_t>(2) * details::step_tolerance(tol, mid) || mid == a || mid == b)
+        {
+            return details::from_si_value<arg_u>(mid);
+        }
+        const type_t fm = details::eval_si<value_fn, arg_u>(f, mid);
+        if (fm == type_t{0})
+        {
+            return details::from_si_value<arg_u>(mid);
+        }
+        if (details::opposite_signs(fa, fm))
+        {
+            b = mid;
+        }
+        else
+        {
+            a = mid;
+            fa = fm;
+        }
+    }
+    throw std::runtime_error("bisection: no convergence within the iteration limit");
+}
+
+// ============================================================================
+// Brent (zeroin)
+// ============================================================================
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr arg_u brent(value_fn&& f, const arg_u& lower, const arg_u& upper, const std::type_identity_t<arg_u>& tolerance = arg_u{0}, std::size_t max_iterations = 200)
+{
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+    constexpr type_t two = static_cast<type_t>(2);
+    constexpr type_t three = static_cast<type_t>(3);
+
+    type_t a = details::to_si_value(lower);
+    type_t b = details::to_si_value(upper);
+    type_t fa = details::eval_si<value_fn, arg_u>(f, a);
+    type_t fb = details::eval_si<value_fn, arg_u>(f, b);
+    if (fa == type_t{0})
+    {
+        return lower;
+    }
+    if (fb == type_t{0})
+    {
+        return upper;
+    }
+    if (!details::opposite_signs(fa, fb))
+    {
+        throw std::invalid_argument("brent: f(lower) and f(upper) must have opposite signs");
+    }
+
+    const type_t tol_user = details::root_abs(details::to_si_value(tolerance));
+    type_t c = a;
+    type_t fc = fa;
+    type_t d = b - a;
+    type_t e = d;
+    for (std::size_t i = 0; i < max_iterations; ++i)
+    {
+        if (details::opposite_signs(fb, fc) == false)
+        {
+            c = a;
+            fc = fa;
+            d = b - a;
+            e = d;
+        }
+        if (details::root_abs(fc) < details::root_abs(fb))
+        {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        const type_t tol = details::step_tolerance(tol_user, b) / two;
+        const type_t m = (c - b) / two;
+        if (details::root_abs(m) <= tol || fb == type_t{0})
+        {
+            return details::from_si_value<arg_u>(b);
+        }
+
+        if (details::root_abs(e) >= tol && details::root_abs(fa) > details::root_abs(fb))
+        {
+            // Secant (a == c) or inverse quadratic interpolation
+            type_t p{};
+            type_t q{};
+            const type_t s = fb / fa;
+            if (a == c)
+            {
+                p = two * m * s;
+                q = type_t{1} - s;
+            }
+            else
+            {
+                const type_t qa = fa / fc;
+                const type_t r = fb / fc;
+                p = s * ((two * m * qa * (qa - r)) - ((b - a) * (r - type_t{1})));
+                q = (qa - type_t{1}) * (r - type_t{1}) * (s - type_t{1});
+            }
+            if (p > type_t{0})
+            {
+                q = -q;
+            }
+            else
+            {
+                p = -p;
+            }
+            if (two * p < std::min((three * m * q) - details::root_abs(tol * q), details::root_abs(e * q)))
+            {
+                e = d;
+                d = p / q;
+            }
+            else
+            {
+                d = m;
+                e = m;
+            }
+        }
+        else
+        {
+            d = m;
+            e = m;
+        }
+
+        a = b;
+        fa = fb;
+        b += details::root_abs(d) > tol ? d : (m > type_t{0} ? tol : -tol);
+        fb = details::eval_si<value_fn, arg_u>(f, b);
+    }
+    throw std::runtime_error("brent: no convergence within the iteration limit");
+}
+
+// ============================================================================
+// Bracketed Newton (rtsafe)
+// ============================================================================
+// Newton steps that would leave the bracket or shrink it too slowly are
+// replaced by bisection, so convergence is guaranteed like bisection and
+// quadratic near the root like Newton.
+template <is_pkr_unit_c arg_u, typename value_fn, typename derivative_fn>
+    requires unit_function_c<value_fn, arg_u> && unit_function_c<derivative_fn, arg_u>
+constexpr arg_u bracketed_newton(
+    value_fn&& f, derivative_fn&& df, const arg_u& lower, const arg_u& upper, const std::type_identity_t<arg_u>& tolerance = arg_u{0}, std::size_t max_iterations = 200)
+{
+    using value_u = unit_function_result_t<value_fn, arg_u>;
+    static_assert(
+        details::is_pkr_unit<unit_function_result_t<derivative_fn, arg_u>>::value_dimension ==
+            details::is_pkr_unit<derivative_t<value_u, arg_u>>::value_dimension,
+        "bracketed_newton: derivative must have the dimension of f(x) / x");
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+    constexpr type_t two = static_cast<type_t>(2);
+
+    type_t lo = details::to_si_value(lower);
+    type_t hi = details::to_si_value(upper);
+    const type_t f_lo = details::eval_si<value_fn, arg_u>(f, lo);
+    const type_t f_hi = details::eval_si<value_fn, arg_u>(f, hi);
+    if (f_lo == type_t{0})
+    {
+        return lower;
+    }
+    if (f_hi == type_t{0})
+    {
+        return upper;
+    }
+    if (!details::opposite_signs(f_lo, f_hi))
+    {
+        throw std::invalid_argument("bracketed_newton: f(lower) and f(upper) must have opposite signs");
+    }
+    // Orient so that f(lo) < 0
+    if (f_lo > type_t{0})
+    {
+        std::swap(lo, hi);
+    }
+
+    const type_t tol = details::root_abs(details::to_si_value(tolerance));
+    type_t x = (lo + hi) / two;
+    type_t dx_old = details::root_abs(hi - lo);
+    type_t dx = dx_old;
+    type_t fx = details::eval_si<value_fn, arg_u>(f, x);
+    type_t dfx = details::eval_si<derivative_fn, arg_u>(df, x);
+    for (std::size_t i = 0; i < max_iterations; ++i)
+    {
+        const bool newton_leaves_bracket = (((x - hi) * dfx) - fx) * (((x - lo) * dfx) - fx) > type_t{0};
+        const bool newton_too_slow = details::root_abs(two * fx) > details::root_abs(dx_old * dfx);
+        dx_old = dx;
+        if (newton_leaves_bracket || newton_too_slow)
+        {
+            dx = (hi - lo) / two;
+            x = lo + dx;
+        }
+        else
+        {
+            dx = fx / dfx;
+            x -= dx;
+        }
+        if (details::root_abs(dx) <= details::step_tolerance(tol, x))
+        {
+            return details::from_si_value<arg_u>(x);
+        }
+        fx = details::eval_si<value_fn, arg_u>(f, x);
+        dfx = details::eval_si<derivative_fn, arg_u>(df, x);
+        if (fx == type_t{0})
+        {
+            return details::from_si_value<arg_u>(x);
+        }
+        if (fx < type_t{0})
+        {
+            lo = x;
+        }
+        else
+        {
+            hi = x;
+        }
+    }
+    throw std::runtime_error("bracketed_newton: no convergence within the iteration limit");
+}
+
+// ============================================================================
+// Brent minimization
+// ============================================================================
+// Finds a local minimum of f on [lower, upper].
+template <is_pkr_unit_c arg_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr arg_u brent_minimize(value_fn&& f, const arg_u& lower, const arg_u& upper, const std::type_identity_t<arg_u>& tolerance = arg_u{0}, std::size_t max_iterations = 200)
+{
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+    constexpr type_t golden = static_cast<type_t>(0.38196601125010515180); // (3 - sqrt(5)) / 2
+    constexpr type_t two = static_cast<type_t>(2);
+    constexpr type_t half = static_cast<type_t>(0.5);
+
+    type_t a = details::to_si_value(lower);
+    type_t b = details::to_si_value(upper);
+    if (b < a)
+    {
+        std::swap(a, b);
+    }
+    const type_t tol_user = details::root_abs(details::to_si_value(tolerance));
+    // Below sqrt(eps) relative the parabola cannot resolve the minimum any better
+    const type_t rel = static_cast<type_t>(2) * std::sqrt(std::numeric_limits<type_t>::epsilon());
+
+    type_t x = a + (golden * (b - a));
+    type_t w = x;
+    type_t v = x;
+    type_t fx = details::eval_si<value_fn, arg_u>(f, x);
+    type_t fw = fx;
+    type_t fv = fx;
+    type_t d{0};
+    type_t e{0};
+    for (std::size_t i = 0; i < max_iterations; ++i)
+    {
+        const type_t xm = half * (a + b);
+        const type_t tol1 = (rel * details::root_abs(x)) + tol_user + std::numeric_limits<type_t>::min();
+        const type_t tol2 = two * tol1;
+        if (details::root_abs(x - xm) <= tol2 - (half * (b - a)))
+        {
+            return details::from_si_value<arg_u>(x);
+        }
+
+        bool golden_step = true;
+        if (details::root_abs(e) > tol1)
+        {
+            // Parabolic fit through x, w, v
+            const type_t r = (x - w) * (fx - fv);
+            type_t q = (x - v) * (fx - fw);
+            type_t p = ((x - v) * q) - ((x - w) * r);
+            q = two * (q - r);
+            if (q > type_t{0})
+            {
+                p = -p;
+            }
+            else
+            {
+                q = -q;
+            }
+            const type_t e_old = e;
+            if (details::root_abs(p) < details::root_abs(half * q * e_old) && p > q * (a - x) && p < q * (b - x))
+            {
+                e = d;
+                d = p / q;
+                const type_t u = x + d;
+                if (u - a < tol2 || b - u < tol2)
+                {
+                    d = xm >= x ? tol1 : -tol1;
+                }
+                golden_step = false;
+            }
+        }
+        if (golden_step)
+        {
+            e = (x >= xm) ? a - x : b - x;
+            d = golden * e;
+        }
+
+        const type_t u = details::root_abs(d) >= tol1 ? x + d : x + (d > type_t{0} ? tol1 : -tol1);
+        const type_t fu = details::eval_si<value_fn, arg_u>(f, u);
+        if (fu <= fx)
+        {
+            (u >= x ? a : b) = x;
+            v = w;
+            fv = fw;
+            w = x;
+            fw = fx;
+            x = u;
+            fx = fu;
+        }
+        else
+        {
+            (u < x ? a : b) = u;
+            if (fu <= fw || w == x)
+            {
+                v = w;
+                fv = fw;
+                w = u;
+                fw = fu;
+            }
+            else if (fu <= fv || v == x || v == w)
+            {
+                v = u;
+                fv = fu;
+            }
+        }
+    }
+    throw std::runtime_error("brent_minimize: no convergence within the iteration limit");
+}
+
+// ============================================================================
+// Batch solvers (many independent problems, one per lane)
+// ============================================================================
+// Solve f(x_i) = targets_i for every lane i. All lanes advance in lock step:
+// every pass evaluates f and f' on every lane and applies the Newton step
+// through a select rather than a branch, so the inner loop over lanes
+// vectorizes when f and df inline (the usual case for property-table
+// inversions). Converged lanes are re-evaluated and take a zero step. x holds
+// the initial guesses on entry and the roots on exit. Returns the number of
+// lanes that did not converge, including lanes stuck where f' = 0 and f != 0.
+template <is_pkr_unit_c arg_u, is_pkr_unit_c value_u, typename value_fn, typename derivative_fn>
+    requires unit_function_c<value_fn, arg_u> && unit_function_c<derivative_fn, arg_u>
+constexpr std::size_t newton_raphson_batch(
+    std::span<const value_u> targets,
+    std::span<arg_u> x,
+    value_fn&& f,
+    derivative_fn&& df,
+    const std::type_identity_t<arg_u>& tolerance = arg_u{0},
+    std::size_t max_iterations = 100)
+{
+    static_assert(
+        details::is_pkr_unit<unit_function_result_t<value_fn, arg_u>>::value_dimension == details::is_pkr_unit<value_u>::value_dimension,
+        "newton_raphson_batch: targets must have the dimension of f(x)");
+    static_assert(
+        details::is_pkr_unit<unit_function_result_t<derivative_fn, arg_u>>::value_dimension ==
+            details::is_pkr_unit<derivative_t<value_u, arg_u>>::value_dimension,
+        "newton_raphson_batch: derivative must have the dimension of f(x) / x");
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+
+    if (targets.size() != x.size())
+    {
+        throw std::invalid_argument("newton_raphson_batch: targets and x must have the same size");
+    }
+
+    const type_t tol = details::root_abs(details::to_si_value(tolerance));
+    std::size_t active = x.size();
+    std::size_t stalled = 0;
+    for (std::size_t iteration = 0; iteration < max_iterations && active > 0; ++iteration)
+    {
+        active = 0;
+        stalled = 0;
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            const type_t xi = details::to_si_value(x[i]);
+            const type_t fx = details::eval_si<value_fn, arg_u>(f, xi) - details::to_si_value(targets[i]);
+            const type_t dfx = details::eval_si<derivative_fn, arg_u>(df, xi);
+            const bool flat = dfx == type_t{0};
+            const type_t dx = flat ? type_t{0} : fx / dfx;
+            const bool moving = details::root_abs(dx) > details::step_tolerance(tol, xi) && fx != type_t{0};
+            x[i] = details::from_si_value<arg_u>(moving ? xi - dx : xi);
+            active += moving ? 1u : 0u;
+            stalled += (flat && fx != type_t{0}) ? 1u : 0u;
+        }
+    }
+    return active + stalled;
+}
+
+// Bracketed batch: every lane bisects [lower_i, upper_i] for f(x) = targets_i until the
+// bracket is narrower than the tolerance. Lanes are taken in blocks whose brackets live
+// on the stack; within a block all lanes halve their bracket once per pass in lock step,
+// with the update done by selects, so the lane loop vectorizes when f inlines. A lane
+// fails when its bracket has no sign change, in which case x_i is left unchanged, or
+// when the bracket is still wider than the tolerance after max_iterations, in which
+// case x_i is the midpoint of the last bracket.
+template <is_pkr_unit_c arg_u, is_pkr_unit_c value_u, typename value_fn>
+    requires unit_function_c<value_fn, arg_u>
+constexpr std::size_t bisection_batch(
+    std::span<const value_u> targets,
+    std::span<const arg_u> lower,
+    std::span<const arg_u> upper,
+    std::span<arg_u> x,
+    value_fn&& f,
+    const std::type_identity_t<arg_u>& tolerance,
+    std::size_t max_iterations = 200)
+{
+    static_assert(
+        details::is_pkr_unit<unit_function_result_t<value_fn, arg_u>>::value_dimension == details::is_pkr_unit<value_u>::value_dimension,
+        "bisection_batch: targets must have the dimension of f(x)");
+    using type_t = typename details::is_pkr_unit<arg_u>::value_type;
+    constexpr std::size_t block = 64;
+
+    if (targets.size() != x.size() || lower.size() != x.size() || upper.size() != x.size())
+    {
+        throw std::invalid_argument("bisection_batch: all spans must have the same size");
+    }
+
+    const type_t tol = details::root_abs(details::to_si_value(tolerance));
+    std::size_t failures = 0;
+    for (std::size_t first = 0; first < x.size(); first += block)
+    {
+        const std::size_t count = std::min(block, x.size() - first);
+        std::array<type_t, block> a{};
+        std::array<type_t, block> b{};
+        std::array<type_t, block> target{};
+        std::array<bool, block> rising{};
+        std::array<bool, block> bracketed{};
+        bool open = false;
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            a[j] = details::to_si_value(lower[first + j]);
+            b[j] = details::to_si_value(upper[first + j]);
+            target[j] = details::to_si_value(targets[first + j]);
+            const type_t fa = details::eval_si<value_fn, arg_u>(f, a[j]) - target[j];
+            const type_t fb = details::eval_si<value_fn, arg_u>(f, b[j]) - target[j];
+            bracketed[j] = fa == type_t{0} || fb == type_t{0} || details::opposite_signs(fa, fb);
+            rising[j] = fa < fb;
+            open = open || (bracketed[j] && details::root_abs(b[j] - a[j]) > tol);
+        }
+
+        for (std::size_t iteration = 0; iteration < max_iterations && open; ++iteration)
+        {
+            open = false;
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                const type_t mid = a[j] + ((b[j] - a[j]) / static_cast<type_t>(2));
+                const bool below = (details::eval_si<value_fn, arg_u>(f, mid) - target[j] < type_t{0}) == rising[j];
+                a[j] = below ? mid : a[j];
+                b[j] = below ? b[j] : mid;
+                open = open || (bracketed[j] && details::root_abs(b[j] - a[j]) > tol);
+            }
+        }
+
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            if (!bracketed[j])
+            {
+                ++failures;
+                continue;
+            }
+            x[first + j] = details::from_si_value<arg_u>(a[j] + ((b[j] - a[j]) / static_cast<type_t>(2)));
+            failures += details::root_abs(b[j] - a[j]) > tol ? 1u : 0u;
+        }
+    }
+    return failures;
+}
+
+} // namespace PKR_UNITS_NAMESPACE
@@ -12,6 +12,7 @@
 #include <pkr_units/impl/concepts/unit_concepts.h>
 #include <pkr_units/impl/formatting/unit_formatting_traits.h>
 #include <pkr_units/impl/formatting/measurement_formatter.h>
+#include <pkr_units/impl/formatting/text_output.h>
 #include <pkr_units/units/math/unit_math.h>
 
 namespace PKR_UNITS_NAMESPACE
@@ -390,6 +391,16 @@ constexpr bool operator==(const measurement_rss_t<UnitT>& lhs, const measurement
 template <typename CharT, typename Traits, typename UnitT>
 std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const measurement_rss_t<UnitT>& measurement)
 {
+    // Fast path: value, uncertainty and symbol into a stack buffer, one sputn
+    if constexpr (impl::fast_text_v<CharT, typename UnitT::value_type>)
+    {
+        impl::text_buffer<CharT> buffer;
+        if (impl::write_measurement_text<CharT, UnitT>(buffer, measurement.value(), measurement.uncertainty()))
+        {
+            return impl::put_text(os, buffer.view());
+        }
+    }
+
     // Use std::format_to with streambuf_iterator to avoid creating intermediate strings
     if constexpr (std::is_same_v<CharT, wchar_t>)
     {
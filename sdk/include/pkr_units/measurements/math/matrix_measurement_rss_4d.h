@@ -1,6 +1,9 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <pkr_units/impl/namespace_config.h>
 #include <pkr_units/measurements/decl/measurement_rss_decl.h>
 #include <pkr_units/units/math/matrix_storage_policies.h>
@@ -34,6 +37,31 @@ public:
     {
     }
 
+    // Allocator-extended constructors for allocating storage policies (pmr_storage)
+    matrix_measurement_rss_4d_t(const array_type& arr, const details::storage_allocator_t<StoragePolicy>& alloc)
+        requires allocating_storage_policy_c<StoragePolicy>
+        : storage(arr, alloc)
+    {
+    }
+
+    matrix_measurement_rss_4d_t(const matrix_measurement_rss_4d_t& other, const details::storage_allocator_t<StoragePolicy>& alloc)
+        requires allocating_storage_policy_c<StoragePolicy>
+        : storage(other.storage, alloc)
+    {
+    }
+
+    matrix_measurement_rss_4d_t(matrix_measurement_rss_4d_t&& other, const details::storage_allocator_t<StoragePolicy>& alloc)
+        requires allocating_storage_policy_c<StoragePolicy>
+        : storage(std::move(other.storage), alloc)
+    {
+    }
+
+    [[nodiscard]] details::storage_allocator_t<StoragePolicy> get_allocator() const noexcept
+        requires allocating_storage_policy_c<StoragePolicy>
+    {
+        return storage.get_allocator();
+    }
+
     constexpr value_type& operator()(std::size_t row, std::size_t col)
     {
         return storage.get(row, col);
@@ -83,3 +111,11 @@ constexpr vec_measurement_rss_4d_t<T> operator*(const matrix_measurement_rss_4d_
 }
 
 } // namespace PKR_UNITS_NAMESPACE
+
+// Matrices with an allocating storage policy take part in uses-allocator
+// construction, so std::pmr containers pass their resource to each element
+template <PKR_UNITS_NAMESPACE::is_pkr_unit_c T, typename StoragePolicy, typename Alloc>
+    requires PKR_UNITS_NAMESPACE::allocating_storage_policy_c<StoragePolicy>
+struct std::uses_allocator<PKR_UNITS_NAMESPACE::matrix_measurement_rss_4d_t<T, StoragePolicy>, Alloc> : std::is_convertible<Alloc, typename StoragePolicy::allocator_type>
+{
+};
@@ -0,0 +1,384 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/simd/vector_kernels.h>
+#include <pkr_units/measurements/decl/measurement_rss_decl.h>
+#include <pkr_units/measurements/math/vector_measurement_rss_3d.h>
+#include <pkr_units/measurements/math/vector_measurement_rss_4d.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Lane-separated 3D and 4D vectors of RSS measurements
+// ============================================================================
+// vec_measurement_rss_3d_t stores one measurement_rss_t per component, so an
+// addition runs three scalar sqrt calls and a dot product goes through six
+// relative uncertainties. These vectors keep the values and the uncertainties
+// in two aligned four-lane blocks instead, and propagate uncertainty for all
+// components with one vector operation:
+//
+//   a +/- b      sigma_i = sqrt(sigma_a_i^2 + sigma_b_i^2)        (lanes_rss)
+//   s * a        sigma_i = |s| sigma_a_i
+//   dot(a, b)    sigma^2 = sum (b_i sigma_a_i)^2 + (a_i sigma_b_i)^2
+//   |a|          sigma   = sqrt(sum (a_i sigma_a_i)^2) / |a|
+//   cross(a, b)  sigma_x^2 = (b_z sigma_a_y)^2 + (b_y sigma_a_z)^2 + (a_y sigma_b_z)^2 + (a_z sigma_b_y)^2, etc.
+//
+// The dot and magnitude formulas are first-order and also hold for zero
+// components, where the per-component relative uncertainty is undefined.
+// Components are treated as independent, as in the unaligned vectors.
+
+namespace details
+{
+
+// Product unit of a measurement product and the factor from raw T * T values to it
+template <typename T>
+using measurement_product_unit_t = decltype((std::declval<T>() * std::declval<T>()).in_base_si_units());
+
+template <typename T>
+constexpr typename is_pkr_unit<T>::value_type measurement_product_scale() noexcept
+{
+    using value_type = typename is_pkr_unit<T>::value_type;
+    return (T{value_type{1}} * T{value_type{1}}).in_base_si_units().value();
+}
+
+// Standard deviation of dot(a, b) from the value and uncertainty lanes
+template <std::floating_point type_t>
+inline type_t dot_uncertainty(const simd_lanes<type_t>& a, const simd_lanes<type_t>& sa, const simd_lanes<type_t>& b, const simd_lanes<type_t>& sb) noexcept
+{
+    const auto ta = lanes_mul(b, sa);
+    const auto tb = lanes_mul(a, sb);
+    return std::sqrt(lanes_dot(ta, ta) + lanes_dot(tb, tb));
+}
+
+// Value and uncertainty of |a|; a zero vector returns the RSS of the component uncertainties
+template <std::floating_point type_t>
+inline std::pair<type_t, type_t> magnitude_with_uncertainty(const simd_lanes<type_t>& a, const simd_lanes<type_t>& sa) noexcept
+{
+    const type_t m = std::sqrt(lanes_dot(a, a));
+    if (m == type_t{0})
+    {
+        return {m, std::sqrt(lanes_dot(sa, sa))};
+    }
+    const auto t = lanes_mul(a, sa);
+    return {m, std::sqrt(lanes_dot(t, t)) / m};
+}
+
+} // namespace details
+
+template <is_pkr_unit_c T>
+    requires std::floating_point<typename details::is_pkr_unit<T>::value_type>
+struct aligned_vec_measurement_rss_3d_t
+{
+    using unit_type = T;
+    using value_type = typename details::is_pkr_unit<T>::value_type;
+    using lanes_type = details::simd_lanes<value_type>;
+    using measurement_type = measurement_rss_t<T>;
+
+    constexpr aligned_vec_measurement_rss_3d_t() noexcept
+        : m_values{{0, 0, 0, 0}}
+        , m_uncertainties{{0, 0, 0, 0}}
+    {
+    }
+
+    constexpr aligned_vec_measurement_rss_3d_t(const measurement_type& x_value, const measurement_type& y_value, const measurement_type& z_value) noexcept
+        : m_values{{x_value.value(), y_value.value(), z_value.value(), 0}}
+        , m_uncertainties{{x_value.uncertainty(), y_value.uncertainty(), z_value.uncertainty(), 0}}
+    {
+    }
+
+    constexpr explicit aligned_vec_measurement_rss_3d_t(const vec_measurement_rss_3d_t<T>& v) noexcept
+        : aligned_vec_measurement_rss_3d_t(v.x, v.y, v.z)
+    {
+    }
+
+    // Uncertainties must be non-negative; lane 3 is cleared
+    constexpr aligned_vec_measurement_rss_3d_t(const lanes_type& values, const lanes_type& uncertainties) noexcept
+        : m_values{values}
+        , m_uncertainties{uncertainties}
+    {
+        m_values.v[3] = 0;
+        m_uncertainties.v[3] = 0;
+    }
+
+    [[nodiscard]] constexpr measurement_type x() const noexcept
+    {
+        return component(0);
+    }
+
+    [[nodiscard]] constexpr measurement_type y() const noexcept
+    {
+        return component(1);
+    }
+
+    [[nodiscard]] constexpr measurement_type z() const noexcept
+    {
+        return component(2);
+    }
+
+    [[nodiscard]] constexpr const lanes_type& values() const noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] constexpr const lanes_type& uncertainties() const noexcept
+    {
+        return m_uncertainties;
+    }
+
+    [[nodiscard]] vec_measurement_rss_3d_t<T> to_vec() const
+    {
+        return vec_measurement_rss_3d_t<T>{x(), y(), z()};
+    }
+
+    aligned_vec_measurement_rss_3d_t& operator+=(const aligned_vec_measurement_rss_3d_t& other) noexcept
+    {
+        m_values = details::lanes_add(m_values, other.m_values);
+        m_uncertainties = details::lanes_rss(m_uncertainties, other.m_uncertainties);
+        return *this;
+    }
+
+    aligned_vec_measurement_rss_3d_t& operator-=(const aligned_vec_measurement_rss_3d_t& other) noexcept
+    {
+        m_values = details::lanes_sub(m_values, other.m_values);
+        m_uncertainties = details::lanes_rss(m_uncertainties, other.m_uncertainties);
+        return *this;
+    }
+
+    constexpr aligned_vec_measurement_rss_3d_t& operator*=(value_type scalar) noexcept
+    {
+        m_values = details::lanes_scale(m_values, scalar);
+        m_uncertainties = details::lanes_scale(m_uncertainties, scalar < 0 ? -scalar : scalar);
+        return *this;
+    }
+
+    constexpr aligned_vec_measurement_rss_3d_t& operator/=(value_type scalar) noexcept
+    {
+        return *this *= value_type{1} / scalar;
+    }
+
+    [[nodiscard]] measurement_type magnitude() const noexcept
+    {
+        const auto [m, sigma] = details::magnitude_with_uncertainty(m_values, m_uncertainties);
+        return measurement_type{m, sigma};
+    }
+
+private:
+    constexpr measurement_type component(std::size_t i) const noexcept
+    {
+        return measurement_type{m_values.v[i], m_uncertainties.v[i]};
+    }
+
+    lanes_type m_values;
+    lanes_type m_uncertainties;
+};
+
+template <is_pkr_unit_c T>
+    requires std::floating_point<typename details::is_pkr_unit<T>::value_type>
+struct aligned_vec_measurement_rss_4d_t
+{
+    using unit_type = T;
+    using value_type = typename details::is_pkr_unit<T>::value_type;
+    using lanes_type = details::simd_lanes<value_type>;
+    using measurement_type = measurement_rss_t<T>;
+
+    constexpr aligned_vec_measurement_rss_4d_t() noexcept
+        : m_values{{0, 0, 0, 1}}
+        , m_uncertainties{{0, 0, 0, 0}}
+    {
+    }
+
+    constexpr aligned_vec_measurement_rss_4d_t(
+        const measurement_type& x_value,
+        const measurement_type& y_value,
+        const measurement_type& z_value,
+        const measurement_type& w_value = measurement_type{value_type{1}, value_type{0}}) noexcept
+        : m_values{{x_value.value(), y_value.value(), z_value.value(), w_value.value()}}
+        , m_uncertainties{{x_value.uncertainty(), y_value.uncertainty(), z_value.uncertainty(), w_value.uncertainty()}}
+    {
+    }
+
+    constexpr explicit aligned_vec_measurement_rss_4d_t(const vec_measurement_rss_4d_t<T>& v) noexcept
+        : aligned_vec_measurement_rss_4d_t(v.x, v.y, v.z, v.w)
+    {
+    }
+
+    // Uncertainties must be non-negative
+    constexpr aligned_vec_measurement_rss_4d_t(const lanes_type& values, const lanes_type& uncertainties) noexcept
+        : m_values{values}
+        , m_uncertainties{uncertainties}
+    {
+    }
+
+    [[nodiscard]] constexpr measurement_type x() const noexcept
+    {
+        return component(0);
+    }
+
+    [[nodiscard]] constexpr measurement_type y() const noexcept
+    {
+        return component(1);
+    }
+
+    [[nodiscard]] constexpr measurement_type z() const noexcept
+    {
+        return component(2);
+    }
+
+    [[nodiscard]] constexpr measurement_type w() const noexcept
+    {
+        return component(3);
+    }
+
+    [[nodiscard]] constexpr const lanes_type& values() const noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] constexpr const lanes_type& uncertainties() const noexcept
+    {
+        return m_uncertainties;
+    }
+
+    [[nodiscard]] vec_measurement_rss_4d_t<T> to_vec() const
+    {
+        return vec_measurement_rss_4d_t<T>{x(), y(), z(), w()};
+    }
+
+    aligned_vec_measurement_rss_4d_t& operator+=(const aligned_vec_measurement_rss_4d_t& other) noexcept
+    {
+        m_values = details::lanes_add(m_values, other.m_values);
+        m_uncertainties = details::lanes_rss(m_uncertainties, other.m_uncertainties);
+        return *this;
+    }
+
+    aligned_vec_measurement_rss_4d_t& operator-=(const aligned_vec_measurement_rss_4d_t& other) noexcept
+    {
+        m_values = details::lanes_sub(m_values, other.m_values);
+        m_uncertainties = details::lanes_rss(m_uncertainties, other.m_uncertainties);
+        return *this;
+    }
+
+    constexpr aligned_vec_measurement_rss_4d_t& operator*=(value_type scalar) noexcept
+    {
+        m_values = details::lanes_scale(m_values, scalar);
+        m_uncertainties = details::lanes_scale(m_uncertainties, scalar < 0 ? -scalar : scalar);
+        return *this;
+    }
+
+    constexpr aligned_vec_measurement_rss_4d_t& operator/=(value_type scalar) noexcept
+    {
+        return *this *= value_type{1} / scalar;
+    }
+
+    // Magnitude of the 3D portion, as vec_measurement_rss_4d_t::magnitude()
+    [[nodiscard]] measurement_type magnitude() const noexcept
+    {
+        const lanes_type values{{m_values.v[0], m_values.v[1], m_values.v[2], 0}};
+        const lanes_type uncertainties{{m_uncertainties.v[0], m_uncertainties.v[1], m_uncertainties.v[2], 0}};
+        const auto [m, sigma] = details::magnitude_with_uncertainty(values, uncertainties);
+        return measurement_type{m, sigma};
+    }
+
+private:
+    constexpr measurement_type component(std::size_t i) const noexcept
+    {
+        return measurement_type{m_values.v[i], m_uncertainties.v[i]};
+    }
+
+    lanes_type m_values;
+    lanes_type m_uncertainties;
+};
+
+// ============================================================================
+// Operators
+// ============================================================================
+
+template <typename V>
+concept aligned_vec_measurement_rss_c = requires(const V& v) {
+    typename V::measurement_type;
+    { v.values() } -> std::same_as<const typename V::lanes_type&>;
+    { v.uncertainties() } -> std::same_as<const typename V::lanes_type&>;
+};
+
+template <aligned_vec_measurement_rss_c V>
+V operator+(const V& a, const V& b) noexcept
+{
+    return V{details::lanes_add(a.values(), b.values()), details::lanes_rss(a.uncertainties(), b.uncertainties())};
+}
+
+template <aligned_vec_measurement_rss_c V>
+V operator-(const V& a, const V& b) noexcept
+{
+    return V{details::lanes_sub(a.values(), b.values()), details::lanes_rss(a.uncertainties(), b.uncertainties())};
+}
+
+template <aligned_vec_measurement_rss_c V>
+constexpr V operator-(const V& v) noexcept
+{
+    return V{details::lanes_scale(v.values(), typename V::value_type{-1}), v.uncertainties()};
+}
+
+template <aligned_vec_measurement_rss_c V>
+constexpr V operator*(const V& v, typename V::value_type scalar) noexcept
+{
+    V result = v;
+    result *= scalar;
+    return result;
+}
+
+template <aligned_vec_measurement_rss_c V>
+constexpr V operator*(typename V::value_type scalar, const V& v) noexcept
+{
+    return v * scalar;
+}
+
+template <aligned_vec_measurement_rss_c V>
+constexpr V operator/(const V& v, typename V::value_type scalar) noexcept
+{
+    V result = v;
+    result /= scalar;
+    return result;
+}
+
+// Dot product in the product unit, as for the unaligned vectors (base SI)
+template <aligned_vec_measurement_rss_c V>
+auto dot(const V& a, const V& b) noexcept
+{
+    using unit_u = typename V::unit_type;
+    using result_u = details::measurement_product_unit_t<unit_u>;
+    constexpr auto scale = details::measurement_product_scale<unit_u>();
+    const auto value = details::lanes_dot(a.values(), b.values());
+    const auto sigma = details::dot_uncertainty(a.values(), a.uncertainties(), b.values(), b.uncertainties());
+    return measurement_rss_t<result_u>{value * scale, sigma * scale};
+}
+
+template <is_pkr_unit_c T>
+auto cross(const aligned_vec_measurement_rss_3d_t<T>& a, const aligned_vec_measurement_rss_3d_t<T>& b) noexcept
+{
+    using result_u = details::measurement_product_unit_t<T>;
+    using value_type = typename aligned_vec_measurement_rss_3d_t<T>::value_type;
+    constexpr value_type scale = details::measurement_product_scale<T>();
+
+    // c = a.yzx * b.zxy - a.zxy * b.yzx; the variance sums, over both factors
+    // of both products, (other factor * own uncertainty)^2
+    const auto a_yzx = details::lanes_yzx(a.values());
+    const auto a_zxy = details::lanes_zxy(a.values());
+    const auto b_yzx = details::lanes_yzx(b.values());
+    const auto b_zxy = details::lanes_zxy(b.values());
+    const auto sa_yzx = details::lanes_yzx(a.uncertainties());
+    const auto sa_zxy = details::lanes_zxy(a.uncertainties());
+    const auto sb_yzx = details::lanes_yzx(b.uncertainties());
+    const auto sb_zxy = details::lanes_zxy(b.uncertainties());
+
+    const auto value = details::lanes_scale(details::lanes_cross(a.values(), b.values()), scale);
+    const auto first = details::lanes_rss(details::lanes_mul(b_zxy, sa_yzx), details::lanes_mul(a_yzx, sb_zxy));
+    const auto second = details::lanes_rss(details::lanes_mul(b_yzx, sa_zxy), details::lanes_mul(a_zxy, sb_yzx));
+    const auto sigma = details::lanes_scale(details::lanes_rss(first, second), scale);
+    return aligned_vec_measurement_rss_3d_t<result_u>{value, sigma};
+}
+
+} // namespace PKR_UNITS_NAMESPACE
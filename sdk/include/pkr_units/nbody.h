@@ -0,0 +1,6 @@
+#pragma once
+
+// N-body gravity: SoA body storage, direct and Barnes-Hut force evaluation, leapfrog integration
+#include <pkr_units/nbody/body_system.h>
+#include <pkr_units/nbody/barnes_hut.h>
+#include <pkr_units/nbody/simulation.h>
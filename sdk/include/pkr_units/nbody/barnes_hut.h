@@ -0,0 +1,381 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+#include <pkr_units/constants/astronomical_constants.h>
+#include <pkr_units/nbody/body_system.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+namespace nbody
+{
+
+// ============================================================================
+// Gravity solvers
+// ============================================================================
+
+template <std::floating_point type_t = double>
+struct gravity_options
+{
+    // G in m^3 kg^-1 s^-2
+    constants::gravitational_constant_unit_t<type_t> gravitational_constant{static_cast<type_t>(constants::gravitational_constant_value)};
+    // Plummer softening length: 1/r^2 becomes 1/(r^2 + eps^2)
+    meter_t<type_t> softening{type_t{0}};
+    // Barnes-Hut opening angle theta: a cell of size s at distance d is treated as a point mass when s < theta * d.
+    // 0 reproduces the direct sum; 0.5 is the usual accuracy/speed compromise.
+    type_t opening_angle{static_cast<type_t>(0.5)};
+    // Maximum number of bodies in a leaf cell
+    std::size_t leaf_size{8};
+    // Number of bodies per scheduling chunk
+    std::size_t grain{256};
+};
+
+// Exact O(n^2) accelerations, parallel over target bodies. Reference for small systems and accuracy checks.
+template <std::floating_point type_t>
+void compute_accelerations_direct(body_system_t<type_t>& bodies, const gravity_options<type_t>& options = {}, work_stealing_pool& pool = work_stealing_pool::shared())
+{
+    const std::size_t n = bodies.size();
+    const auto x = std::as_const(bodies).x();
+    const auto y = std::as_const(bodies).y();
+    const auto z = std::as_const(bodies).z();
+    const auto m = bodies.masses();
+    const auto ax = bodies.ax();
+    const auto ay = bodies.ay();
+    const auto az = bodies.az();
+    const type_t g = options.gravitational_constant.value();
+    const type_t eps2 = options.softening.value() * options.softening.value();
+
+    pool.parallel_for(
+        0,
+        n,
+        options.grain,
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                type_t sx{0};
+                type_t sy{0};
+                type_t sz{0};
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    const type_t dx = x[j] - x[i];
+                    const type_t dy = y[j] - y[i];
+                    const type_t dz = z[j] - z[i];
+                    const type_t r2 = (dx * dx) + (dy * dy) + (dz * dz) + eps2;
+                    // j == i contributes nothing (dx = dy = dz = 0); the select keeps the loop branch-free
+                    const type_t inv_r = r2 > type_t{0} ? type_t{1} / std::sqrt(r2) : type_t{0};
+                    const type_t w = m[j] * inv_r * inv_r * inv_r;
+                    sx += w * dx;
+                    sy += w * dy;
+                    sz += w * dz;
+                }
+                ax[i] = g * sx;
+                ay[i] = g * sy;
+                az[i] = g * sz;
+            }
+        });
+}
+
+// ============================================================================
+// Barnes-Hut octree
+// ============================================================================
+// The tree is rebuilt every step from Morton-sorted bodies:
+//   1. each body gets a 63-bit Morton key of its position in the bounding cube
+//   2. bodies are sorted by key, so every octree cell is a contiguous range
+//   3. cells are emitted depth-first; each stores the index one past its
+//      subtree ("next"), so traversal is a stackless linear scan
+// Positions and masses are copied in sorted order, which keeps a tree walk's
+// memory accesses local. All buffers keep their capacity between builds.
+template <std::floating_point type_t = double>
+class barnes_hut_tree_t
+{
+public:
+    using value_type = type_t;
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    explicit barnes_hut_tree_t(const allocator_type& alloc = allocator_type())
+        : m_keys(alloc)
+        , m_sx(alloc)
+        , m_sy(alloc)
+        , m_sz(alloc)
+        , m_sm(alloc)
+        , m_nodes(alloc)
+    {
+    }
+
+    void build(const body_system_t<type_t>& bodies, std::size_t leaf_size = 8)
+    {
+        const std::size_t n = bodies.size();
+        if (n > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::invalid_argument("barnes_hut_tree_t::build: too many bodies");
+        }
+        m_leaf_size = std::max<std::size_t>(leaf_size, 1);
+        m_nodes.clear();
+        m_keys.resize(n);
+        m_sx.resize(n);
+        m_sy.resize(n);
+        m_sz.resize(n);
+        m_sm.resize(n);
+        if (n == 0)
+        {
+            return;
+        }
+
+        const auto x = bodies.x();
+        const auto y = bodies.y();
+        const auto z = bodies.z();
+        const auto m = bodies.masses();
+
+        type_t lo_x = x[0];
+        type_t lo_y = y[0];
+        type_t lo_z = z[0];
+        type_t hi_x = x[0];
+        type_t hi_y = y[0];
+        type_t hi_z = z[0];
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            lo_x = std::min(lo_x, x[i]);
+            lo_y = std::min(lo_y, y[i]);
+            lo_z = std::min(lo_z, z[i]);
+            hi_x = std::max(hi_x, x[i]);
+            hi_y = std::max(hi_y, y[i]);
+            hi_z = std::max(hi_z, z[i]);
+        }
+        type_t extent = std::max({hi_x - lo_x, hi_y - lo_y, hi_z - lo_z});
+        extent = extent > type_t{0} ? extent * static_cast<type_t>(1.0001) : type_t{1};
+        const type_t scale = static_cast<type_t>(key_cells) / extent;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m_keys[i] = {
+                morton_key(quantize((x[i] - lo_x) * scale), quantize((y[i] - lo_y) * scale), quantize((z[i] - lo_z) * scale)),
+                static_cast<std::uint32_t>(i)};
+        }
+        std::sort(m_keys.begin(), m_keys.end());
+
+        for (std::size_t s = 0; s < n; ++s)
+        {
+            const std::size_t i = m_keys[s].second;
+            m_sx[s] = x[i];
+            m_sy[s] = y[i];
+            m_sz[s] = z[i];
+            m_sm[s] = m[i];
+        }
+
+        build_cell(0, n, 0, extent);
+    }
+
+    // Accelerations of every body (written to bodies.ax/ay/az). build() must have been called for the current positions.
+    void compute_accelerations(body_system_t<type_t>& bodies, const gravity_options<type_t>& options = {}, work_stealing_pool& pool = work_stealing_pool::shared()) const
+    {
+        const std::size_t n = bodies.size();
+        if (n != m_keys.size())
+        {
+            throw std::invalid_argument("barnes_hut_tree_t::compute_accelerations: tree was built for a different body count");
+        }
+        const auto ax = bodies.ax();
+        const auto ay = bodies.ay();
+        const auto az = bodies.az();
+        const type_t g = options.gravitational_constant.value();
+        const type_t eps2 = options.softening.value() * options.softening.value();
+        const type_t theta2 = options.opening_angle * options.opening_angle;
+
+        pool.parallel_for(
+            0,
+            n,
+            options.grain,
+            [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t s = begin; s < end; ++s)
+                {
+                    type_t acc_x{0};
+                    type_t acc_y{0};
+                    type_t acc_z{0};
+                    walk(s, eps2, theta2, acc_x, acc_y, acc_z);
+                    const std::size_t i = m_keys[s].second;
+                    ax[i] = g * acc_x;
+                    ay[i] = g * acc_y;
+                    az[i] = g * acc_z;
+                }
+            });
+    }
+
+    [[nodiscard]] std::size_t node_count() const noexcept
+    {
+        return m_nodes.size();
+    }
+
+private:
+    static constexpr unsigned key_bits = 21;
+    static constexpr std::uint32_t key_cells = 1u << key_bits;
+
+    struct node_t
+    {
+        type_t com_x;
+        type_t com_y;
+        type_t com_z;
+        type_t mass;
+        type_t size2; // squared edge length of the cell
+        std::uint32_t first;
+        std::uint32_t count;
+        std::uint32_t next; // index one past this cell's subtree
+        bool leaf;
+    };
+
+    static std::uint32_t quantize(type_t v) noexcept
+    {
+        const type_t clamped = std::clamp(v, type_t{0}, static_cast<type_t>(key_cells - 1));
+        return static_cast<std::uint32_t>(clamped);
+    }
+
+    // Interleave the low 21 bits of each coordinate (x in the lowest position)
+    static std::uint64_t spread_bits(std::uint32_t v) noexcept
+    {
+        std::uint64_t b = v & 0x1fffffu;
+        b = (b | (b << 32)) & 0x1f00000000ffffULL;
+        b = (b | (b << 16)) & 0x1f0000ff0000ffULL;
+        b = (b | (b << 8)) & 0x100f00f00f00f00fULL;
+        b = (b | (b << 4)) & 0x10c30c30c30c30c3ULL;
+        b = (b | (b << 2)) & 0x1249249249249249ULL;
+        return b;
+    }
+
+    static std::uint64_t morton_key(std::uint32_t ix, std::uint32_t iy, std::uint32_t iz) noexcept
+    {
+        return spread_bits(ix) | (spread_bits(iy) << 1) | (spread_bits(iz) << 2);
+    }
+
+    // Emit the cell covering sorted bodies [first, last) at the given depth; returns its node index
+    std::size_t build_cell(std::size_t first, std::size_t last, unsigned depth, type_t cell_size)
+    {
+        const std::size_t index = m_nodes.size();
+        m_nodes.push_back(node_t{});
+        const bool leaf = (last - first) <= m_leaf_size || depth == key_bits;
+
+        type_t mass{0};
+        type_t mx{0};
+        type_t my{0};
+        type_t mz{0};
+        if (leaf)
+        {
+            for (std::size_t s = first; s < last; ++s)
+            {
+                mass += m_sm[s];
+                mx += m_sm[s] * m_sx[s];
+                my += m_sm[s] * m_sy[s];
+                mz += m_sm[s] * m_sz[s];
+            }
+        }
+        else
+        {
+            const unsigned shift = 3 * (key_bits - 1 - depth);
+            std::size_t begin = first;
+            for (std::uint64_t octant = 0; octant < 8 && begin < last; ++octant)
+            {
+                const auto end_it = std::partition_point(
+                    m_keys.begin() + static_cast<std::ptrdiff_t>(begin),
+                    m_keys.begin() + static_cast<std::ptrdiff_t>(last),
+                    [&](const key_type& key) { return ((key.first >> shift) & 7u) <= octant; });
+                const auto end = static_cast<std::size_t>(end_it - m_keys.begin());
+                if (end > begin)
+                {
+                    const std::size_t child = build_cell(begin, end, depth + 1, cell_size / 2);
+                    const node_t& c = m_nodes[child];
+                    mass += c.mass;
+                    mx += c.mass * c.com_x;
+                    my += c.mass * c.com_y;
+                    mz += c.mass * c.com_z;
+                }
+                begin = end;
+            }
+        }
+
+        node_t& node = m_nodes[index];
+        const type_t inv_mass = mass > type_t{0} ? type_t{1} / mass : type_t{0};
+        node.com_x = mx * inv_mass;
+        node.com_y = my * inv_mass;
+        node.com_z = mz * inv_mass;
+        node.mass = mass;
+        node.size2 = cell_size * cell_size;
+        node.first = static_cast<std::uint32_t>(first);
+        node.count = static_cast<std::uint32_t>(last - first);
+        node.next = static_cast<std::uint32_t>(m_nodes.size());
+        node.leaf = leaf;
+        return index;
+    }
+
+    void walk(std::size_t s, type_t eps2, type_t theta2, type_t& acc_x, type_t& acc_y, type_t& acc_z) const noexcept
+    {
+        const type_t px = m_sx[s];
+        const type_t py = m_sy[s];
+        const type_t pz = m_sz[s];
+        const std::size_t node_total = m_nodes.size();
+        std::size_t index = 0;
+        while (index < node_total)
+        {
+            const node_t& node = m_nodes[index];
+            const type_t dx = node.com_x - px;
+            const type_t dy = node.com_y - py;
+            const type_t dz = node.com_z - pz;
+            const type_t d2 = (dx * dx) + (dy * dy) + (dz * dz);
+            const bool contains_self = s >= node.first && s < node.first + node.count;
+
+            if (!contains_self && node.size2 < theta2 * d2)
+            {
+                // Far cell: point mass at its centre of mass
+                const type_t r2 = d2 + eps2;
+                const type_t inv_r = type_t{1} / std::sqrt(r2);
+                const type_t w = node.mass * inv_r * inv_r * inv_r;
+                acc_x += w * dx;
+                acc_y += w * dy;
+                acc_z += w * dz;
+                index = node.next;
+            }
+            else if (node.leaf)
+            {
+                const std::size_t end = node.first + node.count;
+                for (std::size_t j = node.first; j < end; ++j)
+                {
+                    const type_t bx = m_sx[j] - px;
+                    const type_t by = m_sy[j] - py;
+                    const type_t bz = m_sz[j] - pz;
+                    const type_t r2 = (bx * bx) + (by * by) + (bz * bz) + eps2;
+                    const type_t inv_r = (j != s && r2 > type_t{0}) ? type_t{1} / std::sqrt(r2) : type_t{0};
+                    const type_t w = m_sm[j] * inv_r * inv_r * inv_r;
+                    acc_x += w * bx;
+                    acc_y += w * by;
+                    acc_z += w * bz;
+                }
+                index = node.next;
+            }
+            else
+            {
+                ++index; // open the cell: its first child follows it
+            }
+        }
+    }
+
+    using key_type = std::pair<std::uint64_t, std::uint32_t>;
+
+    std::size_t m_leaf_size{8};
+    std::pmr::vector<key_type> m_keys;
+    std::pmr::vector<type_t> m_sx;
+    std::pmr::vector<type_t> m_sy;
+    std::pmr::vector<type_t> m_sz;
+    std::pmr::vector<type_t> m_sm;
+    std::pmr::vector<node_t> m_nodes;
+};
+
+} // namespace nbody
+} // namespace PKR_UNITS_NAMESPACE
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+#include <pkr_units/units/base/length.h>
+#include <pkr_units/units/base/mass.h>
+#include <pkr_units/units/derived/velocity.h>
+#include <pkr_units/units/derived/acceleration.h>
+#include <pkr_units/units/derived/mechanical/energy.h>
+#include <pkr_units/units/math/vector_unit_3d.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+namespace nbody
+{
+
+// ============================================================================
+// Structure-of-arrays body storage
+// ============================================================================
+// Positions, velocities, accelerations and masses are stored as separate
+// arrays of coherent SI values (m, m/s, m/s^2, kg) so force and integration
+// kernels stream through memory with unit stride. The typed accessors convert
+// at the boundary: add_body() accepts any length, velocity and mass unit.
+template <std::floating_point type_t = double>
+class body_system_t
+{
+public:
+    using value_type = type_t;
+    using position_type = vec_3d_units_t<meter_t<type_t>>;
+    using velocity_type = vec_3d_units_t<meter_per_second_t<type_t>>;
+    using acceleration_type = vec_3d_units_t<meter_per_second_squared_t<type_t>>;
+    using mass_type = kilogram_t<type_t>;
+    using allocator_type = std::pmr::polymorphic_allocator<type_t>;
+
+    explicit body_system_t(const allocator_type& alloc = allocator_type())
+        : m_x(alloc)
+        , m_y(alloc)
+        , m_z(alloc)
+        , m_vx(alloc)
+        , m_vy(alloc)
+        , m_vz(alloc)
+        , m_ax(alloc)
+        , m_ay(alloc)
+        , m_az(alloc)
+        , m_mass(alloc)
+    {
+    }
+
+    void reserve(std::size_t count)
+    {
+        for (auto* component : components())
+        {
+            component->reserve(count);
+        }
+    }
+
+    template <is_pkr_unit_c length_u, is_pkr_unit_c velocity_u, is_pkr_unit_c mass_u>
+    std::size_t add_body(const vec_3d_units_t<length_u>& position, const vec_3d_units_t<velocity_u>& velocity, const mass_u& mass)
+    {
+        static_assert(details::is_pkr_unit<length_u>::value_dimension == length_dimension, "body_system_t::add_body: position must be a length");
+        static_assert(details::is_pkr_unit<velocity_u>::value_dimension == velocity_dimension, "body_system_t::add_body: velocity must be a velocity");
+        static_assert(details::is_pkr_unit<mass_u>::value_dimension == mass_dimension, "body_system_t::add_body: mass must be a mass");
+
+        m_x.push_back(static_cast<type_t>(position.x.in_base_si_units().value()));
+        m_y.push_back(static_cast<type_t>(position.y.in_base_si_units().value()));
+        m_z.push_back(static_cast<type_t>(position.z.in_base_si_units().value()));
+        m_vx.push_back(static_cast<type_t>(velocity.x.in_base_si_units().value()));
+        m_vy.push_back(static_cast<type_t>(velocity.y.in_base_si_units().value()));
+        m_vz.push_back(static_cast<type_t>(velocity.z.in_base_si_units().value()));
+        m_ax.push_back(type_t{0});
+        m_ay.push_back(type_t{0});
+        m_az.push_back(type_t{0});
+        m_mass.push_back(static_cast<type_t>(mass.in_base_si_units().value()));
+        return m_mass.size() - 1;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_mass.size();
+    }
+
+    [[nodiscard]] position_type position(std::size_t i) const
+    {
+        check_index(i);
+        return position_type{meter_t<type_t>{m_x[i]}, meter_t<type_t>{m_y[i]}, meter_t<type_t>{m_z[i]}};
+    }
+
+    [[nodiscard]] velocity_type velocity(std::size_t i) const
+    {
+        check_index(i);
+        return velocity_type{meter_per_second_t<type_t>{m_vx[i]}, meter_per_second_t<type_t>{m_vy[i]}, meter_per_second_t<type_t>{m_vz[i]}};
+    }
+
+    [[nodiscard]] acceleration_type acceleration(std::size_t i) const
+    {
+        check_index(i);
+        return acceleration_type{
+            meter_per_second_squared_t<type_t>{m_ax[i]}, meter_per_second_squared_t<type_t>{m_ay[i]}, meter_per_second_squared_t<type_t>{m_az[i]}};
+    }
+
+    [[nodiscard]] mass_type mass(std::size_t i) const
+    {
+        check_index(i);
+        return mass_type{m_mass[i]};
+    }
+
+    // Raw SI component arrays for kernels
+    [[nodiscard]] std::span<type_t> x() noexcept
+    {
+        return m_x;
+    }
+
+    [[nodiscard]] std::span<type_t> y() noexcept
+    {
+        return m_y;
+    }
+
+    [[nodiscard]] std::span<type_t> z() noexcept
+    {
+        return m_z;
+    }
+
+    [[nodiscard]] std::span<type_t> vx() noexcept
+    {
+        return m_vx;
+    }
+
+    [[nodiscard]] std::span<type_t> vy() noexcept
+    {
+        return m_vy;
+    }
+
+    [[nodiscard]] std::span<type_t> vz() noexcept
+    {
+        return m_vz;
+    }
+
+    [[nodiscard]] std::span<type_t> ax() noexcept
+    {
+        return m_ax;
+    }
+
+    [[nodiscard]] std::span<type_t> ay() noexcept
+    {
+        return m_ay;
+    }
+
+    [[nodiscard]] std::span<type_t> az() noexcept
+    {
+        return m_az;
+    }
+
+    [[nodiscard]] std::span<const type_t> x() const noexcept
+    {
+        return m_x;
+    }
+
+    [[nodiscard]] std::span<const type_t> y() const noexcept
+    {
+        return m_y;
+    }
+
+    [[nodiscard]] std::span<const type_t> z() const noexcept
+    {
+        return m_z;
+    }
+
+    [[nodiscard]] std::span<const type_t> vx() const noexcept
+    {
+        return m_vx;
+    }
+
+    [[nodiscard]] std::span<const type_t> vy() const noexcept
+    {
+        return m_vy;
+    }
+
+    [[nodiscard]] std::span<const type_t> vz() const noexcept
+    {
+        return m_vz;
+    }
+
+    [[nodiscard]] std::span<const type_t> ax() const noexcept
+    {
+        return m_ax;
+    }
+
+    [[nodiscard]] std::span<const type_t> ay() const noexcept
+    {
+        return m_ay;
+    }
+
+    [[nodiscard]] std::span<const type_t> az() const noexcept
+    {
+        return m_az;
+    }
+
+    [[nodiscard]] std::span<const type_t> masses() const noexcept
+    {
+        return m_mass;
+    }
+
+    [[nodiscard]] joule_t<type_t> kinetic_energy() const noexcept
+    {
+        type_t sum{0};
+        for (std::size_t i = 0; i < size(); ++i)
+        {
+            sum += m_mass[i] * ((m_vx[i] * m_vx[i]) + (m_vy[i] * m_vy[i]) + (m_vz[i] * m_vz[i]));
+        }
+        return joule_t<type_t>{static_cast<type_t>(0.5) * sum};
+    }
+
+    // Direct O(n^2) pairwise potential energy -G m_i m_j / sqrt(r^2 + eps^2), evaluated in parallel
+    [[nodiscard]] joule_t<type_t> potential_energy(type_t gravitational_constant, type_t softening = type_t{0}, work_stealing_pool& pool = work_stealing_pool::shared()) const
+    {
+        const std::size_t n = size();
+        const type_t eps2 = softening * softening;
+        std::vector<type_t> partial(n, type_t{0});
+        pool.parallel_for(
+            0,
+            n,
+            64,
+            [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    type_t sum{0};
+                    for (std::size_t j = i + 1; j < n; ++j)
+                    {
+                        const type_t dx = m_x[j] - m_x[i];
+                        const type_t dy = m_y[j] - m_y[i];
+                        const type_t dz = m_z[j] - m_z[i];
+                        sum += m_mass[j] / std::sqrt((dx * dx) + (dy * dy) + (dz * dz) + eps2);
+                    }
+                    partial[i] = m_mass[i] * sum;
+                }
+            });
+        type_t total{0};
+        for (const type_t p : partial)
+        {
+            total += p;
+        }
+        return joule_t<type_t>{-gravitational_constant * total};
+    }
+
+    [[nodiscard]] joule_t<type_t> total_energy(type_t gravitational_constant, type_t softening = type_t{0}) const
+    {
+        return joule_t<type_t>{kinetic_energy().value() + potential_energy(gravitational_constant, softening).value()};
+    }
+
+private:
+    std::array<std::pmr::vector<type_t>*, 10> components() noexcept
+    {
+        return {&m_x, &m_y, &m_z, &m_vx, &m_vy, &m_vz, &m_ax, &m_ay, &m_az, &m_mass};
+    }
+
+    void check_index(std::size_t i) const
+    {
+        if (i >= size())
+        {
+            throw std::out_of_range("body_system_t: body index out of range");
+        }
+    }
+
+    std::pmr::vector<type_t> m_x;
+    std::pmr::vector<type_t> m_y;
+    std::pmr::vector<type_t> m_z;
+    std::pmr::vector<type_t> m_vx;
+    std::pmr::vector<type_t> m_vy;
+    std::pmr::vector<type_t> m_vz;
+    std::pmr::vector<type_t> m_ax;
+    std::pmr::vector<type_t> m_ay;
+    std::pmr::vector<type_t> m_az;
+    std::pmr::vector<type_t> m_mass;
+};
+
+} // namespace nbody
+} // namespace PKR_UNITS_NAMESPACE
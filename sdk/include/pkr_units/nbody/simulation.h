@@ -0,0 +1,166 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+#include <pkr_units/units/base/time.h>
+#include <pkr_units/nbody/body_system.h>
+#include <pkr_units/nbody/barnes_hut.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+namespace nbody
+{
+
+enum class force_method
+{
+    direct,
+    barnes_hut
+};
+
+// ============================================================================
+// Leapfrog (kick-drift-kick) simulation
+// ============================================================================
+// Second order and symplectic: energy error stays bounded over long runs.
+// Accelerations from the end of one step are reused at the start of the next,
+// so each step costs one force evaluation. Kicks and drifts run in parallel on
+// the same pool as the force evaluation.
+template <std::floating_point type_t = double>
+class simulation_t
+{
+public:
+    using value_type = type_t;
+    using time_type = second_t<type_t>;
+
+    explicit simulation_t(
+        body_system_t<type_t> bodies,
+        const gravity_options<type_t>& options = {},
+        force_method method = force_method::barnes_hut,
+        work_stealing_pool& pool = work_stealing_pool::shared())
+        : m_bodies(std::move(bodies))
+        , m_options(options)
+        , m_method(method)
+        , m_pool(&pool)
+    {
+    }
+
+    [[nodiscard]] const body_system_t<type_t>& bodies() const noexcept
+    {
+        return m_bodies;
+    }
+
+    // Direct access for adding bodies or editing state; invalidates cached accelerations
+    [[nodiscard]] body_system_t<type_t>& mutable_bodies() noexcept
+    {
+        m_accelerations_valid = false;
+        return m_bodies;
+    }
+
+    [[nodiscard]] const gravity_options<type_t>& options() const noexcept
+    {
+        return m_options;
+    }
+
+    [[nodiscard]] time_type time() const noexcept
+    {
+        return time_type{m_time};
+    }
+
+    void step(time_type dt)
+    {
+        const type_t h = dt.value();
+        if (!m_accelerations_valid)
+        {
+            compute_accelerations();
+        }
+        kick(h / 2);
+        drift(h);
+        compute_accelerations();
+        kick(h / 2);
+        m_time += h;
+    }
+
+    void run(time_type dt, std::size_t step_count)
+    {
+        for (std::size_t i = 0; i < step_count; ++i)
+        {
+            step(dt);
+        }
+    }
+
+    void compute_accelerations()
+    {
+        if (m_method == force_method::direct)
+        {
+            compute_accelerations_direct(m_bodies, m_options, *m_pool);
+        }
+        else
+        {
+            m_tree.build(m_bodies, m_options.leaf_size);
+            m_tree.compute_accelerations(m_bodies, m_options, *m_pool);
+        }
+        m_accelerations_valid = true;
+    }
+
+private:
+    void kick(type_t h)
+    {
+        const auto vx = m_bodies.vx();
+        const auto vy = m_bodies.vy();
+        const auto vz = m_bodies.vz();
+        const auto ax = std::as_const(m_bodies).ax();
+        const auto ay = std::as_const(m_bodies).ay();
+        const auto az = std::as_const(m_bodies).az();
+        m_pool->parallel_for(
+            0,
+            m_bodies.size(),
+            stream_grain,
+            [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    vx[i] += h * ax[i];
+                    vy[i] += h * ay[i];
+                    vz[i] += h * az[i];
+                }
+            });
+    }
+
+    void drift(type_t h)
+    {
+        const auto x = m_bodies.x();
+        const auto y = m_bodies.y();
+        const auto z = m_bodies.z();
+        const auto vx = std::as_const(m_bodies).vx();
+        const auto vy = std::as_const(m_bodies).vy();
+        const auto vz = std::as_const(m_bodies).vz();
+        m_pool->parallel_for(
+            0,
+            m_bodies.size(),
+            stream_grain,
+            [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    x[i] += h * vx[i];
+                    y[i] += h * vy[i];
+                    z[i] += h * vz[i];
+                }
+            });
+    }
+
+    static constexpr std::size_t stream_grain = 16384;
+
+    body_system_t<type_t> m_bodies;
+    gravity_options<type_t> m_options;
+    force_method m_method;
+    work_stealing_pool* m_pool;
+    barnes_hut_tree_t<type_t> m_tree;
+    type_t m_time{0};
+    bool m_accelerations_valid{false};
+};
+
+} // namespace nbody
+} // namespace PKR_UNITS_NAMESPACE
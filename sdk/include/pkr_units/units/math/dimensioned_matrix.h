@@ -0,0 +1,737 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/impl/linalg/backend_kernels.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
+#include <pkr_units/impl/unit_t.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/units/math/vector_unit_3d.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+// ============================================================================
+// Dimensioned matrices (heterogeneous units per row and column)
+// ============================================================================
+//
+// A dimensioned matrix carries one dimension per row and one per column.
+// Element (i, j) has dimension rows[i] - cols[j]. This covers every matrix
+// that appears in state-space models:
+//
+//   state vector x        rows = x,  cols = {scalar}    x_i
+//   Jacobian / transition rows = y,  cols = x           y_i / x_j
+//   covariance P          rows = x,  cols = -x          x_i * x_j
+//
+// Products, transposes and inverses compute the resulting row/column
+// dimensions at compile time, so a mismatched model (e.g. an H matrix built
+// for the wrong state) fails to compile instead of producing wrong numbers.
+//
+// Values are stored in coherent SI units (ratio 1/1), row-major. Typed access
+// goes through get<i, j>() / set<i, j>(); raw SI access through si_element().
+// A representation is not unique (adding the same dimension to every row and
+// column describes the same elements), so results are always returned in the
+// canonical form where cols[0] is dimensionless.
+//
+// Up to dense_inline_limit elements (32x32) the values live inline in a
+// std::array; larger matrices, such as the covariance of a 200-state
+// estimator, keep the same fixed-size interface on the heap (through
+// dense_matrix_allocator) so temporaries do not exhaust the stack. Products
+// use the cache-blocked GEMM kernel, or the Eigen/BLAS backend for large
+// products when one is selected (see impl/linalg/backend_kernels.h). A CSR
+// counterpart for sparse Jacobians is in sparse_dimensioned_matrix.h.
+
+template <dimension_t... dims_v>
+struct dimension_list
+{
+    static constexpr std::size_t size = sizeof...(dims_v);
+    static constexpr std::array<dimension_t, sizeof...(dims_v)> values{dims_v...};
+};
+
+// Allocator for the heap storage of matrices above dense_inline_limit elements.
+// Specialize it for a value type to take those buffers from a pool or a memory
+// resource (see the allocator and pmr policies in matrix_storage_policies.h).
+// The allocator is default-constructed, so std::pmr::polymorphic_allocator
+// draws from std::pmr::get_default_resource().
+template <typename type_t>
+struct dense_matrix_allocator
+{
+    using type = std::allocator<type_t>;
+};
+
+namespace details
+{
+
+template <typename T>
+struct is_dimension_list : std::false_type
+{
+};
+
+template <dimension_t... dims_v>
+struct is_dimension_list<dimension_list<dims_v...>> : std::true_type
+{
+};
+
+template <typename list_t, dimension_t delta_v>
+struct shift_dimension_list;
+
+template <dimension_t delta_v, dimension_t... dims_v>
+struct shift_dimension_list<dimension_list<dims_v...>, delta_v>
+{
+    using type = dimension_list<add_dimensions(dims_v, delta_v)...>;
+};
+
+template <typename list_t>
+struct negate_dimension_list;
+
+template <dimension_t... dims_v>
+struct negate_dimension_list<dimension_list<dims_v...>>
+{
+    using type = dimension_list<negate_dimension(dims_v)...>;
+};
+
+template <typename list_t, std::size_t offset_v, std::size_t count_v, typename index_t = std::make_index_sequence<count_v>>
+struct slice_dimension_list;
+
+template <typename list_t, std::size_t offset_v, std::size_t count_v, std::size_t... index_v>
+struct slice_dimension_list<list_t, offset_v, count_v, std::index_sequence<index_v...>>
+{
+    static_assert(offset_v + count_v <= list_t::size, "dimension_list: slice out of range");
+    using type = dimension_list<list_t::values[offset_v + index_v]...>;
+};
+
+// Canonical representation: shift rows and columns so that cols[0] is dimensionless
+template <typename row_dims_t, typename col_dims_t>
+struct canonical_dimensions
+{
+    static constexpr dimension_t offset = negate_dimension(col_dims_t::values[0]);
+    using rows = typename shift_dimension_list<row_dims_t, offset>::type;
+    using cols = typename shift_dimension_list<col_dims_t, offset>::type;
+};
+
+// Two representations describe the same elements when rows and columns differ by one common offset
+template <typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+constexpr bool equivalent_dimensions() noexcept
+{
+    if constexpr (rows_a_t::size != rows_b_t::size || cols_a_t::size != cols_b_t::size)
+    {
+        return false;
+    }
+    else
+    {
+        const dimension_t offset = subtract_dimensions(cols_b_t::values[0], cols_a_t::values[0]);
+        for (std::size_t i = 0; i < rows_a_t::size; ++i)
+        {
+            if (subtract_dimensions(rows_b_t::values[i], rows_a_t::values[i]) != offset)
+            {
+                return false;
+            }
+        }
+        for (std::size_t j = 0; j < cols_a_t::size; ++j)
+        {
+            if (subtract_dimensions(cols_b_t::values[j], cols_a_t::values[j]) != offset)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+// A product A * B is consistent when rhs_rows[k] - lhs_cols[k] is the same for every k
+template <typename lhs_cols_t, typename rhs_rows_t>
+constexpr bool consistent_inner_dimensions() noexcept
+{
+    if constexpr (lhs_cols_t::size != rhs_rows_t::size)
+    {
+        return false;
+    }
+    else
+    {
+        const dimension_t delta = subtract_dimensions(rhs_rows_t::values[0], lhs_cols_t::values[0]);
+        for (std::size_t k = 1; k < lhs_cols_t::size; ++k)
+        {
+            if (subtract_dimensions(rhs_rows_t::values[k], lhs_cols_t::values[k]) != delta)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+// Diagonal elements of a square matrix are dimensionless (required for identity)
+template <typename row_dims_t, typename col_dims_t>
+constexpr bool dimensionless_diagonal() noexcept
+{
+    if constexpr (row_dims_t::size != col_dims_t::size)
+    {
+        return false;
+    }
+    else
+    {
+        for (std::size_t i = 0; i < row_dims_t::size; ++i)
+        {
+            if (row_dims_t::values[i] != col_dims_t::values[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+template <typename type_t>
+constexpr type_t abs_value(type_t value) noexcept
+{
+    return value < static_cast<type_t>(0) ? -value : value;
+}
+
+inline constexpr std::size_t dense_inline_limit = 1024;
+
+// Fixed-size, zero-initialized heap buffer with the parts of the std::array
+// interface the matrix uses, allocated through allocator_t. It has value
+// semantics: a moved-from buffer stays usable. Move construction hands the
+// source a fresh zero buffer, and move assignment swaps buffers when the
+// allocators are equal, leaving the source with the target's old values.
+template <typename type_t, std::size_t size_v, typename allocator_t = std::allocator<type_t>>
+class heap_array
+{
+    using allocator_type = typename std::allocator_traits<allocator_t>::template rebind_alloc<type_t>;
+    using traits = std::allocator_traits<allocator_type>;
+
+public:
+    using value_type = type_t;
+
+    explicit heap_array(const allocator_type& alloc = allocator_type())
+        : m_alloc(alloc)
+        , m_data(allocate())
+    {
+        std::uninitialized_fill_n(m_data, size_v, type_t{});
+    }
+
+    // Like aggregate initialization of std::array: missing trailing values are zero
+    heap_array(std::initializer_list<type_t> values)
+        : heap_array()
+    {
+        std::copy_n(values.begin(), std::min(values.size(), size_v), m_data);
+    }
+
+    heap_array(const heap_array& other)
+        : m_alloc(traits::select_on_container_copy_construction(other.m_alloc))
+        , m_data(allocate())
+    {
+        std::uninitialized_copy_n(other.m_data, size_v, m_data);
+    }
+
+    heap_array(heap_array&& other)
+        : m_alloc(other.m_alloc)
+        , m_data(other.replace_with_zero_buffer())
+    {
+    }
+
+    heap_array& operator=(const heap_array& other)
+    {
+        if (this != &other)
+        {
+            std::copy_n(other.m_data, size_v, m_data);
+        }
+        return *this;
+    }
+
+    heap_array& operator=(heap_array&& other) noexcept(traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        if constexpr (traits::propagate_on_container_move_assignment::value)
+        {
+            std::swap(m_alloc, other.m_alloc);
+            std::swap(m_data, other.m_data);
+        }
+        else if (m_alloc == other.m_alloc)
+        {
+            std::swap(m_data, other.m_data);
+        }
+        else
+        {
+            std::copy_n(other.m_data, size_v, m_data);
+        }
+        return *this;
+    }
+
+    ~heap_array()
+    {
+        std::destroy_n(m_data, size_v);
+        traits::deallocate(m_alloc, m_data, size_v);
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return m_alloc;
+    }
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept
+    {
+        return size_v;
+    }
+
+    [[nodiscard]] type_t* data() noexcept
+    {
+        return m_data;
+    }
+
+    [[nodiscard]] const type_t* data() const noexcept
+    {
+        return m_data;
+    }
+
+    [[nodiscard]] type_t& operator[](std::size_t i) noexcept
+    {
+        return m_data[i];
+    }
+
+    [[nodiscard]] const type_t& operator[](std::size_t i) const noexcept
+    {
+        return m_data[i];
+    }
+
+    type_t* begin() noexcept
+    {
+        return data();
+    }
+
+    type_t* end() noexcept
+    {
+        return data() + size_v;
+    }
+
+    const type_t* begin() const noexcept
+    {
+        return data();
+    }
+
+    const type_t* end() const noexcept
+    {
+        return data() + size_v;
+    }
+
+    friend bool operator==(const heap_array& a, const heap_array& b) noexcept
+    {
+        return std::equal(a.begin(), a.end(), b.begin());
+    }
+
+private:
+    type_t* allocate()
+    {
+        return std::to_address(traits::allocate(m_alloc, size_v));
+    }
+
+    // Swaps in a zero buffer from this allocator and returns the old one; unchanged if allocation throws
+    type_t* replace_with_zero_buffer()
+    {
+        type_t* fresh = allocate();
+        std::uninitialized_fill_n(fresh, size_v, type_t{});
+        return std::exchange(m_data, fresh);
+    }
+
+    [[no_unique_address]] allocator_type m_alloc;
+    type_t* m_data;
+};
+
+template <typename type_t, std::size_t size_v>
+using dense_storage_t = std::conditional_t<
+    (size_v <= dense_inline_limit),
+    std::array<type_t, size_v>,
+    heap_array<type_t, size_v, typename dense_matrix_allocator<type_t>::type>>;
+
+} // namespace details
+
+template <is_unit_value_type_c type_t, typename row_dims_t, typename col_dims_t>
+class dimensioned_matrix_t
+{
+    static_assert(details::is_dimension_list<row_dims_t>::value && details::is_dimension_list<col_dims_t>::value,
+        "dimensioned_matrix_t: row and column dimensions must be dimension_list types");
+    static_assert(row_dims_t::size > 0 && col_dims_t::size > 0, "dimensioned_matrix_t: matrix must have at least one row and one column");
+
+public:
+    using value_type = type_t;
+    using row_dimensions = row_dims_t;
+    using col_dimensions = col_dims_t;
+
+    static constexpr std::size_t row_count = row_dims_t::size;
+    static constexpr std::size_t col_count = col_dims_t::size;
+
+    using array_type = details::dense_storage_t<type_t, row_count * col_count>;
+
+    // False for heap-backed matrices, whose construction allocates
+    static constexpr bool nothrow_storage = std::is_nothrow_default_constructible_v<array_type>;
+
+    template <std::size_t row_v, std::size_t col_v = 0>
+    static constexpr dimension_t element_dimension = details::subtract_dimensions(row_dims_t::values[row_v], col_dims_t::values[col_v]);
+
+    template <std::size_t row_v, std::size_t col_v = 0>
+    using element_type = typename derived_unit_type_t<type_t, std::ratio<1, 1>, element_dimension<row_v, col_v>>::type;
+
+    // Zero-initialized matrix
+    constexpr dimensioned_matrix_t() noexcept(nothrow_storage)
+        : m_values{}
+    {
+    }
+
+    // Construct from raw row-major values expressed in coherent SI units
+    explicit constexpr dimensioned_matrix_t(const array_type& si_elements) noexcept(nothrow_storage)
+        : m_values(si_elements)
+    {
+    }
+
+    // Convert from an equivalent representation (same element dimensions)
+    template <typename other_rows_t, typename other_cols_t>
+        requires(
+            !std::is_same_v<dimensioned_matrix_t<type_t, other_rows_t, other_cols_t>, dimensioned_matrix_t> &&
+            details::equivalent_dimensions<row_dims_t, col_dims_t, other_rows_t, other_cols_t>())
+    constexpr dimensioned_matrix_t(const dimensioned_matrix_t<type_t, other_rows_t, other_cols_t>& other) noexcept(nothrow_storage)
+        : m_values(other.si_elements())
+    {
+    }
+
+    static constexpr dimensioned_matrix_t zero() noexcept(nothrow_storage)
+    {
+        return dimensioned_matrix_t{};
+    }
+
+    static constexpr dimensioned_matrix_t identity() noexcept(nothrow_storage)
+        requires(details::dimensionless_diagonal<row_dims_t, col_dims_t>())
+    {
+        dimensioned_matrix_t m{};
+        for (std::size_t i = 0; i < row_count; ++i)
+        {
+            m.m_values[(i * col_count) + i] = static_cast<type_t>(1);
+        }
+        return m;
+    }
+
+    // Typed element access (returns the most derived SI unit for the element dimension)
+    template <std::size_t row_v, std::size_t col_v = 0>
+    [[nodiscard]] constexpr element_type<row_v, col_v> get() const noexcept
+    {
+        static_assert(row_v < row_count && col_v < col_count, "dimensioned_matrix_t::get: index out of range");
+        return element_type<row_v, col_v>{m_values[(row_v * col_count) + col_v]};
+    }
+
+    // Typed element assignment; any unit with the element dimension is accepted and converted to SI
+    template <std::size_t row_v, std::size_t col_v = 0, is_pkr_unit_c unit_u>
+    constexpr void set(const unit_u& value) noexcept
+    {
+        static_assert(row_v < row_count && col_v < col_count, "dimensioned_matrix_t::set: index out of range");
+        static_assert(
+            details::is_pkr_unit<unit_u>::value_dimension == element_dimension<row_v, col_v>,
+            "dimensioned_matrix_t::set: unit dimension does not match the element dimension");
+        static_assert(std::is_same_v<typename details::is_pkr_unit<unit_u>::value_type, type_t>, "dimensioned_matrix_t::set: value type mismatch");
+        using ratio_type = typename details::is_pkr_unit<unit_u>::ratio_type;
+        m_values[(row_v * col_count) + col_v] = details::convert_ratio_to<type_t, ratio_type, std::ratio<1, 1>>(value.value());
+    }
+
+    // Raw SI access for algorithms (dimensions are tracked by the matrix type)
+    [[nodiscard]] constexpr type_t& si_element(std::size_t row, std::size_t col) noexcept
+    {
+        return m_values[(row * col_count) + col];
+    }
+
+    [[nodiscard]] constexpr type_t si_element(std::size_t row, std::size_t col) const noexcept
+    {
+        return m_values[(row * col_count) + col];
+    }
+
+    [[nodiscard]] constexpr const array_type& si_elements() const noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] constexpr array_type& si_elements() noexcept
+    {
+        return m_values;
+    }
+
+    constexpr dimensioned_matrix_t& operator+=(const dimensioned_matrix_t& other) noexcept
+    {
+        for (std::size_t i = 0; i < m_values.size(); ++i)
+        {
+            m_values[i] += other.m_values[i];
+        }
+        return *this;
+    }
+
+    constexpr dimensioned_matrix_t& operator-=(const dimensioned_matrix_t& other) noexcept
+    {
+        for (std::size_t i = 0; i < m_values.size(); ++i)
+        {
+            m_values[i] -= other.m_values[i];
+        }
+        return *this;
+    }
+
+    constexpr dimensioned_matrix_t& operator*=(type_t scalar) noexcept
+    {
+        for (auto& v : m_values)
+        {
+            v *= scalar;
+        }
+        return *this;
+    }
+
+    constexpr bool operator==(const dimensioned_matrix_t& other) const noexcept
+    {
+        return m_values == other.m_values;
+    }
+
+private:
+    array_type m_values;
+};
+
+// ============================================================================
+// Type aliases
+// ============================================================================
+
+template <is_unit_value_type_c type_t, typename row_dims_t, typename col_dims_t>
+using canonical_dimensioned_matrix_t = dimensioned_matrix_t<
+    type_t,
+    typename details::canonical_dimensions<row_dims_t, col_dims_t>::rows,
+    typename details::canonical_dimensions<row_dims_t, col_dims_t>::cols>;
+
+// Column vector with one dimension per element
+template <is_unit_value_type_c type_t, typename dims_t>
+using dimensioned_vector_t = dimensioned_matrix_t<type_t, dims_t, dimension_list<scalar_dimension>>;
+
+// Heterogeneous unit vector built from unit types, e.g. unit_vector_t<meter_t<double>, meter_per_second_t<double>>
+template <is_pkr_unit_c... units_t>
+using unit_vector_t =
+    dimensioned_vector_t<std::common_type_t<typename details::is_pkr_unit<units_t>::value_type...>, dimension_list<details::is_pkr_unit<units_t>::value_dimension...>>;
+
+// Covariance of a vector with dimensions dims_t: element (i, j) has dimension dims[i] + dims[j]
+template <is_unit_value_type_c type_t, typename dims_t>
+using covariance_matrix_t = canonical_dimensioned_matrix_t<type_t, dims_t, typename details::negate_dimension_list<dims_t>::type>;
+
+// Jacobian d(out)/d(in): element (i, j) has dimension out[i] - in[j]
+template <is_unit_value_type_c type_t, typename out_dims_t, typename in_dims_t>
+using jacobian_matrix_t = canonical_dimensioned_matrix_t<type_t, out_dims_t, in_dims_t>;
+
+template <typename T>
+struct is_dimensioned_matrix : std::false_type
+{
+};
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+struct is_dimensioned_matrix<dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>> : std::true_type
+{
+};
+
+template <typename T>
+concept dimensioned_matrix_c = is_dimensioned_matrix<std::remove_cvref_t<T>>::value;
+
+template <typename T>
+concept dimensioned_vector_c = dimensioned_matrix_c<T> && std::remove_cvref_t<T>::col_count == 1 &&
+                               std::remove_cvref_t<T>::col_dimensions::values[0] == scalar_dimension;
+
+// ============================================================================
+// Construction helpers
+// ============================================================================
+
+template <is_pkr_unit_c... units_t>
+constexpr unit_vector_t<units_t...> make_unit_vector(const units_t&... values) noexcept(unit_vector_t<units_t...>::nothrow_storage)
+{
+    unit_vector_t<units_t...> result{};
+    std::size_t index = 0;
+    ((result.si_element(index++, 0) = details::convert_ratio_to<
+          typename unit_vector_t<units_t...>::value_type,
+          typename details::is_pkr_unit<units_t>::ratio_type,
+          std::ratio<1, 1>>(values.value())),
+     ...);
+    return result;
+}
+
+template <is_pkr_unit_c unit_u>
+constexpr unit_vector_t<unit_u, unit_u, unit_u> make_unit_vector(const vec_3d_units_t<unit_u>& v) noexcept
+{
+    return make_unit_vector(v.x, v.y, v.z);
+}
+
+// Extract three consecutive elements with identical dimension as a vec_3d_units_t
+template <std::size_t offset_v, dimensioned_vector_c vector_t>
+constexpr auto to_vec_3d_units(const vector_t& v) noexcept
+{
+    static_assert(offset_v + 3 <= vector_t::row_count, "to_vec_3d_units: offset out of range");
+    static_assert(
+        vector_t::row_dimensions::values[offset_v] == vector_t::row_dimensions::values[offset_v + 1] &&
+            vector_t::row_dimensions::values[offset_v] == vector_t::row_dimensions::values[offset_v + 2],
+        "to_vec_3d_units: the three elements must share one dimension");
+    using element_t = typename vector_t::template element_type<offset_v>;
+    return vec_3d_units_t<element_t>{v.template get<offset_v>(), v.template get<offset_v + 1>(), v.template get<offset_v + 2>()};
+}
+
+// ============================================================================
+// Arithmetic
+// ============================================================================
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+constexpr dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>
+    operator+(dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> lhs, const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+constexpr dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>
+    operator-(dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> lhs, const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+constexpr dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> operator-(dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> m) noexcept
+{
+    m *= static_cast<type_t>(-1);
+    return m;
+}
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+constexpr dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> operator*(dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> m, type_t scalar) noexcept
+{
+    m *= scalar;
+    return m;
+}
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+constexpr dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> operator*(type_t scalar, dimensioned_matrix_t<type_t, row_dims_t, col_dims_t> m) noexcept
+{
+    m *= scalar;
+    return m;
+}
+
+namespace details
+{
+
+// Result type of (rows_a, cols_a) * (rows_b, cols_b): (rows_a + delta, cols_b) with delta = rows_b[k] - cols_a[k]
+template <typename type_t, typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+struct dimensioned_product
+{
+    static_assert(cols_a_t::size == rows_b_t::size, "dimensioned_matrix_t: operand sizes do not match for multiplication");
+    static_assert(consistent_inner_dimensions<cols_a_t, rows_b_t>(), "dimensioned_matrix_t: inner dimensions of the product are inconsistent");
+
+    static constexpr dimension_t delta = subtract_dimensions(rows_b_t::values[0], cols_a_t::values[0]);
+    using type = canonical_dimensioned_matrix_t<type_t, typename shift_dimension_list<rows_a_t, delta>::type, cols_b_t>;
+};
+
+} // namespace details
+
+// Matrix product: (rows_a, cols_a) * (rows_b, cols_b) -> (rows_a + delta, cols_b)
+template <typename type_t, typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+constexpr auto operator*(const dimensioned_matrix_t<type_t, rows_a_t, cols_a_t>& lhs, const dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& rhs) noexcept(
+    details::dimensioned_product<type_t, rows_a_t, cols_a_t, rows_b_t, cols_b_t>::type::nothrow_storage)
+{
+    using result_t = typename details::dimensioned_product<type_t, rows_a_t, cols_a_t, rows_b_t, cols_b_t>::type;
+    result_t result{};
+    details::gemm_dispatch(lhs.si_elements().data(), rhs.si_elements().data(), result.si_elements().data(), rows_a_t::size, cols_a_t::size, cols_b_t::size);
+    return result;
+}
+
+// Transpose: element (i, j) of the result is element (j, i) of the input -> (-cols, -rows)
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+constexpr auto transpose(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& m) noexcept(dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>::nothrow_storage)
+{
+    using result_t = canonical_dimensioned_matrix_t<
+        type_t,
+        typename details::negate_dimension_list<col_dims_t>::type,
+        typename details::negate_dimension_list<row_dims_t>::type>;
+
+    result_t result{};
+    for (std::size_t i = 0; i < row_dims_t::size; ++i)
+    {
+        for (std::size_t j = 0; j < col_dims_t::size; ++j)
+        {
+            result.si_element(j, i) = m.si_element(i, j);
+        }
+    }
+    return result;
+}
+
+// Inverse (Gauss-Jordan with partial pivoting): (rows, cols) -> (cols, rows)
+// Throws std::invalid_argument when the matrix is singular.
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+    requires std::is_floating_point_v<type_t>
+constexpr auto inverse(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& m)
+{
+    static_assert(row_dims_t::size == col_dims_t::size, "dimensioned_matrix_t::inverse: matrix must be square");
+    constexpr std::size_t n = row_dims_t::size;
+    using result_t = canonical_dimensioned_matrix_t<type_t, col_dims_t, row_dims_t>;
+
+    auto a = m.si_elements();
+    typename result_t::array_type inv{};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        inv[(i * n) + i] = static_cast<type_t>(1);
+    }
+
+    for (std::size_t col = 0; col < n; ++col)
+    {
+        std::size_t pivot = col;
+        for (std::size_t row = col + 1; row < n; ++row)
+        {
+            if (details::abs_value(a[(row * n) + col]) > details::abs_value(a[(pivot * n) + col]))
+            {
+                pivot = row;
+            }
+        }
+        if (a[(pivot * n) + col] == static_cast<type_t>(0))
+        {
+            throw std::invalid_argument("dimensioned_matrix_t::inverse: matrix is singular");
+        }
+        if (pivot != col)
+        {
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                std::swap(a[(pivot * n) + j], a[(col * n) + j]);
+                std::swap(inv[(pivot * n) + j], inv[(col * n) + j]);
+            }
+        }
+
+        const type_t inv_pivot = static_cast<type_t>(1) / a[(col * n) + col];
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            a[(col * n) + j] *= inv_pivot;
+            inv[(col * n) + j] *= inv_pivot;
+        }
+
+        for (std::size_t row = 0; row < n; ++row)
+        {
+            if (row == col)
+            {
+                continue;
+            }
+            const type_t factor = a[(row * n) + col];
+            if (factor == static_cast<type_t>(0))
+            {
+                continue;
+            }
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                a[(row * n) + j] -= factor * a[(col * n) + j];
+                inv[(row * n) + j] -= factor * inv[(col * n) + j];
+            }
+        }
+    }
+
+    // Pivoting permutes rows of the augmented system only, so inv is already A^-1
+    return result_t{inv};
+}
+
+} // namespace PKR_UNITS_NAMESPACE
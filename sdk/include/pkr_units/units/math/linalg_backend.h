@@ -0,0 +1,176 @@
+#pragma once
+#include <cstddef>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/linalg/backend_kernels.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/units/math/dimensioned_matrix.h>
+#include <pkr_units/units/math/matrix_unit_3d.h>
+#include <pkr_units/units/math/matrix_unit_4d.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+// ============================================================================
+// Zero-copy views for external linear algebra
+// ============================================================================
+//
+// si_view() exposes the storage of a unit-typed matrix as a raw row-major
+// buffer that can be handed to BLAS, LAPACK or any other library expecting
+// (pointer, rows, cols, leading dimension). Nothing is copied: writes through
+// the view change the matrix. The view carries SI values, so only sources that
+// already store SI values are accepted:
+//
+//   dimensioned_matrix_t         always (values are kept in coherent SI units)
+//   matrix_3d/4d_units_t<T>      T with ratio 1 (e.g. meter_t, not millimeter_t)
+//   std::span<T> of unit values  T with ratio 1, reshaped to rows x cols
+//
+// Dimensions are not part of the view; keep the typed matrix as the owner and
+// compute result types with the pkr_units operators, then run the arithmetic
+// on the views. With PKR_UNITS_LINALG_EIGEN defined, eigen_map() wraps the same
+// storage in an Eigen::Map.
+
+template <typename type_t>
+struct si_matrix_view
+{
+    type_t* data;
+    std::size_t rows;
+    std::size_t cols;
+    std::size_t leading_dimension; // elements between the starts of consecutive rows
+};
+
+namespace details
+{
+
+// A unit value can be viewed as its SI value when it is stored as exactly that value
+template <typename unit_u>
+inline constexpr bool si_viewable_unit_v = std::is_standard_layout_v<unit_u> && sizeof(unit_u) == sizeof(typename is_pkr_unit<unit_u>::value_type) &&
+                                           std::ratio_equal_v<typename is_pkr_unit<unit_u>::ratio_type, std::ratio<1, 1>>;
+
+template <typename unit_u>
+auto si_pointer(unit_u* values) noexcept
+{
+    static_assert(si_viewable_unit_v<std::remove_const_t<unit_u>>, "si_view: unit values must be coherent SI units (ratio 1)");
+    using type_t = typename is_pkr_unit<std::remove_const_t<unit_u>>::value_type;
+    if constexpr (std::is_const_v<unit_u>)
+    {
+        return reinterpret_cast<const type_t*>(values);
+    }
+    else
+    {
+        return reinterpret_cast<type_t*>(values);
+    }
+}
+
+} // namespace details
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+si_matrix_view<type_t> si_view(dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& m) noexcept
+{
+    return {m.si_elements().data(), row_dims_t::size, col_dims_t::size, col_dims_t::size};
+}
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+si_matrix_view<const type_t> si_view(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& m) noexcept
+{
+    return {m.si_elements().data(), row_dims_t::size, col_dims_t::size, col_dims_t::size};
+}
+
+template <is_pkr_unit_c unit_u>
+auto si_view(matrix_3d_units_t<unit_u>& m) noexcept
+{
+    return si_matrix_view{details::si_pointer(&m(0, 0)), 3, 3, 3};
+}
+
+template <is_pkr_unit_c unit_u>
+auto si_view(const matrix_3d_units_t<unit_u>& m) noexcept
+{
+    return si_matrix_view{details::si_pointer(&m(0, 0)), 3, 3, 3};
+}
+
+// Every storage policy keeps the 16 elements in one std::array<std::array<T, 4>, 4>
+template <is_pkr_unit_c unit_u, typename StoragePolicy>
+auto si_view(matrix_4d_units_t<unit_u, StoragePolicy>& m) noexcept
+{
+    return si_matrix_view{details::si_pointer(&m(0, 0)), 4, 4, 4};
+}
+
+template <is_pkr_unit_c unit_u, typename StoragePolicy>
+auto si_view(const matrix_4d_units_t<unit_u, StoragePolicy>& m) noexcept
+{
+    return si_matrix_view{details::si_pointer(&m(0, 0)), 4, 4, 4};
+}
+
+// Row-major rows x cols view of a contiguous unit array.
+// Throws std::invalid_argument when rows * cols does not match the array size.
+template <typename unit_u>
+    requires is_pkr_unit_c<std::remove_const_t<unit_u>>
+auto si_view(std::span<unit_u> values, std::size_t rows, std::size_t cols)
+{
+    if (rows * cols != values.size())
+    {
+        throw std::invalid_argument("si_view: rows * cols must equal the number of values");
+    }
+    return si_matrix_view{details::si_pointer(values.data()), rows, cols, cols};
+}
+
+// C += A B on views, through the selected backend (or the built-in blocked kernel).
+// Throws std::invalid_argument when the shapes do not match.
+template <typename a_t, typename b_t, typename type_t>
+    requires(std::is_same_v<std::remove_const_t<a_t>, type_t> && std::is_same_v<std::remove_const_t<b_t>, type_t> && !std::is_const_v<type_t>)
+void gemm(si_matrix_view<a_t> a, si_matrix_view<b_t> b, si_matrix_view<type_t> c)
+{
+    if (a.cols != b.rows || c.rows != a.rows || c.cols != b.cols)
+    {
+        throw std::invalid_argument("gemm: operand shapes do not match");
+    }
+    details::backend_gemm<type_t>(a.data, a.leading_dimension, b.data, b.leading_dimension, c.data, c.leading_dimension, a.rows, a.cols, b.cols, static_cast<type_t>(1));
+}
+
+#if defined(PKR_UNITS_LINALG_EIGEN)
+
+// ============================================================================
+// Eigen maps
+// ============================================================================
+
+namespace details
+{
+
+// Eigen rejects row-major column vectors; a single column has the same layout either way
+template <typename type_t, std::size_t rows_v, std::size_t cols_v>
+using eigen_matrix_t =
+    Eigen::Matrix<type_t, static_cast<int>(rows_v), static_cast<int>(cols_v), (cols_v == 1 && rows_v != 1) ? Eigen::ColMajor : Eigen::RowMajor>;
+
+template <typename type_t>
+using eigen_dynamic_matrix_t = Eigen::Matrix<std::remove_const_t<type_t>, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+} // namespace details
+
+// Fixed-size map over the SI values of a dimensioned matrix
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+auto eigen_map(dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& m) noexcept
+{
+    return Eigen::Map<details::eigen_matrix_t<type_t, row_dims_t::size, col_dims_t::size>>(m.si_elements().data());
+}
+
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+auto eigen_map(const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& m) noexcept
+{
+    return Eigen::Map<const details::eigen_matrix_t<type_t, row_dims_t::size, col_dims_t::size>>(m.si_elements().data());
+}
+
+// Dynamic map over any view
+template <typename type_t>
+auto eigen_map(si_matrix_view<type_t> view) noexcept
+{
+    using matrix_t = std::conditional_t<std::is_const_v<type_t>, const details::eigen_dynamic_matrix_t<type_t>, details::eigen_dynamic_matrix_t<type_t>>;
+    using stride_t = Eigen::OuterStride<>;
+    return Eigen::Map<matrix_t, Eigen::Unaligned, stride_t>(
+        view.data, static_cast<Eigen::Index>(view.rows), static_cast<Eigen::Index>(view.cols), stride_t(static_cast<Eigen::Index>(view.leading_dimension)));
+}
+
+#endif
+
+} // namespace PKR_UNITS_NAMESPACE
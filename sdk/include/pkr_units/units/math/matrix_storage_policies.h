@@ -1,8 +1,20 @@
 #pragma once
 
 #include <pkr_units/impl/namespace_config.h>
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <bitset>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
 
 namespace PKR_UNITS_NAMESPACE
 {
@@ -24,6 +36,18 @@ namespace PKR_UNITS_NAMESPACE
 //    - Automatically falls back to stack if pool is exhausted
 //    - Perfect for stack-limited embedded systems
 //    - Provides runtime monitoring (peak_usage, fallback_count)
+//    - Single-threaded only
+//
+// 3. concurrent_arena_storage
+//    - Same fallback behaviour as arena_storage, safe from any thread
+//    - Lock-free slot allocation on atomic bitmap words
+//    - Statistics kept per thread and aggregated on request
+//
+// 4. pmr_storage
+//    - Elements allocated from a std::pmr::memory_resource
+//    - Matrices become allocator-aware: pass an allocator to the constructor,
+//      and std::pmr containers of matrices propagate theirs
+//    - Back a whole frame with one monotonic_buffer_resource, release in O(1)
 //
 // USAGE EXAMPLES:
 //
@@ -294,4 +318,470 @@ public:
     }
 };
 
+// ============================================================================
+// Thread-safe arena storage policy
+// ============================================================================
+//
+// A drop-in alternative to arena_storage for matrices created on worker
+// threads. The pool is shared by all threads; slots are tracked in atomic
+// 64-bit words, so acquiring one is a find-first-zero plus a compare-exchange
+// (O(POOL_SIZE / 64)) and releasing is a single fetch_and. Each thread starts
+// its search at the word where it last succeeded, which keeps threads on
+// different words when the pool is large. A matrix may be destroyed on a
+// different thread from the one that created it.
+//
+// Unlike arena_storage the initial values are constructed in the slot, and
+// instances are copyable (a copy acquires its own slot).
+//
+// Statistics are counted per thread without contention and summed by
+// statistics(); counts from threads that have exited are kept.
+//
+// Monitoring Methods:
+//   statistics()         - Allocations, fallbacks and peak usage over all threads
+//   thread_statistics()  - The same counters for the calling thread only
+//   active_slots()       - Currently allocated arena slots
+//   reset_statistics()   - Clear the counters of every thread
+//
+struct arena_statistics
+{
+    std::size_t allocations{0};
+    std::size_t fallbacks{0};
+    std::size_t peak_usage{0}; // highest pool occupancy observed at allocation
+};
+
+template <typename T, std::size_t POOL_SIZE = 64, typename ExhaustedPolicy = default_arena_policy>
+class concurrent_arena_storage
+{
+public:
+    using value_type = T;
+    using array_type = std::array<std::array<T, 4>, 4>;
+
+    static_assert(POOL_SIZE > 0, "POOL_SIZE must be greater than 0");
+
+    explicit concurrent_arena_storage(const array_type& init_data)
+        : m_fallback(init_data)
+        , m_slot(acquire(init_data))
+    {
+    }
+
+    concurrent_arena_storage(const concurrent_arena_storage& other)
+        : concurrent_arena_storage(other.values())
+    {
+    }
+
+    concurrent_arena_storage(concurrent_arena_storage&& other) noexcept
+        : m_fallback(other.m_fallback)
+        , m_slot(std::exchange(other.m_slot, nullptr))
+    {
+    }
+
+    concurrent_arena_storage& operator=(const concurrent_arena_storage& other)
+    {
+        if (this != &other)
+        {
+            values() = other.values();
+        }
+        return *this;
+    }
+
+    concurrent_arena_storage& operator=(concurrent_arena_storage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release(m_slot);
+            m_fallback = other.m_fallback;
+            m_slot = std::exchange(other.m_slot, nullptr);
+        }
+        return *this;
+    }
+
+    ~concurrent_arena_storage()
+    {
+        release(m_slot);
+    }
+
+    [[nodiscard]] bool in_arena() const noexcept
+    {
+        return m_slot != nullptr;
+    }
+
+    T& get(std::size_t row, std::size_t col)
+    {
+        return values()[row][col];
+    }
+
+    const T& get(std::size_t row, std::size_t col) const
+    {
+        return values()[row][col];
+    }
+
+    std::array<T, 4>& operator[](std::size_t row)
+    {
+        return values()[row];
+    }
+
+    const std::array<T, 4>& operator[](std::size_t row) const
+    {
+        return values()[row];
+    }
+
+    // ========== Monitoring Utilities ==========
+
+    static constexpr std::size_t pool_size()
+    {
+        return POOL_SIZE;
+    }
+
+    static std::size_t active_slots() noexcept
+    {
+        std::size_t count = 0;
+        for (const auto& word : s_in_use)
+        {
+            count += static_cast<std::size_t>(std::popcount(word.load(std::memory_order_relaxed)));
+        }
+        return count;
+    }
+
+    static arena_statistics thread_statistics()
+    {
+        return local_counters().snapshot();
+    }
+
+    static arena_statistics statistics()
+    {
+        std::lock_guard lock(s_registry_mutex);
+        arena_statistics total = s_retired;
+        for (const thread_counters* counters : s_registry)
+        {
+            merge(total, counters->snapshot());
+        }
+        return total;
+    }
+
+    static void reset_statistics()
+    {
+        std::lock_guard lock(s_registry_mutex);
+        s_retired = {};
+        for (thread_counters* counters : s_registry)
+        {
+            counters->reset();
+        }
+    }
+
+private:
+    static constexpr std::size_t word_bits = 64;
+    static constexpr std::size_t word_count = (POOL_SIZE + word_bits - 1) / word_bits;
+
+    // Counters are incremented by their own thread and zeroed by
+    // reset_statistics() from any thread, so every update is a single atomic
+    // read-modify-write: fetch_add for the counts, a CAS loop for the peak
+    struct thread_counters
+    {
+        std::atomic<std::size_t> allocations{0};
+        std::atomic<std::size_t> fallbacks{0};
+        std::atomic<std::size_t> peak_usage{0};
+        std::size_t search_hint{0};
+
+        thread_counters()
+        {
+            std::lock_guard lock(s_registry_mutex);
+            s_registry.push_back(this);
+        }
+
+        ~thread_counters()
+        {
+            std::lock_guard lock(s_registry_mutex);
+            merge(s_retired, snapshot());
+            s_registry.erase(std::find(s_registry.begin(), s_registry.end(), this));
+        }
+
+        thread_counters(const thread_counters&) = delete;
+        thread_counters& operator=(const thread_counters&) = delete;
+
+        arena_statistics snapshot() const noexcept
+        {
+            return {allocations.load(std::memory_order_relaxed), fallbacks.load(std::memory_order_relaxed), peak_usage.load(std::memory_order_relaxed)};
+        }
+
+        void record_usage(std::size_t usage) noexcept
+        {
+            std::size_t peak = peak_usage.load(std::memory_order_relaxed);
+            while (usage > peak && !peak_usage.compare_exchange_weak(peak, usage, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void reset() noexcept
+        {
+            allocations.store(0, std::memory_order_relaxed);
+            fallbacks.store(0, std::memory_order_relaxed);
+            peak_usage.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    static void merge(arena_statistics& total, const arena_statistics& part) noexcept
+    {
+        total.allocations += part.allocations;
+        total.fallbacks += part.fallbacks;
+        total.peak_usage = std::max(total.peak_usage, part.peak_usage);
+    }
+
+    static thread_counters& local_counters()
+    {
+        thread_local thread_counters counters;
+        return counters;
+    }
+
+    static constexpr std::uint64_t valid_bits(std::size_t word) noexcept
+    {
+        const std::size_t used = std::min(word_bits, POOL_SIZE - (word * word_bits));
+        return used == word_bits ? ~std::uint64_t{0} : (std::uint64_t{1} << used) - 1;
+    }
+
+    static array_type* slot_ptr(std::size_t index) noexcept
+    {
+        return std::launder(reinterpret_cast<array_type*>(s_pool.data() + (index * sizeof(array_type))));
+    }
+
+    static array_type* acquire(const array_type& init_data)
+    {
+        thread_counters& counters = local_counters();
+        for (std::size_t n = 0; n < word_count; ++n)
+        {
+            const std::size_t word = (counters.search_hint + n) % word_count;
+            std::uint64_t bits = s_in_use[word].load(std::memory_order_relaxed);
+            for (std::uint64_t free_bits = ~bits & valid_bits(word); free_bits != 0; free_bits = ~bits & valid_bits(word))
+            {
+                const auto bit = static_cast<std::size_t>(std::countr_zero(free_bits));
+                if (s_in_use[word].compare_exchange_weak(bits, bits | (std::uint64_t{1} << bit), std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    counters.search_hint = word;
+                    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+                    counters.record_usage(active_slots());
+                    return std::construct_at(slot_ptr((word * word_bits) + bit), init_data);
+                }
+            }
+        }
+
+        // Arena exhausted — notify policy and fall back to the inline array
+        ExhaustedPolicy::on_exhausted();
+        counters.fallbacks.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    static void release(array_type* slot) noexcept
+    {
+        if (slot == nullptr)
+        {
+            return;
+        }
+        const auto index = static_cast<std::size_t>(reinterpret_cast<std::byte*>(slot) - s_pool.data()) / sizeof(array_type);
+        std::destroy_at(slot);
+        s_in_use[index / word_bits].fetch_and(~(std::uint64_t{1} << (index % word_bits)), std::memory_order_release);
+    }
+
+    array_type& values() noexcept
+    {
+        return m_slot != nullptr ? *m_slot : m_fallback;
+    }
+
+    const array_type& values() const noexcept
+    {
+        return m_slot != nullptr ? *m_slot : m_fallback;
+    }
+
+    array_type m_fallback;
+    array_type* m_slot;
+
+    alignas(array_type) static inline std::array<std::byte, sizeof(array_type) * POOL_SIZE> s_pool{};
+    static inline std::array<std::atomic<std::uint64_t>, word_count> s_in_use{};
+    static inline std::mutex s_registry_mutex;
+    static inline std::vector<thread_counters*> s_registry;
+    static inline arena_statistics s_retired{};
+};
+
+// ============================================================================
+// Memory-resource storage policy
+// ============================================================================
+//
+// Allocates the 4x4 element array from a std::pmr::memory_resource. Matrices
+// using this policy gain allocator-extended constructors and satisfy
+// std::uses_allocator, so a std::pmr::vector of them places every element
+// array in the vector's resource. With a monotonic_buffer_resource per frame
+// or request, all matrices of a computation come from one buffer and are
+// released together when the resource is destroyed.
+//
+// Allocator semantics follow the std::pmr containers: copy construction uses
+// the default resource unless an allocator is passed, assignment keeps the
+// target's resource, and move construction takes the source's resource.
+//
+// Moving takes the element array, so a moved-from storage holds none. It may
+// be destroyed, assigned to, or copied (the copy holds no array either), but
+// its elements must not be read until it is assigned again. Move assignment is
+// not noexcept: polymorphic_allocator does not propagate on move assignment,
+// so with a different resource the values are copied into a new allocation,
+// which may throw. With equal resources it only swaps ownership and never
+// throws, but noexcept cannot depend on a run-time comparison.
+//
+// Example:
+//   std::array<std::byte, 16384> buffer;
+//   std::pmr::monotonic_buffer_resource frame{buffer.data(), buffer.size()};
+//   using M = matrix_4d_units_t<meter_t<double>, pmr_storage<meter_t<double>>>;
+//   M m{values, &frame};
+//
+template <typename T>
+class pmr_storage
+{
+public:
+    using value_type = T;
+    using array_type = std::array<std::array<T, 4>, 4>;
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    explicit pmr_storage(const array_type& init_data, const allocator_type& alloc = allocator_type())
+        : m_alloc(alloc)
+        , m_data(m_alloc.new_object<array_type>(init_data))
+    {
+    }
+
+    pmr_storage(const pmr_storage& other)
+        : pmr_storage(other, allocator_type())
+    {
+    }
+
+    pmr_storage(const pmr_storage& other, const allocator_type& alloc)
+        : m_alloc(alloc)
+        , m_data(other.m_data != nullptr ? m_alloc.new_object<array_type>(*other.m_data) : nullptr)
+    {
+    }
+
+    pmr_storage(pmr_storage&& other) noexcept
+        : m_alloc(other.m_alloc)
+        , m_data(std::exchange(other.m_data, nullptr))
+    {
+    }
+
+    pmr_storage(pmr_storage&& other, const allocator_type& alloc)
+        : m_alloc(alloc)
+        , m_data(alloc == other.m_alloc || other.m_data == nullptr ? std::exchange(other.m_data, nullptr) : m_alloc.new_object<array_type>(*other.m_data))
+    {
+    }
+
+    pmr_storage& operator=(const pmr_storage& other)
+    {
+        if (this != &other)
+        {
+            assign(other.m_data);
+        }
+        return *this;
+    }
+
+    pmr_storage& operator=(pmr_storage&& other)
+    {
+        if (this != &other)
+        {
+            if (m_alloc == other.m_alloc)
+            {
+                reset();
+                m_data = std::exchange(other.m_data, nullptr);
+            }
+            else
+            {
+                assign(other.m_data);
+            }
+        }
+        return *this;
+    }
+
+    ~pmr_storage()
+    {
+        reset();
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return m_alloc;
+    }
+
+    T& get(std::size_t row, std::size_t col)
+    {
+        return (*m_data)[row][col];
+    }
+
+    const T& get(std::size_t row, std::size_t col) const
+    {
+        return (*m_data)[row][col];
+    }
+
+    std::array<T, 4>& operator[](std::size_t row)
+    {
+        return (*m_data)[row];
+    }
+
+    const std::array<T, 4>& operator[](std::size_t row) const
+    {
+        return (*m_data)[row];
+    }
+
+private:
+    // Copies the values of `source`, or drops the array when the source is moved-from
+    void assign(const array_type* source)
+    {
+        if (source == nullptr)
+        {
+            reset();
+        }
+        else if (m_data == nullptr)
+        {
+            m_data = m_alloc.new_object<array_type>(*source);
+        }
+        else
+        {
+            *m_data = *source;
+        }
+    }
+
+    void reset() noexcept
+    {
+        if (m_data != nullptr)
+        {
+            m_alloc.delete_object(m_data);
+            m_data = nullptr;
+        }
+    }
+
+    allocator_type m_alloc;
+    array_type* m_data;
+};
+
+// Storage policies that allocate expose allocator_type; matrices forward it
+template <typename StoragePolicy>
+concept allocating_storage_policy_c = requires(const StoragePolicy& s) {
+    typename StoragePolicy::allocator_type;
+    { s.get_allocator() } -> std::convertible_to<typename StoragePolicy::allocator_type>;
+};
+
+namespace details
+{
+
+struct no_storage_allocator
+{
+};
+
+template <typename StoragePolicy>
+struct storage_allocator
+{
+    using type = no_storage_allocator;
+};
+
+template <allocating_storage_policy_c StoragePolicy>
+struct storage_allocator<StoragePolicy>
+{
+    using type = typename StoragePolicy::allocator_type;
+};
+
+template <typename StoragePolicy>
+using storage_allocator_t = typename storage_allocator<StoragePolicy>::type;
+
+} // namespace details
+
 } // namespace PKR_UNITS_NAMESPACE
@@ -1,8 +1,10 @@
 ﻿#pragma once
 #include <array>
+#include <stdexcept>
 #include <pkr_units/impl/unit_t.h>
 #include <pkr_units/impl/concepts/unit_concepts.h>
 #include <pkr_units/units/math/unit_math.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
 #include "vector_unit_3d.h"
 
 namespace PKR_UNITS_NAMESPACE
@@ -10,7 +12,7 @@ namespace PKR_UNITS_NAMESPACE
 // ============================================================================
 // Specialized 3x3 Matrix for Units (using stable math)
 // ============================================================================
-template <is_base_pkr_unit_c T>
+template <is_pkr_unit_c T>
 class matrix_3d_units_t
 {
 public:
@@ -73,18 +75,96 @@ constexpr matrix_3d_units_t<T> identity_3d()
     return m;
 }
 
-template <is_base_pkr_unit_c T>
-constexpr vec_3d_units_t<T> matrix_vector_multiply(const matrix_3d_units_t<T>& m, const vec_3d_units_t<T>& v) noexcept
+// ============================================================================
+// Matrix algebra with dimension tracking
+// ============================================================================
+// Every element of a matrix_3d_units_t shares one unit, so results carry the
+// combined dimension: A (unit a) * B (unit b) has unit a*b, det(A) has a^3,
+// inverse(A) has a^-1. Results are in coherent SI units (ratio 1); inputs with
+// other ratios (e.g. millimeter) are converted first.
+
+// Matrix-vector product with any element units: M (unit a) * v (unit b) has unit a*b
+template <is_pkr_unit_c lhs_u, is_pkr_unit_c rhs_u>
+constexpr vec_3d_units_t<unit_product_t<lhs_u, rhs_u>> operator*(const matrix_3d_units_t<lhs_u>& m, const vec_3d_units_t<rhs_u>& v) noexcept
 {
-    return vec_3d_units_t<T>{
-        (m.data[0][0] * v.x) + (m.data[0][1] * v.y) + (m.data[0][2] * v.z),
-        (m.data[1][0] * v.x) + (m.data[1][1] * v.y) + (m.data[1][2] * v.z),
-        (m.data[2][0] * v.x) + (m.data[2][1] * v.y) + (m.data[2][2] * v.z)};
+    using result_u = unit_product_t<lhs_u, rhs_u>;
+    const auto a = details::unpack_si_values<3>(m);
+    const auto x = v.x.in_base_si_units().value();
+    const auto y = v.y.in_base_si_units().value();
+    const auto z = v.z.in_base_si_units().value();
+    return vec_3d_units_t<result_u>{
+        result_u{(a[0] * x) + (a[1] * y) + (a[2] * z)}, result_u{(a[3] * x) + (a[4] * y) + (a[5] * z)}, result_u{(a[6] * x) + (a[7] * y) + (a[8] * z)}};
 }
 
 template <is_base_pkr_unit_c T>
-constexpr vec_3d_units_t<T> operator*(const matrix_3d_units_t<T>& m, const vec_3d_units_t<T>& v) noexcept
+constexpr vec_3d_units_t<unit_product_t<T, T>> matrix_vector_multiply(const matrix_3d_units_t<T>& m, const vec_3d_units_t<T>& v) noexcept
+{
+    return m * v;
+}
+
+template <is_pkr_unit_c lhs_u, is_pkr_unit_c rhs_u>
+constexpr matrix_3d_units_t<unit_product_t<lhs_u, rhs_u>> operator*(const matrix_3d_units_t<lhs_u>& a, const matrix_3d_units_t<rhs_u>& b) noexcept
+{
+    using result_u = unit_product_t<lhs_u, rhs_u>;
+    return matrix_3d_units_t<result_u>{
+        details::pack_si_values<result_u, 3>(details::multiply_scalar<typename details::is_pkr_unit<result_u>::value_type, 3>(
+            details::unpack_si_values<3>(a), details::unpack_si_values<3>(b)))};
+}
+
+template <is_pkr_unit_c T>
+constexpr matrix_3d_units_t<T> transpose(const matrix_3d_units_t<T>& m)
+{
+    typename matrix_3d_units_t<T>::array_type t = m.data;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            t[j][i] = m.data[i][j];
+        }
+    }
+    return matrix_3d_units_t<T>{t};
+}
+
+template <is_pkr_unit_c T>
+constexpr unit_power_t<T, 3> determinant(const matrix_3d_units_t<T>& m) noexcept
+{
+    return unit_power_t<T, 3>{details::determinant_3x3(details::unpack_si_values<3>(m))};
+}
+
+// Throws std::invalid_argument when the matrix is singular
+template <is_pkr_unit_c T>
+constexpr matrix_3d_units_t<unit_power_t<T, -1>> inverse(const matrix_3d_units_t<T>& m)
 {
-    return matrix_vector_multiply(m, v);
+    using result_u = unit_power_t<T, -1>;
+    using type_t = typename details::is_pkr_unit<T>::value_type;
+    const auto a = details::unpack_si_values<3>(m);
+    const type_t det = details::determinant_3x3(a);
+    if (det == type_t{0})
+    {
+        throw std::invalid_argument("matrix_3d_units_t::inverse: matrix is singular");
+    }
+    auto adjugate = details::adjugate_3x3(a);
+    const type_t inv_det = type_t{1} / det;
+    for (auto& v : adjugate)
+    {
+        v *= inv_det;
+    }
+    return matrix_3d_units_t<result_u>{details::pack_si_values<result_u, 3>(adjugate)};
+}
+
+// Solve A x = b (partial pivoting): x has the unit of b divided by the unit of A.
+// Throws std::invalid_argument when A is singular.
+template <is_pkr_unit_c matrix_u, is_pkr_unit_c rhs_u>
+constexpr vec_3d_units_t<unit_product_t<rhs_u, unit_power_t<matrix_u, -1>>> solve(const matrix_3d_units_t<matrix_u>& a, const vec_3d_units_t<rhs_u>& b)
+{
+    using result_u = unit_product_t<rhs_u, unit_power_t<matrix_u, -1>>;
+    using type_t = typename details::is_pkr_unit<matrix_u>::value_type;
+    const std::array<type_t, 3> rhs{b.x.in_base_si_units().value(), b.y.in_base_si_units().value(), b.z.in_base_si_units().value()};
+    std::array<type_t, 3> x{};
+    if (!details::solve_values<type_t, 3>(details::unpack_si_values<3>(a), rhs, x))
+    {
+        throw std::invalid_argument("matrix_3d_units_t::solve: matrix is singular");
+    }
+    return vec_3d_units_t<result_u>{result_u{x[0]}, result_u{x[1]}, result_u{x[2]}};
 }
 } // namespace PKR_UNITS_NAMESPACE
@@ -1,6 +1,13 @@
 #pragma once
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
 #include <pkr_units/units/math/matrix_storage_policies.h>
+#include <pkr_units/units/math/unit_math.h>
+#include <pkr_units/units/math/vector_unit_4d.h>
 #include <pkr_units/math/4d/vector_4d.h>
 
 namespace PKR_UNITS_NAMESPACE
@@ -30,6 +37,31 @@ public:
     {
     }
 
+    // Allocator-extended constructors for allocating storage policies (pmr_storage)
+    matrix_4d_units_t(const array_type& arr, const details::storage_allocator_t<StoragePolicy>& alloc)
+        requires allocating_storage_policy_c<StoragePolicy>
+        : storage(arr, alloc)
+    {
+    }
+
+    matrix_4d_units_t(const matrix_4d_units_t& other, const details::storage_allocator_t<StoragePolicy>& alloc)
+        requires allocating_storage_policy_c<StoragePolicy>
+        : storage(other.storage, alloc)
+    {
+    }
+
+    matrix_4d_units_t(matrix_4d_units_t&& other, const details::storage_allocator_t<StoragePolicy>& alloc)
+        requires allocating_storage_policy_c<StoragePolicy>
+        : storage(std::move(other.storage), alloc)
+    {
+    }
+
+    [[nodiscard]] details::storage_allocator_t<StoragePolicy> get_allocator() const noexcept
+        requires allocating_storage_policy_c<StoragePolicy>
+    {
+        return storage.get_allocator();
+    }
+
     constexpr T& operator()(std::size_t row, std::size_t col)
     {
         return storage.get(row, col);
@@ -62,19 +94,132 @@ constexpr matrix_4d_units_t<T, StoragePolicy> identity_4d()
     return m;
 }
 
-template <is_base_pkr_unit_c T, typename StoragePolicy = stack_storage<T>>
-constexpr vec_4d_t<T> matrix_vector_multiply(const matrix_4d_units_t<T, StoragePolicy>& m, const vec_4d_t<T>& v) noexcept
+// ============================================================================
+// Matrix algebra with dimension tracking
+// ============================================================================
+// As for matrix_3d_units_t: products combine the element units, det(A) has the
+// element unit to the 4th power and inverse(A) its reciprocal. Inputs may use
+// any storage policy; results use stack_storage and coherent SI units. The
+// product and matrix-vector kernels are vectorized (AVX/SSE2 for double,
+// SSE/NEON for float).
+
+namespace details
+{
+
+template <typename vector_t>
+constexpr auto vector_4d_si_values(const vector_t& v) noexcept
+{
+    return std::array{v.x.in_base_si_units().value(), v.y.in_base_si_units().value(), v.z.in_base_si_units().value(), v.w.in_base_si_units().value()};
+}
+
+template <typename matrix_u, typename StoragePolicy, typename rhs_u>
+auto solve_4d_si_values(const matrix_4d_units_t<matrix_u, StoragePolicy>& a, const std::array<typename is_pkr_unit<rhs_u>::value_type, 4>& b)
+{
+    std::array<typename is_pkr_unit<rhs_u>::value_type, 4> x{};
+    if (!solve_values<typename is_pkr_unit<rhs_u>::value_type, 4>(unpack_si_values<4>(a), b, x))
+    {
+        throw std::invalid_argument("matrix_4d_units_t::solve: matrix is singular");
+    }
+    return x;
+}
+
+} // namespace details
+
+// Matrix-vector product with any element units: M (unit a) * v (unit b) has unit a*b
+template <is_pkr_unit_c lhs_u, typename StoragePolicy, is_pkr_unit_c rhs_u>
+constexpr vec_4d_t<unit_product_t<lhs_u, rhs_u>> operator*(const matrix_4d_units_t<lhs_u, StoragePolicy>& m, const vec_4d_t<rhs_u>& v) noexcept
 {
-    return vec_4d_t<T>{
-        ((m(0, 0) * v.x) + (m(0, 1) * v.y)) + ((m(0, 2) * v.z) + (m(0, 3) * v.w)),
-        ((m(1, 0) * v.x) + (m(1, 1) * v.y)) + ((m(1, 2) * v.z) + (m(1, 3) * v.w)),
-        ((m(2, 0) * v.x) + (m(2, 1) * v.y)) + ((m(2, 2) * v.z) + (m(2, 3) * v.w)),
-        ((m(3, 0) * v.x) + (m(3, 1) * v.y)) + ((m(3, 2) * v.z) + (m(3, 3) * v.w))};
+    using result_u = unit_product_t<lhs_u, rhs_u>;
+    const auto y = details::multiply_4x4_vector(details::unpack_si_values<4>(m), details::vector_4d_si_values(v));
+    return vec_4d_t<result_u>{result_u{y[0]}, result_u{y[1]}, result_u{y[2]}, result_u{y[3]}};
 }
 
 template <is_base_pkr_unit_c T, typename StoragePolicy = stack_storage<T>>
-constexpr vec_4d_t<T> operator*(const matrix_4d_units_t<T, StoragePolicy>& m, const vec_4d_t<T>& v) noexcept
+constexpr vec_4d_t<unit_product_t<T, T>> matrix_vector_multiply(const matrix_4d_units_t<T, StoragePolicy>& m, const vec_4d_t<T>& v) noexcept
+{
+    return m * v;
+}
+
+template <is_pkr_unit_c lhs_u, typename StoragePolicy, is_pkr_unit_c rhs_u>
+constexpr vec_4d_units_t<unit_product_t<lhs_u, rhs_u>> operator*(const matrix_4d_units_t<lhs_u, StoragePolicy>& m, const vec_4d_units_t<rhs_u>& v) noexcept
+{
+    using result_u = unit_product_t<lhs_u, rhs_u>;
+    const auto y = details::multiply_4x4_vector(details::unpack_si_values<4>(m), details::vector_4d_si_values(v));
+    return vec_4d_units_t<result_u>{result_u{y[0]}, result_u{y[1]}, result_u{y[2]}, result_u{y[3]}};
+}
+
+template <is_pkr_unit_c lhs_u, typename lhs_storage_t, is_pkr_unit_c rhs_u, typename rhs_storage_t>
+matrix_4d_units_t<unit_product_t<lhs_u, rhs_u>> operator*(const matrix_4d_units_t<lhs_u, lhs_storage_t>& a, const matrix_4d_units_t<rhs_u, rhs_storage_t>& b)
 {
-    return matrix_vector_multiply(m, v);
+    using result_u = unit_product_t<lhs_u, rhs_u>;
+    return matrix_4d_units_t<result_u>{details::pack_si_values<result_u, 4>(details::multiply_4x4(details::unpack_si_values<4>(a), details::unpack_si_values<4>(b)))};
+}
+
+template <is_pkr_unit_c T, typename StoragePolicy>
+matrix_4d_units_t<T> transpose(const matrix_4d_units_t<T, StoragePolicy>& m)
+{
+    typename matrix_4d_units_t<T>::array_type t{{m[0], m[1], m[2], m[3]}};
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            t[j][i] = m(i, j);
+        }
+    }
+    return matrix_4d_units_t<T>{t};
+}
+
+template <is_pkr_unit_c T, typename StoragePolicy>
+constexpr unit_power_t<T, 4> determinant(const matrix_4d_units_t<T, StoragePolicy>& m) noexcept
+{
+    return unit_power_t<T, 4>{details::determinant_4x4(details::compute_minors_4x4(details::unpack_si_values<4>(m)))};
+}
+
+// Cofactor inverse. Throws std::invalid_argument when the matrix is singular.
+template <is_pkr_unit_c T, typename StoragePolicy>
+matrix_4d_units_t<unit_power_t<T, -1>> inverse(const matrix_4d_units_t<T, StoragePolicy>& m)
+{
+    using result_u = unit_power_t<T, -1>;
+    using type_t = typename details::is_pkr_unit<T>::value_type;
+    const auto a = details::unpack_si_values<4>(m);
+    const auto minors = details::compute_minors_4x4(a);
+    const type_t det = details::determinant_4x4(minors);
+    if (det == type_t{0})
+    {
+        throw std::invalid_argument("matrix_4d_units_t::inverse: matrix is singular");
+    }
+    auto adjugate = details::adjugate_4x4(a, minors);
+    const type_t inv_det = type_t{1} / det;
+    for (auto& v : adjugate)
+    {
+        v *= inv_det;
+    }
+    return matrix_4d_units_t<result_u>{details::pack_si_values<result_u, 4>(adjugate)};
+}
+
+// Solve A x = b (partial pivoting): x has the unit of b divided by the unit of A.
+// Throws std::invalid_argument when A is singular.
+template <is_pkr_unit_c matrix_u, typename StoragePolicy, is_pkr_unit_c rhs_u>
+vec_4d_t<unit_product_t<rhs_u, unit_power_t<matrix_u, -1>>> solve(const matrix_4d_units_t<matrix_u, StoragePolicy>& a, const vec_4d_t<rhs_u>& b)
+{
+    using result_u = unit_product_t<rhs_u, unit_power_t<matrix_u, -1>>;
+    const auto x = details::solve_4d_si_values<matrix_u, StoragePolicy, rhs_u>(a, details::vector_4d_si_values(b));
+    return vec_4d_t<result_u>{result_u{x[0]}, result_u{x[1]}, result_u{x[2]}, result_u{x[3]}};
+}
+
+template <is_pkr_unit_c matrix_u, typename StoragePolicy, is_pkr_unit_c rhs_u>
+vec_4d_units_t<unit_product_t<rhs_u, unit_power_t<matrix_u, -1>>> solve(const matrix_4d_units_t<matrix_u, StoragePolicy>& a, const vec_4d_units_t<rhs_u>& b)
+{
+    using result_u = unit_product_t<rhs_u, unit_power_t<matrix_u, -1>>;
+    const auto x = details::solve_4d_si_values<matrix_u, StoragePolicy, rhs_u>(a, details::vector_4d_si_values(b));
+    return vec_4d_units_t<result_u>{result_u{x[0]}, result_u{x[1]}, result_u{x[2]}, result_u{x[3]}};
 }
 } // namespace PKR_UNITS_NAMESPACE
+
+// Matrices with an allocating storage policy take part in uses-allocator
+// construction, so std::pmr containers pass their resource to each element
+template <PKR_UNITS_NAMESPACE::is_pkr_unit_c T, typename StoragePolicy, typename Alloc>
+    requires PKR_UNITS_NAMESPACE::allocating_storage_policy_c<StoragePolicy>
+struct std::uses_allocator<PKR_UNITS_NAMESPACE::matrix_4d_units_t<T, StoragePolicy>, Alloc> : std::is_convertible<Alloc, typename StoragePolicy::allocator_type>
+{
+};
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/concepts/unit_concepts.h>
+#include <pkr_units/impl/dimension.h>
+#include <pkr_units/units/dimensionless/scalar.h>
+#include <pkr_units/units/math/matrix_unit_4d.h>
+#include <pkr_units/units/math/quaternion.h>
+#include <pkr_units/units/math/vector_unit_3d.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Rigid transform (rotation then translation)
+// ============================================================================
+// p' = R p + t with R a unit quaternion and t a length. Composition follows
+// function composition: (a * b)(p) == a(b(p)). Points and translation share
+// length_u; the span overload of apply() streams through the same SIMD column
+// kernel as quaternion_t::rotate.
+template <is_pkr_unit_c length_u>
+    requires(details::is_pkr_unit<length_u>::value_dimension == length_dimension)
+class rigid_transform_t
+{
+public:
+    using length_type = length_u;
+    using value_type = typename details::is_pkr_unit<length_u>::value_type;
+    using rotation_type = quaternion_t<value_type>;
+    using point_type = vec_3d_units_t<length_u>;
+
+    constexpr rigid_transform_t() = default;
+
+    constexpr rigid_transform_t(const rotation_type& rotation, const point_type& translation) noexcept
+        : m_rotation(rotation)
+        , m_translation(translation)
+    {
+    }
+
+    static constexpr rigid_transform_t identity() noexcept
+    {
+        return rigid_transform_t{};
+    }
+
+    [[nodiscard]] constexpr const rotation_type& rotation() const noexcept
+    {
+        return m_rotation;
+    }
+
+    [[nodiscard]] constexpr const point_type& translation() const noexcept
+    {
+        return m_translation;
+    }
+
+    [[nodiscard]] constexpr point_type apply(const point_type& p) const noexcept
+    {
+        const auto r = m_rotation.rotate_values(p.x.value(), p.y.value(), p.z.value());
+        return point_type{
+            length_u{r[0] + m_translation.x.value()}, length_u{r[1] + m_translation.y.value()}, length_u{r[2] + m_translation.z.value()}};
+    }
+
+    // Rotate a direction (no translation)
+    [[nodiscard]] constexpr point_type apply_to_direction(const point_type& d) const noexcept
+    {
+        return m_rotation.rotate(d);
+    }
+
+    // Transform a batch; in and out may be the same span. Throws std::invalid_argument on size mismatch.
+    void apply(std::span<const point_type> in, std::span<point_type> out) const
+    {
+        details::affine_3d_points(
+            m_rotation.rotation_values(), std::array<value_type, 3>{m_translation.x.value(), m_translation.y.value(), m_translation.z.value()}, in, out);
+    }
+
+    void apply(std::span<point_type> in, std::span<point_type> out) const
+    {
+        apply(std::span<const point_type>{in}, out);
+    }
+
+    [[nodiscard]] constexpr rigid_transform_t inverse() const noexcept
+    {
+        const rotation_type inv = m_rotation.conjugate();
+        const auto t = inv.rotate_values(m_translation.x.value(), m_translation.y.value(), m_translation.z.value());
+        return rigid_transform_t{inv, point_type{length_u{-t[0]}, length_u{-t[1]}, length_u{-t[2]}}};
+    }
+
+    // Renormalize the rotation after long chains of compositions
+    [[nodiscard]] rigid_transform_t normalized() const noexcept
+    {
+        return rigid_transform_t{m_rotation.normalized(), m_translation};
+    }
+
+    // Homogeneous matrix [R | t; 0 0 0 1] with translation entries in length_u,
+    // for use with transform() on point clouds of length_u
+    [[nodiscard]] matrix_4d_units_t<scalar_t<value_type>> to_matrix() const
+    {
+        using s = scalar_t<value_type>;
+        const auto r = m_rotation.rotation_values();
+        return matrix_4d_units_t<s>{typename matrix_4d_units_t<s>::array_type{{
+            {s{r[0]}, s{r[1]}, s{r[2]}, s{m_translation.x.value()}},
+            {s{r[3]}, s{r[4]}, s{r[5]}, s{m_translation.y.value()}},
+            {s{r[6]}, s{r[7]}, s{r[8]}, s{m_translation.z.value()}},
+            {s{value_type{0}}, s{value_type{0}}, s{value_type{0}}, s{value_type{1}}},
+        }}};
+    }
+
+private:
+    rotation_type m_rotation{};
+    point_type m_translation{};
+};
+
+template <is_pkr_unit_c length_u>
+constexpr rigid_transform_t<length_u> operator*(const rigid_transform_t<length_u>& a, const rigid_transform_t<length_u>& b) noexcept
+{
+    return rigid_transform_t<length_u>{a.rotation() * b.rotation(), a.apply(b.translation())};
+}
+
+// Interpolate between two poses: slerp on the rotation, linear on the translation
+template <is_pkr_unit_c length_u>
+rigid_transform_t<length_u> interpolate(const rigid_transform_t<length_u>& a, const rigid_transform_t<length_u>& b, typename rigid_transform_t<length_u>::value_type t) noexcept
+{
+    using value_t = typename rigid_transform_t<length_u>::value_type;
+    const auto lerp = [t](const length_u& p, const length_u& q) { return length_u{p.value() + (t * (q.value() - p.value()))}; };
+    const auto& ta = a.translation();
+    const auto& tb = b.translation();
+    return rigid_transform_t<length_u>{
+        slerp(a.rotation(), b.rotation(), static_cast<value_t>(t)),
+        typename rigid_transform_t<length_u>::point_type{lerp(ta.x, tb.x), lerp(ta.y, tb.y), lerp(ta.z, tb.z)}};
+}
+
+} // namespace PKR_UNITS_NAMESPACE
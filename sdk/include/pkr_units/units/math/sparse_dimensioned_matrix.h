@@ -0,0 +1,286 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/simd/matrix_kernels.h>
+#include <pkr_units/units/math/dimensioned_matrix.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+// ============================================================================
+// Sparse dimensioned matrices (compressed sparse row)
+// ============================================================================
+//
+// Same row/column dimension rules as dimensioned_matrix_t: element (i, j) has
+// dimension rows[i] - cols[j], typed access is checked at compile time and
+// values are stored in coherent SI units. Only the non-zero elements are kept,
+// in CSR form:
+//
+//   row_offsets()    row_count + 1 offsets into the two arrays below
+//   column_indices() column of each stored element, ascending within a row
+//   si_values()      SI value of each stored element
+//
+// Measurement Jacobians of large estimators are mostly zero (each measurement
+// touches a few states), so H P and P H^T against the dense covariance cost
+// O(nnz * n) instead of O(m * n * n). Products with dense matrices return
+// dense matrices with the same result dimensions as the dense product.
+
+template <typename type_t>
+struct sparse_triplet
+{
+    std::size_t row;
+    std::size_t col;
+    type_t value; // SI units
+};
+
+template <is_unit_value_type_c type_t, typename row_dims_t, typename col_dims_t>
+class sparse_dimensioned_matrix_t
+{
+public:
+    using dense_type = dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>;
+    using value_type = type_t;
+    using row_dimensions = row_dims_t;
+    using col_dimensions = col_dims_t;
+
+    static constexpr std::size_t row_count = dense_type::row_count;
+    static constexpr std::size_t col_count = dense_type::col_count;
+
+    template <std::size_t row_v, std::size_t col_v = 0>
+    static constexpr dimension_t element_dimension = dense_type::template element_dimension<row_v, col_v>;
+
+    template <std::size_t row_v, std::size_t col_v = 0>
+    using element_type = typename dense_type::template element_type<row_v, col_v>;
+
+    // All-zero matrix
+    sparse_dimensioned_matrix_t()
+        : m_row_offsets(row_count + 1, 0)
+    {
+    }
+
+    // Compress a dense matrix, keeping only non-zero elements
+    explicit sparse_dimensioned_matrix_t(const dense_type& dense)
+        : sparse_dimensioned_matrix_t()
+    {
+        for (std::size_t i = 0; i < row_count; ++i)
+        {
+            for (std::size_t j = 0; j < col_count; ++j)
+            {
+                const type_t v = dense.si_element(i, j);
+                if (v != type_t{0})
+                {
+                    m_columns.push_back(j);
+                    m_values.push_back(v);
+                }
+            }
+            m_row_offsets[i + 1] = m_columns.size();
+        }
+    }
+
+    // Build from (row, column, SI value) entries in any order; duplicates are summed.
+    // Throws std::out_of_range when an entry lies outside the matrix.
+    static sparse_dimensioned_matrix_t from_triplets(std::vector<sparse_triplet<type_t>> entries)
+    {
+        for (const auto& e : entries)
+        {
+            if (e.row >= row_count || e.col >= col_count)
+            {
+                throw std::out_of_range("sparse_dimensioned_matrix_t::from_triplets: entry outside the matrix");
+            }
+        }
+        std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.row != b.row ? a.row < b.row : a.col < b.col; });
+
+        sparse_dimensioned_matrix_t m;
+        m.m_columns.reserve(entries.size());
+        m.m_values.reserve(entries.size());
+        for (std::size_t k = 0; k < entries.size(); ++k)
+        {
+            const auto& e = entries[k];
+            if (k > 0 && entries[k - 1].row == e.row && entries[k - 1].col == e.col)
+            {
+                m.m_values.back() += e.value;
+                continue;
+            }
+            m.m_columns.push_back(e.col);
+            m.m_values.push_back(e.value);
+            ++m.m_row_offsets[e.row + 1];
+        }
+        for (std::size_t i = 0; i < row_count; ++i)
+        {
+            m.m_row_offsets[i + 1] += m.m_row_offsets[i];
+        }
+        return m;
+    }
+
+    // Typed element access; elements that are not stored read as zero
+    template <std::size_t row_v, std::size_t col_v = 0>
+    [[nodiscard]] element_type<row_v, col_v> get() const noexcept
+    {
+        static_assert(row_v < row_count && col_v < col_count, "sparse_dimensioned_matrix_t::get: index out of range");
+        return element_type<row_v, col_v>{si_element(row_v, col_v)};
+    }
+
+    // Typed element assignment; inserts the element when it is not stored yet
+    template <std::size_t row_v, std::size_t col_v = 0, is_pkr_unit_c unit_u>
+    void set(const unit_u& value)
+    {
+        static_assert(row_v < row_count && col_v < col_count, "sparse_dimensioned_matrix_t::set: index out of range");
+        static_assert(
+            details::is_pkr_unit<unit_u>::value_dimension == element_dimension<row_v, col_v>,
+            "sparse_dimensioned_matrix_t::set: unit dimension does not match the element dimension");
+        static_assert(std::is_same_v<typename details::is_pkr_unit<unit_u>::value_type, type_t>, "sparse_dimensioned_matrix_t::set: value type mismatch");
+        using ratio_type = typename details::is_pkr_unit<unit_u>::ratio_type;
+        set_si_element(row_v, col_v, details::convert_ratio_to<type_t, ratio_type, std::ratio<1, 1>>(value.value()));
+    }
+
+    // Raw SI access for algorithms (dimensions are tracked by the matrix type)
+    [[nodiscard]] type_t si_element(std::size_t row, std::size_t col) const noexcept
+    {
+        const auto first = m_columns.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[row]);
+        const auto last = m_columns.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[row + 1]);
+        const auto it = std::lower_bound(first, last, col);
+        return it != last && *it == col ? m_values[static_cast<std::size_t>(it - m_columns.begin())] : type_t{0};
+    }
+
+    void set_si_element(std::size_t row, std::size_t col, type_t value)
+    {
+        const auto first = m_columns.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[row]);
+        const auto last = m_columns.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[row + 1]);
+        const auto it = std::lower_bound(first, last, col);
+        const auto position = it - m_columns.begin();
+        if (it != last && *it == col)
+        {
+            m_values[static_cast<std::size_t>(position)] = value;
+            return;
+        }
+        m_columns.insert(it, col);
+        m_values.insert(m_values.begin() + position, value);
+        for (std::size_t i = row + 1; i <= row_count; ++i)
+        {
+            ++m_row_offsets[i];
+        }
+    }
+
+    [[nodiscard]] std::size_t non_zeros() const noexcept
+    {
+        return m_values.size();
+    }
+
+    [[nodiscard]] std::span<const std::size_t> row_offsets() const noexcept
+    {
+        return m_row_offsets;
+    }
+
+    [[nodiscard]] std::span<const std::size_t> column_indices() const noexcept
+    {
+        return m_columns;
+    }
+
+    [[nodiscard]] std::span<const type_t> si_values() const noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] dense_type to_dense() const
+    {
+        dense_type dense{};
+        for (std::size_t i = 0; i < row_count; ++i)
+        {
+            for (std::size_t k = m_row_offsets[i]; k < m_row_offsets[i + 1]; ++k)
+            {
+                dense.si_element(i, m_columns[k]) = m_values[k];
+            }
+        }
+        return dense;
+    }
+
+    bool operator==(const sparse_dimensioned_matrix_t&) const = default;
+
+private:
+    std::vector<std::size_t> m_row_offsets;
+    std::vector<std::size_t> m_columns;
+    std::vector<type_t> m_values;
+};
+
+// ============================================================================
+// Products with dense matrices
+// ============================================================================
+
+// Sparse * dense: row i of the result accumulates a_ik * (row k of B) for each stored a_ik
+template <typename type_t, typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+auto operator*(const sparse_dimensioned_matrix_t<type_t, rows_a_t, cols_a_t>& lhs, const dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& rhs)
+{
+    using result_t = typename details::dimensioned_product<type_t, rows_a_t, cols_a_t, rows_b_t, cols_b_t>::type;
+    constexpr std::size_t m = cols_b_t::size;
+
+    result_t result{};
+    const auto offsets = lhs.row_offsets();
+    const auto columns = lhs.column_indices();
+    const auto values = lhs.si_values();
+    const type_t* b = rhs.si_elements().data();
+    type_t* c = result.si_elements().data();
+    for (std::size_t i = 0; i < rows_a_t::size; ++i)
+    {
+        for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            details::axpy_row(values[k], b + (columns[k] * m), c + (i * m), m);
+        }
+    }
+    return result;
+}
+
+// Dense * sparse: row i of the result accumulates a_ik * (row k of S), touching only stored elements
+template <typename type_t, typename rows_a_t, typename cols_a_t, typename rows_b_t, typename cols_b_t>
+auto operator*(const dimensioned_matrix_t<type_t, rows_a_t, cols_a_t>& lhs, const sparse_dimensioned_matrix_t<type_t, rows_b_t, cols_b_t>& rhs)
+{
+    using result_t = typename details::dimensioned_product<type_t, rows_a_t, cols_a_t, rows_b_t, cols_b_t>::type;
+    constexpr std::size_t p = cols_a_t::size;
+    constexpr std::size_t m = cols_b_t::size;
+
+    result_t result{};
+    const auto offsets = rhs.row_offsets();
+    const auto columns = rhs.column_indices();
+    const auto values = rhs.si_values();
+    const type_t* a = lhs.si_elements().data();
+    type_t* c = result.si_elements().data();
+    for (std::size_t i = 0; i < rows_a_t::size; ++i)
+    {
+        for (std::size_t k = 0; k < p; ++k)
+        {
+            const type_t a_ik = a[(i * p) + k];
+            for (std::size_t s = offsets[k]; s < offsets[k + 1]; ++s)
+            {
+                c[(i * m) + columns[s]] += a_ik * values[s];
+            }
+        }
+    }
+    return result;
+}
+
+// Transpose: (rows, cols) -> (-cols, -rows), still in CSR form
+template <typename type_t, typename row_dims_t, typename col_dims_t>
+auto transpose(const sparse_dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>& m)
+{
+    using dense_result_t = decltype(transpose(std::declval<const dimensioned_matrix_t<type_t, row_dims_t, col_dims_t>&>()));
+    using result_t = sparse_dimensioned_matrix_t<type_t, typename dense_result_t::row_dimensions, typename dense_result_t::col_dimensions>;
+
+    std::vector<sparse_triplet<type_t>> entries;
+    entries.reserve(m.non_zeros());
+    const auto offsets = m.row_offsets();
+    const auto columns = m.column_indices();
+    const auto values = m.si_values();
+    for (std::size_t i = 0; i < row_dims_t::size; ++i)
+    {
+        for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            entries.push_back({columns[k], i, values[k]});
+        }
+    }
+    return result_t::from_triplets(std::move(entries));
+}
+
+} // namespace PKR_UNITS_NAMESPACE
@@ -353,4 +353,23 @@ auto tan(const T&)
 {
     static_assert(is_angle_unit_c<T>, "tan() requires an angle unit");
 }
+
+// ============================================================================
+// Result unit types (coherent SI)
+// ============================================================================
+// The unit of a product of two units and of an integer power of a unit, always
+// with ratio 1 (e.g. unit_product_t<kilometer_t<double>, newton_t<double>> is
+// joule_t<double>). Containers use these to name the result of element-wise
+// algebra without multiplying sample values.
+template <is_pkr_unit_c lhs_u, is_pkr_unit_c rhs_u>
+using unit_product_t = typename derived_unit_type_t<
+    typename details::is_pkr_unit<lhs_u>::value_type,
+    std::ratio<1, 1>,
+    details::add_dimensions(details::is_pkr_unit<lhs_u>::value_dimension, details::is_pkr_unit<rhs_u>::value_dimension)>::type;
+
+template <is_pkr_unit_c unit_u, int power_v>
+using unit_power_t = typename derived_unit_type_t<
+    typename details::is_pkr_unit<unit_u>::value_type,
+    std::ratio<1, 1>,
+    details::scale_dimension(details::is_pkr_unit<unit_u>::value_dimension, power_v)>::type;
 } // namespace PKR_UNITS_NAMESPACE
@@ -113,7 +113,7 @@ struct vec_3d_units_t
         // Extract the underlying scalar value, take sqrt, and construct result unit
         auto scalar_value = sum_of_squares.value();
         using value_type = typename details::is_pkr_unit<T>::value_type;
-        auto sqrt_value = static_cast<value_type>(std::sqrt(static_cast<double>(scalar_value)));
+        auto sqrt_value = static_cast<value_type>(std::sqrt(scalar_value));
         return T{sqrt_value};
     }
 };
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/impl/namespace_config.h>
+#include <pkr_units/impl/simd/vector_kernels.h>
+#include <pkr_units/units/dimensionless/scalar.h>
+#include <pkr_units/units/math/unit_math.h>
+#include <pkr_units/units/math/vector_unit_3d.h>
+#include <pkr_units/units/math/vector_unit_4d.h>
+
+namespace PKR_UNITS_NAMESPACE
+{
+
+// ============================================================================
+// Register-aligned 3D and 4D unit vectors
+// ============================================================================
+// Same dimension rules as vec_3d_units_t / vec_4d_units_t, but the raw values
+// live in one aligned four-lane block so add, subtract, scale, dot and cross
+// are single SIMD operations (see impl/simd/vector_kernels.h). Components are
+// read through x(), y(), z() (and w()), which return T; the raw lanes are
+// exposed for kernels. Mixing units of one dimension goes through the
+// vec_3d_units_t conversions; results of products use the unit that T * U
+// names, as for the unaligned vectors. float vectors compute magnitude() and
+// normalized() with a refined rsqrt estimate instead of a divide and sqrt.
+
+template <is_pkr_unit_c T>
+    requires std::floating_point<typename details::is_pkr_unit<T>::value_type>
+struct aligned_vec_3d_units_t
+{
+    using unit_type = T;
+    using value_type = typename details::is_pkr_unit<T>::value_type;
+    using lanes_type = details::simd_lanes<value_type>;
+
+    constexpr aligned_vec_3d_units_t() noexcept
+        : m_lanes{{0, 0, 0, 0}}
+    {
+    }
+
+    constexpr aligned_vec_3d_units_t(T x_value, T y_value, T z_value) noexcept
+        : m_lanes{{x_value.value(), y_value.value(), z_value.value(), 0}}
+    {
+    }
+
+    template <typename ScalarT>
+        requires scalar_value_c<ScalarT>
+    constexpr aligned_vec_3d_units_t(ScalarT x_value, ScalarT y_value, ScalarT z_value) noexcept
+        : m_lanes{{static_cast<value_type>(x_value), static_cast<value_type>(y_value), static_cast<value_type>(z_value), 0}}
+    {
+    }
+
+    constexpr explicit aligned_vec_3d_units_t(const vec_3d_units_t<T>& v) noexcept
+        : aligned_vec_3d_units_t(v.x, v.y, v.z)
+    {
+    }
+
+    constexpr explicit aligned_vec_3d_units_t(const lanes_type& lanes) noexcept
+        : m_lanes{lanes}
+    {
+        m_lanes.v[3] = 0;
+    }
+
+    [[nodiscard]] constexpr T x() const noexcept
+    {
+        return T{m_lanes.v[0]};
+    }
+
+    [[nodiscard]] constexpr T y() const noexcept
+    {
+        return T{m_lanes.v[1]};
+    }
+
+    [[nodiscard]] constexpr T z() const noexcept
+    {
+        return T{m_lanes.v[2]};
+    }
+
+    [[nodiscard]] constexpr const lanes_type& lanes() const noexcept
+    {
+        return m_lanes;
+    }
+
+    [[nodiscard]] constexpr vec_3d_units_t<T> to_vec() const noexcept
+    {
+        return vec_3d_units_t<T>{x(), y(), z()};
+    }
+
+    constexpr aligned_vec_3d_units_t& operator+=(const aligned_vec_3d_units_t& other) noexcept
+    {
+        m_lanes = details::lanes_add(m_lanes, other.m_lanes);
+        return *this;
+    }
+
+    constexpr aligned_vec_3d_units_t& operator-=(const aligned_vec_3d_units_t& other) noexcept
+    {
+        m_lanes = details::lanes_sub(m_lanes, other.m_lanes);
+        return *this;
+    }
+
+    template <typename Factor>
+        requires scalar_value_c<Factor>
+    constexpr aligned_vec_3d_units_t& operator*=(const Factor& value) noexcept
+    {
+        m_lanes = details::lanes_scale(m_lanes, static_cast<value_type>(value));
+        return *this;
+    }
+
+    template <typename Factor>
+        requires scalar_value_c<Factor>
+    constexpr aligned_vec_3d_units_t& operator/=(const Factor& value) noexcept
+    {
+        m_lanes = details::lanes_scale(m_lanes, value_type{1} / static_cast<value_type>(value));
+        return *this;
+    }
+
+    [[nodiscard]] T magnitude() const noexcept
+    {
+        return T{details::lanes_length(m_lanes)};
+    }
+
+    // Unit-length direction; the zero vector stays zero
+    [[nodiscard]] aligned_vec_3d_units_t<scalar_t<value_type>> normalized() const noexcept
+    {
+        const value_type s = details::lanes_dot(m_lanes, m_lanes);
+        if (s == value_type{0})
+        {
+            return aligned_vec_3d_units_t<scalar_t<value_type>>{};
+        }
+        return aligned_vec_3d_units_t<scalar_t<value_type>>{details::lanes_normalized(m_lanes, s)};
+    }
+
+private:
+    lanes_type m_lanes;
+};
+
+template <is_pkr_unit_c T>
+    requires std::floating_point<typename details::is_pkr_unit<T>::value_type>
+struct aligned_vec_4d_units_t
+{
+    using unit_type = T;
+    using value_type = typename details::is_pkr_unit<T>::value_type;
+    using lanes_type = details::simd_lanes<value_type>;
+
+    constexpr aligned_vec_4d_units_t() noexcept
+        : m_lanes{{0, 0, 0, 1}}
+    {
+    }
+
+    constexpr aligned_vec_4d_units_t(T x_value, T y_value, T z_value, T w_value = T{1}) noexcept
+        : m_lanes{{x_value.value(), y_value.value(), z_value.value(), w_value.value()}}
+    {
+    }
+
+    template <typename ScalarT>
+        requires scalar_value_c<ScalarT>
+    constexpr aligned_vec_4d_units_t(ScalarT x_value, ScalarT y_value, ScalarT z_value, ScalarT w_value = 1) noexcept
+        : m_lanes{{static_cast<value_type>(x_value), static_cast<value_type>(y_value), static_cast<value_type>(z_value), static_cast<value_type>(w_value)}}
+    {
+    }
+
+    constexpr explicit aligned_vec_4d_units_t(const vec_4d_units_t<T>& v) noexcept
+        : aligned_vec_4d_units_t(v.x, v.y, v.z, v.w)
+    {
+    }
+
+    constexpr explicit aligned_vec_4d_units_t(const lanes_type& lanes) noexcept
+        : m_lanes{lanes}
+    {
+    }
+
+    [[nodiscard]] constexpr T x() const noexcept
+    {
+        return T{m_lanes.v[0]};
+    }
+
+    [[nodiscard]] constexpr T y() const noexcept
+    {
+        return T{m_lanes.v[1]};
+    }
+
+    [[nodiscard]] constexpr T z() const noexcept
+    {
+        return T{m_lanes.v[2]};
+    }
+
+    [[nodiscard]] constexpr T w() const noexcept
+    {
+        return T{m_lanes.v[3]};
+    }
+
+    [[nodiscard]] constexpr const lanes_type& lanes() const noexcept
+    {
+        return m_lanes;
+    }
+
+    [[nodiscard]] constexpr vec_4d_units_t<T> to_vec() const noexcept
+    {
+        return vec_4d_units_t<T>{x(), y(), z(), w()};
+    }
+
+    constexpr aligned_vec_4d_units_t& operator+=(const aligned_vec_4d_units_t& other) noexcept
+    {
+        m_lanes = details::lanes_add(m_lanes, other.m_lanes);
+        return *this;
+    }
+
+    constexpr aligned_vec_4d_units_t& operator-=(const aligned_vec_4d_units_t& other) noexcept
+    {
+        m_lanes = details::lanes_sub(m_lanes, other.m_lanes);
+        return *this;
+    }
+
+    template <typename Factor>
+        requires scalar_value_c<Factor>
+    constexpr aligned_vec_4d_units_t& operator*=(const Factor& value) noexcept
+    {
+        m_lanes = details::lanes_scale(m_lanes, static_cast<value_type>(value));
+        return *this;
+    }
+
+    template <typename Factor>
+        requires scalar_value_c<Factor>
+    constexpr aligned_vec_4d_units_t& operator/=(const Factor& value) noexcept
+    {
+        m_lanes = details::lanes_scale(m_lanes, value_type{1} / static_cast<value_type>(value));
+        return *this;
+    }
+
+    [[nodiscard]] T magnitude() const noexcept
+    {
+        return T{details::lanes_length(m_lanes)};
+    }
+
+    // Unit-length direction over all four lanes; the zero vector stays zero
+    [[nodiscard]] aligned_vec_4d_units_t<scalar_t<value_type>> normalized() const noexcept
+    {
+        const value_type s = details::lanes_dot(m_lanes, m_lanes);
+        if (s == value_type{0})
+        {
+            return aligned_vec_4d_units_t<scalar_t<value_type>>{details::simd_lanes<value_type>{{0, 0, 0, 0}}};
+        }
+        return aligned_vec_4d_units_t<scalar_t<value_type>>{details::lanes_normalized(m_lanes, s)};
+    }
+
+private:
+    lanes_type m_lanes;
+};
+
+namespace details
+{
+
+template <typename>
+struct is_aligned_vec_units : std::false_type
+{
+};
+
+template <typename T>
+struct is_aligned_vec_units<aligned_vec_3d_units_t<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_aligned_vec_units<aligned_vec_4d_units_t<T>> : std::true_type
+{
+};
+
+} // namespace details
+
+template <typename V>
+concept aligned_vec_units_c = details::is_aligned_vec_units<V>::value;
+
+// ============================================================================
+// Operators
+// ============================================================================
+// Written once for both sizes: lane 3 of a 3D vector is zero and stays zero
+// under every operation below.
+
+template <aligned_vec_units_c V>
+constexpr V operator+(const V& a, const V& b) noexcept
+{
+    return V{details::lanes_add(a.lanes(), b.lanes())};
+}
+
+template <aligned_vec_units_c V>
+constexpr V operator-(const V& a, const V& b) noexcept
+{
+    return V{details::lanes_sub(a.lanes(), b.lanes())};
+}
+
+template <aligned_vec_units_c V>
+constexpr V operator-(const V& v) noexcept
+{
+    return V{details::lanes_scale(v.lanes(), typename V::value_type{-1})};
+}
+
+template <aligned_vec_units_c V, typename Factor>
+    requires scalar_value_c<Factor>
+constexpr V operator*(const V& v, const Factor& value) noexcept
+{
+    return V{details::lanes_scale(v.lanes(), static_cast<typename V::value_type>(value))};
+}
+
+template <typename Factor, aligned_vec_units_c V>
+    requires scalar_value_c<Factor>
+constexpr V operator*(const Factor& value, const V& v) noexcept
+{
+    return v * value;
+}
+
+template <aligned_vec_units_c V, typename Factor>
+    requires scalar_value_c<Factor>
+constexpr V operator/(const V& v, const Factor& value) noexcept
+{
+    return V{details::lanes_scale(v.lanes(), typename V::value_type{1} / static_cast<typename V::value_type>(value))};
+}
+
+template <aligned_vec_units_c V>
+constexpr bool operator==(const V& a, const V& b) noexcept
+{
+    return a.lanes().v == b.lanes().v;
+}
+
+// Scaling by a unit changes the vector unit, e.g. a velocity times a time
+template <is_pkr_unit_c T, is_pkr_unit_c F>
+constexpr auto operator*(const aligned_vec_3d_units_t<T>& v, const F& factor) noexcept
+{
+    using result_u = decltype(std::declval<T>() * std::declval<F>());
+    return aligned_vec_3d_units_t<result_u>{details::lanes_scale(v.lanes(), static_cast<typename aligned_vec_3d_units_t<T>::value_type>(factor.value()))};
+}
+
+template <is_pkr_unit_c F, is_pkr_unit_c T>
+constexpr auto operator*(const F& factor, const aligned_vec_3d_units_t<T>& v) noexcept
+{
+    return v * factor;
+}
+
+template <is_pkr_unit_c T, is_pkr_unit_c U>
+constexpr auto dot(const aligned_vec_3d_units_t<T>& a, const aligned_vec_3d_units_t<U>& b) noexcept
+{
+    using result_u = decltype(std::declval<T>() * std::declval<U>());
+    return result_u{details::lanes_dot(a.lanes(), b.lanes())};
+}
+
+template <is_pkr_unit_c T, is_pkr_unit_c U>
+constexpr auto dot(const aligned_vec_4d_units_t<T>& a, const aligned_vec_4d_units_t<U>& b) noexcept
+{
+    using result_u = decltype(std::declval<T>() * std::declval<U>());
+    return result_u{details::lanes_dot(a.lanes(), b.lanes())};
+}
+
+template <is_pkr_unit_c T, is_pkr_unit_c U>
+constexpr auto cross(const aligned_vec_3d_units_t<T>& a, const aligned_vec_3d_units_t<U>& b) noexcept
+{
+    using result_u = decltype(std::declval<T>() * std::declval<U>());
+    return aligned_vec_3d_units_t<result_u>{details::lanes_cross(a.lanes(), b.lanes())};
+}
+
+} // namespace PKR_UNITS_NAMESPACE
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <ratio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/format/range.h>
+
+using namespace pkr::units;
+
+// ============================================================================
+// Bulk formatting of arrays and series
+// ============================================================================
+
+class FormatRangeTest : public ::testing::Test
+{
+};
+
+TEST_F(FormatRangeTest, shortest_round_trip_with_symbol_per_element)
+{
+    const std::vector<meter_t<double>> samples{meter_t<double>{1.5}, meter_t<double>{0.1}, meter_t<double>{-2.0}};
+    EXPECT_EQ(format_range_to_string(std::span<const meter_t<double>>(samples)), "1.5 m\n0.1 m\n-2 m\n");
+
+    range_format_options once;
+    once.symbol = symbol_placement::once;
+    once.separator = ";";
+    EXPECT_EQ(format_range_to_string(std::span<const meter_t<double>>(samples), once), "m;1.5;0.1;-2;");
+}
+
+TEST_F(FormatRangeTest, spec_is_parsed_once_with_std_format_meaning)
+{
+    const std::vector<meter_t<double>> samples{meter_t<double>{1.0 / 3.0}};
+    range_format_options options;
+    options.symbol = symbol_placement::none;
+
+    options.spec = ".3f";
+    EXPECT_EQ(format_range_to_string(std::span<const meter_t<double>>(samples), options), "0.333\n");
+    options.spec = "e";
+    EXPECT_EQ(format_range_to_string(std::span<const meter_t<double>>(samples), options), "3.333333e-01\n");
+    options.spec = ".2";
+    EXPECT_EQ(format_range_to_string(std::span<const meter_t<double>>(samples), options), "0.33\n");
+
+    options.spec = "x";
+    EXPECT_THROW(static_cast<void>(format_range_to_string(std::span<const meter_t<double>>(samples), options)), std::invalid_argument);
+}
+
+TEST_F(FormatRangeTest, fixed_capacity_follows_the_value_type)
+{
+    // 601 integer digits: more than any double, within long double's range
+    const std::vector<meter_t<long double>> samples{meter_t<long double>{1e600L}};
+    range_format_options options;
+    options.spec = "f";
+    const std::string text = format_range_to_string(std::span<const meter_t<long double>>(samples), options);
+    EXPECT_EQ(text.size(), 601u + std::string_view(".000000 m\n").size());
+    EXPECT_EQ(text.front(), '1');
+    EXPECT_TRUE(text.ends_with(".000000 m\n"));
+
+    const std::vector<meter_t<double>> largest{meter_t<double>{-std::numeric_limits<double>::max()}};
+    options.spec = ".3f";
+    EXPECT_EQ(format_range_to_string(std::span<const meter_t<double>>(largest), options).size(), 1u + 309u + 4u + 3u);
+}
+
+TEST_F(FormatRangeTest, base_units_use_the_compile_time_dimension_symbol)
+{
+    using energy_type = unit_t<double, std::ratio<1>, dimension_t{2, 1, -2, 0, 0, 0, 0, 0, 0}>;
+    const std::vector<energy_type> samples{energy_type{2.0}};
+    EXPECT_EQ(format_range_to_string(std::span<const energy_type>(samples)), "2 kg*m^2*s^-2\n");
+}
+
+TEST_F(FormatRangeTest, parallel_chunks_match_serial_output)
+{
+    std::vector<meter_t<double>> samples;
+    for (int i = 0; i < 100000; ++i)
+    {
+        samples.emplace_back(std::sin(i) * 1e3);
+    }
+    const std::span<const meter_t<double>> view(samples);
+
+    range_format_options serial;
+    serial.chunk_bytes = 4096;
+    range_format_options parallel = serial;
+    parallel.parallel = true;
+
+    std::size_t chunks = 0;
+    std::string text;
+    format_range(view, [&](std::string_view chunk) { ++chunks; text.append(chunk); }, parallel);
+    EXPECT_EQ(text, format_range_to_string(view, serial));
+    EXPECT_GT(chunks, 1u);
+
+    std::ostringstream os;
+    format_range(view, os, serial);
+    EXPECT_EQ(os.str(), text);
+}
+
+TEST_F(FormatRangeTest, series_rows)
+{
+    const std::vector<millisecond_t<std::int64_t>> time{millisecond_t<std::int64_t>{0}, millisecond_t<std::int64_t>{250}};
+    const std::vector<pascal_t<double>> pressure{pascal_t<double>{101325.0}, pascal_t<double>{101300.5}};
+
+    std::string text;
+    range_format_options options;
+    options.symbol = symbol_placement::once;
+    format_series(std::span<const millisecond_t<std::int64_t>>(time), std::span<const pascal_t<double>>(pressure), [&](std::string_view chunk) { text.append(chunk); }, options);
+    EXPECT_EQ(text, "ms,Pa\n0,101325\n250,101300.5\n");
+
+    const std::vector<pascal_t<double>> one_more{pascal_t<double>{101325.0}, pascal_t<double>{101300.5}, pascal_t<double>{0.0}};
+    EXPECT_THROW(format_series_to_string(std::span<const millisecond_t<std::int64_t>>(time), std::span<const pascal_t<double>>(one_more)), std::invalid_argument);
+}
+
+TEST_F(FormatRangeTest, series_to_ostream_and_string)
+{
+    const std::vector<second_t<double>> time{second_t<double>{0.0}, second_t<double>{0.5}};
+    const std::vector<meter_t<double>> height{meter_t<double>{1.25}, meter_t<double>{2.0}};
+    const std::span<const second_t<double>> time_view(time);
+    const std::span<const meter_t<double>> height_view(height);
+
+    std::ostringstream os;
+    format_series(time_view, height_view, os);
+    EXPECT_EQ(os.str(), "0 s,1.25 m\n0.5 s,2 m\n");
+    EXPECT_EQ(format_series_to_string(time_view, height_view), os.str());
+}
+
+TEST_F(FormatRangeTest, ostream_output_honours_the_stream_state)
+{
+    const std::vector<meter_t<double>> samples{meter_t<double>{1.0}, meter_t<double>{2.0}};
+    const std::span<const meter_t<double>> view(samples);
+
+    // A failed stream writes nothing
+    std::ostringstream failed;
+    failed.setstate(std::ios_base::failbit);
+    format_range(view, failed);
+    EXPECT_TRUE(failed.str().empty());
+
+    // A stream buffer that accepts nothing sets badbit
+    std::stringbuf read_only(std::ios_base::in);
+    std::ostream rejecting(&read_only);
+    format_range(view, rejecting);
+    EXPECT_TRUE(rejecting.bad());
+}
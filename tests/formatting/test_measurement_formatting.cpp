@@ -334,3 +334,35 @@ TEST_F(MeasurementFormattingDerivedUnitsTest, kilogram_meter_per_second_squared)
     EXPECT_TRUE(formatted.find("20") != std::string::npos);
     EXPECT_TRUE(formatted.find("2") != std::string::npos);
 }
+
+// ============================================================================
+// Stream Output Fast Path
+// ============================================================================
+
+class MeasurementStreamOutputTest : public ::testing::Test
+{
+};
+
+TEST_F(MeasurementStreamOutputTest, stream_output_matches_default_format)
+{
+    pkr::units::measurement_lin_t<pkr::units::meter_t<double>> lin{5.0, 0.1};
+    pkr::units::measurement_rss_t<pkr::units::volt_t<float>> rss{1.25f, 0.5f};
+
+    std::ostringstream os;
+    os << lin << '|' << rss;
+    EXPECT_EQ(os.str(), "5 +/- 0.1 m|1.25 +/- 0.5 V");
+    EXPECT_EQ(os.str(), std::format("{}|{}", lin, rss));
+
+    std::wostringstream wos;
+    wos << rss;
+    EXPECT_EQ(wos.str(), L"1.25 \u00b1 0.5 V");
+}
+
+TEST_F(MeasurementStreamOutputTest, stream_output_respects_stream_state)
+{
+    pkr::units::measurement_lin_t<pkr::units::meter_t<double>> lin{5.0, 0.1};
+    std::ostringstream os;
+    os.setstate(std::ios_base::failbit);
+    os << lin;
+    EXPECT_TRUE(os.str().empty());
+}
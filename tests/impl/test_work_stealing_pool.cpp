@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <pkr_units/impl/parallel/work_stealing_pool.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class WorkStealingPoolTest : public Test
+{
+};
+
+TEST_F(WorkStealingPoolTest, covers_every_index_once)
+{
+    pkr::units::work_stealing_pool pool{4};
+    std::vector<int> hits(100003, 0);
+    pool.parallel_for(0, hits.size(), 97, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            ++hits[i];
+        }
+    });
+    for (const int h : hits)
+    {
+        ASSERT_EQ(h, 1);
+    }
+}
+
+TEST_F(WorkStealingPoolTest, chunks_respect_grain)
+{
+    pkr::units::work_stealing_pool pool{3};
+    std::atomic<std::size_t> largest{0};
+    std::atomic<std::size_t> total{0};
+    pool.parallel_for(10, 5010, 64, [&](std::size_t begin, std::size_t end)
+    {
+        std::size_t size = end - begin;
+        std::size_t seen = largest.load();
+        while (size > seen && !largest.compare_exchange_weak(seen, size))
+        {
+        }
+        total += size;
+    });
+    EXPECT_LE(largest.load(), 64u);
+    EXPECT_EQ(total.load(), 5000u);
+}
+
+TEST_F(WorkStealingPoolTest, balances_irregular_work)
+{
+    // The first quarter of the range is far more expensive; stealing must still finish it correctly
+    pkr::units::work_stealing_pool pool{4};
+    std::vector<double> out(4096, 0.0);
+    pool.parallel_for(0, out.size(), 8, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const std::size_t work = i < 1024 ? 2000 : 10;
+            double acc = 0.0;
+            for (std::size_t k = 0; k < work; ++k)
+            {
+                acc += 1.0 / static_cast<double>(k + 1);
+            }
+            out[i] = acc;
+        }
+    });
+    EXPECT_GT(out[0], 8.0);
+    EXPECT_GT(out[4095], 2.9);
+}
+
+TEST_F(WorkStealingPoolTest, rethrows_exceptions)
+{
+    pkr::units::work_stealing_pool pool{4};
+    EXPECT_THROW(
+        pool.parallel_for(0, 10000, 10, [](std::size_t begin, std::size_t)
+        {
+            if (begin == 5000)
+            {
+                throw std::runtime_error("boom");
+            }
+        }),
+        std::runtime_error);
+
+    // The pool stays usable afterwards
+    std::atomic<std::size_t> count{0};
+    pool.parallel_for(0, 1000, 10, [&](std::size_t begin, std::size_t end) { count += end - begin; });
+    EXPECT_EQ(count.load(), 1000u);
+}
+
+TEST_F(WorkStealingPoolTest, nested_loops_run_serially)
+{
+    pkr::units::work_stealing_pool pool{4};
+    std::atomic<std::size_t> count{0};
+    pool.parallel_for(0, 64, 1, [&](std::size_t, std::size_t)
+    {
+        pool.parallel_for(0, 100, 10, [&](std::size_t begin, std::size_t end) { count += end - begin; });
+    });
+    EXPECT_EQ(count.load(), 6400u);
+}
+
+TEST_F(WorkStealingPoolTest, single_thread_pool)
+{
+    pkr::units::work_stealing_pool pool{1};
+    std::vector<std::size_t> v(1000);
+    pool.parallel_for(0, v.size(), 7, [&](std::size_t begin, std::size_t end) { std::iota(v.begin() + static_cast<std::ptrdiff_t>(begin), v.begin() + static_cast<std::ptrdiff_t>(end), begin); });
+    EXPECT_EQ(v[999], 999u);
+}
+
+} // namespace test
@@ -0,0 +1,199 @@
+#include "three_body_simulation/double_body.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/nbody.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class NBodyTest : public Test
+{
+protected:
+    using length_vec = pkr::units::vec_3d_units_t<pkr::units::meter_t<double>>;
+    using velocity_vec = pkr::units::vec_3d_units_t<pkr::units::meter_per_second_t<double>>;
+
+    static pkr::units::nbody::body_system_t<double> random_cluster(std::size_t count, std::uint32_t seed)
+    {
+        std::mt19937 rng{seed};
+        std::normal_distribution<double> position{0.0, 1.0e11};
+        std::normal_distribution<double> velocity{0.0, 1.0e3};
+        std::uniform_real_distribution<double> mass{1.0e29, 1.0e30};
+
+        pkr::units::nbody::body_system_t<double> bodies;
+        bodies.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            bodies.add_body(
+                length_vec{position(rng), position(rng), position(rng)},
+                velocity_vec{velocity(rng), velocity(rng), velocity(rng)},
+                pkr::units::kilogram_t<double>{mass(rng)});
+        }
+        return bodies;
+    }
+
+    static std::vector<double> acceleration_magnitudes(const pkr::units::nbody::body_system_t<double>& bodies)
+    {
+        std::vector<double> a(bodies.size());
+        for (std::size_t i = 0; i < bodies.size(); ++i)
+        {
+            a[i] = std::sqrt((bodies.ax()[i] * bodies.ax()[i]) + (bodies.ay()[i] * bodies.ay()[i]) + (bodies.az()[i] * bodies.az()[i]));
+        }
+        return a;
+    }
+};
+
+// ============================================================================
+// Body storage
+// ============================================================================
+
+TEST_F(NBodyTest, add_body_converts_to_si)
+{
+    pkr::units::nbody::body_system_t<double> bodies;
+    bodies.add_body(
+        pkr::units::vec_3d_units_t<pkr::units::kilometer_t<double>>{1.0, 2.0, 3.0},
+        pkr::units::vec_3d_units_t<pkr::units::meter_per_second_t<double>>{4.0, 5.0, 6.0},
+        pkr::units::gram_t<double>{2500.0});
+
+    ASSERT_EQ(bodies.size(), 1u);
+    EXPECT_DOUBLE_EQ(bodies.position(0).y.value(), 2000.0);
+    EXPECT_DOUBLE_EQ(bodies.velocity(0).z.value(), 6.0);
+    EXPECT_DOUBLE_EQ(bodies.mass(0).value(), 2.5);
+    EXPECT_THROW(static_cast<void>(bodies.position(1)), std::out_of_range);
+}
+
+// ============================================================================
+// Force evaluation
+// ============================================================================
+
+TEST_F(NBodyTest, barnes_hut_with_zero_opening_angle_matches_direct_sum)
+{
+    auto bodies = random_cluster(700, 1);
+    pkr::units::nbody::gravity_options<double> options;
+    options.opening_angle = 0.0;
+
+    pkr::units::nbody::compute_accelerations_direct(bodies, options);
+    const std::vector<double> ax(bodies.ax().begin(), bodies.ax().end());
+
+    pkr::units::nbody::barnes_hut_tree_t<double> tree;
+    tree.build(bodies, options.leaf_size);
+    tree.compute_accelerations(bodies, options);
+
+    for (std::size_t i = 0; i < bodies.size(); ++i)
+    {
+        ASSERT_NEAR(bodies.ax()[i], ax[i], 1e-9 * std::abs(ax[i]) + 1e-30);
+    }
+}
+
+TEST_F(NBodyTest, barnes_hut_error_shrinks_with_opening_angle)
+{
+    auto bodies = random_cluster(4000, 2);
+    pkr::units::nbody::gravity_options<double> options;
+    pkr::units::nbody::compute_accelerations_direct(bodies, options);
+    const std::vector<double> exact_x(bodies.ax().begin(), bodies.ax().end());
+    const std::vector<double> exact_y(bodies.ay().begin(), bodies.ay().end());
+    const std::vector<double> exact_z(bodies.az().begin(), bodies.az().end());
+    const auto exact_magnitude = acceleration_magnitudes(bodies);
+
+    auto rms_relative_error = [&](double theta)
+    {
+        options.opening_angle = theta;
+        pkr::units::nbody::barnes_hut_tree_t<double> tree;
+        tree.build(bodies, options.leaf_size);
+        tree.compute_accelerations(bodies, options);
+        double sum = 0.0;
+        for (std::size_t i = 0; i < bodies.size(); ++i)
+        {
+            const double dx = bodies.ax()[i] - exact_x[i];
+            const double dy = bodies.ay()[i] - exact_y[i];
+            const double dz = bodies.az()[i] - exact_z[i];
+            sum += ((dx * dx) + (dy * dy) + (dz * dz)) / (exact_magnitude[i] * exact_magnitude[i]);
+        }
+        return std::sqrt(sum / static_cast<double>(bodies.size()));
+    };
+
+    const double coarse = rms_relative_error(0.8);
+    const double fine = rms_relative_error(0.3);
+    EXPECT_LT(coarse, 5e-2);
+    EXPECT_LT(fine, 5e-3);
+    EXPECT_LT(fine, coarse);
+}
+
+// ============================================================================
+// Accuracy against the three-body reference
+// ============================================================================
+// Sun-Jupiter-Ganymede, the same setup as test_three_body_problem.cpp. The
+// plain double reference integrates with RK4 in km; the nbody module
+// integrates with leapfrog in SI units. Both must agree on the trajectories.
+
+TEST_F(NBodyTest, leapfrog_matches_three_body_reference)
+{
+    using three_body_double::make_direction;
+    using three_body_double::make_position;
+    std::vector<three_body_double::Body> reference_bodies{
+        three_body_double::Body(make_position(0.0, 0.0, 0.0), make_direction(0.0, 0.0, 0.0), 1.989e30),
+        three_body_double::Body(make_position(778.5e6, 0.0, 0.0), make_direction(0.0, 13.07, 0.0), 1.898e27),
+        three_body_double::Body(make_position(778.5e6, 1.070400e6, 0.0), make_direction(0.0, 13.07 + 10.88, 0.0), 1.4819e23)};
+    three_body_double::ThreeBodySystem reference{reference_bodies};
+    for (int step = 0; step < 1440; ++step)
+    {
+        reference.rk4_step(60.0);
+    }
+
+    for (const auto method : {pkr::units::nbody::force_method::direct, pkr::units::nbody::force_method::barnes_hut})
+    {
+        pkr::units::nbody::body_system_t<double> bodies;
+        for (const auto& body : reference_bodies)
+        {
+            bodies.add_body(
+                pkr::units::vec_3d_units_t<pkr::units::kilometer_t<double>>{body.position.x, body.position.y, body.position.z},
+                pkr::units::vec_3d_units_t<pkr::units::kilometer_per_second_t<double>>{body.velocity.x, body.velocity.y, body.velocity.z},
+                pkr::units::kilogram_t<double>{body.mass});
+        }
+
+        pkr::units::nbody::gravity_options<double> options;
+        options.gravitational_constant = pkr::units::constants::gravitational_constant_unit_t<double>{three_body_double::G * 1.0e9};
+        options.opening_angle = 0.0;
+        pkr::units::nbody::simulation_t<double> simulation{std::move(bodies), options, method};
+        const double initial_energy = simulation.bodies().total_energy(options.gravitational_constant.value()).value();
+
+        const pkr::units::second_t<double> dt{60.0};
+        simulation.run(dt, 1440);
+        EXPECT_DOUBLE_EQ(simulation.time().value(), 86400.0);
+
+        const double energy = simulation.bodies().total_energy(options.gravitational_constant.value()).value();
+        EXPECT_LT(std::abs((energy - initial_energy) / initial_energy), 1e-9);
+
+        const auto& expected = reference.get_bodies();
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            const auto p = simulation.bodies().position(i);
+            // 1 km over a day, against a 1.07e6 km Ganymede orbit
+            EXPECT_NEAR(p.x.value(), expected[i].position.x * 1000.0, 1000.0);
+            EXPECT_NEAR(p.y.value(), expected[i].position.y * 1000.0, 1000.0);
+        }
+    }
+}
+
+TEST_F(NBodyTest, barnes_hut_simulation_conserves_energy)
+{
+    pkr::units::nbody::gravity_options<double> options;
+    options.softening = pkr::units::meter_t<double>{1.0e10};
+    options.opening_angle = 0.4;
+    pkr::units::nbody::simulation_t<double> simulation{random_cluster(1000, 3), options};
+    const double initial_energy = simulation.bodies().total_energy(options.gravitational_constant.value(), options.softening.value()).value();
+
+    simulation.run(pkr::units::second_t<double>{3600.0}, 48);
+
+    const double energy = simulation.bodies().total_energy(options.gravitational_constant.value(), options.softening.value()).value();
+    EXPECT_LT(std::abs((energy - initial_energy) / initial_energy), 1e-3);
+}
+
+} // namespace test
@@ -50,6 +50,15 @@ class ThreeBodySystem
 public:
     ThreeBodySystem(const std::vector<Body>& initial_bodies)
         : bodies(initial_bodies)
+        , temp_bodies(initial_bodies)
+        , k1_vel(initial_bodies.size())
+        , k1_acc(initial_bodies.size())
+        , k2_vel(initial_bodies.size())
+        , k2_acc(initial_bodies.size())
+        , k3_vel(initial_bodies.size())
+        , k3_acc(initial_bodies.size())
+        , k4_vel(initial_bodies.size())
+        , k4_acc(initial_bodies.size())
     {
     }
 
@@ -77,14 +86,10 @@ public:
         return acc;
     }
 
-    // 4th order Runge-Kutta integration step
+    // 4th order Runge-Kutta integration step (stage buffers are allocated once in the constructor)
     void rk4_step(double dt)
     {
         size_t n = bodies.size();
-        std::vector<pkr::units::vec_4d_t<double>> k1_vel(n), k1_acc(n);
-        std::vector<pkr::units::vec_4d_t<double>> k2_vel(n), k2_acc(n);
-        std::vector<pkr::units::vec_4d_t<double>> k3_vel(n), k3_acc(n);
-        std::vector<pkr::units::vec_4d_t<double>> k4_vel(n), k4_acc(n);
 
         double dt_val = dt;
 
@@ -96,7 +101,7 @@ public:
         }
 
         // k2
-        std::vector<Body> temp_bodies = bodies;
+        temp_bodies = bodies;
         for (size_t i = 0; i < n; ++i)
         {
             auto new_pos = make_position(bodies[i].position.x.value(), bodies[i].position.y.value(), bodies[i].position.z.value()) + k1_vel[i] * (dt_val / 2.0);
@@ -191,6 +196,13 @@ public:
 
 private:
     mutable std::vector<Body> bodies;
+
+    // RK4 workspace
+    std::vector<Body> temp_bodies;
+    std::vector<pkr::units::vec_4d_t<double>> k1_vel, k1_acc;
+    std::vector<pkr::units::vec_4d_t<double>> k2_vel, k2_acc;
+    std::vector<pkr::units::vec_4d_t<double>> k3_vel, k3_acc;
+    std::vector<pkr::units::vec_4d_t<double>> k4_vel, k4_acc;
 };
 
 } // namespace three_body_units
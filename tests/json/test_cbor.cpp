@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/json/cbor.h>
+
+using namespace pkr::units;
+
+// ============================================================================
+// CBOR arrays and series
+// ============================================================================
+
+class CborTest : public ::testing::Test
+{
+};
+
+TEST_F(CborTest, unit_array_round_trips_and_converts)
+{
+    const std::vector<meter_t<double>> samples{meter_t<double>{1.5}, meter_t<double>{-2.0}, meter_t<double>{1e-9}};
+    const std::vector<std::byte> bytes = cbor::encode(std::span<const meter_t<double>>(samples));
+    EXPECT_LT(bytes.size(), 128u + (samples.size() * sizeof(double)));
+
+    auto same = cbor::decode<meter_t<double>>(bytes);
+    ASSERT_TRUE(same);
+    ASSERT_EQ(same->size(), 3u);
+    EXPECT_EQ((*same)[0].value(), 1.5);
+    EXPECT_EQ((*same)[2].value(), 1e-9);
+
+    auto millimeters = cbor::decode<millimeter_t<float>>(bytes);
+    ASSERT_TRUE(millimeters);
+    EXPECT_FLOAT_EQ((*millimeters)[1].value(), -2000.0f);
+
+    auto wrong = cbor::decode<second_t<double>>(bytes);
+    ASSERT_FALSE(wrong);
+    EXPECT_EQ(wrong.error().code, cbor::error_code::dimension_mismatch);
+}
+
+TEST_F(CborTest, temperature_offsets_apply_to_values_only)
+{
+    const std::vector<measurement_lin_t<celsius_t<double>>> samples{{celsius_t<double>{20.0}, celsius_t<double>{0.5}}};
+    const std::vector<std::byte> bytes = cbor::encode(std::span<const measurement_lin_t<celsius_t<double>>>(samples));
+
+    auto kelvin = cbor::decode<measurement_lin_t<kelvin_t<double>>>(bytes);
+    ASSERT_TRUE(kelvin);
+    EXPECT_DOUBLE_EQ((*kelvin)[0].value(), 293.15);
+    EXPECT_DOUBLE_EQ((*kelvin)[0].uncertainty(), 0.5);
+
+    auto as_unit = cbor::decode<kelvin_t<double>>(bytes);
+    ASSERT_FALSE(as_unit);
+    EXPECT_EQ(as_unit.error().code, cbor::error_code::layout_mismatch);
+}
+
+TEST_F(CborTest, columnar_and_native_layouts_decode_alike)
+{
+    std::vector<measurement_rss_t<volt_t<float>>> samples;
+    for (int i = 0; i < 100; ++i)
+    {
+        samples.emplace_back(volt_t<float>{static_cast<float>(i)}, volt_t<float>{0.25f});
+    }
+    const std::span<const measurement_rss_t<volt_t<float>>> view(samples);
+
+    cbor::options columnar;
+    columnar.layout = cbor::measurement_layout::columnar;
+    cbor::options native;
+    native.order = cbor::byte_order::native;
+
+    for (const auto& bytes : {cbor::encode(view, columnar), cbor::encode(view, native), cbor::encode(view)})
+    {
+        auto decoded = cbor::decode<measurement_rss_t<millivolt_t<double>>>(bytes);
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(decoded->size(), 100u);
+        EXPECT_DOUBLE_EQ((*decoded)[42].value(), 42000.0);
+        EXPECT_DOUBLE_EQ((*decoded)[42].uncertainty(), 250.0);
+    }
+}
+
+TEST_F(CborTest, view_is_zero_copy_for_matching_aligned_documents)
+{
+    const std::vector<meter_t<double>> samples{meter_t<double>{1.0}, meter_t<double>{2.0}, meter_t<double>{3.0}};
+    cbor::options native;
+    native.order = cbor::byte_order::native;
+    const std::vector<std::byte> bytes = cbor::encode(std::span<const meter_t<double>>(samples), native);
+
+    auto in_place = cbor::view<meter_t<double>>(bytes);
+    ASSERT_TRUE(in_place);
+    ASSERT_EQ(in_place->size(), 3u);
+    EXPECT_EQ((*in_place)[2].value(), 3.0);
+    EXPECT_GE(reinterpret_cast<const std::byte*>(in_place->data()), bytes.data());
+    EXPECT_LT(reinterpret_cast<const std::byte*>(in_place->data()), bytes.data() + bytes.size());
+
+    auto other_unit = cbor::view<millimeter_t<double>>(bytes);
+    ASSERT_FALSE(other_unit);
+    EXPECT_EQ(other_unit.error().code, cbor::error_code::not_viewable);
+
+    auto other_type = cbor::view<meter_t<float>>(bytes);
+    ASSERT_FALSE(other_type);
+    EXPECT_EQ(other_type.error().code, cbor::error_code::not_viewable);
+}
+
+TEST_F(CborTest, series_round_trip)
+{
+    std::vector<millisecond_t<std::int64_t>> time;
+    std::vector<pascal_t<double>> pressure;
+    for (std::int64_t i = 0; i < 10; ++i)
+    {
+        time.emplace_back(i * 100);
+        pressure.emplace_back(101325.0 + static_cast<double>(i));
+    }
+    const std::vector<std::byte> bytes =
+        cbor::encode_series(std::span<const millisecond_t<std::int64_t>>(time), std::span<const pascal_t<double>>(pressure));
+
+    auto series = cbor::decode_series<second_t<double>, kilopascal_t<double>>(bytes);
+    ASSERT_TRUE(series);
+    ASSERT_EQ(series->time.size(), 10u);
+    EXPECT_DOUBLE_EQ(series->time[3].value(), 0.3);
+    EXPECT_DOUBLE_EQ(series->values[3].value(), 101.328);
+
+    auto samples_only = cbor::decode<pascal_t<double>>(bytes);
+    ASSERT_TRUE(samples_only);
+    EXPECT_EQ(samples_only->size(), 10u);
+
+    auto not_a_series = cbor::decode_series<second_t<double>, pascal_t<double>>(cbor::encode(std::span<const pascal_t<double>>(pressure)));
+    ASSERT_FALSE(not_a_series);
+    EXPECT_EQ(not_a_series.error().code, cbor::error_code::layout_mismatch);
+}
+
+TEST_F(CborTest, series_lengths_must_match)
+{
+    const std::vector<second_t<double>> time{second_t<double>{0.0}, second_t<double>{1.0}};
+    const std::vector<pascal_t<double>> pressure{pascal_t<double>{101325.0}};
+    EXPECT_THROW(cbor::encode_series(std::span<const second_t<double>>(time), std::span<const pascal_t<double>>(pressure)), std::invalid_argument);
+}
+
+TEST_F(CborTest, reports_truncated_and_malformed_input)
+{
+    const std::vector<meter_t<double>> samples{meter_t<double>{1.0}, meter_t<double>{2.0}};
+    std::vector<std::byte> bytes = cbor::encode(std::span<const meter_t<double>>(samples));
+
+    auto truncated = cbor::decode<meter_t<double>>(std::span<const std::byte>(bytes).first(bytes.size() - 3));
+    ASSERT_FALSE(truncated);
+    EXPECT_EQ(truncated.error().code, cbor::error_code::truncated);
+
+    const std::vector<std::byte> not_a_map{std::byte{0x83}, std::byte{0x01}, std::byte{0x02}, std::byte{0x03}};
+    auto malformed = cbor::decode<meter_t<double>>(not_a_map);
+    ASSERT_FALSE(malformed);
+    EXPECT_EQ(malformed.error().code, cbor::error_code::malformed);
+    EXPECT_EQ(malformed.error().offset, 0u);
+
+    const std::vector<std::byte> indefinite{std::byte{0xBF}, std::byte{0xFF}};
+    auto unsupported = cbor::decode<meter_t<double>>(indefinite);
+    ASSERT_FALSE(unsupported);
+    EXPECT_EQ(unsupported.error().code, cbor::error_code::unsupported);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/json/json.h>
+
+using namespace pkr::units;
+
+// ============================================================================
+// Caller-provided buffers
+// ============================================================================
+
+class JsonBufferTest : public ::testing::Test
+{
+};
+
+TEST_F(JsonBufferTest, serialize_to_writes_into_the_caller_span)
+{
+    std::array<char, 64> buffer{};
+    auto json_str = json::serialize_to(std::span<char>(buffer), kilometer_t<double>{10.5});
+    EXPECT_EQ(json_str, R"({"value":10.5,"unit":"km"})");
+    EXPECT_EQ(json_str.data(), buffer.data());
+}
+
+TEST_F(JsonBufferTest, serialize_to_reports_a_short_buffer_without_overrunning)
+{
+    std::array<char, 16> buffer{};
+    buffer.fill('#');
+    auto json_str = json::serialize_to(std::span<char>(buffer.data(), 12), meter_t<double>{5.0});
+    EXPECT_TRUE(json_str.empty());
+    EXPECT_EQ(buffer[12], '#');
+}
+
+TEST_F(JsonBufferTest, serialize_to_handles_measurements_and_wide_buffers)
+{
+    std::array<char, 96> narrow{};
+    measurement_lin_t<meter_t<double>> meas{meter_t<double>{5.0}, meter_t<double>{0.1}};
+    EXPECT_EQ(json::serialize_to(std::span<char>(narrow), meas), R"({"value":5,"uncertainty":0.1,"unit":"m"})");
+
+    std::array<wchar_t, 64> wide{};
+    EXPECT_EQ(json::serialize_to(std::span<wchar_t>(wide), second_t<double>{0.25}), LR"({"value":0.25,"unit":"s"})");
+}
+
+TEST_F(JsonBufferTest, non_finite_numbers_are_written_as_null)
+{
+    std::array<char, 96> buffer{};
+    EXPECT_EQ(json::serialize_to(std::span<char>(buffer), meter_t<double>{std::numeric_limits<double>::quiet_NaN()}), R"({"value":null,"unit":"m"})");
+    EXPECT_EQ(json::serialize_to(std::span<char>(buffer), meter_t<float>{-std::numeric_limits<float>::infinity()}), R"({"value":null,"unit":"m"})");
+
+    const measurement_lin_t<meter_t<double>> meas{meter_t<double>{std::numeric_limits<double>::infinity()},
+                                                  meter_t<double>{std::numeric_limits<double>::quiet_NaN()}};
+    EXPECT_EQ(json::serialize_to(std::span<char>(buffer), meas), R"({"value":null,"uncertainty":null,"unit":"m"})");
+
+    std::string body;
+    json::format_to(std::back_inserter(body), measurement_rss_t<kilogram_t<double>>{kilogram_t<double>{2.0}, kilogram_t<double>{std::numeric_limits<double>::infinity()}});
+    EXPECT_EQ(body, R"({"value":2,"uncertainty":null,"unit":"kg"})");
+}
+
+TEST_F(JsonBufferTest, format_to_appends_through_an_output_iterator)
+{
+    std::string body = "[";
+    json::format_to(std::back_inserter(body), meter_t<double>{1.0});
+    body += ",";
+    json::format_to(std::back_inserter(body), measurement_rss_t<kilogram_t<double>>{kilogram_t<double>{2.0}, kilogram_t<double>{0.5}});
+    body += "]";
+    EXPECT_EQ(body, R"([{"value":1,"unit":"m"},{"value":2,"uncertainty":0.5,"unit":"kg"}])");
+}
+
+TEST_F(JsonBufferTest, deserialize_does_not_clobber_a_serialized_view)
+{
+    auto json_str = json::serialize_unit_to_json_string(meter_t<double>{3.0});
+    auto parsed = json::deserialize_unit_from_json_string<kilometer_t<double>>(std::string_view{R"({"value":2,"unit":"km"})"});
+    ASSERT_TRUE(parsed);
+    EXPECT_DOUBLE_EQ(parsed->value(), 2.0);
+    EXPECT_EQ(json_str, R"({"value":3,"unit":"m"})");
+}
+
+// ============================================================================
+// Concurrency
+// ============================================================================
+
+TEST_F(JsonBufferTest, threads_serialize_concurrently)
+{
+    constexpr int thread_count = 4;
+    constexpr int iterations = 2000;
+    std::vector<int> mismatches(thread_count, 0);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < thread_count; ++t)
+    {
+        workers.emplace_back(
+            [t, &mismatches]
+            {
+                const meter_t<double> value{static_cast<double>(t)};
+                const std::string expected = "{\"value\":" + std::to_string(t) + ",\"unit\":\"m\"}";
+                std::array<char, 64> buffer{};
+                for (int i = 0; i < iterations; ++i)
+                {
+                    if (json::serialize_to(std::span<char>(buffer), value) != expected)
+                    {
+                        ++mismatches[static_cast<std::size_t>(t)];
+                    }
+                    // The default thread-local format buffer is private to this thread as well
+                    if (json::serialize_unit_to_json_string(value) != expected)
+                    {
+                        ++mismatches[static_cast<std::size_t>(t)];
+                    }
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (int count : mismatches)
+    {
+        EXPECT_EQ(count, 0);
+    }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/json/json_stream.h>
+
+using namespace pkr::units;
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+class JsonStreamTest : public ::testing::Test
+{
+};
+
+TEST_F(JsonStreamTest, arrays_carry_the_unit_once)
+{
+    std::vector<kilometer_t<double>> distances{kilometer_t<double>{1.5}, kilometer_t<double>{2.0}, kilometer_t<double>{-0.25}};
+    std::string body;
+    json::write_array(std::back_inserter(body), distances);
+    EXPECT_EQ(body, R"({"unit":"km","values":[1.5,2,-0.25]})");
+
+    std::string empty;
+    json::write_array(std::back_inserter(empty), std::vector<meter_t<double>>{});
+    EXPECT_EQ(empty, R"({"unit":"m","values":[]})");
+}
+
+TEST_F(JsonStreamTest, measurements_and_series_are_written_as_rows)
+{
+    std::string body;
+    auto writer = json::make_array_writer<measurement_lin_t<meter_t<double>>>(std::back_inserter(body));
+    writer.write(measurement_lin_t<meter_t<double>>{meter_t<double>{5.0}, meter_t<double>{0.1}});
+    writer.write(measurement_lin_t<meter_t<double>>{meter_t<double>{std::nan("")}, meter_t<double>{0.2}});
+    writer.finish();
+    EXPECT_EQ(body, R"({"unit":"m","values":[[5,0.1],[null,0.2]]})");
+
+    std::ostringstream stream;
+    auto series = json::make_series_writer<second_t<double>, kelvin_t<double>>(std::ostreambuf_iterator<char>(stream));
+    series.write(second_t<double>{0.0}, kelvin_t<double>{293.15});
+    series.write(second_t<double>{0.5}, kelvin_t<double>{294.0});
+    series.finish();
+    EXPECT_EQ(stream.str(), R"({"time_unit":"s","unit":"K","values":[[0,293.15],[0.5,294]]})");
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+TEST_F(JsonStreamTest, arrays_round_trip_with_unit_conversion)
+{
+    auto meters = json::read_array<meter_t<double>>(R"( { "unit" : "km", "values" : [ 1.5 , 2e-3, null ] } )");
+    ASSERT_TRUE(meters);
+    ASSERT_EQ(meters->size(), 3u);
+    EXPECT_DOUBLE_EQ((*meters)[0].value(), 1500.0);
+    EXPECT_DOUBLE_EQ((*meters)[1].value(), 2.0);
+    EXPECT_TRUE(std::isnan((*meters)[2].value()));
+
+    auto speeds = json::read_array<meter_per_second_t<double>>(R"({"note":{"a":[1,"]"]},"unit":"km/h","values":[36]})");
+    ASSERT_TRUE(speeds);
+    EXPECT_DOUBLE_EQ((*speeds)[0].value(), 10.0);
+}
+
+TEST_F(JsonStreamTest, measurement_uncertainty_takes_scale_but_not_offset)
+{
+    auto temperatures = json::read_array<measurement_lin_t<kelvin_t<double>>>(R"({"unit":"°C","values":[[20,0.5]]})");
+    ASSERT_TRUE(temperatures);
+    EXPECT_DOUBLE_EQ((*temperatures)[0].value(), 293.15);
+    EXPECT_DOUBLE_EQ((*temperatures)[0].uncertainty(), 0.5);
+}
+
+TEST_F(JsonStreamTest, series_round_trip)
+{
+    std::string body;
+    auto writer = json::make_series_writer<millisecond_t<double>, measurement_rss_t<meter_t<double>>>(std::back_inserter(body));
+    for (int i = 0; i < 100; ++i)
+    {
+        writer.write(millisecond_t<double>{static_cast<double>(i)}, measurement_rss_t<meter_t<double>>{meter_t<double>{i * 0.5}, meter_t<double>{0.01}});
+    }
+    writer.finish();
+
+    auto samples = json::read_series<second_t<double>, measurement_rss_t<meter_t<double>>>(body);
+    ASSERT_TRUE(samples);
+    ASSERT_EQ(samples->size(), 100u);
+    EXPECT_DOUBLE_EQ((*samples)[10].first.value(), 0.01);
+    EXPECT_DOUBLE_EQ((*samples)[10].second.value(), 5.0);
+    EXPECT_DOUBLE_EQ((*samples)[99].second.uncertainty(), 0.01);
+}
+
+TEST_F(JsonStreamTest, byte_at_a_time_matches_whole_document)
+{
+    std::string body;
+    auto writer = json::make_array_writer<meter_t<double>>(std::back_inserter(body));
+    for (int i = 0; i < 500; ++i)
+    {
+        writer.write(meter_t<double>{i * 1.25e-3});
+    }
+    writer.finish();
+
+    json::stream_reader<millimeter_t<double>> reader;
+    std::vector<double> values;
+    for (char c : body)
+    {
+        auto fed = reader.feed(std::string_view(&c, 1), [&](millimeter_t<double> mm) { values.push_back(mm.value()); });
+        ASSERT_TRUE(fed);
+    }
+    auto total = reader.finish();
+    ASSERT_TRUE(total);
+    EXPECT_EQ(*total, 500u);
+    ASSERT_EQ(values.size(), 500u);
+    EXPECT_DOUBLE_EQ(values[400], 500.0);
+}
+
+TEST_F(JsonStreamTest, reports_errors_with_offsets)
+{
+    auto bad_number = json::read_array<meter_t<double>>(R"({"unit":"m","values":[1,2x]})");
+    ASSERT_FALSE(bad_number);
+    EXPECT_EQ(bad_number.error().code, json::stream_error_code::numeric_parse_error);
+    EXPECT_EQ(bad_number.error().offset, 24u);
+
+    auto wrong_dimension = json::read_array<meter_t<double>>(R"({"unit":"s","values":[1]})");
+    ASSERT_FALSE(wrong_dimension);
+    EXPECT_EQ(wrong_dimension.error().code, json::stream_error_code::dimension_mismatch);
+
+    auto unknown = json::read_array<meter_t<double>>(R"({"unit":"cubit","values":[1]})");
+    ASSERT_FALSE(unknown);
+    EXPECT_EQ(unknown.error().code, json::stream_error_code::unknown_unit);
+
+    auto unit_last = json::read_array<meter_t<double>>(R"({"values":[1],"unit":"m"})");
+    ASSERT_FALSE(unit_last);
+    EXPECT_EQ(unit_last.error().code, json::stream_error_code::missing_unit);
+
+    auto short_row = json::read_array<measurement_lin_t<meter_t<double>>>(R"({"unit":"m","values":[[1]]})");
+    ASSERT_FALSE(short_row);
+    EXPECT_EQ(short_row.error().code, json::stream_error_code::malformed);
+
+    auto truncated = json::read_array<meter_t<double>>(R"({"unit":"m","values":[1,2)");
+    ASSERT_FALSE(truncated);
+    EXPECT_EQ(truncated.error().code, json::stream_error_code::incomplete);
+}
@@ -0,0 +1,298 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/math/dimensioned_matrix.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class DimensionedMatrixTest : public Test
+{
+};
+
+using state_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>, pkr::units::meter_per_second_t<double>>;
+using state_dims = state_t::row_dimensions;
+using covariance_t = pkr::units::covariance_matrix_t<double, state_dims>;
+using transition_t = pkr::units::jacobian_matrix_t<double, state_dims, state_dims>;
+
+// Large estimator state: alternating position and velocity components
+template <std::size_t... index_v>
+auto alternating_dims(std::index_sequence<index_v...>)
+    -> pkr::units::dimension_list<(index_v % 2 == 0 ? pkr::units::length_dimension : pkr::units::velocity_dimension)...>;
+
+using large_dims = decltype(alternating_dims(std::make_index_sequence<200>{}));
+using large_covariance_t = pkr::units::covariance_matrix_t<double, large_dims>;
+using large_transition_t = pkr::units::jacobian_matrix_t<double, large_dims, large_dims>;
+
+// ============================================================================
+// Element types
+// ============================================================================
+
+TEST_F(DimensionedMatrixTest, element_types_follow_row_and_column_dimensions)
+{
+    static_assert(std::is_same_v<state_t::element_type<0>, pkr::units::meter_t<double>>);
+    static_assert(std::is_same_v<state_t::element_type<1>, pkr::units::meter_per_second_t<double>>);
+    static_assert(std::is_same_v<transition_t::element_type<0, 1>, pkr::units::second_t<double>>);
+    static_assert(covariance_t::element_dimension<0, 0> == pkr::units::dimension_t{2, 0, 0, 0, 0, 0, 0, 0});
+    static_assert(covariance_t::element_dimension<1, 1> == pkr::units::dimension_t{2, 0, -2, 0, 0, 0, 0, 0});
+    SUCCEED();
+}
+
+TEST_F(DimensionedMatrixTest, make_unit_vector_converts_to_si)
+{
+    const auto x = pkr::units::make_unit_vector(pkr::units::kilometer_t<double>{1.5}, pkr::units::meter_per_second_t<double>{2.0});
+    static_assert(std::is_same_v<std::remove_const_t<decltype(x)>, pkr::units::unit_vector_t<pkr::units::kilometer_t<double>, pkr::units::meter_per_second_t<double>>>);
+    EXPECT_DOUBLE_EQ(x.get<0>().value(), 1500.0);
+    EXPECT_DOUBLE_EQ(x.get<1>().value(), 2.0);
+}
+
+TEST_F(DimensionedMatrixTest, set_converts_units)
+{
+    transition_t f = transition_t::identity();
+    f.set<0, 1>(pkr::units::millisecond_t<double>{250.0});
+    EXPECT_DOUBLE_EQ((f.get<0, 1>().value()), 0.25);
+    EXPECT_DOUBLE_EQ(f.si_element(0, 0), 1.0);
+    EXPECT_DOUBLE_EQ(f.si_element(1, 0), 0.0);
+}
+
+// ============================================================================
+// Algebra
+// ============================================================================
+
+TEST_F(DimensionedMatrixTest, product_propagates_dimensions)
+{
+    transition_t f = transition_t::identity();
+    f.set<0, 1>(pkr::units::second_t<double>{2.0});
+    const auto x = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{3.0});
+
+    const auto x_next = f * x;
+    static_assert(std::is_same_v<std::remove_const_t<decltype(x_next)>, state_t>);
+    EXPECT_DOUBLE_EQ(x_next.get<0>().value(), 7.0);
+    EXPECT_DOUBLE_EQ(x_next.get<1>().value(), 3.0);
+}
+
+TEST_F(DimensionedMatrixTest, covariance_propagation_keeps_type)
+{
+    transition_t f = transition_t::identity();
+    f.set<0, 1>(pkr::units::second_t<double>{1.0});
+    const covariance_t p{covariance_t::array_type{1.0, 0.0, 0.0, 1.0}};
+
+    const auto p_next = f * p * pkr::units::transpose(f);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(p_next)>, covariance_t>);
+    EXPECT_DOUBLE_EQ(p_next.si_element(0, 0), 2.0);
+    EXPECT_DOUBLE_EQ(p_next.si_element(0, 1), 1.0);
+    EXPECT_DOUBLE_EQ(p_next.si_element(1, 0), 1.0);
+    EXPECT_DOUBLE_EQ(p_next.si_element(1, 1), 1.0);
+}
+
+TEST_F(DimensionedMatrixTest, outer_product_is_a_covariance)
+{
+    const auto x = pkr::units::make_unit_vector(pkr::units::meter_t<double>{2.0}, pkr::units::meter_per_second_t<double>{3.0});
+    const covariance_t outer = x * pkr::units::transpose(x);
+    EXPECT_DOUBLE_EQ(outer.si_element(0, 1), 6.0);
+    EXPECT_DOUBLE_EQ((outer.get<1, 1>().value()), 9.0);
+}
+
+TEST_F(DimensionedMatrixTest, inverse_swaps_rows_and_columns)
+{
+    covariance_t p{covariance_t::array_type{4.0, 1.0, 1.0, 3.0}};
+    const auto p_inv = pkr::units::inverse(p);
+    const auto product = p * p_inv;
+    static_assert(std::is_same_v<std::remove_const_t<decltype(product)>, transition_t>);
+
+    EXPECT_NEAR(product.si_element(0, 0), 1.0, 1e-12);
+    EXPECT_NEAR(product.si_element(0, 1), 0.0, 1e-12);
+    EXPECT_NEAR(product.si_element(1, 0), 0.0, 1e-12);
+    EXPECT_NEAR(product.si_element(1, 1), 1.0, 1e-12);
+}
+
+TEST_F(DimensionedMatrixTest, inverse_of_singular_matrix_throws)
+{
+    covariance_t p{covariance_t::array_type{1.0, 2.0, 2.0, 4.0}};
+    EXPECT_THROW(static_cast<void>(pkr::units::inverse(p)), std::invalid_argument);
+}
+
+TEST_F(DimensionedMatrixTest, vec_3d_round_trip)
+{
+    const pkr::units::vec_3d_units_t<pkr::units::meter_t<double>> v{
+        pkr::units::meter_t<double>{1.0}, pkr::units::meter_t<double>{2.0}, pkr::units::meter_t<double>{3.0}};
+    const auto dv = pkr::units::make_unit_vector(v);
+    const auto back = pkr::units::to_vec_3d_units<0>(dv);
+    EXPECT_DOUBLE_EQ(back.x.value(), 1.0);
+    EXPECT_DOUBLE_EQ(back.y.value(), 2.0);
+    EXPECT_DOUBLE_EQ(back.z.value(), 3.0);
+}
+
+TEST_F(DimensionedMatrixTest, constexpr_evaluation)
+{
+    constexpr auto result = []()
+    {
+        transition_t f = transition_t::identity();
+        f.set<0, 1>(pkr::units::second_t<double>{0.5});
+        const auto x = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{4.0});
+        return (pkr::units::inverse(f) * (f * x)).si_element(0, 0);
+    }();
+    static_assert(result == 1.0);
+    EXPECT_DOUBLE_EQ(result, 1.0);
+}
+
+// ============================================================================
+// Large matrices
+// ============================================================================
+
+TEST_F(DimensionedMatrixTest, large_matrices_use_heap_storage)
+{
+    static_assert(std::is_same_v<covariance_t::array_type, std::array<double, 4>>);
+    static_assert(!large_covariance_t::nothrow_storage);
+    static_assert(sizeof(large_covariance_t) < 64);
+
+    large_covariance_t p = large_covariance_t::zero();
+    p.si_element(199, 3) = 2.5;
+    const large_covariance_t copy = p;
+    EXPECT_DOUBLE_EQ(copy.si_element(199, 3), 2.5);
+    EXPECT_TRUE(copy == p);
+    p.si_element(0, 0) = 1.0;
+    EXPECT_FALSE(copy == p);
+    static_assert(large_covariance_t::element_dimension<1, 1> == pkr::units::dimension_t{2, 0, -2, 0, 0, 0, 0, 0, 0});
+}
+
+TEST_F(DimensionedMatrixTest, moved_from_large_matrix_stays_usable)
+{
+    large_covariance_t p = large_covariance_t::zero();
+    p.si_element(5, 7) = 3.0;
+
+    const large_covariance_t moved = std::move(p);
+    EXPECT_DOUBLE_EQ(moved.si_element(5, 7), 3.0);
+    EXPECT_DOUBLE_EQ(p.si_element(5, 7), 0.0); // zero after move construction
+    EXPECT_TRUE(p == large_covariance_t::zero());
+    const large_covariance_t copy = p;
+    EXPECT_TRUE(copy == p);
+
+    large_covariance_t q = large_covariance_t::zero();
+    q = std::move(p);
+    p.si_element(0, 0) = 1.0;
+    EXPECT_DOUBLE_EQ(p.si_element(0, 0), 1.0);
+    EXPECT_TRUE(q == large_covariance_t::zero());
+}
+
+namespace
+{
+
+std::size_t live_allocations = 0;
+
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++live_allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        --live_allocations;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept
+    {
+        return true;
+    }
+};
+
+} // namespace
+
+TEST_F(DimensionedMatrixTest, heap_storage_allocates_through_its_allocator)
+{
+    using buffer_t = pkr::units::details::heap_array<double, 2048, counting_allocator<double>>;
+    {
+        buffer_t a{1.0, 2.0};
+        EXPECT_EQ(live_allocations, 1u);
+        buffer_t b = a;
+        buffer_t c = std::move(a);
+        EXPECT_EQ(live_allocations, 3u);
+        b = std::move(c);
+        EXPECT_EQ(live_allocations, 3u);
+        EXPECT_DOUBLE_EQ(b[1], 2.0);
+        EXPECT_DOUBLE_EQ(b[2047], 0.0);
+    }
+    EXPECT_EQ(live_allocations, 0u);
+}
+
+namespace
+{
+
+// The built-in kernel reproduces the triple loop bit for bit; an Eigen/BLAS backend picks its own summation order
+void expect_product_element(double actual, double expected)
+{
+    if constexpr (pkr::units::linalg_backend_name == "builtin")
+    {
+        EXPECT_EQ(actual, expected);
+    }
+    else
+    {
+        EXPECT_NEAR(actual, expected, 1e-12);
+    }
+}
+
+} // namespace
+
+TEST_F(DimensionedMatrixTest, blocked_product_matches_triple_loop)
+{
+    std::mt19937 rng{7};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+    large_transition_t f = large_transition_t::identity();
+    large_covariance_t p{};
+    for (auto& v : f.si_elements())
+    {
+        v += 0.01 * dist(rng);
+    }
+    for (auto& v : p.si_elements())
+    {
+        v = dist(rng);
+    }
+
+    const auto fp = f * p;
+    static_assert(std::is_same_v<std::remove_const_t<decltype(fp)>, pkr::units::jacobian_matrix_t<double, large_dims, pkr::units::details::negate_dimension_list<large_dims>::type>>);
+    for (std::size_t i = 0; i < 200; i += 13)
+    {
+        for (std::size_t j = 0; j < 200; j += 7)
+        {
+            double expected = 0.0;
+            for (std::size_t k = 0; k < 200; ++k)
+            {
+                expected += f.si_element(i, k) * p.si_element(k, j);
+            }
+            expect_product_element(fp.si_element(i, j), expected);
+        }
+    }
+
+    // F P F^T keeps the covariance type at full size
+    const large_covariance_t propagated = fp * pkr::units::transpose(f);
+    double expected = 0.0;
+    for (std::size_t k = 0; k < 200; ++k)
+    {
+        expected += fp.si_element(10, k) * f.si_element(11, k);
+    }
+    expect_product_element(propagated.si_element(10, 11), expected);
+}
+
+} // namespace test
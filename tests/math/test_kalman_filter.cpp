@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/math/kalman_filter.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class KalmanFilterTest : public Test
+{
+};
+
+using state_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>, pkr::units::meter_per_second_t<double>>;
+using measurement_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>>;
+using filter_t = pkr::units::kalman_filter_t<state_t, measurement_t>;
+
+namespace
+{
+
+constexpr filter_t::transition_type constant_velocity(double dt)
+{
+    filter_t::transition_type f = filter_t::transition_type::identity();
+    f.set<0, 1>(pkr::units::second_t<double>{dt});
+    return f;
+}
+
+constexpr filter_t::observation_type position_observation()
+{
+    filter_t::observation_type h{};
+    h.si_element(0, 0) = 1.0;
+    return h;
+}
+
+constexpr filter_t::measurement_noise_type position_noise(double variance)
+{
+    return filter_t::measurement_noise_type{filter_t::measurement_noise_type::array_type{variance}};
+}
+
+constexpr filter_t::covariance_type diagonal_covariance(double p_position, double p_velocity)
+{
+    return filter_t::covariance_type{filter_t::covariance_type::array_type{p_position, 0.0, 0.0, p_velocity}};
+}
+
+} // namespace
+
+// ============================================================================
+// Linear filter
+// ============================================================================
+
+TEST_F(KalmanFilterTest, model_types)
+{
+    static_assert(filter_t::gain_type::element_dimension<1, 0> == pkr::units::dimension_t{0, 0, -1, 0, 0, 0, 0, 0});
+    static_assert(std::is_same_v<filter_t::observation_type::element_type<0, 1>, pkr::units::second_t<double>>);
+    static_assert(filter_t::covariance_type::element_dimension<0, 0> == pkr::units::dimension_t{2, 0, 0, 0, 0, 0, 0, 0});
+    SUCCEED();
+}
+
+TEST_F(KalmanFilterTest, predict_moves_state_and_grows_covariance)
+{
+    filter_t kf{pkr::units::make_unit_vector(pkr::units::meter_t<double>{0.0}, pkr::units::meter_per_second_t<double>{2.0}), diagonal_covariance(1.0, 1.0)};
+    kf.predict(constant_velocity(0.5), filter_t::process_noise_type{});
+
+    EXPECT_DOUBLE_EQ(kf.state().get<0>().value(), 1.0);
+    EXPECT_DOUBLE_EQ(kf.state().get<1>().value(), 2.0);
+    EXPECT_DOUBLE_EQ(kf.covariance().si_element(0, 0), 1.25);
+    EXPECT_DOUBLE_EQ(kf.covariance().si_element(0, 1), 0.5);
+}
+
+TEST_F(KalmanFilterTest, update_blends_prediction_and_measurement)
+{
+    filter_t kf{pkr::units::make_unit_vector(pkr::units::meter_t<double>{0.0}, pkr::units::meter_per_second_t<double>{0.0}), diagonal_covariance(1.0, 1.0)};
+    kf.update(pkr::units::make_unit_vector(pkr::units::meter_t<double>{2.0}), position_observation(), position_noise(1.0));
+
+    // Equal variances: the estimate lands halfway and the position variance halves
+    EXPECT_DOUBLE_EQ(kf.state().get<0>().value(), 1.0);
+    EXPECT_DOUBLE_EQ(kf.state().get<1>().value(), 0.0);
+    EXPECT_DOUBLE_EQ(kf.covariance().si_element(0, 0), 0.5);
+    EXPECT_DOUBLE_EQ(kf.covariance().si_element(1, 1), 1.0);
+    EXPECT_DOUBLE_EQ(kf.innovation().si_element(0, 0), 2.0);
+    EXPECT_DOUBLE_EQ(kf.normalized_innovation_squared(), 2.0);
+}
+
+TEST_F(KalmanFilterTest, tracks_constant_velocity_target)
+{
+    filter_t kf{pkr::units::make_unit_vector(pkr::units::meter_t<double>{0.0}, pkr::units::meter_per_second_t<double>{0.0}), diagonal_covariance(100.0, 100.0)};
+    const auto f = constant_velocity(1.0);
+    const auto h = position_observation();
+    const auto r = position_noise(0.01);
+
+    for (int step = 1; step <= 20; ++step)
+    {
+        kf.predict(f, filter_t::process_noise_type{});
+        kf.update(pkr::units::make_unit_vector(pkr::units::meter_t<double>{3.0 * step}), h, r);
+    }
+
+    const auto velocity = kf.estimate<1>();
+    static_assert(std::is_same_v<decltype(velocity), const pkr::units::measurement_rss_t<pkr::units::meter_per_second_t<double>>>);
+    EXPECT_NEAR(velocity.value(), 3.0, 1e-4);
+    EXPECT_LT(velocity.uncertainty(), 0.05);
+    EXPECT_NEAR(kf.estimate<0>().value(), 60.0, 1e-4);
+}
+
+TEST_F(KalmanFilterTest, constexpr_filter_step)
+{
+    constexpr double position = []()
+    {
+        filter_t kf{pkr::units::make_unit_vector(pkr::units::meter_t<double>{0.0}, pkr::units::meter_per_second_t<double>{1.0}), diagonal_covariance(1.0, 1.0)};
+        kf.predict(constant_velocity(1.0), filter_t::process_noise_type{});
+        kf.update(pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}), position_observation(), position_noise(1.0));
+        return kf.state().si_element(0, 0);
+    }();
+    static_assert(position == 1.0);
+    EXPECT_DOUBLE_EQ(position, 1.0);
+}
+
+// ============================================================================
+// Extended filter
+// ============================================================================
+
+TEST_F(KalmanFilterTest, extended_filter_with_range_measurement)
+{
+    // Position on a line observed through its range from a sensor 3 m off the line
+    using ekf_t = pkr::units::extended_kalman_filter_t<state_t, measurement_t>;
+    ekf_t ekf{pkr::units::make_unit_vector(pkr::units::meter_t<double>{3.5}, pkr::units::meter_per_second_t<double>{0.0}), diagonal_covariance(1.0, 0.01)};
+
+    const auto range = [](const state_t& x)
+    {
+        const double p = x.si_element(0, 0);
+        return pkr::units::make_unit_vector(pkr::units::meter_t<double>{std::sqrt((p * p) + 9.0)});
+    };
+    const auto range_jacobian = [](const state_t& x)
+    {
+        const double p = x.si_element(0, 0);
+        ekf_t::observation_type h{};
+        h.si_element(0, 0) = p / std::sqrt((p * p) + 9.0);
+        return h;
+    };
+    const auto identity_motion = [](const state_t& x) { return x; };
+    const auto identity_jacobian = [](const state_t&) { return ekf_t::transition_type::identity(); };
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ekf.predict(identity_motion, identity_jacobian, ekf_t::process_noise_type{});
+        ekf.update(pkr::units::make_unit_vector(pkr::units::meter_t<double>{5.0}), range, range_jacobian, position_noise(0.01));
+    }
+    EXPECT_NEAR(ekf.state().get<0>().value(), 4.0, 1e-3);
+}
+
+// ============================================================================
+// Batched filter
+// ============================================================================
+
+TEST_F(KalmanFilterTest, batch_matches_single_track_filter)
+{
+    constexpr std::size_t tracks = 37;
+    using batch_t = pkr::units::kalman_filter_batch_t<state_t, measurement_t>;
+    batch_t batch{tracks};
+    std::vector<filter_t> reference;
+
+    for (std::size_t t = 0; t < tracks; ++t)
+    {
+        const auto x0 = pkr::units::make_unit_vector(
+            pkr::units::meter_t<double>{static_cast<double>(t)}, pkr::units::meter_per_second_t<double>{0.1 * static_cast<double>(t)});
+        const auto p0 = diagonal_covariance(1.0 + static_cast<double>(t), 2.0);
+        batch.set_track(t, x0, p0);
+        reference.emplace_back(x0, p0);
+    }
+
+    filter_t::process_noise_type q{filter_t::process_noise_type::array_type{0.01, 0.0, 0.0, 0.02}};
+    const auto f = constant_velocity(0.1);
+    const auto h = position_observation();
+    const auto r = position_noise(0.25);
+
+    std::vector<measurement_t> z(tracks);
+    for (int step = 0; step < 5; ++step)
+    {
+        batch.predict(f, q);
+        for (std::size_t t = 0; t < tracks; ++t)
+        {
+            z[t] = pkr::units::make_unit_vector(pkr::units::meter_t<double>{static_cast<double>(t) + (0.3 * step)});
+            reference[t].predict(f, q);
+            reference[t].update(z[t], h, r);
+        }
+        batch.update(z, h, r);
+    }
+
+    for (std::size_t t = 0; t < tracks; ++t)
+    {
+        const auto x = batch.state(t);
+        const auto p = batch.covariance(t);
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            EXPECT_NEAR(x.si_element(i, 0), reference[t].state().si_element(i, 0), 1e-12);
+            for (std::size_t j = 0; j < 2; ++j)
+            {
+                EXPECT_NEAR(p.si_element(i, j), reference[t].covariance().si_element(i, j), 1e-12);
+            }
+        }
+        EXPECT_NEAR(batch.estimate<0>(t).uncertainty(), reference[t].estimate<0>().uncertainty(), 1e-12);
+    }
+}
+
+TEST_F(KalmanFilterTest, batch_rejects_invalid_input)
+{
+    pkr::units::kalman_filter_batch_t<state_t, measurement_t> batch{4};
+    std::vector<measurement_t> z(3);
+    EXPECT_THROW(batch.update(z, position_observation(), position_noise(1.0)), std::invalid_argument);
+
+    z.resize(4);
+    EXPECT_THROW(batch.update(z, position_observation(), position_noise(0.0)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(batch.state(4)), std::out_of_range);
+}
+
+} // namespace test
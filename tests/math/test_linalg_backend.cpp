@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/math/linear_solvers.h>
+#include <pkr_units/units/math/linalg_backend.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class LinalgBackendTest : public Test
+{
+};
+
+using state_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>, pkr::units::meter_per_second_t<double>>;
+using covariance_t = pkr::units::covariance_matrix_t<double, state_t::row_dimensions>;
+
+template <std::size_t... index_v>
+auto alternating_dims(std::index_sequence<index_v...>)
+    -> pkr::units::dimension_list<(index_v % 2 == 0 ? pkr::units::length_dimension : pkr::units::velocity_dimension)...>;
+
+using large_dims = decltype(alternating_dims(std::make_index_sequence<96>{}));
+using large_covariance_t = pkr::units::covariance_matrix_t<double, large_dims>;
+using large_transition_t = pkr::units::jacobian_matrix_t<double, large_dims, large_dims>;
+
+// ============================================================================
+// Views
+// ============================================================================
+
+TEST_F(LinalgBackendTest, backend_name_is_known)
+{
+    EXPECT_TRUE(
+        pkr::units::linalg_backend_name == "builtin" || pkr::units::linalg_backend_name == "eigen" || pkr::units::linalg_backend_name == "blas");
+}
+
+TEST_F(LinalgBackendTest, dimensioned_matrix_view_aliases_storage)
+{
+    covariance_t p{covariance_t::array_type{4.0, 2.0, 2.0, 5.0}};
+    const auto view = pkr::units::si_view(p);
+    EXPECT_EQ(view.data, p.si_elements().data());
+    EXPECT_EQ(view.rows, 2u);
+    EXPECT_EQ(view.cols, 2u);
+    EXPECT_EQ(view.leading_dimension, 2u);
+
+    view.data[3] = 6.0;
+    EXPECT_EQ(p.si_element(1, 1), 6.0);
+}
+
+TEST_F(LinalgBackendTest, unit_matrix_views_expose_si_values)
+{
+    using m_t = pkr::units::meter_t<double>;
+    const m_t z{0.0};
+    pkr::units::matrix_3d_units_t<m_t> m{{{{z, z, z}, {z, z, m_t{7.0}}, {z, z, z}}}};
+    const auto view = pkr::units::si_view(m);
+    EXPECT_EQ(view.data[(1 * view.leading_dimension) + 2], 7.0);
+    view.data[0] = 2.0;
+    EXPECT_EQ(m(0, 0).value(), 2.0);
+
+    const pkr::units::matrix_4d_units_t<m_t> m4{{{{m_t{1.0}, z, z, z}, {z, m_t{1.0}, z, z}, {z, z, m_t{1.0}, z}, {z, z, z, m_t{1.0}}}}};
+    const auto view4 = pkr::units::si_view(m4);
+    EXPECT_EQ(view4.rows, 4u);
+    EXPECT_EQ(view4.data[5], 1.0);
+    EXPECT_EQ(view4.data[6], 0.0);
+}
+
+TEST_F(LinalgBackendTest, unit_array_view_reshapes_and_checks_size)
+{
+    std::vector<pkr::units::meter_t<double>> values(6, pkr::units::meter_t<double>{0.0});
+    values[4] = pkr::units::meter_t<double>{3.0};
+
+    const auto view = pkr::units::si_view(std::span{values}, 2, 3);
+    EXPECT_EQ(view.data[(1 * view.leading_dimension) + 1], 3.0);
+    view.data[0] = 1.5;
+    EXPECT_EQ(values[0].value(), 1.5);
+
+    EXPECT_THROW(static_cast<void>(pkr::units::si_view(std::span{values}, 4, 2)), std::invalid_argument);
+}
+
+// ============================================================================
+// Products and solves on the selected backend
+// ============================================================================
+
+TEST_F(LinalgBackendTest, gemm_on_views_honours_leading_dimension)
+{
+    // A is the left 2x2 block of a 2x3 buffer
+    const std::array<double, 6> a{1.0, 2.0, 99.0, 3.0, 4.0, 99.0};
+    const std::array<double, 4> b{5.0, 6.0, 7.0, 8.0};
+    std::array<double, 4> c{1.0, 1.0, 1.0, 1.0};
+
+    pkr::units::gemm(
+        pkr::units::si_matrix_view<const double>{a.data(), 2, 2, 3},
+        pkr::units::si_matrix_view<const double>{b.data(), 2, 2, 2},
+        pkr::units::si_matrix_view<double>{c.data(), 2, 2, 2});
+    EXPECT_DOUBLE_EQ(c[0], 20.0);
+    EXPECT_DOUBLE_EQ(c[1], 23.0);
+    EXPECT_DOUBLE_EQ(c[2], 44.0);
+    EXPECT_DOUBLE_EQ(c[3], 51.0);
+
+    EXPECT_THROW(
+        pkr::units::gemm(
+            pkr::units::si_matrix_view<const double>{a.data(), 2, 3, 3},
+            pkr::units::si_matrix_view<const double>{b.data(), 2, 2, 2},
+            pkr::units::si_matrix_view<double>{c.data(), 2, 2, 2}),
+        std::invalid_argument);
+}
+
+TEST_F(LinalgBackendTest, large_product_keeps_dimensions_and_matches_reference)
+{
+    large_transition_t f{};
+    large_covariance_t p{};
+    constexpr std::size_t n = large_transition_t::row_count;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            f.si_element(i, j) = i == j ? 1.0 : 0.001 * static_cast<double>((i + (2 * j)) % 7);
+            p.si_element(i, j) = i == j ? 2.0 : 0.01 * static_cast<double>((i * j) % 5);
+        }
+    }
+
+    const large_covariance_t fp_ft = f * p * pkr::units::transpose(f);
+
+    std::array<double, n * n> fp{};
+    std::array<double, n * n> reference{};
+    pkr::units::details::gemm_blocked(f.si_elements().data(), p.si_elements().data(), fp.data(), n, n, n);
+    const auto ft = pkr::units::transpose(f);
+    pkr::units::details::gemm_blocked(fp.data(), ft.si_elements().data(), reference.data(), n, n, n);
+    for (std::size_t k = 0; k < n * n; ++k)
+    {
+        EXPECT_NEAR(fp_ft.si_elements()[k], reference[k], 1e-12);
+    }
+}
+
+TEST_F(LinalgBackendTest, lu_trailing_update_on_backend_solves_system)
+{
+    large_transition_t a{};
+    pkr::units::dimensioned_vector_t<double, large_dims> b{};
+    constexpr std::size_t n = large_transition_t::row_count;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            a.si_element(i, j) = i == j ? 4.0 : 1.0 / (1.0 + static_cast<double>(i + j));
+        }
+        b.si_element(i, 0) = static_cast<double>(i % 3);
+    }
+
+    const auto x = pkr::units::solve(a, b);
+    const auto ax = a * x;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        EXPECT_NEAR(ax.si_element(i, 0), b.si_element(i, 0), 1e-12);
+    }
+}
+
+#if defined(PKR_UNITS_LINALG_EIGEN)
+
+TEST_F(LinalgBackendTest, eigen_maps_share_storage)
+{
+    covariance_t p{covariance_t::array_type{4.0, 2.0, 2.0, 5.0}};
+    auto map = pkr::units::eigen_map(p);
+    EXPECT_EQ(map(0, 1), 2.0);
+    map(1, 0) = 3.0;
+    EXPECT_EQ(p.si_element(1, 0), 3.0);
+
+    state_t x{};
+    x.si_element(1, 0) = 2.0;
+    EXPECT_EQ(pkr::units::eigen_map(std::as_const(x))(1), 2.0);
+
+    const auto dynamic = pkr::units::eigen_map(pkr::units::si_view(std::as_const(p)));
+    EXPECT_EQ(dynamic.rows(), 2);
+    EXPECT_EQ(dynamic(1, 0), 3.0);
+}
+
+#endif
+
+} // namespace test
@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <pkr_units/si_units.h>
+#include <pkr_units/math/linear_solvers.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class LinearSolversTest : public Test
+{
+};
+
+using state_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>, pkr::units::meter_per_second_t<double>>;
+using positions_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>, pkr::units::meter_t<double>>;
+using observation_t = pkr::units::jacobian_matrix_t<double, positions_t::row_dimensions, state_t::row_dimensions>;
+using covariance_t = pkr::units::covariance_matrix_t<double, state_t::row_dimensions>;
+
+// Position samples at t = 0..4 s for a straight-line fit
+using samples_t = pkr::units::dimensioned_vector_t<
+    double,
+    pkr::units::dimension_list<
+        pkr::units::length_dimension,
+        pkr::units::length_dimension,
+        pkr::units::length_dimension,
+        pkr::units::length_dimension,
+        pkr::units::length_dimension>>;
+using line_model_t = pkr::units::jacobian_matrix_t<double, samples_t::row_dimensions, state_t::row_dimensions>;
+
+// Large estimator state: alternating position and velocity components
+template <std::size_t... index_v>
+auto alternating_dims(std::index_sequence<index_v...>)
+    -> pkr::units::dimension_list<(index_v % 2 == 0 ? pkr::units::length_dimension : pkr::units::velocity_dimension)...>;
+
+using large_dims = decltype(alternating_dims(std::make_index_sequence<300>{}));
+using large_state_t = pkr::units::dimensioned_vector_t<double, large_dims>;
+using large_covariance_t = pkr::units::covariance_matrix_t<double, large_dims>;
+using large_transition_t = pkr::units::jacobian_matrix_t<double, large_dims, large_dims>;
+
+namespace
+{
+
+// Two position fixes one and three seconds apart: p(t) = p0 + v t
+observation_t two_fixes()
+{
+    observation_t h{};
+    h.set<0, 0>(pkr::units::scalar_t<double>{1.0});
+    h.set<0, 1>(pkr::units::second_t<double>{1.0});
+    h.set<1, 0>(pkr::units::scalar_t<double>{1.0});
+    h.set<1, 1>(pkr::units::second_t<double>{3.0});
+    return h;
+}
+
+template <typename matrix_t>
+void fill_diagonally_dominant(matrix_t& m)
+{
+    constexpr std::size_t n = matrix_t::row_count;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            const double distance = i > j ? static_cast<double>(i - j) : static_cast<double>(j - i);
+            m.si_element(i, j) = i == j ? static_cast<double>(n) : 1.0 / (1.0 + distance);
+        }
+    }
+}
+
+large_state_t ramp_state()
+{
+    large_state_t b{};
+    for (std::size_t i = 0; i < large_state_t::row_count; ++i)
+    {
+        b.si_element(i, 0) = 1.0 + (0.01 * static_cast<double>(i));
+    }
+    return b;
+}
+
+} // namespace
+
+// ============================================================================
+// LU decomposition
+// ============================================================================
+
+TEST_F(LinearSolversTest, lu_solution_type_follows_matrix_and_rhs)
+{
+    positions_t b{};
+    b.set<0>(pkr::units::meter_t<double>{5.0});
+    b.set<1>(pkr::units::meter_t<double>{9.0});
+
+    const auto x = pkr::units::solve(two_fixes(), b);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(x)>, state_t>);
+    EXPECT_NEAR(x.get<0>().value(), 3.0, 1e-12);
+    EXPECT_NEAR(x.get<1>().value(), 2.0, 1e-12);
+}
+
+TEST_F(LinearSolversTest, lu_determinant_has_product_dimension)
+{
+    const pkr::units::lu_decomposition_t lu{two_fixes()};
+    static_assert(std::is_same_v<decltype(lu.determinant()), pkr::units::second_t<double>>);
+    EXPECT_NEAR(lu.determinant().value(), 2.0, 1e-12);
+}
+
+TEST_F(LinearSolversTest, lu_pivots_on_zero_leading_element)
+{
+    observation_t h{};
+    h.si_element(0, 1) = 1.0;
+    h.si_element(1, 0) = 1.0;
+    positions_t b{};
+    b.si_element(0, 0) = 4.0;
+    b.si_element(1, 0) = 7.0;
+
+    const pkr::units::lu_decomposition_t lu{h};
+    EXPECT_EQ(lu.pivots()[0], 1u);
+    EXPECT_NEAR(lu.determinant().value(), -1.0, 1e-12);
+    const auto x = lu.solve(b);
+    EXPECT_NEAR(x.si_element(0, 0), 7.0, 1e-12);
+    EXPECT_NEAR(x.si_element(1, 0), 4.0, 1e-12);
+}
+
+TEST_F(LinearSolversTest, lu_solves_multiple_right_hand_sides)
+{
+    using rhs_t = pkr::units::dimensioned_matrix_t<double, positions_t::row_dimensions, pkr::units::dimension_list<pkr::units::scalar_dimension, pkr::units::scalar_dimension>>;
+    rhs_t b{rhs_t::array_type{5.0, 1.0, 9.0, 3.0}};
+
+    const auto x = pkr::units::lu_decomposition_t{two_fixes()}.solve(b);
+    EXPECT_NEAR(x.si_element(0, 0), 3.0, 1e-12);
+    EXPECT_NEAR(x.si_element(1, 0), 2.0, 1e-12);
+    EXPECT_NEAR(x.si_element(0, 1), 0.0, 1e-12);
+    EXPECT_NEAR(x.si_element(1, 1), 1.0, 1e-12);
+}
+
+TEST_F(LinearSolversTest, lu_throws_on_singular_matrix)
+{
+    observation_t h{};
+    h.si_element(0, 0) = 1.0;
+    h.si_element(0, 1) = 2.0;
+    h.si_element(1, 0) = 2.0;
+    h.si_element(1, 1) = 4.0;
+    EXPECT_THROW(pkr::units::lu_decomposition_t{h}, std::invalid_argument);
+}
+
+TEST_F(LinearSolversTest, lu_blocked_large_system_matches_right_hand_side)
+{
+    large_transition_t a{};
+    fill_diagonally_dominant(a);
+    const large_state_t b = ramp_state();
+
+    pkr::units::work_stealing_pool pool{3};
+    const large_state_t x = pkr::units::lu_decomposition_t{a, pool}.solve(b);
+    const large_state_t ax = a * x;
+    for (std::size_t i = 0; i < large_state_t::row_count; ++i)
+    {
+        EXPECT_NEAR(ax.si_element(i, 0), b.si_element(i, 0), 1e-12);
+    }
+
+    const large_state_t serial = pkr::units::solve(a, b);
+    EXPECT_EQ(serial, x);
+}
+
+// ============================================================================
+// Cholesky decomposition
+// ============================================================================
+
+TEST_F(LinearSolversTest, cholesky_factor_and_solve_covariance)
+{
+    const covariance_t p{covariance_t::array_type{4.0, 2.0, 2.0, 5.0}};
+    const pkr::units::cholesky_decomposition_t chol{p};
+
+    const auto& l = chol.si_factor();
+    EXPECT_NEAR(l[0], 2.0, 1e-12);
+    EXPECT_EQ(l[1], 0.0);
+    EXPECT_NEAR(l[2], 1.0, 1e-12);
+    EXPECT_NEAR(l[3], 2.0, 1e-12);
+
+    state_t b{};
+    b.set<0>(pkr::units::meter_t<double>{2.0});
+    b.set<1>(pkr::units::meter_per_second_t<double>{1.0});
+    const auto x = chol.solve(b);
+    const auto expected = pkr::units::solve(p, b);
+    static_assert(std::is_same_v<decltype(x), decltype(expected)>);
+    EXPECT_NEAR(x.si_element(0, 0), expected.si_element(0, 0), 1e-12);
+    EXPECT_NEAR(x.si_element(1, 0), expected.si_element(1, 0), 1e-12);
+}
+
+TEST_F(LinearSolversTest, cholesky_squared_mahalanobis_is_dimensionless)
+{
+    const covariance_t p{covariance_t::array_type{4.0, 2.0, 2.0, 5.0}};
+    state_t r{};
+    r.set<0>(pkr::units::meter_t<double>{2.0});
+    r.set<1>(pkr::units::meter_per_second_t<double>{1.0});
+
+    const auto d2 = pkr::units::cholesky_decomposition_t{p}.squared_mahalanobis(r);
+    static_assert(pkr::units::details::is_pkr_unit<std::remove_const_t<decltype(d2)>>::value_dimension == pkr::units::scalar_dimension);
+    EXPECT_NEAR(d2.value(), 1.0, 1e-12);
+}
+
+TEST_F(LinearSolversTest, cholesky_throws_when_not_positive_definite)
+{
+    const covariance_t p{covariance_t::array_type{1.0, 2.0, 2.0, 1.0}};
+    EXPECT_THROW(pkr::units::cholesky_decomposition_t{p}, std::invalid_argument);
+}
+
+TEST_F(LinearSolversTest, cholesky_blocked_large_covariance_matches_lu)
+{
+    large_covariance_t p{};
+    fill_diagonally_dominant(p);
+    const large_state_t b = ramp_state();
+
+    const auto x = pkr::units::cholesky_decomposition_t{p}.solve(b);
+    const auto expected = pkr::units::solve(p, b);
+    for (std::size_t i = 0; i < large_state_t::row_count; ++i)
+    {
+        EXPECT_NEAR(x.si_element(i, 0), expected.si_element(i, 0), 1e-12);
+    }
+}
+
+// ============================================================================
+// Householder QR
+// ============================================================================
+
+TEST_F(LinearSolversTest, qr_least_squares_fits_line)
+{
+    line_model_t a{};
+    samples_t b{};
+    for (std::size_t i = 0; i < samples_t::row_count; ++i)
+    {
+        const double t = static_cast<double>(i);
+        a.si_element(i, 0) = 1.0;
+        a.si_element(i, 1) = t;
+        b.si_element(i, 0) = 1.0 + (2.0 * t) + (i % 2 == 0 ? 0.1 : -0.1);
+    }
+
+    const auto x = pkr::units::least_squares(a, b);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(x)>, state_t>);
+
+    // Normal equations: (A^T A) x = A^T b
+    const auto expected = pkr::units::solve(pkr::units::transpose(a) * a, pkr::units::transpose(a) * b);
+    EXPECT_NEAR(x.get<0>().value(), expected.si_element(0, 0), 1e-12);
+    EXPECT_NEAR(x.get<1>().value(), expected.si_element(1, 0), 1e-12);
+    EXPECT_NEAR(x.get<0>().value(), 1.02, 1e-12);
+    EXPECT_NEAR(x.get<1>().value(), 2.0, 1e-12);
+}
+
+TEST_F(LinearSolversTest, qr_square_system_matches_lu)
+{
+    positions_t b{};
+    b.set<0>(pkr::units::meter_t<double>{5.0});
+    b.set<1>(pkr::units::meter_t<double>{9.0});
+
+    const pkr::units::qr_decomposition_t qr{two_fixes()};
+    const auto x = qr.solve(b);
+    EXPECT_NEAR(x.get<0>().value(), 3.0, 1e-12);
+    EXPECT_NEAR(x.get<1>().value(), 2.0, 1e-12);
+}
+
+TEST_F(LinearSolversTest, qr_throws_on_rank_deficient_matrix)
+{
+    line_model_t a{};
+    for (std::size_t i = 0; i < samples_t::row_count; ++i)
+    {
+        a.si_element(i, 1) = static_cast<double>(i);
+    }
+    EXPECT_THROW(pkr::units::qr_decomposition_t{a}, std::invalid_argument);
+}
+
+} // namespace test
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/derived/area/area_units.h>
+#include <pkr_units/units/math/matrix_unit_3d.h>
+#include <pkr_units/units/math/matrix_unit_4d.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class MatrixUnitAlgebraTest : public Test
+{
+protected:
+    using meter_3x3 = pkr::units::matrix_3d_units_t<pkr::units::meter_t<double>>;
+
+    // Row-major values; array_type is used because unit types have no default constructor
+    template <typename unit_u>
+    static constexpr pkr::units::matrix_3d_units_t<unit_u> from_values_3x3(const std::array<double, 9>& v)
+    {
+        using value_t = typename unit_u::value_type;
+        using array_type = typename pkr::units::matrix_3d_units_t<unit_u>::array_type;
+        return pkr::units::matrix_3d_units_t<unit_u>{array_type{{
+            {unit_u{static_cast<value_t>(v[0])}, unit_u{static_cast<value_t>(v[1])}, unit_u{static_cast<value_t>(v[2])}},
+            {unit_u{static_cast<value_t>(v[3])}, unit_u{static_cast<value_t>(v[4])}, unit_u{static_cast<value_t>(v[5])}},
+            {unit_u{static_cast<value_t>(v[6])}, unit_u{static_cast<value_t>(v[7])}, unit_u{static_cast<value_t>(v[8])}},
+        }}};
+    }
+
+    static meter_3x3 sample_3x3()
+    {
+        return from_values_3x3<pkr::units::meter_t<double>>({4.0, -2.0, 1.0, 3.0, 6.0, -4.0, 2.0, 1.0, 8.0});
+    }
+
+    template <typename unit_u>
+    static pkr::units::matrix_4d_units_t<unit_u> from_values(const std::array<double, 16>& v)
+    {
+        using value_t = typename unit_u::value_type;
+        typename pkr::units::matrix_4d_units_t<unit_u>::array_type a{{
+            {unit_u{static_cast<value_t>(v[0])}, unit_u{static_cast<value_t>(v[1])}, unit_u{static_cast<value_t>(v[2])}, unit_u{static_cast<value_t>(v[3])}},
+            {unit_u{static_cast<value_t>(v[4])}, unit_u{static_cast<value_t>(v[5])}, unit_u{static_cast<value_t>(v[6])}, unit_u{static_cast<value_t>(v[7])}},
+            {unit_u{static_cast<value_t>(v[8])}, unit_u{static_cast<value_t>(v[9])}, unit_u{static_cast<value_t>(v[10])}, unit_u{static_cast<value_t>(v[11])}},
+            {unit_u{static_cast<value_t>(v[12])}, unit_u{static_cast<value_t>(v[13])}, unit_u{static_cast<value_t>(v[14])}, unit_u{static_cast<value_t>(v[15])}},
+        }};
+        return pkr::units::matrix_4d_units_t<unit_u>{a};
+    }
+
+    static std::array<double, 16> random_values(std::uint32_t seed)
+    {
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<double> dist{-2.0, 2.0};
+        std::array<double, 16> v{};
+        for (auto& x : v)
+        {
+            x = dist(rng);
+        }
+        return v;
+    }
+};
+
+// ============================================================================
+// 3x3
+// ============================================================================
+
+TEST_F(MatrixUnitAlgebraTest, product_3x3_combines_dimensions)
+{
+    const auto a = sample_3x3();
+    const auto p = a * a;
+    EXPECT_TRUE((pkr::units::details::is_pkr_unit<std::remove_cvref_t<decltype(p(0, 0))>>::value_dimension == pkr::units::area_dimension));
+    // Row 0 of A times column 0 of A: 4*4 + -2*3 + 1*2
+    EXPECT_DOUBLE_EQ(p(0, 0).value(), 12.0);
+    EXPECT_DOUBLE_EQ(p(2, 1).value(), (2.0 * -2.0) + (1.0 * 6.0) + (8.0 * 1.0));
+}
+
+TEST_F(MatrixUnitAlgebraTest, mixed_ratios_are_converted_to_si)
+{
+    const auto mm = from_values_3x3<pkr::units::millimeter_t<double>>({1000.0, 0.0, 0.0, 0.0, 2000.0, 0.0, 0.0, 0.0, 500.0});
+    const auto p = mm * sample_3x3();
+    EXPECT_DOUBLE_EQ(p(1, 1).value(), 12.0);
+    EXPECT_DOUBLE_EQ(pkr::units::determinant(mm).value(), 1.0);
+}
+
+TEST_F(MatrixUnitAlgebraTest, determinant_3x3_is_cubed_and_constexpr)
+{
+    constexpr auto diagonal = from_values_3x3<pkr::units::meter_t<double>>({2.0, 0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, 4.0});
+    constexpr auto det = pkr::units::determinant(diagonal);
+    static_assert(det.value() == 24.0);
+    EXPECT_TRUE((pkr::units::details::is_pkr_unit<std::remove_cvref_t<decltype(det)>>::value_dimension == pkr::units::volume_dimension));
+    EXPECT_DOUBLE_EQ(pkr::units::determinant(sample_3x3()).value(), (4.0 * 52.0) + (2.0 * 32.0) + (1.0 * -9.0));
+}
+
+TEST_F(MatrixUnitAlgebraTest, inverse_3x3_has_reciprocal_dimension)
+{
+    const auto a = sample_3x3();
+    const auto inv = pkr::units::inverse(a);
+    constexpr auto inverse_length = pkr::units::details::scale_dimension(pkr::units::length_dimension, -1);
+    EXPECT_TRUE((pkr::units::details::is_pkr_unit<std::remove_cvref_t<decltype(inv(0, 0))>>::value_dimension == inverse_length));
+
+    const auto identity = a * inv;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            EXPECT_NEAR(identity(i, j).value(), i == j ? 1.0 : 0.0, 1e-14);
+        }
+    }
+
+    const auto singular = from_values_3x3<pkr::units::meter_t<double>>({1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 0.0, 1.0, 1.0});
+    EXPECT_THROW(static_cast<void>(pkr::units::inverse(singular)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(pkr::units::solve(singular, pkr::units::vec_3d_units_t<pkr::units::meter_t<double>>{1.0, 1.0, 1.0})), std::invalid_argument);
+}
+
+TEST_F(MatrixUnitAlgebraTest, transpose_and_solve_3x3)
+{
+    const auto a = sample_3x3();
+    const auto t = pkr::units::transpose(a);
+    EXPECT_DOUBLE_EQ(t(0, 1).value(), 3.0);
+    EXPECT_DOUBLE_EQ(t(1, 0).value(), -2.0);
+
+    // Pressure matrix times area gives force; solving recovers the area
+    const auto stiffness = from_values_3x3<pkr::units::pascal_t<double>>({4.0, -2.0, 1.0, 3.0, 6.0, -4.0, 2.0, 1.0, 8.0});
+    const pkr::units::vec_3d_units_t<pkr::units::square_meter_t<double>> area{1.0, 2.0, 3.0};
+    const auto force = stiffness * area;
+    EXPECT_TRUE((std::is_same_v<std::remove_cvref_t<decltype(force.x)>, pkr::units::newton_t<double>>));
+    const auto solved = pkr::units::solve(stiffness, force);
+    EXPECT_TRUE((pkr::units::details::is_pkr_unit<std::remove_cvref_t<decltype(solved.x)>>::value_dimension == pkr::units::area_dimension));
+    EXPECT_NEAR(solved.x.value(), 1.0, 1e-14);
+    EXPECT_NEAR(solved.y.value(), 2.0, 1e-14);
+    EXPECT_NEAR(solved.z.value(), 3.0, 1e-14);
+}
+
+// ============================================================================
+// 4x4
+// ============================================================================
+
+TEST_F(MatrixUnitAlgebraTest, product_4x4_matches_reference)
+{
+    const auto va = random_values(1);
+    const auto vb = random_values(2);
+    const auto a = from_values<pkr::units::meter_t<double>>(va);
+    const auto b = from_values<pkr::units::second_t<double>>(vb);
+    const auto p = a * b;
+    constexpr auto expected_dimension = pkr::units::details::add_dimensions(pkr::units::length_dimension, pkr::units::time_dimension);
+    EXPECT_TRUE((pkr::units::details::is_pkr_unit<std::remove_cvref_t<decltype(p(0, 0))>>::value_dimension == expected_dimension));
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            double sum = 0.0;
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                sum += va[(i * 4) + k] * vb[(k * 4) + j];
+            }
+            EXPECT_NEAR(p(i, j).value(), sum, 1e-14);
+        }
+    }
+}
+
+TEST_F(MatrixUnitAlgebraTest, product_4x4_float_matches_reference)
+{
+    const auto va = random_values(3);
+    const auto vb = random_values(4);
+    const auto fa = from_values<pkr::units::meter_t<float>>(va);
+    const auto fb = from_values<pkr::units::meter_t<float>>(vb);
+    const auto p = fa * fb;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            double sum = 0.0;
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                sum += static_cast<double>(fa(i, k).value()) * static_cast<double>(fb(k, j).value());
+            }
+            EXPECT_NEAR(static_cast<double>(p(i, j).value()), sum, 1e-5);
+        }
+    }
+}
+
+TEST_F(MatrixUnitAlgebraTest, matrix_vector_4x4_combines_dimensions)
+{
+    const auto va = random_values(5);
+    const auto m = from_values<pkr::units::newton_t<double>>(va);
+    const pkr::units::vec_4d_units_t<pkr::units::meter_t<double>> v{1.0, -2.0, 0.5, 1.0};
+    const auto work = m * v;
+    EXPECT_TRUE((std::is_same_v<std::remove_cvref_t<decltype(work.x)>, pkr::units::joule_t<double>>));
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        const double expected = (va[(i * 4) + 0] * 1.0) + (va[(i * 4) + 1] * -2.0) + (va[(i * 4) + 2] * 0.5) + va[(i * 4) + 3];
+        const double actual = i == 0 ? work.x.value() : i == 1 ? work.y.value() : i == 2 ? work.z.value() : work.w.value();
+        EXPECT_NEAR(actual, expected, 1e-14);
+    }
+}
+
+TEST_F(MatrixUnitAlgebraTest, same_base_unit_matrix_vector_squares_the_dimension)
+{
+    // A plain unit_t (no derived symbol) for both operands: the product is an area, not a length
+    using length_u = pkr::units::unit_t<double, std::ratio<1>, pkr::units::length_dimension>;
+    using area_u = pkr::units::unit_product_t<length_u, length_u>;
+
+    constexpr auto m3 = from_values_3x3<length_u>({1.0, 2.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 3.0});
+    constexpr pkr::units::vec_3d_units_t<length_u> v3{length_u{1.0}, length_u{2.0}, length_u{3.0}};
+    constexpr auto y3 = m3 * v3;
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(y3)>, pkr::units::vec_3d_units_t<area_u>>);
+    static_assert(std::is_same_v<decltype(pkr::units::matrix_vector_multiply(m3, v3)), pkr::units::vec_3d_units_t<area_u>>);
+    static_assert(y3.x.value() == 5.0 && y3.z.value() == 9.0);
+
+    const auto m4 = from_values<length_u>({1.0, 0.0, 0.0, 2.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0});
+    const pkr::units::vec_4d_t<length_u> v4{length_u{1.0}, length_u{2.0}, length_u{3.0}, length_u{4.0}};
+    const auto y4 = m4 * v4;
+    EXPECT_TRUE((std::is_same_v<std::remove_cvref_t<decltype(y4)>, pkr::units::vec_4d_t<area_u>>));
+    EXPECT_TRUE((std::is_same_v<decltype(pkr::units::matrix_vector_multiply(m4, v4)), pkr::units::vec_4d_t<area_u>>));
+    EXPECT_DOUBLE_EQ(y4.x.value(), 9.0);
+    EXPECT_DOUBLE_EQ(y4.w.value(), 4.0);
+}
+
+TEST_F(MatrixUnitAlgebraTest, determinant_and_inverse_4x4)
+{
+    const auto va = random_values(6);
+    const auto a = from_values<pkr::units::meter_t<double>>(va);
+    const auto det = pkr::units::determinant(a);
+    constexpr auto length_4 = pkr::units::details::scale_dimension(pkr::units::length_dimension, 4);
+    EXPECT_TRUE((pkr::units::details::is_pkr_unit<std::remove_cvref_t<decltype(det)>>::value_dimension == length_4));
+
+    // det(A) from the 3x3 cofactor expansion along the first row
+    double expected_det = 0.0;
+    for (std::size_t c = 0; c < 4; ++c)
+    {
+        std::array<double, 9> minor{};
+        std::size_t k = 0;
+        for (std::size_t r = 1; r < 4; ++r)
+        {
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                if (j != c)
+                {
+                    minor[k++] = va[(r * 4) + j];
+                }
+            }
+        }
+        const double m3 = pkr::units::details::determinant_3x3<double>(minor);
+        expected_det += (c % 2 == 0 ? 1.0 : -1.0) * va[c] * m3;
+    }
+    EXPECT_NEAR(det.value(), expected_det, 1e-13);
+
+    const auto identity = a * pkr::units::inverse(a);
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            EXPECT_NEAR(identity(i, j).value(), i == j ? 1.0 : 0.0, 1e-12);
+        }
+    }
+
+    // Integer entries keep the cofactor arithmetic exact, so the duplicated row gives det == 0
+    constexpr std::array<double, 16> singular{1.0, 2.0, 3.0, 4.0, 0.0, 1.0, 5.0, 2.0, 7.0, 1.0, 0.0, 3.0, 1.0, 2.0, 3.0, 4.0};
+    EXPECT_THROW(static_cast<void>(pkr::units::inverse(from_values<pkr::units::meter_t<double>>(singular))), std::invalid_argument);
+}
+
+TEST_F(MatrixUnitAlgebraTest, transpose_and_solve_4x4)
+{
+    const auto va = random_values(7);
+    const auto a = from_values<pkr::units::second_t<double>>(va);
+    const auto t = pkr::units::transpose(a);
+    EXPECT_DOUBLE_EQ(t(1, 3).value(), va[13]);
+
+    // Seconds matrix, meter right-hand side: the solution is a velocity
+    const pkr::units::vec_4d_units_t<pkr::units::meter_t<double>> b{1.0, 2.0, 3.0, 4.0};
+    const auto x = pkr::units::solve(a, b);
+    EXPECT_TRUE((std::is_same_v<std::remove_cvref_t<decltype(x.x)>, pkr::units::meter_per_second_t<double>>));
+    const auto back = a * x;
+    EXPECT_NEAR(back.x.value(), 1.0, 1e-12);
+    EXPECT_NEAR(back.y.value(), 2.0, 1e-12);
+    EXPECT_NEAR(back.z.value(), 3.0, 1e-12);
+    EXPECT_NEAR(back.w.value(), 4.0, 1e-12);
+}
+
+TEST_F(MatrixUnitAlgebraTest, arena_storage_inputs)
+{
+    using arena_matrix = pkr::units::matrix_4d_units_t<pkr::units::meter_t<double>, pkr::units::arena_storage<pkr::units::meter_t<double>, 4>>;
+    const auto va = random_values(8);
+    const auto stack = from_values<pkr::units::meter_t<double>>(va);
+    typename arena_matrix::array_type values{{stack[0], stack[1], stack[2], stack[3]}};
+    arena_matrix arena{values};
+    // Arena slots are not seeded from the constructor argument, so write through the accessor
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            arena(i, j) = stack(i, j);
+        }
+    }
+    const auto p = arena * stack;
+    const auto q = stack * stack;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            EXPECT_DOUBLE_EQ(p(i, j).value(), q(i, j).value());
+        }
+    }
+}
+
+} // namespace test
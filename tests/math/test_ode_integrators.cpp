@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <pkr_units/si_units.h>
+#include <pkr_units/math/ode_integrators.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class OdeIntegratorsTest : public Test
+{
+};
+
+using oscillator_state_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>, pkr::units::meter_per_second_t<double>>;
+using oscillator_derivative_t = pkr::units::time_derivative_t<oscillator_state_t>;
+using position_t = pkr::units::unit_vector_t<pkr::units::meter_t<double>>;
+
+namespace
+{
+
+// Harmonic oscillator x'' = -omega^2 x with omega = 2 rad/s
+constexpr double omega = 2.0;
+
+constexpr oscillator_derivative_t oscillator(pkr::units::second_t<double>, const oscillator_state_t& x)
+{
+    return pkr::units::make_unit_vector(x.get<1>(), pkr::units::meter_per_second_squared_t<double>{-omega * omega * x.si_element(0, 0)});
+}
+
+constexpr auto spring_acceleration = [](const position_t& q)
+{ return pkr::units::make_unit_vector(pkr::units::meter_per_second_squared_t<double>{-omega * omega * q.si_element(0, 0)}); };
+
+double oscillator_energy(const position_t& q, const pkr::units::time_derivative_t<position_t>& v)
+{
+    const double x = q.si_element(0, 0);
+    const double u = v.si_element(0, 0);
+    return (0.5 * u * u) + (0.5 * omega * omega * x * x);
+}
+
+} // namespace
+
+// ============================================================================
+// Derivative types
+// ============================================================================
+
+TEST_F(OdeIntegratorsTest, derivative_type_divides_by_second)
+{
+    static_assert(std::is_same_v<
+                  oscillator_derivative_t,
+                  pkr::units::unit_vector_t<pkr::units::meter_per_second_t<double>, pkr::units::meter_per_second_squared_t<double>>>);
+    static_assert(std::is_same_v<pkr::units::time_derivative_t<position_t>::element_type<0>, pkr::units::meter_per_second_t<double>>);
+    SUCCEED();
+}
+
+// ============================================================================
+// Runge-Kutta
+// ============================================================================
+
+TEST_F(OdeIntegratorsTest, rk4_harmonic_oscillator)
+{
+    pkr::units::rk4_integrator_t<oscillator_state_t> rk4;
+    const auto x0 = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{0.0});
+    const auto x = rk4.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{0.001}, 1000);
+
+    EXPECT_NEAR(x.get<0>().value(), std::cos(omega), 1e-10);
+    EXPECT_NEAR(x.get<1>().value(), -omega * std::sin(omega), 1e-10);
+}
+
+TEST_F(OdeIntegratorsTest, rk4_fourth_order_convergence)
+{
+    const auto x0 = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{0.0});
+    pkr::units::rk4_integrator_t<oscillator_state_t> rk4;
+    const double coarse = std::abs(rk4.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{0.1}, 10).si_element(0, 0) - std::cos(omega));
+    const double fine = std::abs(rk4.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{0.05}, 20).si_element(0, 0) - std::cos(omega));
+    EXPECT_GT(coarse / fine, 12.0);
+}
+
+TEST_F(OdeIntegratorsTest, runge_kutta_step_is_constexpr)
+{
+    // Exponential decay dx/dt = -x / (1 s); one step of h = 0.1 s matches the 4th order Taylor polynomial
+    constexpr auto x1 = pkr::units::runge_kutta_step(
+        [](pkr::units::second_t<double>, const position_t& x)
+        { return pkr::units::make_unit_vector(pkr::units::meter_per_second_t<double>{-x.si_element(0, 0)}); },
+        pkr::units::second_t<double>{0.0},
+        pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}),
+        pkr::units::second_t<double>{0.1});
+    constexpr double h = 0.1;
+    static_assert(x1.si_element(0, 0) > 0.9048 && x1.si_element(0, 0) < 0.9049);
+    EXPECT_DOUBLE_EQ(x1.si_element(0, 0), 1.0 - h + (h * h / 2.0) - (h * h * h / 6.0) + (h * h * h * h / 24.0));
+}
+
+TEST_F(OdeIntegratorsTest, rk4_accepts_other_time_units)
+{
+    pkr::units::rk4_integrator_t<oscillator_state_t> rk4;
+    const auto x0 = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{0.0});
+    const auto a = rk4.step(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::millisecond_t<double>{10.0});
+    const auto b = rk4.step(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{0.01});
+    EXPECT_EQ(a, b);
+}
+
+// ============================================================================
+// Dormand-Prince
+// ============================================================================
+
+TEST_F(OdeIntegratorsTest, dormand_prince_meets_tolerance)
+{
+    pkr::units::adaptive_step_options<oscillator_state_t> options{
+        pkr::units::make_unit_vector(pkr::units::meter_t<double>{1e-10}, pkr::units::meter_per_second_t<double>{1e-10})};
+    options.relative_tolerance = 1e-10;
+    pkr::units::dormand_prince_integrator_t<oscillator_state_t> dopri{options};
+
+    const auto x0 = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{0.0});
+    const auto x = dopri.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{10.0}, pkr::units::second_t<double>{1.0});
+
+    EXPECT_NEAR(x.get<0>().value(), std::cos(omega * 10.0), 1e-7);
+    EXPECT_NEAR(x.get<1>().value(), -omega * std::sin(omega * 10.0), 1e-7);
+    EXPECT_GT(dopri.statistics().accepted_steps, 10u);
+    // The oversized initial step must have been rejected at least once
+    EXPECT_GT(dopri.statistics().rejected_steps, 0u);
+    EXPECT_EQ(dopri.statistics().function_evaluations, 1 + (6 * (dopri.statistics().accepted_steps + dopri.statistics().rejected_steps)));
+}
+
+TEST_F(OdeIntegratorsTest, dormand_prince_looser_tolerance_takes_fewer_steps)
+{
+    const auto x0 = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{0.0});
+    const auto atol = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1e-6}, pkr::units::meter_per_second_t<double>{1e-6});
+
+    pkr::units::adaptive_step_options<oscillator_state_t> loose{atol, 1e-4};
+    pkr::units::adaptive_step_options<oscillator_state_t> tight{atol, 1e-10};
+    pkr::units::dormand_prince_integrator_t<oscillator_state_t> a{loose};
+    pkr::units::dormand_prince_integrator_t<oscillator_state_t> b{tight};
+    static_cast<void>(a.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{5.0}, pkr::units::second_t<double>{0.01}));
+    static_cast<void>(b.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{5.0}, pkr::units::second_t<double>{0.01}));
+    EXPECT_LT(a.statistics().accepted_steps, b.statistics().accepted_steps);
+}
+
+TEST_F(OdeIntegratorsTest, dormand_prince_integrates_backwards)
+{
+    pkr::units::adaptive_step_options<oscillator_state_t> options{
+        pkr::units::make_unit_vector(pkr::units::meter_t<double>{1e-12}, pkr::units::meter_per_second_t<double>{1e-12}), 1e-12};
+    pkr::units::dormand_prince_integrator_t<oscillator_state_t> dopri{options};
+
+    const auto x0 = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{0.0});
+    const auto forward = dopri.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{1.0}, pkr::units::second_t<double>{0.1});
+    const auto back = dopri.integrate(oscillator, pkr::units::second_t<double>{1.0}, forward, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{0.1});
+    EXPECT_NEAR(back.get<0>().value(), 1.0, 1e-9);
+    EXPECT_NEAR(back.get<1>().value(), 0.0, 1e-9);
+}
+
+TEST_F(OdeIntegratorsTest, dormand_prince_step_limit_throws)
+{
+    pkr::units::adaptive_step_options<oscillator_state_t> options{
+        pkr::units::make_unit_vector(pkr::units::meter_t<double>{1e-12}, pkr::units::meter_per_second_t<double>{1e-12}), 1e-12};
+    options.max_steps = 5;
+    pkr::units::dormand_prince_integrator_t<oscillator_state_t> dopri{options};
+    const auto x0 = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0}, pkr::units::meter_per_second_t<double>{0.0});
+    EXPECT_THROW(
+        static_cast<void>(dopri.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{100.0}, pkr::units::second_t<double>{0.1})),
+        std::runtime_error);
+    EXPECT_THROW(
+        static_cast<void>(dopri.integrate(oscillator, pkr::units::second_t<double>{0.0}, x0, pkr::units::second_t<double>{1.0}, pkr::units::second_t<double>{0.0})),
+        std::invalid_argument);
+}
+
+// ============================================================================
+// Symplectic integrators
+// ============================================================================
+
+TEST_F(OdeIntegratorsTest, velocity_verlet_energy_is_bounded)
+{
+    pkr::units::velocity_verlet_integrator_t<position_t> verlet;
+    auto q = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0});
+    auto v = pkr::units::make_unit_vector(pkr::units::meter_per_second_t<double>{0.0});
+    const double e0 = oscillator_energy(q, v);
+
+    double max_error = 0.0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        verlet.step(spring_acceleration, q, v, pkr::units::second_t<double>{0.01});
+        max_error = std::max(max_error, std::abs(oscillator_energy(q, v) - e0));
+    }
+    EXPECT_LT(max_error / e0, 1e-3);
+}
+
+TEST_F(OdeIntegratorsTest, yoshida_is_more_accurate_than_verlet)
+{
+    pkr::units::velocity_verlet_integrator_t<position_t> verlet;
+    pkr::units::yoshida_integrator_t<position_t> yoshida;
+    auto q_verlet = pkr::units::make_unit_vector(pkr::units::meter_t<double>{1.0});
+    auto v_verlet = pkr::units::make_unit_vector(pkr::units::meter_per_second_t<double>{0.0});
+    auto q_yoshida = q_verlet;
+    auto v_yoshida = v_verlet;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        verlet.step(spring_acceleration, q_verlet, v_verlet, pkr::units::second_t<double>{0.01});
+        yoshida.step(spring_acceleration, q_yoshida, v_yoshida, pkr::units::second_t<double>{0.01});
+    }
+
+    const double exact = std::cos(omega);
+    const double verlet_error = std::abs(q_verlet.si_element(0, 0) - exact);
+    const double yoshida_error = std::abs(q_yoshida.si_element(0, 0) - exact);
+    EXPECT_LT(yoshida_error, 1e-7);
+    EXPECT_LT(yoshida_error * 100.0, verlet_error);
+}
+
+} // namespace test
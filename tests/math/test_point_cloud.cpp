@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/dimensionless/scalar.h>
+#include <pkr_units/units/math/point_cloud.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class PointCloudTest : public Test
+{
+protected:
+    template <typename unit_u>
+    static pkr::units::matrix_4d_units_t<unit_u> from_values(const std::array<double, 16>& v)
+    {
+        using value_t = typename unit_u::value_type;
+        typename pkr::units::matrix_4d_units_t<unit_u>::array_type a{{
+            {unit_u{static_cast<value_t>(v[0])}, unit_u{static_cast<value_t>(v[1])}, unit_u{static_cast<value_t>(v[2])}, unit_u{static_cast<value_t>(v[3])}},
+            {unit_u{static_cast<value_t>(v[4])}, unit_u{static_cast<value_t>(v[5])}, unit_u{static_cast<value_t>(v[6])}, unit_u{static_cast<value_t>(v[7])}},
+            {unit_u{static_cast<value_t>(v[8])}, unit_u{static_cast<value_t>(v[9])}, unit_u{static_cast<value_t>(v[10])}, unit_u{static_cast<value_t>(v[11])}},
+            {unit_u{static_cast<value_t>(v[12])}, unit_u{static_cast<value_t>(v[13])}, unit_u{static_cast<value_t>(v[14])}, unit_u{static_cast<value_t>(v[15])}},
+        }};
+        return pkr::units::matrix_4d_units_t<unit_u>{a};
+    }
+
+    // Rotation of 30 degrees about z followed by a translation of (1.5, -2, 0.25)
+    static std::array<double, 16> rigid_values()
+    {
+        const double c = std::cos(0.5235987755982988);
+        const double s = std::sin(0.5235987755982988);
+        return {c, -s, 0.0, 1.5, s, c, 0.0, -2.0, 0.0, 0.0, 1.0, 0.25, 0.0, 0.0, 0.0, 1.0};
+    }
+
+    static std::array<double, 16> projective_values()
+    {
+        return {1.0, 0.2, 0.0, 0.5, 0.0, 0.9, 0.1, -1.0, 0.3, 0.0, 1.1, 0.0, 0.01, 0.02, 0.03, 1.0};
+    }
+
+    static std::array<double, 4> reference(const std::array<double, 16>& m, const std::array<double, 4>& p)
+    {
+        std::array<double, 4> r{};
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            r[i] = (m[(i * 4) + 0] * p[0]) + (m[(i * 4) + 1] * p[1]) + (m[(i * 4) + 2] * p[2]) + (m[(i * 4) + 3] * p[3]);
+        }
+        return r;
+    }
+
+    static pkr::units::point_cloud_t<pkr::units::meter_t<double>> random_cloud(std::size_t n)
+    {
+        std::mt19937 rng{42};
+        std::uniform_real_distribution<double> dist{-50.0, 50.0};
+        pkr::units::point_cloud_t<pkr::units::meter_t<double>> cloud;
+        cloud.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            cloud.add_point(pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>{dist(rng), dist(rng), dist(rng), 1.0});
+        }
+        return cloud;
+    }
+};
+
+// ============================================================================
+// Container
+// ============================================================================
+
+TEST_F(PointCloudTest, add_point_converts_to_cloud_unit)
+{
+    pkr::units::point_cloud_t<pkr::units::meter_t<double>> cloud;
+    EXPECT_TRUE(cloud.empty());
+    const auto index = cloud.add_point(pkr::units::vec_4d_units_t<pkr::units::millimeter_t<double>>{1500.0, -250.0, 10.0, 1000.0});
+    EXPECT_EQ(index, 0u);
+    EXPECT_EQ(cloud.size(), 1u);
+
+    const auto p = cloud.point(0);
+    EXPECT_DOUBLE_EQ(p.x.value(), 1.5);
+    EXPECT_DOUBLE_EQ(p.y.value(), -0.25);
+    EXPECT_DOUBLE_EQ(p.z.value(), 0.01);
+    EXPECT_DOUBLE_EQ(p.w.value(), 1.0);
+    EXPECT_DOUBLE_EQ(cloud.x()[0], 1.5);
+
+    cloud.set_point(0, pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>{2.0, 3.0, 4.0});
+    EXPECT_DOUBLE_EQ(cloud.point(0).z.value(), 4.0);
+    EXPECT_THROW(static_cast<void>(cloud.point(1)), std::out_of_range);
+}
+
+TEST_F(PointCloudTest, resize_fills_homogeneous_origin)
+{
+    pkr::units::point_cloud_t<pkr::units::meter_t<float>> cloud;
+    cloud.resize(3);
+    EXPECT_EQ(cloud.size(), 3u);
+    EXPECT_FLOAT_EQ(cloud.x()[2], 0.0f);
+    EXPECT_FLOAT_EQ(cloud.w()[2], 1.0f);
+    cloud.clear();
+    EXPECT_TRUE(cloud.empty());
+}
+
+// ============================================================================
+// Structure-of-arrays transform
+// ============================================================================
+
+TEST_F(PointCloudTest, affine_transform_matches_reference)
+{
+    pkr::units::work_stealing_pool pool{4};
+    const auto cloud = random_cloud(100003);
+    const auto values = rigid_values();
+    const auto m = from_values<pkr::units::scalar_t<double>>(values);
+
+    pkr::units::point_cloud_t<pkr::units::meter_t<double>> out;
+    pkr::units::transform(cloud, m, out, pool);
+    ASSERT_EQ(out.size(), cloud.size());
+    for (std::size_t i = 0; i < cloud.size(); i += 997)
+    {
+        const auto expected = reference(values, {cloud.x()[i], cloud.y()[i], cloud.z()[i], cloud.w()[i]});
+        EXPECT_NEAR(out.x()[i], expected[0], 1e-12);
+        EXPECT_NEAR(out.y()[i], expected[1], 1e-12);
+        EXPECT_NEAR(out.z()[i], expected[2], 1e-12);
+        EXPECT_DOUBLE_EQ(out.w()[i], 1.0);
+    }
+    const std::size_t last = cloud.size() - 1;
+    EXPECT_NEAR(out.x()[last], reference(values, {cloud.x()[last], cloud.y()[last], cloud.z()[last], 1.0})[0], 1e-12);
+}
+
+TEST_F(PointCloudTest, projective_transform_computes_w)
+{
+    pkr::units::work_stealing_pool pool{2};
+    const auto cloud = random_cloud(1027);
+    const auto values = projective_values();
+    const auto m = from_values<pkr::units::scalar_t<double>>(values);
+
+    pkr::units::point_cloud_t<pkr::units::meter_t<double>> out;
+    pkr::units::transform(cloud, m, out, pool);
+    for (std::size_t i = 0; i < cloud.size(); ++i)
+    {
+        const auto expected = reference(values, {cloud.x()[i], cloud.y()[i], cloud.z()[i], cloud.w()[i]});
+        EXPECT_NEAR(out.w()[i], expected[3], 1e-12);
+        EXPECT_NEAR(out.y()[i], expected[1], 1e-12);
+    }
+}
+
+TEST_F(PointCloudTest, in_place_transform)
+{
+    auto cloud = random_cloud(513);
+    const auto original = cloud;
+    const auto values = rigid_values();
+    pkr::units::transform(cloud, from_values<pkr::units::scalar_t<double>>(values), cloud);
+    for (std::size_t i = 0; i < cloud.size(); ++i)
+    {
+        const auto expected = reference(values, {original.x()[i], original.y()[i], original.z()[i], 1.0});
+        EXPECT_NEAR(cloud.x()[i], expected[0], 1e-12);
+        EXPECT_NEAR(cloud.z()[i], expected[2], 1e-12);
+    }
+}
+
+TEST_F(PointCloudTest, ratios_fold_into_the_matrix)
+{
+    pkr::units::point_cloud_t<pkr::units::millimeter_t<double>> mm;
+    mm.add_point(pkr::units::vec_4d_units_t<pkr::units::millimeter_t<double>>{1000.0, 2000.0, 3000.0, 1000.0});
+    const auto values = rigid_values();
+
+    pkr::units::point_cloud_t<pkr::units::meter_t<double>> m_out;
+    pkr::units::transform(mm, from_values<pkr::units::scalar_t<double>>(values), m_out);
+    const auto expected = reference(values, {1.0, 2.0, 3.0, 1.0});
+    EXPECT_NEAR(m_out.x()[0], expected[0], 1e-12);
+    EXPECT_NEAR(m_out.y()[0], expected[1], 1e-12);
+    EXPECT_NEAR(m_out.w()[0], 1.0, 1e-12);
+
+    // A newton matrix applied to meter points gives joules, output in kilojoules
+    pkr::units::point_cloud_t<pkr::units::kilojoule_t<double>> work;
+    pkr::units::transform(mm, from_values<pkr::units::newton_t<double>>(values), work);
+    EXPECT_NEAR(work.x()[0], expected[0] / 1000.0, 1e-15);
+    EXPECT_NEAR(work.w()[0], 1.0 / 1000.0, 1e-15);
+}
+
+TEST_F(PointCloudTest, float_cloud_transform)
+{
+    pkr::units::point_cloud_t<pkr::units::meter_t<float>> cloud;
+    for (int i = 0; i < 37; ++i)
+    {
+        const float f = static_cast<float>(i);
+        cloud.add_point(pkr::units::vec_4d_units_t<pkr::units::meter_t<float>>{f, -f, 0.5f * f, 1.0f});
+    }
+    const auto values = projective_values();
+    pkr::units::point_cloud_t<pkr::units::meter_t<float>> out;
+    pkr::units::transform(cloud, from_values<pkr::units::scalar_t<float>>(values), out);
+    for (std::size_t i = 0; i < cloud.size(); ++i)
+    {
+        const auto expected = reference(
+            values,
+            {static_cast<double>(cloud.x()[i]), static_cast<double>(cloud.y()[i]), static_cast<double>(cloud.z()[i]), static_cast<double>(cloud.w()[i])});
+        EXPECT_NEAR(static_cast<double>(out.x()[i]), expected[0], 1e-4);
+        EXPECT_NEAR(static_cast<double>(out.w()[i]), expected[3], 1e-4);
+    }
+}
+
+// ============================================================================
+// Array-of-structures transform
+// ============================================================================
+
+TEST_F(PointCloudTest, span_transform_matches_soa)
+{
+    pkr::units::work_stealing_pool pool{4};
+    const auto cloud = random_cloud(40001);
+    std::vector<pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>> points;
+    points.reserve(cloud.size());
+    for (std::size_t i = 0; i < cloud.size(); ++i)
+    {
+        points.push_back(cloud.point(i));
+    }
+    const auto m = from_values<pkr::units::scalar_t<double>>(projective_values());
+
+    pkr::units::point_cloud_t<pkr::units::meter_t<double>> soa;
+    pkr::units::transform(cloud, m, soa, pool);
+
+    std::vector<pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>> out(points.size());
+    pkr::units::transform(std::span<const pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>>{points}, m, std::span{out}, pool);
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(out[i].x.value(), soa.x()[i]);
+        EXPECT_DOUBLE_EQ(out[i].w.value(), soa.w()[i]);
+    }
+
+    // In place over the same span
+    pkr::units::transform(std::span{points}, m, std::span{points}, pool);
+    EXPECT_DOUBLE_EQ(points[12345].y.value(), soa.y()[12345]);
+}
+
+TEST_F(PointCloudTest, span_transform_size_mismatch_throws)
+{
+    std::vector<pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>> in(4);
+    std::vector<pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>> out(3);
+    const auto m = from_values<pkr::units::scalar_t<double>>(rigid_values());
+    EXPECT_THROW(pkr::units::transform(std::span{in}, m, std::span{out}), std::invalid_argument);
+}
+
+} // namespace test
@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/derived/area/area_units.h>
+#include <pkr_units/math/quadrature.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class QuadratureTest : public Test
+{
+};
+
+namespace
+{
+
+// Half-sine power pulse of 100 W over 60 s: E = 2 * P * T / pi
+constexpr double pulse_period = 60.0;
+constexpr double pulse_energy = 2.0 * 100.0 * pulse_period / std::numbers::pi;
+
+const auto power_pulse = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{100.0 * std::sin(std::numbers::pi * t.value() / pulse_period)}; };
+
+constexpr auto quintic = [](const pkr::units::second_t<double>& t)
+{
+    const double v = t.value();
+    return pkr::units::meter_per_second_t<double>{v * v * v * v * v};
+};
+
+} // namespace
+
+// ============================================================================
+// Result dimensions
+// ============================================================================
+
+TEST_F(QuadratureTest, power_over_time_is_energy)
+{
+    const auto energy = pkr::units::gauss_kronrod(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period});
+    EXPECT_TRUE((std::is_same_v<std::remove_cvref_t<decltype(energy)>, pkr::units::joule_t<double>>));
+    EXPECT_NEAR(energy.value(), pulse_energy, 1e-8);
+}
+
+TEST_F(QuadratureTest, pressure_over_area_is_force)
+{
+    const auto load = [](const pkr::units::square_meter_t<double>& a) { return pkr::units::pascal_t<double>{1000.0 + (50.0 * a.value())}; };
+    const auto force = pkr::units::gauss_kronrod(load, pkr::units::square_meter_t<double>{0.0}, pkr::units::square_meter_t<double>{2.0});
+    EXPECT_TRUE((std::is_same_v<std::remove_cvref_t<decltype(force)>, pkr::units::newton_t<double>>));
+    EXPECT_NEAR(force.value(), 2100.0, 1e-9);
+}
+
+TEST_F(QuadratureTest, mixed_ratios_are_converted_to_si)
+{
+    // kW over ms: 2 kW for 500 ms is 1000 J
+    const auto constant = [](const pkr::units::millisecond_t<double>&) { return pkr::units::kilowatt_t<double>{2.0}; };
+    const auto energy = pkr::units::gauss_kronrod_15(constant, pkr::units::millisecond_t<double>{0.0}, pkr::units::millisecond_t<double>{500.0});
+    EXPECT_NEAR(energy.value(), 1000.0, 1e-10);
+}
+
+// ============================================================================
+// Fixed-order rules
+// ============================================================================
+
+TEST_F(QuadratureTest, kronrod_15_is_exact_for_polynomials_at_compile_time)
+{
+    constexpr auto distance = pkr::units::gauss_kronrod_15(quintic, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{2.0});
+    static_assert(distance.value() > 64.0 / 6.0 - 1e-12 && distance.value() < 64.0 / 6.0 + 1e-12);
+    EXPECT_DOUBLE_EQ(distance.value(), 64.0 / 6.0);
+}
+
+TEST_F(QuadratureTest, composite_simpson_converges_at_fourth_order)
+{
+    const auto coarse = pkr::units::composite_simpson(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period}, 8);
+    const auto fine = pkr::units::composite_simpson(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period}, 16);
+    const double ratio = std::abs(coarse.value() - pulse_energy) / std::abs(fine.value() - pulse_energy);
+    EXPECT_NEAR(ratio, 16.0, 0.5);
+
+    // Odd counts are rounded up to the next even count
+    const auto odd = pkr::units::composite_simpson(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period}, 15);
+    EXPECT_DOUBLE_EQ(odd.value(), fine.value());
+    EXPECT_THROW(
+        static_cast<void>(pkr::units::composite_simpson(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{1.0}, 0)),
+        std::invalid_argument);
+}
+
+// ============================================================================
+// Adaptive rules
+// ============================================================================
+
+TEST_F(QuadratureTest, gauss_kronrod_resolves_oscillatory_integrand)
+{
+    const auto wave = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{std::cos(50.0 * t.value()) * std::exp(-t.value())}; };
+    const auto energy = pkr::units::gauss_kronrod(wave, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{10.0}, pkr::units::joule_t<double>{1e-13}, 0.0, 200);
+    // integral of e^-t cos(wt) on [0, T]
+    const double w = 50.0;
+    const double expected = (1.0 + (std::exp(-10.0) * ((w * std::sin(w * 10.0)) - std::cos(w * 10.0)))) / (1.0 + (w * w));
+    EXPECT_NEAR(energy.value(), expected, 1e-12);
+}
+
+TEST_F(QuadratureTest, gauss_kronrod_reversed_bounds_negate)
+{
+    const auto forward = pkr::units::gauss_kronrod(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period});
+    const auto backward = pkr::units::gauss_kronrod(power_pulse, pkr::units::second_t<double>{pulse_period}, pkr::units::second_t<double>{0.0});
+    EXPECT_NEAR(backward.value(), -forward.value(), 1e-9);
+}
+
+TEST_F(QuadratureTest, gauss_kronrod_throws_when_subdivisions_run_out)
+{
+    const auto spike = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{1.0 / (1e-6 + ((t.value() - 0.3) * (t.value() - 0.3)))}; };
+    EXPECT_THROW(
+        static_cast<void>(pkr::units::gauss_kronrod(spike, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{1.0}, pkr::units::joule_t<double>{0.0}, 1e-12, 2)),
+        std::runtime_error);
+    const auto energy = pkr::units::gauss_kronrod(spike, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{1.0});
+    const double expected = 1e3 * (std::atan(0.7e3) + std::atan(0.3e3));
+    EXPECT_NEAR(energy.value(), expected, 1e-6);
+}
+
+TEST_F(QuadratureTest, adaptive_simpson_meets_absolute_tolerance)
+{
+    const auto energy = pkr::units::simpson(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period}, pkr::units::joule_t<double>{1e-9});
+    EXPECT_NEAR(energy.value(), pulse_energy, 1e-9);
+    EXPECT_THROW(
+        static_cast<void>(pkr::units::simpson(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period}, pkr::units::joule_t<double>{1e-12}, 2)),
+        std::runtime_error);
+}
+
+TEST_F(QuadratureTest, tanh_sinh_handles_endpoint_singularities)
+{
+    const auto inverse_sqrt = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{1.0 / std::sqrt(t.value())}; };
+    const auto log_power = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{std::log(t.value())}; };
+
+    EXPECT_NEAR(pkr::units::tanh_sinh(inverse_sqrt, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{1.0}).value(), 2.0, 1e-9);
+    EXPECT_NEAR(pkr::units::tanh_sinh(log_power, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{1.0}).value(), -1.0, 1e-9);
+    // Singularity at the upper end: nodes cannot get closer to 4 s than one ulp,
+    // so the unresolved tail limits the accuracy to about 2 * sqrt(4 eps)
+    const auto reflected = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{1.0 / std::sqrt(4.0 - t.value())}; };
+    EXPECT_NEAR(pkr::units::tanh_sinh(reflected, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{4.0}).value(), 4.0, 1e-7);
+}
+
+TEST_F(QuadratureTest, tanh_sinh_matches_gauss_kronrod_on_smooth_integrands)
+{
+    const auto energy = pkr::units::tanh_sinh(power_pulse, pkr::units::second_t<double>{0.0}, pkr::units::second_t<double>{pulse_period});
+    EXPECT_NEAR(energy.value(), pulse_energy, 1e-8);
+}
+
+// ============================================================================
+// Batched and parallel forms
+// ============================================================================
+
+TEST_F(QuadratureTest, batch_intervals_sum_to_whole_integral)
+{
+    constexpr std::size_t lanes = 60;
+    std::vector<pkr::units::second_t<double>> lower;
+    std::vector<pkr::units::second_t<double>> upper;
+    for (std::size_t i = 0; i < lanes; ++i)
+    {
+        lower.emplace_back(static_cast<double>(i));
+        upper.emplace_back(static_cast<double>(i + 1));
+    }
+    std::vector<pkr::units::joule_t<double>> energies(lanes, pkr::units::joule_t<double>{0.0});
+    pkr::units::gauss_kronrod_batch(
+        power_pulse,
+        std::span<const pkr::units::second_t<double>>{lower},
+        std::span<const pkr::units::second_t<double>>{upper},
+        std::span<pkr::units::joule_t<double>>{energies});
+
+    double total = 0.0;
+    for (const auto& e : energies)
+    {
+        total += e.value();
+    }
+    EXPECT_NEAR(total, pulse_energy, 1e-9);
+    EXPECT_NEAR(energies[0].value(), 100.0 * pulse_period / std::numbers::pi * (1.0 - std::cos(std::numbers::pi / pulse_period)), 1e-12);
+}
+
+TEST_F(QuadratureTest, parallel_lanes_match_scalar_rule)
+{
+    pkr::units::work_stealing_pool pool(4);
+    constexpr std::size_t lanes = 500;
+    std::vector<pkr::units::second_t<double>> lower(lanes, pkr::units::second_t<double>{0.0});
+    std::vector<pkr::units::second_t<double>> upper;
+    for (std::size_t i = 0; i < lanes; ++i)
+    {
+        upper.emplace_back(0.01 * static_cast<double>(i + 1));
+    }
+    const auto wave = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{std::sin(20.0 * t.value())}; };
+    std::vector<pkr::units::kilojoule_t<double>> energies(lanes, pkr::units::kilojoule_t<double>{0.0});
+
+    const std::size_t failures = pkr::units::gauss_kronrod_parallel(
+        wave,
+        std::span<const pkr::units::second_t<double>>{lower},
+        std::span<const pkr::units::second_t<double>>{upper},
+        std::span<pkr::units::kilojoule_t<double>>{energies},
+        pkr::units::kilojoule_t<double>{1e-15},
+        0.0,
+        100,
+        pool);
+
+    EXPECT_EQ(failures, 0u);
+    for (std::size_t i = 0; i < lanes; ++i)
+    {
+        const double expected = (1.0 - std::cos(20.0 * upper[i].value())) / 20.0;
+        ASSERT_NEAR(energies[i].value() * 1000.0, expected, 1e-11);
+    }
+
+    std::vector<pkr::units::joule_t<double>> mismatched(lanes - 1, pkr::units::joule_t<double>{0.0});
+    EXPECT_THROW(
+        static_cast<void>(pkr::units::gauss_kronrod_parallel(
+            wave,
+            std::span<const pkr::units::second_t<double>>{lower},
+            std::span<const pkr::units::second_t<double>>{upper},
+            std::span<pkr::units::joule_t<double>>{mismatched})),
+        std::invalid_argument);
+}
+
+TEST_F(QuadratureTest, parallel_counts_lanes_that_miss_tolerance)
+{
+    const auto spike = [](const pkr::units::second_t<double>& t) { return pkr::units::watt_t<double>{1.0 / (1e-8 + (t.value() * t.value()))}; };
+    std::vector<pkr::units::second_t<double>> lower{pkr::units::second_t<double>{-1.0}, pkr::units::second_t<double>{1.0}};
+    std::vector<pkr::units::second_t<double>> upper{pkr::units::second_t<double>{1.0}, pkr::units::second_t<double>{2.0}};
+    std::vector<pkr::units::joule_t<double>> energies(2, pkr::units::joule_t<double>{0.0});
+    const std::size_t failures = pkr::units::gauss_kronrod_parallel(
+        spike,
+        std::span<const pkr::units::second_t<double>>{lower},
+        std::span<const pkr::units::second_t<double>>{upper},
+        std::span<pkr::units::joule_t<double>>{energies},
+        pkr::units::joule_t<double>{0.0},
+        1e-13,
+        3);
+    EXPECT_EQ(failures, 1u);
+    EXPECT_NEAR(energies[1].value(), 0.5, 1e-7);
+}
+
+} // namespace test
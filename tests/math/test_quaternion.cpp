@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/math/quaternion.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class QuaternionTest : public Test
+{
+protected:
+    using quat = pkr::units::quaternion_t<double>;
+    using meter_vec = pkr::units::vec_3d_units_t<pkr::units::meter_t<double>>;
+
+    static constexpr double half_pi = std::numbers::pi / 2.0;
+
+    static quat about_z(double angle)
+    {
+        return quat::from_axis_angle(meter_vec{0.0, 0.0, 2.0}, pkr::units::radian_t<double>{angle});
+    }
+};
+
+TEST_F(QuaternionTest, axis_angle_round_trip)
+{
+    const auto q = quat::from_axis_angle(meter_vec{1.0, 2.0, 2.0}, pkr::units::radian_t<double>{0.75});
+    EXPECT_NEAR(q.norm(), 1.0, 1e-15);
+    EXPECT_NEAR(q.angle().value(), 0.75, 1e-14);
+    const auto axis = q.axis();
+    EXPECT_NEAR(axis.x.value(), 1.0 / 3.0, 1e-14);
+    EXPECT_NEAR(axis.z.value(), 2.0 / 3.0, 1e-14);
+    EXPECT_THROW(static_cast<void>(quat::from_axis_angle(meter_vec{0.0, 0.0, 0.0}, pkr::units::radian_t<double>{1.0})), std::invalid_argument);
+
+    // Degrees convert at the boundary
+    const auto d = quat::from_axis_angle(meter_vec{0.0, 0.0, 1.0}, pkr::units::radian_t<double>{pkr::units::degree_t<double>{90.0}});
+    EXPECT_NEAR(d.angle().value(), half_pi, 1e-6);
+}
+
+TEST_F(QuaternionTest, rotate_keeps_unit_and_matches_matrix)
+{
+    const auto q = about_z(half_pi);
+    const auto r = q.rotate(meter_vec{1.0, 0.0, 5.0});
+    EXPECT_NEAR(r.x.value(), 0.0, 1e-15);
+    EXPECT_NEAR(r.y.value(), 1.0, 1e-15);
+    EXPECT_NEAR(r.z.value(), 5.0, 1e-15);
+
+    const auto general = quat::from_euler(pkr::units::radian_t<double>{0.3}, pkr::units::radian_t<double>{-0.7}, pkr::units::radian_t<double>{1.1});
+    const auto m = general.to_rotation_matrix();
+    const meter_vec v{0.4, -1.2, 2.5};
+    const auto by_quat = general.rotate(v);
+    const double mx = (m(0, 0).value() * 0.4) + (m(0, 1).value() * -1.2) + (m(0, 2).value() * 2.5);
+    const double mz = (m(2, 0).value() * 0.4) + (m(2, 1).value() * -1.2) + (m(2, 2).value() * 2.5);
+    EXPECT_NEAR(by_quat.x.value(), mx, 1e-14);
+    EXPECT_NEAR(by_quat.z.value(), mz, 1e-14);
+    EXPECT_NEAR(pkr::units::determinant(m).value(), 1.0, 1e-14);
+}
+
+TEST_F(QuaternionTest, compose_and_inverse)
+{
+    const auto a = about_z(0.4);
+    const auto b = quat::from_axis_angle(meter_vec{1.0, 0.0, 0.0}, pkr::units::radian_t<double>{-1.2});
+    const meter_vec v{1.0, 2.0, 3.0};
+
+    const auto composed = (a * b).rotate(v);
+    const auto sequential = a.rotate(b.rotate(v));
+    EXPECT_NEAR(composed.x.value(), sequential.x.value(), 1e-14);
+    EXPECT_NEAR(composed.y.value(), sequential.y.value(), 1e-14);
+    EXPECT_NEAR(composed.z.value(), sequential.z.value(), 1e-14);
+
+    const auto back = a.inverse().rotate(a.rotate(v));
+    EXPECT_NEAR(back.y.value(), 2.0, 1e-14);
+    const auto identity = a * a.conjugate();
+    EXPECT_NEAR(identity.w, 1.0, 1e-15);
+    EXPECT_NEAR(identity.z, 0.0, 1e-15);
+
+    // Long chains drift off unit length; normalized() restores it
+    quat drift = quat::identity();
+    for (int i = 0; i < 100000; ++i)
+    {
+        drift = drift * about_z(1e-3);
+    }
+    EXPECT_NEAR(drift.normalized().norm(), 1.0, 1e-15);
+}
+
+TEST_F(QuaternionTest, slerp_interpolates_angle)
+{
+    const auto a = quat::identity();
+    const auto b = about_z(half_pi);
+    const auto mid = pkr::units::slerp(a, b, 0.5);
+    EXPECT_NEAR(mid.angle().value(), half_pi / 2.0, 1e-14);
+    EXPECT_NEAR(pkr::units::slerp(a, b, 0.0).w, 1.0, 1e-15);
+    EXPECT_NEAR(pkr::units::slerp(a, b, 1.0).angle().value(), half_pi, 1e-14);
+
+    // Opposite-sign quaternions are the same rotation: take the short arc
+    const quat negated{-b.w, -b.x, -b.y, -b.z};
+    EXPECT_NEAR(pkr::units::slerp(a, negated, 0.5).angle().value(), half_pi / 2.0, 1e-14);
+
+    // Nearly parallel inputs fall back to normalized lerp
+    const auto tiny = pkr::units::slerp(a, about_z(1e-12), 0.5);
+    EXPECT_NEAR(tiny.norm(), 1.0, 1e-15);
+}
+
+TEST_F(QuaternionTest, batched_rotate_matches_single)
+{
+    const auto q = quat::from_euler(pkr::units::radian_t<double>{0.2}, pkr::units::radian_t<double>{0.5}, pkr::units::radian_t<double>{-0.9});
+    std::vector<meter_vec> points;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const double s = static_cast<double>(i);
+        points.emplace_back(s, -0.5 * s, std::sin(s));
+    }
+    std::vector<meter_vec> out(points.size());
+    q.rotate(std::span<const meter_vec>{points}, std::span{out});
+    for (std::size_t i = 0; i < points.size(); i += 37)
+    {
+        const auto expected = q.rotate(points[i]);
+        EXPECT_NEAR(out[i].x.value(), expected.x.value(), 1e-12);
+        EXPECT_NEAR(out[i].y.value(), expected.y.value(), 1e-12);
+        EXPECT_NEAR(out[i].z.value(), expected.z.value(), 1e-12);
+    }
+
+    q.rotate(std::span{points}, std::span{points});
+    EXPECT_NEAR(points[999].z.value(), out[999].z.value(), 1e-15);
+
+    std::vector<meter_vec> short_out(3);
+    EXPECT_THROW(q.rotate(std::span{points}, std::span{short_out}), std::invalid_argument);
+}
+
+TEST_F(QuaternionTest, float_quaternion)
+{
+    using quat_f = pkr::units::quaternion_t<float>;
+    const auto q = quat_f::from_axis_angle(pkr::units::vec_3d_units_t<pkr::units::meter_t<float>>{0.0f, 1.0f, 0.0f}, pkr::units::radian_t<float>{1.5707964f});
+    const auto r = q.rotate(pkr::units::vec_3d_units_t<pkr::units::meter_t<float>>{1.0f, 0.0f, 0.0f});
+    EXPECT_NEAR(static_cast<double>(r.z.value()), -1.0, 1e-6);
+}
+
+} // namespace test
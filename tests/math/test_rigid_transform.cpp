@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <numbers>
+#include <span>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/math/point_cloud.h>
+#include <pkr_units/units/math/rigid_transform.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class RigidTransformTest : public Test
+{
+protected:
+    using pose = pkr::units::rigid_transform_t<pkr::units::meter_t<double>>;
+    using quat = pkr::units::quaternion_t<double>;
+    using meter_vec = pkr::units::vec_3d_units_t<pkr::units::meter_t<double>>;
+
+    static pose sample_a()
+    {
+        return pose{quat::from_axis_angle(meter_vec{0.0, 0.0, 1.0}, pkr::units::radian_t<double>{std::numbers::pi / 2.0}), meter_vec{1.0, 2.0, 3.0}};
+    }
+
+    static pose sample_b()
+    {
+        return pose{quat::from_euler(pkr::units::radian_t<double>{0.3}, pkr::units::radian_t<double>{-0.2}, pkr::units::radian_t<double>{0.8}), meter_vec{-4.0, 0.5, 1.5}};
+    }
+
+    static void expect_near(const meter_vec& a, const meter_vec& b, double tol)
+    {
+        EXPECT_NEAR(a.x.value(), b.x.value(), tol);
+        EXPECT_NEAR(a.y.value(), b.y.value(), tol);
+        EXPECT_NEAR(a.z.value(), b.z.value(), tol);
+    }
+};
+
+TEST_F(RigidTransformTest, apply_rotates_then_translates)
+{
+    const auto p = sample_a().apply(meter_vec{1.0, 0.0, 0.0});
+    expect_near(p, meter_vec{1.0, 3.0, 3.0}, 1e-15);
+    const auto d = sample_a().apply_to_direction(meter_vec{1.0, 0.0, 0.0});
+    expect_near(d, meter_vec{0.0, 1.0, 0.0}, 1e-15);
+    expect_near(pose::identity().apply(meter_vec{4.0, 5.0, 6.0}), meter_vec{4.0, 5.0, 6.0}, 0.0);
+}
+
+TEST_F(RigidTransformTest, compose_and_inverse)
+{
+    const meter_vec p{0.3, -2.0, 7.0};
+    expect_near((sample_a() * sample_b()).apply(p), sample_a().apply(sample_b().apply(p)), 1e-14);
+    expect_near(sample_b().inverse().apply(sample_b().apply(p)), p, 1e-14);
+    expect_near((sample_a() * sample_a().inverse()).translation(), meter_vec{0.0, 0.0, 0.0}, 1e-15);
+}
+
+TEST_F(RigidTransformTest, interpolate_poses)
+{
+    const auto a = pose::identity();
+    const auto b = sample_a();
+    const auto mid = pkr::units::interpolate(a, b, 0.5);
+    EXPECT_NEAR(mid.rotation().angle().value(), std::numbers::pi / 4.0, 1e-14);
+    expect_near(mid.translation(), meter_vec{0.5, 1.0, 1.5}, 1e-15);
+}
+
+TEST_F(RigidTransformTest, batched_apply_and_point_cloud_matrix)
+{
+    const auto t = sample_b();
+    std::vector<meter_vec> points;
+    pkr::units::point_cloud_t<pkr::units::meter_t<double>> cloud;
+    for (int i = 0; i < 515; ++i)
+    {
+        const double s = static_cast<double>(i) * 0.1;
+        points.emplace_back(s, 1.0 - s, 0.5 * s);
+        cloud.add_point(pkr::units::vec_4d_units_t<pkr::units::meter_t<double>>{s, 1.0 - s, 0.5 * s, 1.0});
+    }
+    std::vector<meter_vec> out(points.size());
+    t.apply(std::span<const meter_vec>{points}, std::span{out});
+
+    pkr::units::transform(cloud, t.to_matrix(), cloud);
+    for (std::size_t i = 0; i < points.size(); i += 17)
+    {
+        const auto expected = t.apply(points[i]);
+        expect_near(out[i], expected, 1e-13);
+        EXPECT_NEAR(cloud.x()[i], expected.x.value(), 1e-13);
+        EXPECT_NEAR(cloud.z()[i], expected.z.value(), 1e-13);
+    }
+}
+
+} // namespace test
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/math/root_finding.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class RootFindingTest : public Test
+{
+};
+
+namespace
+{
+
+// Classic test problem x^3 - 2x - 5 = 0 with x in meters
+constexpr double cubic_root = 2.0945514815423265;
+
+constexpr auto cubic = [](const pkr::units::meter_t<double>& x)
+{
+    const double v = x.value();
+    return pkr::units::meter_t<double>{(v * v * v) - (2.0 * v) - 5.0};
+};
+
+constexpr auto cubic_derivative = [](const pkr::units::meter_t<double>& x)
+{
+    const double v = x.value();
+    return pkr::units::scalar_t<double>{(3.0 * v * v) - 2.0};
+};
+
+// Pressure as a function of temperature, p = c * T^2 with c = 0.5 Pa/K^2, returned in kPa
+constexpr auto pressure_of = [](const pkr::units::kelvin_t<double>& t)
+{ return pkr::units::kilopascal_t<double>{0.5 * t.value() * t.value() / 1000.0}; };
+
+constexpr auto pressure_slope = [](const pkr::units::kelvin_t<double>& t)
+{ return pkr::units::pascal_t<double>{t.value()} / pkr::units::kelvin_t<double>{1.0}; };
+
+} // namespace
+
+TEST_F(RootFindingTest, derivative_type_is_value_over_argument)
+{
+    static_assert(std::is_same_v<pkr::units::derivative_t<pkr::units::meter_t<double>, pkr::units::second_t<double>>, pkr::units::meter_per_second_t<double>>);
+    static_assert(std::is_same_v<pkr::units::derivative_t<pkr::units::newton_t<double>, pkr::units::meter_per_second_t<double>>::value_type, double>);
+    SUCCEED();
+}
+
+// ============================================================================
+// Open methods
+// ============================================================================
+
+TEST_F(RootFindingTest, newton_raphson_readme_example)
+{
+    const pkr::units::kilogram_t<double> mass{1200.0};
+    const pkr::units::newton_t<double> target_force{3600.0};
+    const pkr::units::second_t<double> time{3.0};
+
+    const auto f = [=](const pkr::units::meter_per_second_t<double>& v) { return pkr::units::newton_t<double>{mass * (v / time)} - target_force; };
+    const auto df = [=](const pkr::units::meter_per_second_t<double>&) { return mass / time; };
+
+    const auto speed = pkr::units::newton_raphson(pkr::units::meter_per_second_t<double>{1.0}, f, df);
+    EXPECT_NEAR(speed.value(), 9.0, 1e-12);
+}
+
+TEST_F(RootFindingTest, newton_raphson_converts_ratios)
+{
+    // Solve p(T) = 50 kPa with f in kPa and f' in Pa/K
+    const auto f = [](const pkr::units::kelvin_t<double>& t) { return pressure_of(t) - pkr::units::kilopascal_t<double>{50.0}; };
+    const auto temperature = pkr::units::newton_raphson(pkr::units::kelvin_t<double>{300.0}, f, pressure_slope, pkr::units::kelvin_t<double>{1e-9});
+    EXPECT_NEAR(temperature.value(), std::sqrt(2.0 * 50000.0), 1e-9);
+}
+
+TEST_F(RootFindingTest, newton_raphson_is_constexpr)
+{
+    constexpr auto root = pkr::units::newton_raphson(pkr::units::meter_t<double>{2.0}, cubic, cubic_derivative);
+    static_assert(root.value() > 2.0945514 && root.value() < 2.0945515);
+    EXPECT_NEAR(root.value(), cubic_root, 1e-14);
+}
+
+TEST_F(RootFindingTest, newton_raphson_without_root_throws)
+{
+    const auto f = [](const pkr::units::meter_t<double>& x) { return pkr::units::meter_t<double>{(x.value() * x.value()) + 1.0}; };
+    const auto df = [](const pkr::units::meter_t<double>& x) { return pkr::units::scalar_t<double>{2.0 * x.value()}; };
+    EXPECT_THROW(static_cast<void>(pkr::units::newton_raphson(pkr::units::meter_t<double>{0.5}, f, df)), std::runtime_error);
+}
+
+TEST_F(RootFindingTest, halley_converges)
+{
+    const auto d2 = [](const pkr::units::meter_t<double>& x) { return pkr::units::scalar_t<double>{6.0 * x.value()} / pkr::units::meter_t<double>{1.0}; };
+    const auto root = pkr::units::halley(pkr::units::meter_t<double>{2.0}, cubic, cubic_derivative, d2);
+    EXPECT_NEAR(root.value(), cubic_root, 1e-14);
+}
+
+// ============================================================================
+// Bracketing methods
+// ============================================================================
+
+TEST_F(RootFindingTest, bisection_converges_to_tolerance)
+{
+    const auto root = pkr::units::bisection(cubic, pkr::units::meter_t<double>{2.0}, pkr::units::meter_t<double>{3.0}, pkr::units::millimeter_t<double>{0.001});
+    EXPECT_NEAR(root.value(), cubic_root, 1e-6);
+}
+
+TEST_F(RootFindingTest, brent_converges)
+{
+    const auto root = pkr::units::brent(cubic, pkr::units::meter_t<double>{2.0}, pkr::units::meter_t<double>{3.0});
+    EXPECT_NEAR(root.value(), cubic_root, 1e-14);
+
+    const auto decreasing = [](const pkr::units::meter_t<double>& x) { return pkr::units::meter_t<double>{std::cos(x.value())}; };
+    const auto pi_half = pkr::units::brent(decreasing, pkr::units::meter_t<double>{0.0}, pkr::units::meter_t<double>{3.0});
+    EXPECT_NEAR(pi_half.value(), std::acos(0.0), 1e-14);
+}
+
+TEST_F(RootFindingTest, bracketed_newton_converges)
+{
+    const auto root = pkr::units::bracketed_newton(cubic, cubic_derivative, pkr::units::meter_t<double>{3.0}, pkr::units::meter_t<double>{-3.0});
+    EXPECT_NEAR(root.value(), cubic_root, 1e-14);
+}
+
+TEST_F(RootFindingTest, invalid_bracket_throws)
+{
+    EXPECT_THROW(static_cast<void>(pkr::units::bisection(cubic, pkr::units::meter_t<double>{3.0}, pkr::units::meter_t<double>{4.0})), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(pkr::units::brent(cubic, pkr::units::meter_t<double>{3.0}, pkr::units::meter_t<double>{4.0})), std::invalid_argument);
+    EXPECT_THROW(
+        static_cast<void>(pkr::units::bracketed_newton(cubic, cubic_derivative, pkr::units::meter_t<double>{3.0}, pkr::units::meter_t<double>{4.0})),
+        std::invalid_argument);
+}
+
+TEST_F(RootFindingTest, brent_minimize_finds_minimum)
+{
+    const auto f = [](const pkr::units::meter_t<double>& x)
+    {
+        const double d = x.value() - 2.0;
+        return pkr::units::meter_t<double>{(d * d) + 1.0};
+    };
+    const auto minimum = pkr::units::brent_minimize(f, pkr::units::meter_t<double>{-5.0}, pkr::units::meter_t<double>{10.0});
+    EXPECT_NEAR(minimum.value(), 2.0, 1e-7);
+}
+
+// ============================================================================
+// Batch solvers
+// ============================================================================
+
+TEST_F(RootFindingTest, newton_raphson_batch_inverts_property_table)
+{
+    constexpr std::size_t lanes = 1000;
+    std::vector<pkr::units::kilopascal_t<double>> targets;
+    std::vector<pkr::units::kelvin_t<double>> temperatures(lanes, pkr::units::kelvin_t<double>{300.0});
+    for (std::size_t i = 0; i < lanes; ++i)
+    {
+        targets.emplace_back(10.0 + static_cast<double>(i));
+    }
+
+    const std::size_t failed = pkr::units::newton_raphson_batch(
+        std::span<const pkr::units::kilopascal_t<double>>{targets},
+        std::span<pkr::units::kelvin_t<double>>{temperatures},
+        pressure_of,
+        pressure_slope,
+        pkr::units::kelvin_t<double>{1e-9});
+
+    EXPECT_EQ(failed, 0u);
+    for (std::size_t i = 0; i < lanes; ++i)
+    {
+        EXPECT_NEAR(temperatures[i].value(), std::sqrt(2.0 * 1000.0 * targets[i].value()), 1e-8);
+    }
+}
+
+TEST_F(RootFindingTest, bisection_batch_reports_bad_brackets)
+{
+    const std::vector<pkr::units::kilopascal_t<double>> targets{pkr::units::kilopascal_t<double>{50.0}, pkr::units::kilopascal_t<double>{1000.0}};
+    const std::vector<pkr::units::kelvin_t<double>> lower(2, pkr::units::kelvin_t<double>{100.0});
+    const std::vector<pkr::units::kelvin_t<double>> upper(2, pkr::units::kelvin_t<double>{500.0});
+    std::vector<pkr::units::kelvin_t<double>> x(2, pkr::units::kelvin_t<double>{0.0});
+
+    const std::size_t failed = pkr::units::bisection_batch(
+        std::span<const pkr::units::kilopascal_t<double>>{targets},
+        std::span<const pkr::units::kelvin_t<double>>{lower},
+        std::span<const pkr::units::kelvin_t<double>>{upper},
+        std::span<pkr::units::kelvin_t<double>>{x},
+        pressure_of,
+        pkr::units::kelvin_t<double>{1e-9});
+
+    EXPECT_EQ(failed, 1u);
+    EXPECT_NEAR(x[0].value(), std::sqrt(100000.0), 1e-8);
+    EXPECT_EQ(x[1].value(), 0.0); // no sign change: left unchanged
+}
+
+TEST_F(RootFindingTest, newton_raphson_batch_counts_flat_lanes_as_failures)
+{
+    // f'(0) = 0 while f(0) != 0: the lane cannot move
+    const std::vector<pkr::units::kilopascal_t<double>> targets{pkr::units::kilopascal_t<double>{50.0}, pkr::units::kilopascal_t<double>{50.0}};
+    std::vector<pkr::units::kelvin_t<double>> temperatures{pkr::units::kelvin_t<double>{0.0}, pkr::units::kelvin_t<double>{300.0}};
+
+    const std::size_t failed = pkr::units::newton_raphson_batch(
+        std::span<const pkr::units::kilopascal_t<double>>{targets},
+        std::span<pkr::units::kelvin_t<double>>{temperatures},
+        pressure_of,
+        pressure_slope,
+        pkr::units::kelvin_t<double>{1e-9});
+
+    EXPECT_EQ(failed, 1u);
+    EXPECT_EQ(temperatures[0].value(), 0.0);
+    EXPECT_NEAR(temperatures[1].value(), std::sqrt(100000.0), 1e-8);
+}
+
+TEST_F(RootFindingTest, bisection_batch_solves_many_lanes_in_lock_step)
+{
+    constexpr std::size_t lanes = 150; // more than one block
+    std::vector<pkr::units::kilopascal_t<double>> targets;
+    for (std::size_t i = 0; i < lanes; ++i)
+    {
+        targets.emplace_back(10.0 + static_cast<double>(i));
+    }
+    const std::vector<pkr::units::kelvin_t<double>> lower(lanes, pkr::units::kelvin_t<double>{100.0});
+    const std::vector<pkr::units::kelvin_t<double>> upper(lanes, pkr::units::kelvin_t<double>{1000.0});
+    std::vector<pkr::units::kelvin_t<double>> x(lanes, pkr::units::kelvin_t<double>{0.0});
+
+    const std::size_t failed = pkr::units::bisection_batch(
+        std::span<const pkr::units::kilopascal_t<double>>{targets},
+        std::span<const pkr::units::kelvin_t<double>>{lower},
+        std::span<const pkr::units::kelvin_t<double>>{upper},
+        std::span<pkr::units::kelvin_t<double>>{x},
+        pressure_of,
+        pkr::units::kelvin_t<double>{1e-9});
+
+    EXPECT_EQ(failed, 0u);
+    for (std::size_t i = 0; i < lanes; ++i)
+    {
+        EXPECT_NEAR(x[i].value(), std::sqrt(2.0 * 1000.0 * targets[i].value()), 1e-8);
+    }
+}
+
+TEST_F(RootFindingTest, bisection_batch_counts_unfinished_brackets_as_failures)
+{
+    const std::vector<pkr::units::kilopascal_t<double>> targets{pkr::units::kilopascal_t<double>{50.0}};
+    const std::vector<pkr::units::kelvin_t<double>> lower{pkr::units::kelvin_t<double>{100.0}};
+    const std::vector<pkr::units::kelvin_t<double>> upper{pkr::units::kelvin_t<double>{500.0}};
+    std::vector<pkr::units::kelvin_t<double>> x{pkr::units::kelvin_t<double>{0.0}};
+
+    // 400 K halved 5 times is still 12.5 K wide
+    const std::size_t failed = pkr::units::bisection_batch(
+        std::span<const pkr::units::kilopascal_t<double>>{targets},
+        std::span<const pkr::units::kelvin_t<double>>{lower},
+        std::span<const pkr::units::kelvin_t<double>>{upper},
+        std::span<pkr::units::kelvin_t<double>>{x},
+        pressure_of,
+        pkr::units::kelvin_t<double>{1e-9},
+        5);
+
+    EXPECT_EQ(failed, 1u);
+    EXPECT_NEAR(x[0].value(), std::sqrt(100000.0), 12.5);
+}
+
+} // namespace test
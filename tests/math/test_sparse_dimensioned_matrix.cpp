@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/math/sparse_dimensioned_matrix.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class SparseDimensionedMatrixTest : public Test
+{
+};
+
+template <std::size_t... index_v>
+auto alternating_dims(std::index_sequence<index_v...>)
+    -> pkr::units::dimension_list<(index_v % 2 == 0 ? pkr::units::length_dimension : pkr::units::velocity_dimension)...>;
+
+// 200 states, 20 position measurements
+using state_dims = decltype(alternating_dims(std::make_index_sequence<200>{}));
+template <std::size_t... index_v>
+auto position_dims(std::index_sequence<index_v...>) -> pkr::units::dimension_list<((void)index_v, pkr::units::length_dimension)...>;
+using measurement_dims = decltype(position_dims(std::make_index_sequence<20>{}));
+
+using covariance_t = pkr::units::covariance_matrix_t<double, state_dims>;
+using jacobian_t = pkr::units::jacobian_matrix_t<double, measurement_dims, state_dims>;
+using sparse_jacobian_t = pkr::units::sparse_dimensioned_matrix_t<double, jacobian_t::row_dimensions, jacobian_t::col_dimensions>;
+
+// Measurement i observes position state 2 * (5 * i)
+sparse_jacobian_t position_jacobian()
+{
+    std::vector<pkr::units::sparse_triplet<double>> entries;
+    for (std::size_t i = 0; i < measurement_dims::size; ++i)
+    {
+        entries.push_back({i, 10 * i, 1.0});
+    }
+    return sparse_jacobian_t::from_triplets(entries);
+}
+
+covariance_t random_covariance()
+{
+    std::mt19937 rng{3};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+    covariance_t p{};
+    for (auto& v : p.si_elements())
+    {
+        v = dist(rng);
+    }
+    return p;
+}
+
+// ============================================================================
+// Storage
+// ============================================================================
+
+TEST_F(SparseDimensionedMatrixTest, triplets_build_sorted_rows)
+{
+    using small_dims = pkr::units::dimension_list<pkr::units::length_dimension, pkr::units::velocity_dimension>;
+    using small_t = pkr::units::sparse_dimensioned_matrix_t<double, small_dims, small_dims>;
+    const auto m = small_t::from_triplets({{1, 1, 4.0}, {0, 1, 2.0}, {0, 0, 1.0}, {1, 1, 0.5}});
+    EXPECT_EQ(m.non_zeros(), 3u);
+    EXPECT_EQ(m.row_offsets()[1], 2u);
+    EXPECT_EQ(m.column_indices()[0], 0u);
+    EXPECT_DOUBLE_EQ(m.si_element(1, 1), 4.5);
+    EXPECT_DOUBLE_EQ(m.si_element(1, 0), 0.0);
+    EXPECT_DOUBLE_EQ((m.get<0, 1>().value()), 2.0);
+    static_assert(std::is_same_v<small_t::element_type<0, 1>, pkr::units::second_t<double>>);
+
+    EXPECT_THROW(static_cast<void>(small_t::from_triplets({{2, 0, 1.0}})), std::out_of_range);
+}
+
+TEST_F(SparseDimensionedMatrixTest, set_inserts_and_converts)
+{
+    sparse_jacobian_t h;
+    h.set<3, 30>(pkr::units::scalar_t<double>{1.0});
+    h.set<0, 1>(pkr::units::millisecond_t<double>{500.0});
+    h.set<3, 2>(pkr::units::scalar_t<double>{2.0});
+    EXPECT_EQ(h.non_zeros(), 3u);
+    EXPECT_DOUBLE_EQ((h.get<0, 1>().value()), 0.5);
+    EXPECT_DOUBLE_EQ(h.si_element(3, 2), 2.0);
+    EXPECT_EQ(h.column_indices()[1], 2u);
+
+    h.set<3, 2>(pkr::units::scalar_t<double>{3.0});
+    EXPECT_EQ(h.non_zeros(), 3u);
+    EXPECT_TRUE(sparse_jacobian_t{h.to_dense()} == h);
+}
+
+// ============================================================================
+// Products
+// ============================================================================
+
+TEST_F(SparseDimensionedMatrixTest, products_match_dense)
+{
+    const auto h = position_jacobian();
+    const auto h_dense = h.to_dense();
+    const auto p = random_covariance();
+
+    const auto hp = h * p;
+    const auto hp_dense = h_dense * p;
+    static_assert(std::is_same_v<decltype(hp), decltype(hp_dense)>);
+    EXPECT_TRUE(hp == hp_dense);
+
+    const auto pht = p * pkr::units::transpose(h);
+    const auto pht_dense = p * pkr::units::transpose(h_dense);
+    static_assert(std::is_same_v<decltype(pht), decltype(pht_dense)>);
+    EXPECT_TRUE(pht == pht_dense);
+
+    // Innovation covariance H P H^T has the measurement covariance type
+    const auto s = h * pht;
+    static_assert(std::is_same_v<std::remove_const_t<decltype(s)>, pkr::units::covariance_matrix_t<double, measurement_dims>>);
+    EXPECT_DOUBLE_EQ(s.si_element(2, 3), p.si_element(20, 30));
+}
+
+TEST_F(SparseDimensionedMatrixTest, transpose_keeps_csr_form)
+{
+    const auto h = position_jacobian();
+    const auto ht = pkr::units::transpose(h);
+    EXPECT_EQ(ht.non_zeros(), h.non_zeros());
+    EXPECT_DOUBLE_EQ(ht.si_element(190, 19), 1.0);
+    EXPECT_TRUE(ht.to_dense() == pkr::units::transpose(h.to_dense()));
+}
+
+} // namespace test
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <pkr_units/measurements/measurement_rss_3d.h>
+#include <pkr_units/measurements/measurement_rss_4d.h>
+#include <pkr_units/measurements/math/vector_measurement_rss_aligned.h>
+#include <pkr_units/si_units.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class AlignedVectorMeasurementsRSSTest : public Test
+{
+protected:
+    using meter_m = pkr::units::measurement_rss_t<pkr::units::meter_t<double>>;
+    using vec3 = pkr::units::vec_measurement_rss_3d_t<pkr::units::meter_t<double>>;
+    using aligned3 = pkr::units::aligned_vec_measurement_rss_3d_t<pkr::units::meter_t<double>>;
+    using aligned4 = pkr::units::aligned_vec_measurement_rss_4d_t<pkr::units::meter_t<double>>;
+
+    static aligned3 sample_a()
+    {
+        return aligned3{meter_m{1.0, 0.1}, meter_m{2.0, 0.2}, meter_m{3.0, 0.3}};
+    }
+
+    static aligned3 sample_b()
+    {
+        return aligned3{meter_m{-4.0, 0.05}, meter_m{0.5, 0.4}, meter_m{2.0, 0.1}};
+    }
+};
+
+TEST_F(AlignedVectorMeasurementsRSSTest, add_and_scale_match_per_component_vector)
+{
+    const vec3 a = sample_a().to_vec();
+    const vec3 b = sample_b().to_vec();
+    const auto sum = sample_a() + sample_b();
+    const auto expected = a + b;
+    EXPECT_DOUBLE_EQ(sum.x().value(), expected.x.value());
+    EXPECT_DOUBLE_EQ(sum.y().uncertainty(), expected.y.uncertainty());
+    EXPECT_DOUBLE_EQ(sum.z().uncertainty(), expected.z.uncertainty());
+
+    const auto diff = sample_a() - sample_b();
+    EXPECT_DOUBLE_EQ(diff.x().value(), 5.0);
+    EXPECT_DOUBLE_EQ(diff.x().uncertainty(), std::sqrt((0.1 * 0.1) + (0.05 * 0.05)));
+
+    const auto scaled = -2.0 * sample_a();
+    EXPECT_DOUBLE_EQ(scaled.z().value(), -6.0);
+    EXPECT_DOUBLE_EQ(scaled.z().uncertainty(), 0.6);
+    EXPECT_DOUBLE_EQ((sample_a() / 2.0).y().uncertainty(), 0.1);
+    EXPECT_DOUBLE_EQ((-sample_a()).y().uncertainty(), 0.2);
+
+    aligned3 acc = sample_a();
+    acc += sample_b();
+    acc -= sample_b();
+    EXPECT_DOUBLE_EQ(acc.x().value(), 1.0);
+    EXPECT_EQ(acc.values().v[3], 0.0);
+    EXPECT_EQ(acc.uncertainties().v[3], 0.0);
+}
+
+TEST_F(AlignedVectorMeasurementsRSSTest, dot_uncertainty_is_analytic)
+{
+    const auto d = pkr::units::dot(sample_a(), sample_b());
+    EXPECT_DOUBLE_EQ(d.value(), -4.0 + 1.0 + 6.0);
+
+    double variance = 0.0;
+    const double a[3] = {1.0, 2.0, 3.0};
+    const double sa[3] = {0.1, 0.2, 0.3};
+    const double b[3] = {-4.0, 0.5, 2.0};
+    const double sb[3] = {0.05, 0.4, 0.1};
+    for (int i = 0; i < 3; ++i)
+    {
+        variance += (b[i] * sa[i]) * (b[i] * sa[i]) + (a[i] * sb[i]) * (a[i] * sb[i]);
+    }
+    EXPECT_NEAR(d.uncertainty(), std::sqrt(variance), 1e-15);
+
+    // Same result as the per-component vector when all products are positive
+    const aligned3 positive{meter_m{4.0, 0.05}, meter_m{0.5, 0.4}, meter_m{2.0, 0.1}};
+    EXPECT_NEAR(pkr::units::dot(sample_a(), positive).uncertainty(), pkr::units::dot(sample_a().to_vec(), positive.to_vec()).uncertainty(), 1e-14);
+    EXPECT_EQ(pkr::units::details::is_pkr_unit<std::remove_cvref_t<decltype(d.unit_value())>>::value_dimension, pkr::units::area_dimension);
+
+    // A zero component still contributes through the other factor
+    const aligned3 x_axis{meter_m{1.0, 0.0}, meter_m{0.0, 0.0}, meter_m{0.0, 0.0}};
+    const aligned3 uncertain{meter_m{0.0, 0.5}, meter_m{1.0, 0.0}, meter_m{0.0, 0.0}};
+    EXPECT_DOUBLE_EQ(pkr::units::dot(x_axis, uncertain).uncertainty(), 0.5);
+}
+
+TEST_F(AlignedVectorMeasurementsRSSTest, magnitude_uncertainty)
+{
+    const aligned3 v{meter_m{3.0, 0.3}, meter_m{4.0, 0.1}, meter_m{0.0, 0.2}};
+    const auto m = v.magnitude();
+    EXPECT_DOUBLE_EQ(m.value(), 5.0);
+    EXPECT_NEAR(m.uncertainty(), std::sqrt((0.9 * 0.9) + (0.4 * 0.4)) / 5.0, 1e-15);
+    EXPECT_NEAR(sample_a().magnitude().uncertainty(), sample_a().to_vec().magnitude().uncertainty(), 1e-15);
+
+    const aligned3 zero{meter_m{0.0, 0.3}, meter_m{0.0, 0.4}, meter_m{0.0, 0.0}};
+    EXPECT_DOUBLE_EQ(zero.magnitude().uncertainty(), 0.5);
+}
+
+TEST_F(AlignedVectorMeasurementsRSSTest, cross_uncertainty)
+{
+    const auto c = pkr::units::cross(sample_a(), sample_b());
+    EXPECT_DOUBLE_EQ(c.x().value(), (2.0 * 2.0) - (3.0 * 0.5));
+    EXPECT_DOUBLE_EQ(c.y().value(), (3.0 * -4.0) - (1.0 * 2.0));
+    EXPECT_DOUBLE_EQ(c.z().value(), (1.0 * 0.5) - (2.0 * -4.0));
+
+    // c_x = a_y b_z - a_z b_y
+    const double expected_x = std::sqrt(std::pow(2.0 * 0.2, 2) + std::pow(2.0 * 0.1, 2) + std::pow(0.5 * 0.3, 2) + std::pow(3.0 * 0.4, 2));
+    EXPECT_NEAR(c.x().uncertainty(), expected_x, 1e-15);
+    // c_z = a_x b_y - a_y b_x
+    const double expected_z = std::sqrt(std::pow(0.5 * 0.1, 2) + std::pow(1.0 * 0.4, 2) + std::pow(-4.0 * 0.2, 2) + std::pow(2.0 * 0.05, 2));
+    EXPECT_NEAR(c.z().uncertainty(), expected_z, 1e-15);
+}
+
+TEST_F(AlignedVectorMeasurementsRSSTest, four_component_vector)
+{
+    const aligned4 p{meter_m{3.0, 0.3}, meter_m{4.0, 0.4}, meter_m{0.0, 0.0}};
+    EXPECT_DOUBLE_EQ(p.w().value(), 1.0);
+    EXPECT_DOUBLE_EQ(p.magnitude().value(), 5.0);
+    EXPECT_NEAR(p.magnitude().uncertainty(), std::sqrt((0.9 * 0.9) + (1.6 * 1.6)) / 5.0, 1e-15);
+
+    const aligned4 q{pkr::units::vec_measurement_rss_4d_t<pkr::units::meter_t<double>>{meter_m{1.0, 0.1}, meter_m{1.0, 0.1}, meter_m{1.0, 0.1}, meter_m{2.0, 0.2}}};
+    const auto d = pkr::units::dot(p, q);
+    EXPECT_DOUBLE_EQ(d.value(), 9.0);
+    EXPECT_NEAR(d.uncertainty(), pkr::units::dot(p.to_vec(), q.to_vec()).uncertainty(), 1e-14);
+    EXPECT_DOUBLE_EQ((p + q).w().uncertainty(), 0.2);
+}
+
+TEST_F(AlignedVectorMeasurementsRSSTest, float_and_scaled_units)
+{
+    using mm = pkr::units::measurement_rss_t<pkr::units::millimeter_t<float>>;
+    const pkr::units::aligned_vec_measurement_rss_3d_t<pkr::units::millimeter_t<float>> v{mm{1000.0f, 10.0f}, mm{0.0f, 0.0f}, mm{0.0f, 0.0f}};
+    const auto d = pkr::units::dot(v, v);
+    // Product lands in base SI like measurement_rss_t multiplication: 1 m^2
+    EXPECT_NEAR(static_cast<double>(d.value()), 1.0, 1e-6);
+    EXPECT_NEAR(static_cast<double>(d.uncertainty()), 0.01 * std::sqrt(2.0), 1e-6);
+    EXPECT_NEAR(static_cast<double>(v.magnitude().uncertainty()), 10.0, 1e-4);
+}
+
+} // namespace test
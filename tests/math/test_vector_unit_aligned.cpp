@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <type_traits>
+#include <pkr_units/si_units.h>
+#include <pkr_units/units/math/vector_unit_aligned.h>
+
+namespace test
+{
+
+using namespace ::testing;
+
+class AlignedVectorUnitsTest : public Test
+{
+protected:
+    using meter_vec = pkr::units::aligned_vec_3d_units_t<pkr::units::meter_t<double>>;
+    using meter_vec_f = pkr::units::aligned_vec_3d_units_t<pkr::units::meter_t<float>>;
+    using meter_vec4 = pkr::units::aligned_vec_4d_units_t<pkr::units::meter_t<double>>;
+};
+
+TEST_F(AlignedVectorUnitsTest, layout_is_register_aligned)
+{
+    EXPECT_EQ(alignof(meter_vec), 32u);
+    EXPECT_EQ(sizeof(meter_vec), 32u);
+    EXPECT_EQ(alignof(meter_vec_f), 16u);
+    EXPECT_EQ(sizeof(meter_vec4), 32u);
+}
+
+TEST_F(AlignedVectorUnitsTest, arithmetic_matches_unaligned_vector)
+{
+    const pkr::units::vec_3d_units_t<pkr::units::meter_t<double>> a{1.5, -2.0, 3.25};
+    const pkr::units::vec_3d_units_t<pkr::units::meter_t<double>> b{0.5, 4.0, -1.0};
+    const meter_vec va{a};
+    const meter_vec vb{b};
+
+    EXPECT_EQ((va + vb).to_vec(), a + b);
+    EXPECT_EQ((va - vb).to_vec(), a - b);
+    EXPECT_EQ((2.0 * va).to_vec(), 2.0 * a);
+    EXPECT_EQ((-va).to_vec(), -a);
+    EXPECT_DOUBLE_EQ((va / 4.0).z().value(), 3.25 / 4.0);
+    EXPECT_DOUBLE_EQ(pkr::units::dot(va, vb).value(), pkr::units::dot(a, b).value());
+    EXPECT_DOUBLE_EQ(va.magnitude().value(), a.magnitude().value());
+
+    meter_vec acc = va;
+    acc += vb;
+    acc -= va;
+    acc *= 3.0;
+    EXPECT_EQ(acc, 3.0 * vb);
+    EXPECT_EQ(acc.lanes().v[3], 0.0);
+}
+
+TEST_F(AlignedVectorUnitsTest, products_carry_dimensions)
+{
+    const meter_vec r{1.0, 0.0, 0.0};
+    const pkr::units::aligned_vec_3d_units_t<pkr::units::newton_t<double>> f{0.0, 2.0, 0.0};
+    const auto torque = pkr::units::cross(r, f);
+    EXPECT_EQ(pkr::units::details::is_pkr_unit<decltype(torque.z())>::value_dimension, pkr::units::details::is_pkr_unit<pkr::units::joule_t<double>>::value_dimension);
+    EXPECT_DOUBLE_EQ(torque.z().value(), 2.0);
+    EXPECT_DOUBLE_EQ(torque.x().value(), 0.0);
+
+    const auto work = pkr::units::dot(r, f);
+    EXPECT_EQ(pkr::units::details::is_pkr_unit<decltype(work)>::value_dimension, pkr::units::details::is_pkr_unit<pkr::units::joule_t<double>>::value_dimension);
+
+    const auto displacement = pkr::units::aligned_vec_3d_units_t<pkr::units::meter_per_second_t<double>>{1.0, 2.0, 3.0} * pkr::units::second_t<double>{0.5};
+    EXPECT_EQ(pkr::units::details::is_pkr_unit<decltype(displacement.y())>::value_dimension, pkr::units::length_dimension);
+    EXPECT_DOUBLE_EQ(displacement.y().value(), 1.0);
+}
+
+TEST_F(AlignedVectorUnitsTest, cross_product_right_handed)
+{
+    const meter_vec a{1.0, 2.0, 3.0};
+    const meter_vec b{-4.0, 0.5, 2.0};
+    const auto c = pkr::units::cross(a, b);
+    EXPECT_DOUBLE_EQ(c.x().value(), (2.0 * 2.0) - (3.0 * 0.5));
+    EXPECT_DOUBLE_EQ(c.y().value(), (3.0 * -4.0) - (1.0 * 2.0));
+    EXPECT_DOUBLE_EQ(c.z().value(), (1.0 * 0.5) - (2.0 * -4.0));
+
+    const meter_vec_f af{1.0f, 2.0f, 3.0f};
+    const meter_vec_f bf{-4.0f, 0.5f, 2.0f};
+    const auto cf = pkr::units::cross(af, bf);
+    EXPECT_FLOAT_EQ(cf.x().value(), 2.5f);
+    EXPECT_FLOAT_EQ(cf.y().value(), -14.0f);
+    EXPECT_FLOAT_EQ(cf.z().value(), 8.5f);
+    EXPECT_EQ(cf.lanes().v[3], 0.0f);
+}
+
+TEST_F(AlignedVectorUnitsTest, float_rsqrt_is_refined)
+{
+    for (float s : {1e-6f, 0.37f, 1.0f, 2.0f, 12345.0f, 3.5e12f})
+    {
+        const meter_vec_f v{s, 0.0f, 0.0f};
+        EXPECT_NEAR(static_cast<double>(v.magnitude().value()), static_cast<double>(s), static_cast<double>(s) * 1e-6);
+    }
+    const meter_vec_f v{3.0f, 4.0f, 12.0f};
+    EXPECT_NEAR(static_cast<double>(v.magnitude().value()), 13.0, 13.0 * 1e-6);
+    const auto n = v.normalized();
+    EXPECT_NEAR(static_cast<double>(n.magnitude().value()), 1.0, 1e-6);
+    EXPECT_NEAR(static_cast<double>(n.z().value()), 12.0 / 13.0, 1e-6);
+    EXPECT_EQ(meter_vec_f{}.magnitude().value(), 0.0f);
+    EXPECT_EQ(meter_vec_f{}.normalized(), pkr::units::aligned_vec_3d_units_t<pkr::units::scalar_t<float>>{});
+}
+
+TEST_F(AlignedVectorUnitsTest, float_magnitude_outside_the_normal_range)
+{
+    const double root3 = std::sqrt(3.0);
+
+    // Sum of squares is a denormal float
+    const meter_vec_f tiny{1e-21f, 1e-21f, 1e-21f};
+    EXPECT_NEAR(static_cast<double>(tiny.magnitude().value()), 1e-21 * root3, 1e-21 * root3 * 1e-6);
+    EXPECT_NEAR(static_cast<double>(tiny.normalized().x().value()), 1.0 / root3, 1e-6);
+
+    // Sum of squares overflows float
+    const meter_vec_f huge{1e20f, 1e20f, 1e20f};
+    EXPECT_NEAR(static_cast<double>(huge.magnitude().value()), 1e20 * root3, 1e20 * root3 * 1e-6);
+    EXPECT_NEAR(static_cast<double>(huge.normalized().z().value()), 1.0 / root3, 1e-6);
+
+    const meter_vec_f nan{std::nanf(""), 1.0f, 1.0f};
+    EXPECT_TRUE(std::isnan(nan.magnitude().value()));
+    EXPECT_TRUE(std::isnan(nan.normalized().y().value()));
+}
+
+TEST_F(AlignedVectorUnitsTest, four_component_vector)
+{
+    const meter_vec4 p{1.0, 2.0, 2.0, 4.0};
+    EXPECT_DOUBLE_EQ(p.magnitude().value(), 5.0);
+    EXPECT_DOUBLE_EQ(meter_vec4{}.w().value(), 1.0);
+    const pkr::units::vec_4d_units_t<pkr::units::meter_t<double>> q{0.5, 0.5, 0.5, 0.5};
+    EXPECT_DOUBLE_EQ(pkr::units::dot(p, meter_vec4{q}).value(), 4.5);
+    EXPECT_EQ((p - p).w().value(), 0.0);
+    EXPECT_DOUBLE_EQ(p.normalized().w().value(), 0.8);
+}
+
+TEST_F(AlignedVectorUnitsTest, constexpr_evaluation)
+{
+    constexpr meter_vec a{1.0, 2.0, 3.0};
+    constexpr meter_vec b{4.0, 5.0, 6.0};
+    static_assert((a + b).z().value() == 9.0);
+    static_assert(pkr::units::dot(a, b).value() == 32.0);
+    static_assert(pkr::units::cross(a, b).x().value() == -3.0);
+    SUCCEED();
+}
+
+} // namespace test
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include <clocale>
+#include <cstdlib>
 #include <sstream>
+#include <string>
 
 #include <pkr_units/si_units.h>
 #include <pkr_units/impl/parsing/parse.h>
@@ -623,3 +626,82 @@ TEST_F(ComplexMonadicChainTest, parse_with_validation)
     ASSERT_TRUE(result);
     EXPECT_DOUBLE_EQ(*result, 42.5);
 }
+
+// ============================================================================
+// from_chars numeric parsing
+// ============================================================================
+
+class ParseFromCharsTest : public ::testing::Test
+{
+};
+
+TEST_F(ParseFromCharsTest, leading_plus_sign)
+{
+    auto result = parse<meter_t<double>>("+5.25 m");
+    ASSERT_TRUE(result);
+    EXPECT_DOUBLE_EQ(result->value(), 5.25);
+
+    auto invalid = parse<meter_t<double>>("+-5.25 m");
+    ASSERT_FALSE(invalid);
+    EXPECT_EQ(invalid.error(), parse_error::numeric_parse_error);
+}
+
+TEST_F(ParseFromCharsTest, out_of_range_is_rejected)
+{
+    auto result = parse<meter_t<double>>("1e400 m");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), parse_error::numeric_parse_error);
+}
+
+TEST_F(ParseFromCharsTest, integer_value_type)
+{
+    auto result = parse<second_t<int>>("-17 s");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), -17);
+}
+
+TEST_F(ParseFromCharsTest, wide_scientific_and_float_suffix)
+{
+    auto result = parse<meter_t<double>, wchar_t>(L"-1.5e3 m");
+    ASSERT_TRUE(result);
+    EXPECT_DOUBLE_EQ(result->value(), -1500.0);
+
+    auto suffixed = parse<meter_t<float>, wchar_t>(L"2.5f m");
+    ASSERT_TRUE(suffixed);
+    EXPECT_FLOAT_EQ(suffixed->value(), 2.5f);
+}
+
+TEST_F(ParseFromCharsTest, wide_non_ascii_digit_is_rejected)
+{
+    // U+0661 ARABIC-INDIC DIGIT ONE
+    auto result = parse<meter_t<double>, wchar_t>(L"\u0661 m");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), parse_error::numeric_parse_error);
+}
+
+TEST_F(ParseFromCharsTest, independent_of_c_locale)
+{
+    const char* previous = std::setlocale(LC_NUMERIC, nullptr);
+    const std::string saved = previous != nullptr ? previous : "C";
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr && std::setlocale(LC_NUMERIC, "de_DE") == nullptr)
+    {
+        GTEST_SKIP() << "no locale with a decimal comma installed";
+    }
+
+    auto result = parse<meter_t<double>>("5.25 m");
+    std::setlocale(LC_NUMERIC, saved.c_str());
+    ASSERT_TRUE(result);
+    EXPECT_DOUBLE_EQ(result->value(), 5.25);
+}
+
+// Same values as the strtod baseline it replaced (timing: examples/bench_parse_numeric.cpp)
+TEST_F(ParseFromCharsTest, matches_strtod)
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        const std::string text = std::to_string(static_cast<double>(i) * 1.125e-3) + "e2";
+        const auto value = impl::parse_numeric_char<double>(text);
+        ASSERT_TRUE(value) << text;
+        EXPECT_EQ(*value, std::strtod(text.c_str(), nullptr)) << text;
+    }
+}
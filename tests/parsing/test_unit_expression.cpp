@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <string_view>
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/impl/parsing/parse.h>
+
+using namespace pkr::units;
+
+// ============================================================================
+// Expression grammar
+// ============================================================================
+
+class UnitExpressionTest : public ::testing::Test
+{
+};
+
+TEST_F(UnitExpressionTest, products_quotients_and_powers)
+{
+    auto force = parse_unit_expression("kg*m/s^2");
+    ASSERT_TRUE(force);
+    EXPECT_EQ(force->dimension, (dimension_t{1, 1, -2, 0, 0, 0, 0, 0, 0}));
+    EXPECT_DOUBLE_EQ(force->scale, 1.0);
+
+    auto spaced = parse_unit_expression("kg m s^-2");
+    ASSERT_TRUE(spaced);
+    EXPECT_EQ(spaced->dimension, force->dimension);
+
+    auto adjacent = parse_unit_expression("m.s-1");
+    ASSERT_TRUE(adjacent);
+    EXPECT_EQ(adjacent->dimension, velocity_dimension);
+
+    auto inverse = parse_unit_expression("1/s");
+    ASSERT_TRUE(inverse);
+    EXPECT_EQ(inverse->dimension, (dimension_t{0, 0, -1, 0, 0, 0, 0, 0, 0}));
+}
+
+TEST_F(UnitExpressionTest, unicode_operators_and_superscripts)
+{
+    auto narrow = parse_unit_expression("W/(m²·K)");
+    ASSERT_TRUE(narrow);
+    EXPECT_EQ(narrow->dimension, (dimension_t{0, 1, -3, 0, -1, 0, 0, 0, 0}));
+
+    auto wide = parse_unit_expression(L"kg⋅m⋅s⁻²");
+    ASSERT_TRUE(wide);
+    EXPECT_EQ(wide->dimension, (dimension_t{1, 1, -2, 0, 0, 0, 0, 0, 0}));
+}
+
+TEST_F(UnitExpressionTest, operators_are_left_associative)
+{
+    auto grouped = parse_unit_expression("J/(kg*K)");
+    ASSERT_TRUE(grouped);
+    EXPECT_EQ(grouped->dimension, (dimension_t{2, 0, -2, 0, -1, 0, 0, 0, 0}));
+
+    auto left = parse_unit_expression("J/kg*K");
+    ASSERT_TRUE(left);
+    EXPECT_EQ(left->dimension, (dimension_t{2, 0, -2, 0, 1, 0, 0, 0, 0}));
+}
+
+TEST_F(UnitExpressionTest, scales_multiply_through)
+{
+    auto kmh = parse_unit_expression("km/h");
+    ASSERT_TRUE(kmh);
+    EXPECT_DOUBLE_EQ(kmh->scale, 1000.0 / 3600.0);
+
+    auto area = parse_unit_expression("cm^2");
+    ASSERT_TRUE(area);
+    EXPECT_DOUBLE_EQ(area->scale, 1e-4);
+
+    auto grouped = parse_unit_expression("(km/h)^2");
+    ASSERT_TRUE(grouped);
+    EXPECT_EQ(grouped->dimension, (dimension_t{2, 0, -2, 0, 0, 0, 0, 0, 0}));
+    EXPECT_DOUBLE_EQ(grouped->scale, (1000.0 / 3600.0) * (1000.0 / 3600.0));
+}
+
+TEST_F(UnitExpressionTest, si_prefixes_apply_to_registered_symbols)
+{
+    auto micro = parse_unit_expression("µmol/L");
+    ASSERT_TRUE(micro);
+    EXPECT_EQ(micro->dimension, molar_concentration_v);
+    EXPECT_DOUBLE_EQ(micro->scale, 1e-3);
+
+    auto deca = parse_unit_expression("dam");
+    ASSERT_TRUE(deca);
+    EXPECT_DOUBLE_EQ(deca->scale, 10.0);
+
+    auto mega = parse_unit_expression(L"MJ/kg");
+    ASSERT_TRUE(mega);
+    EXPECT_DOUBLE_EQ(mega->scale, 1e6);
+}
+
+TEST_F(UnitExpressionTest, rational_powers_need_whole_results)
+{
+    auto root = parse_unit_expression("(m^4)^(1/2)");
+    ASSERT_TRUE(root);
+    EXPECT_EQ(root->dimension, area_dimension);
+
+    auto scaled_root = parse_unit_expression("(cm^2)^(1/2)");
+    ASSERT_TRUE(scaled_root);
+    EXPECT_DOUBLE_EQ(scaled_root->scale, 0.01);
+
+    auto fractional = parse_unit_expression("m^(1/2)");
+    ASSERT_FALSE(fractional);
+    EXPECT_EQ(fractional.error(), parse_error::invalid_expression);
+}
+
+TEST_F(UnitExpressionTest, reports_malformed_expressions_and_unknown_symbols)
+{
+    for (std::string_view text : {"", "m/", "kg^", "(m", "m)", "m^(1/0)", "m**s", "10/s"})
+    {
+        auto result = parse_unit_expression(text);
+        ASSERT_FALSE(result) << text;
+        EXPECT_EQ(result.error(), parse_error::invalid_expression) << text;
+    }
+
+    auto unknown = parse_unit_expression("cubit/s");
+    ASSERT_FALSE(unknown);
+    EXPECT_EQ(unknown.error(), parse_error::unknown_symbol);
+}
+
+// ============================================================================
+// Compile-time checked expressions
+// ============================================================================
+
+TEST_F(UnitExpressionTest, checked_expressions_are_constant_expressions)
+{
+    constexpr checked_unit_expression_t<newton_t<double>> force_unit{"kg·m/s²"};
+    static_assert(force_unit.expression().scale == 1.0);
+    static_assert(force_unit.convert(2.5).value() == 2.5);
+
+    constexpr checked_unit_expression_t<meter_per_second_t<double>> speed_unit{L"km·h⁻¹"};
+    EXPECT_DOUBLE_EQ(speed_unit.convert(36.0).value(), 10.0);
+}
+
+// ============================================================================
+// parse<T> with compound symbols
+// ============================================================================
+
+TEST_F(UnitExpressionTest, parse_accepts_expressions_of_the_target_dimension)
+{
+    auto force = parse<newton_t<double>>("9.81 kg m/s^2");
+    ASSERT_TRUE(force);
+    EXPECT_DOUBLE_EQ(force->value(), 9.81);
+
+    auto speed = parse<meter_per_second_t<double>, wchar_t>(L"72 km·h⁻¹");
+    ASSERT_TRUE(speed);
+    EXPECT_DOUBLE_EQ(speed->value(), 20.0);
+
+    auto wrong = parse<newton_t<double>>("1 kg m/s");
+    ASSERT_FALSE(wrong);
+    EXPECT_EQ(wrong.error(), parse_error::symbol_mismatch);
+}
+
+TEST_F(UnitExpressionTest, parse_reports_the_expression_error)
+{
+    auto malformed = parse<newton_t<double>>("1 kg^");
+    ASSERT_FALSE(malformed);
+    EXPECT_EQ(malformed.error(), parse_error::invalid_expression);
+
+    auto unknown = parse<newton_t<double>>("1 cubit kg/s^2");
+    ASSERT_FALSE(unknown);
+    EXPECT_EQ(unknown.error(), parse_error::unknown_symbol);
+}
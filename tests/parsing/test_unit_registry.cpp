@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/impl/parsing/parse.h>
+
+using namespace pkr::units;
+
+// ============================================================================
+// Registry contents
+// ============================================================================
+
+class UnitRegistryTest : public ::testing::Test
+{
+};
+
+namespace
+{
+
+template <std::size_t... index_v>
+bool table_matches_types(std::index_sequence<index_v...>)
+{
+    return ((impl::make_unit_info<std::tuple_element_t<index_v, impl::registered_unit_types>>() == impl::unit_table[index_v]) && ...);
+}
+
+} // namespace
+
+// Guards against a stale unit_registry_table.h: re-run tools/generate_unit_registry.py
+TEST_F(UnitRegistryTest, generated_table_matches_unit_types)
+{
+    static_assert(std::tuple_size_v<impl::registered_unit_types> == impl::unit_table.size());
+    EXPECT_TRUE(table_matches_types(std::make_index_sequence<impl::unit_table.size()>{}));
+}
+
+TEST_F(UnitRegistryTest, every_symbol_and_name_is_found)
+{
+    // Spellings shared by units of one dimension that convert differently are not resolved by a dimensioned lookup
+    const auto shared = [](const unit_info& unit, auto member)
+    {
+        return std::any_of(registered_units().begin(),
+                           registered_units().end(),
+                           [&](const unit_info& other)
+                           { return other.dimension == unit.dimension && other.*member == unit.*member && other.scale != unit.scale; });
+    };
+
+    for (const unit_info& unit : registered_units())
+    {
+        const unit_info* by_symbol = find_unit(unit.symbol, unit.dimension);
+        if (shared(unit, &unit_info::symbol))
+        {
+            EXPECT_EQ(by_symbol, nullptr) << unit.name;
+        }
+        else
+        {
+            ASSERT_NE(by_symbol, nullptr) << unit.name;
+            EXPECT_EQ(by_symbol->symbol, unit.symbol);
+            EXPECT_EQ(by_symbol->scale, unit.scale);
+        }
+
+        if (!unit.w_symbol.empty())
+        {
+            const unit_info* by_w_symbol = find_unit(unit.w_symbol, unit.dimension);
+            if (shared(unit, &unit_info::w_symbol))
+            {
+                EXPECT_EQ(by_w_symbol, nullptr) << unit.name;
+            }
+            else
+            {
+                ASSERT_NE(by_w_symbol, nullptr) << unit.name;
+                EXPECT_EQ(by_w_symbol->w_symbol, unit.w_symbol);
+            }
+        }
+
+        if (!unit.name.empty())
+        {
+            const unit_info* by_name = find_unit(unit.name, unit.dimension);
+            ASSERT_NE(by_name, nullptr) << unit.name;
+            EXPECT_EQ(by_name->name, unit.name);
+        }
+    }
+}
+
+TEST_F(UnitRegistryTest, unknown_text_is_not_found)
+{
+    EXPECT_EQ(find_unit("cubit"), nullptr);
+    EXPECT_EQ(find_unit(""), nullptr);
+    EXPECT_EQ(find_unit(L"µ"), nullptr);
+    EXPECT_EQ(find_unit("km", mass_dimension), nullptr);
+}
+
+TEST_F(UnitRegistryTest, shared_symbols_prefer_si_then_dimension)
+{
+    EXPECT_EQ(find_unit("m")->name, "meter");
+    EXPECT_EQ(find_unit("m", angle_dimension), nullptr); // hms and dms arcminute
+    EXPECT_EQ(find_unit("h", angle_dimension)->name, "hms_archour");
+    EXPECT_EQ(find_unit("F")->name, "farad");
+    EXPECT_EQ(find_unit("F", temperature_dimension)->name, "fahrenheit");
+    EXPECT_EQ(find_unit(L"°C")->name, "celsius");
+}
+
+TEST_F(UnitRegistryTest, lookup_is_usable_in_constant_expressions)
+{
+    static_assert(find_unit("km")->scale == 1000.0);
+    static_assert(find_unit("kilometer")->dimension == length_dimension);
+    static_assert(find_unit(L"µm")->symbol == "um");
+    SUCCEED();
+}
+
+// ============================================================================
+// Converting parse
+// ============================================================================
+
+class ParseConversionTest : public ::testing::Test
+{
+};
+
+TEST_F(ParseConversionTest, prefixed_symbol_converts_to_target)
+{
+    auto km = parse<meter_t<double>>("5 km");
+    ASSERT_TRUE(km);
+    EXPECT_DOUBLE_EQ(km->value(), 5000.0);
+
+    auto mm = parse<meter_t<double>>("250 mm");
+    ASSERT_TRUE(mm);
+    EXPECT_DOUBLE_EQ(mm->value(), 0.25);
+
+    auto m = parse<kilometer_t<float>>("1500 m");
+    ASSERT_TRUE(m);
+    EXPECT_FLOAT_EQ(m->value(), 1.5f);
+}
+
+TEST_F(ParseConversionTest, other_systems_and_names_convert)
+{
+    auto ft = parse<meter_t<double>>("12 ft");
+    ASSERT_TRUE(ft);
+    EXPECT_DOUBLE_EQ(ft->value(), 3.6576);
+
+    auto by_name = parse<meter_t<double>>("2 kilometer");
+    ASSERT_TRUE(by_name);
+    EXPECT_DOUBLE_EQ(by_name->value(), 2000.0);
+}
+
+TEST_F(ParseConversionTest, temperature_scales_apply_offsets)
+{
+    auto kelvin = parse<kelvin_t<double>>("20 C");
+    ASSERT_TRUE(kelvin);
+    EXPECT_DOUBLE_EQ(kelvin->value(), 293.15);
+
+    auto celsius = parse<celsius_t<double>>("68 F");
+    ASSERT_TRUE(celsius);
+    EXPECT_NEAR(celsius->value(), 20.0, 1e-12);
+
+    auto from_kelvin = parse<celsius_t<double>>("300 K");
+    ASSERT_TRUE(from_kelvin);
+    EXPECT_NEAR(from_kelvin->value(), 26.85, 1e-12);
+}
+
+TEST_F(ParseConversionTest, wide_symbols_convert)
+{
+    auto result = parse<meter_t<double>, wchar_t>(L"3 µm");
+    ASSERT_TRUE(result);
+    EXPECT_DOUBLE_EQ(result->value(), 3e-6);
+}
+
+TEST_F(ParseConversionTest, other_dimensions_and_unknown_symbols_still_fail)
+{
+    auto kg = parse<meter_t<double>>("5 kg");
+    ASSERT_FALSE(kg);
+    EXPECT_EQ(kg.error(), parse_error::symbol_mismatch);
+
+    auto unknown = parse<meter_t<double>>("5 cubit");
+    ASSERT_FALSE(unknown);
+    EXPECT_EQ(unknown.error(), parse_error::unknown_symbol);
+}
+
+TEST_F(ParseConversionTest, symbols_shared_within_a_dimension_are_ambiguous)
+{
+    auto arcminutes = parse<degree_t<double>>("30 m");
+    ASSERT_FALSE(arcminutes);
+    EXPECT_EQ(arcminutes.error(), parse_error::ambiguous_symbol);
+
+    auto arcseconds = parse<radian_t<double>>("1 s");
+    ASSERT_FALSE(arcseconds);
+    EXPECT_EQ(arcseconds.error(), parse_error::ambiguous_symbol);
+
+    auto degrees = parse<radian_t<double>>("180 deg");
+    ASSERT_TRUE(degrees);
+    EXPECT_NEAR(degrees->value(), 3.14159265, 1e-6);
+}
+
+// ============================================================================
+// parse_any
+// ============================================================================
+
+class ParseAnyTest : public ::testing::Test
+{
+};
+
+TEST_F(ParseAnyTest, returns_value_unit_and_dimension)
+{
+    auto result = parse_any("12 ft");
+    ASSERT_TRUE(result);
+    EXPECT_DOUBLE_EQ(result->value, 12.0);
+    EXPECT_EQ(result->unit->name, "foot");
+    EXPECT_EQ(result->dimension(), length_dimension);
+    EXPECT_DOUBLE_EQ(result->coherent_value(), 3.6576);
+}
+
+TEST_F(ParseAnyTest, converts_to_unit_types_of_the_same_dimension)
+{
+    auto result = parse_any(L"20 °C");
+    ASSERT_TRUE(result);
+
+    auto kelvin = result->as<kelvin_t<double>>();
+    ASSERT_TRUE(kelvin);
+    EXPECT_DOUBLE_EQ(kelvin->value(), 293.15);
+
+    auto fahrenheit = result->as<fahrenheit_t<double>>();
+    ASSERT_TRUE(fahrenheit);
+    EXPECT_NEAR(fahrenheit->value(), 68.0, 1e-12);
+
+    auto seconds = result->as<second_t<double>>();
+    ASSERT_FALSE(seconds);
+    EXPECT_EQ(seconds.error(), parse_error::symbol_mismatch);
+}
+
+TEST_F(ParseAnyTest, bare_number_is_dimensionless)
+{
+    auto result = parse_any("0.5");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->dimension(), scalar_dimension);
+    EXPECT_DOUBLE_EQ(result->coherent_value(), 0.5);
+}
+
+TEST_F(ParseAnyTest, reports_unknown_symbols_and_bad_numbers)
+{
+    auto unknown = parse_any("3 cubit");
+    ASSERT_FALSE(unknown);
+    EXPECT_EQ(unknown.error(), parse_error::unknown_symbol);
+
+    auto bad = parse_any("x m");
+    ASSERT_FALSE(bad);
+    EXPECT_EQ(bad.error(), parse_error::numeric_parse_error);
+}
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 #include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <pkr_units/units/math/matrix_unit_4d.h>
 #include <pkr_units/units/math/matrix_storage_policies.h>
 #include <pkr_units/measurements/math/matrix_measurement_rss_4d.h>
@@ -802,3 +808,222 @@ TEST(MatrixAccessPatternsTest, row_col_diagonal_access)
     EXPECT_EQ(m(2, 1).value(), 10.0);
     EXPECT_EQ(m(3, 0).value(), 13.0);
 }
+
+// ============================================================================
+// concurrent_arena_storage
+// ============================================================================
+
+namespace
+{
+using ConcurrentArena = concurrent_arena_storage<meter_t<double>, 70>;
+using ConcurrentArenaMatrix = matrix_4d_units_t<meter_t<double>, ConcurrentArena>;
+
+ConcurrentArenaMatrix::array_type diagonal_meters(double d)
+{
+    return ConcurrentArenaMatrix::array_type{
+        {{{meter_t<double>{d}, 0.0_m, 0.0_m, 0.0_m}},
+         {{0.0_m, meter_t<double>{d}, 0.0_m, 0.0_m}},
+         {{0.0_m, 0.0_m, meter_t<double>{d}, 0.0_m}},
+         {{0.0_m, 0.0_m, 0.0_m, meter_t<double>{d}}}}};
+}
+} // namespace
+
+TEST(MatrixStorageConcurrentArenaTest, slot_holds_initial_values)
+{
+    ConcurrentArena::reset_statistics();
+    {
+        ConcurrentArenaMatrix m(diagonal_meters(3.0));
+        EXPECT_TRUE(m.storage.in_arena());
+        EXPECT_EQ(ConcurrentArena::active_slots(), 1u);
+        EXPECT_EQ(m(2, 2).value(), 3.0);
+        m(0, 1) = 5.0_m;
+        EXPECT_EQ(m[0][1].value(), 5.0);
+
+        ConcurrentArenaMatrix copy(m);
+        EXPECT_EQ(ConcurrentArena::active_slots(), 2u);
+        EXPECT_EQ(copy(0, 1).value(), 5.0);
+
+        ConcurrentArenaMatrix moved(std::move(copy));
+        EXPECT_EQ(ConcurrentArena::active_slots(), 2u);
+        EXPECT_EQ(moved(1, 1).value(), 3.0);
+    }
+    EXPECT_EQ(ConcurrentArena::active_slots(), 0u);
+    EXPECT_EQ(ConcurrentArena::statistics().allocations, 2u);
+    EXPECT_EQ(ConcurrentArena::thread_statistics().peak_usage, 2u);
+}
+
+TEST(MatrixStorageConcurrentArenaTest, fallback_spans_multiple_words)
+{
+    ConcurrentArena::reset_statistics();
+    {
+        std::vector<ConcurrentArenaMatrix> matrices;
+        matrices.reserve(72);
+        for (int i = 0; i < 72; ++i)
+        {
+            matrices.emplace_back(diagonal_meters(static_cast<double>(i)));
+        }
+        EXPECT_EQ(ConcurrentArena::active_slots(), 70u);
+        EXPECT_FALSE(matrices[71].storage.in_arena());
+        EXPECT_EQ(matrices[71](3, 3).value(), 71.0);
+        EXPECT_EQ(matrices[69](3, 3).value(), 69.0);
+    }
+    const auto stats = ConcurrentArena::statistics();
+    EXPECT_EQ(stats.allocations, 70u);
+    EXPECT_EQ(stats.fallbacks, 2u);
+    EXPECT_EQ(stats.peak_usage, 70u);
+    EXPECT_EQ(ConcurrentArena::active_slots(), 0u);
+}
+
+TEST(MatrixStorageConcurrentArenaTest, worker_threads_share_the_pool)
+{
+    ConcurrentArena::reset_statistics();
+    constexpr int thread_count = 4;
+    constexpr int iterations = 2000;
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(thread_count, 0);
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back(
+            [t, &mismatches]()
+            {
+                for (int i = 0; i < iterations; ++i)
+                {
+                    const double d = static_cast<double>((t * iterations) + i);
+                    ConcurrentArenaMatrix a(diagonal_meters(d));
+                    ConcurrentArenaMatrix b(diagonal_meters(-d));
+                    if (a(1, 1).value() != d || b(2, 2).value() != -d)
+                    {
+                        ++mismatches[static_cast<std::size_t>(t)];
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const int m : mismatches)
+    {
+        EXPECT_EQ(m, 0);
+    }
+    // Counters of exited threads are retained in the aggregate
+    const auto stats = ConcurrentArena::statistics();
+    EXPECT_EQ(stats.allocations + stats.fallbacks, static_cast<std::size_t>(2 * thread_count * iterations));
+    EXPECT_EQ(stats.fallbacks, 0u);
+    EXPECT_LE(stats.peak_usage, static_cast<std::size_t>(2 * thread_count));
+    EXPECT_EQ(ConcurrentArena::active_slots(), 0u);
+}
+
+// ============================================================================
+// pmr_storage
+// ============================================================================
+
+namespace
+{
+using PmrMatrix = matrix_4d_units_t<meter_t<double>, pmr_storage<meter_t<double>>>;
+
+bool allocated_from(const void* p, const std::array<std::byte, 8192>& buffer)
+{
+    const auto* b = static_cast<const std::byte*>(p);
+    return b >= buffer.data() && b < buffer.data() + buffer.size();
+}
+} // namespace
+
+TEST(MatrixStoragePmrTest, elements_live_in_the_resource)
+{
+    std::array<std::byte, 8192> buffer{};
+    std::pmr::monotonic_buffer_resource frame{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    PmrMatrix m(diagonal_meters(2.0), &frame);
+    EXPECT_TRUE(allocated_from(&m(0, 0), buffer));
+    EXPECT_EQ(m.get_allocator().resource(), &frame);
+    EXPECT_EQ(m(3, 3).value(), 2.0);
+
+    // Extended copy stays in the frame; plain copy uses the default resource
+    PmrMatrix frame_copy(m, &frame);
+    EXPECT_TRUE(allocated_from(&frame_copy(0, 0), buffer));
+    PmrMatrix heap_copy(m);
+    EXPECT_FALSE(allocated_from(&heap_copy(0, 0), buffer));
+    EXPECT_EQ(heap_copy(1, 1).value(), 2.0);
+
+    // Assignment keeps the target's resource
+    heap_copy(1, 1) = 7.0_m;
+    frame_copy = heap_copy;
+    EXPECT_TRUE(allocated_from(&frame_copy(0, 0), buffer));
+    EXPECT_EQ(frame_copy(1, 1).value(), 7.0);
+
+    PmrMatrix moved(std::move(frame_copy));
+    EXPECT_TRUE(allocated_from(&moved(0, 0), buffer));
+    EXPECT_EQ(moved(1, 1).value(), 7.0);
+}
+
+TEST(MatrixStoragePmrTest, moved_from_matrix_can_be_copied_and_reassigned)
+{
+    std::array<std::byte, 8192> buffer{};
+    std::pmr::monotonic_buffer_resource frame{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    PmrMatrix m(diagonal_meters(2.0), &frame);
+    PmrMatrix moved(std::move(m));
+    EXPECT_EQ(moved(2, 2).value(), 2.0);
+
+    // Copies of a moved-from matrix hold no elements either, and no copy reads from it
+    PmrMatrix copy(m);
+    PmrMatrix frame_copy(m, &frame);
+    PmrMatrix target(diagonal_meters(5.0), &frame);
+    target = m;
+
+    // Assigning a value makes them usable again
+    copy = moved;
+    frame_copy = moved;
+    target = moved;
+    m = moved;
+    EXPECT_EQ(copy(1, 1).value(), 2.0);
+    EXPECT_TRUE(allocated_from(&frame_copy(0, 0), buffer));
+    EXPECT_EQ(frame_copy(3, 3).value(), 2.0);
+    EXPECT_EQ(target(0, 0).value(), 2.0);
+    EXPECT_EQ(m(0, 0).value(), 2.0);
+
+    // Moving a moved-from matrix into another resource allocates nothing
+    PmrMatrix empty(std::move(moved));
+    PmrMatrix elsewhere(std::move(moved), &frame);
+    elsewhere = empty;
+}
+
+TEST(MatrixStoragePmrTest, pmr_vector_propagates_its_resource)
+{
+    std::array<std::byte, 8192> buffer{};
+    std::pmr::monotonic_buffer_resource frame{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    static_assert(std::uses_allocator_v<PmrMatrix, std::pmr::polymorphic_allocator<PmrMatrix>>);
+    static_assert(!std::uses_allocator_v<matrix_4d_units_t<meter_t<double>>, std::pmr::polymorphic_allocator<std::byte>>);
+
+    std::pmr::vector<PmrMatrix> matrices{&frame};
+    for (int i = 0; i < 10; ++i)
+    {
+        matrices.emplace_back(diagonal_meters(static_cast<double>(i)));
+    }
+    for (const auto& m : matrices)
+    {
+        EXPECT_EQ(m.get_allocator().resource(), &frame);
+        EXPECT_TRUE(allocated_from(&m(0, 0), buffer));
+    }
+    EXPECT_EQ(matrices[9](2, 2).value(), 9.0);
+}
+
+TEST(MatrixStoragePmrTest, measurement_matrix_with_pmr_storage)
+{
+    using PmrMeasMatrix = matrix_measurement_rss_4d_t<meter_t<double>, pmr_storage<measurement_rss_t<meter_t<double>>>>;
+    std::array<std::byte, 8192> buffer{};
+    std::pmr::monotonic_buffer_resource frame{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    auto arr = PmrMeasMatrix::array_type{
+        {{{{5.0, 0.1}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}},
+         {{{0.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}},
+         {{{0.0, 0.0}, {0.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}}},
+         {{{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {1.0, 0.0}}}}};
+    PmrMeasMatrix m(arr, &frame);
+
+    EXPECT_TRUE(allocated_from(&m(0, 0), buffer));
+    EXPECT_NEAR(m(0, 0).value(), 5.0, 0.001);
+    EXPECT_NEAR(m(0, 0).uncertainty(), 0.1, 0.001);
+}
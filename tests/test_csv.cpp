@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#include <pkr_units/si_units.h>
+#include <pkr_units/csv/csv.h>
+
+using namespace pkr::units;
+
+// ============================================================================
+// CSV / TSV ingest
+// ============================================================================
+
+class CsvReadTest : public ::testing::Test
+{
+};
+
+TEST_F(CsvReadTest, header_units_convert_into_target_columns)
+{
+    const std::string_view text = "timestamp,pressure [kPa],temperature [degC],note\n"
+                                  "0.0,101.3,20.5,start\n"
+                                  "0.5,99.8,21.0,\n";
+    auto table = csv::read(
+        text, csv::column<second_t<double>>{"timestamp"}, csv::column<pascal_t<double>>{"pressure"}, csv::column<kelvin_t<double>>{"temperature"});
+    ASSERT_TRUE(table);
+
+    const auto& [t, p, k] = *table;
+    ASSERT_EQ(t.size(), 2u);
+    EXPECT_DOUBLE_EQ(t[1].value(), 0.5);
+    EXPECT_DOUBLE_EQ(p[0].value(), 101300.0);
+    EXPECT_DOUBLE_EQ(k[1].value(), 294.15);
+}
+
+TEST_F(CsvReadTest, binding_unit_overrides_header_and_expressions_work)
+{
+    const std::string_view text = "a\tspeed (km/h)\n"
+                                  "1\t36\r\n"
+                                  "\n"
+                                  "2\t\"72\"\r\n";
+    csv::options options;
+    options.delimiter = '\t';
+    auto table = csv::read(text, options, csv::column<meter_per_second_t<double>>{"speed"}, csv::column<meter_t<float>>{"a", "ft"});
+    ASSERT_TRUE(table);
+
+    const auto& [speed, a] = *table;
+    ASSERT_EQ(speed.size(), 2u);
+    EXPECT_DOUBLE_EQ(speed[0].value(), 10.0);
+    EXPECT_DOUBLE_EQ(speed[1].value(), 20.0);
+    EXPECT_FLOAT_EQ(a[1].value(), 0.6096f);
+}
+
+TEST_F(CsvReadTest, empty_cells_are_nan)
+{
+    auto table = csv::read(std::string_view{"x,y\n1,\n2,3\n"}, csv::column<meter_t<double>>{"y"});
+    ASSERT_TRUE(table);
+    EXPECT_TRUE(std::isnan(std::get<0>(*table)[0].value()));
+    EXPECT_DOUBLE_EQ(std::get<0>(*table)[1].value(), 3.0);
+}
+
+TEST_F(CsvReadTest, quoted_empty_line_is_a_row_in_both_passes)
+{
+    // Whitespace-only lines are skipped; a line holding "" is one empty cell
+    auto table = csv::read(std::string_view{"x\n1\n\"\"\n \t\r\n2\n"}, csv::column<meter_t<double>>{"x"});
+    ASSERT_TRUE(table);
+    const auto& x = std::get<0>(*table);
+    ASSERT_EQ(x.size(), 3u);
+    EXPECT_DOUBLE_EQ(x[0].value(), 1.0);
+    EXPECT_TRUE(std::isnan(x[1].value()));
+    EXPECT_DOUBLE_EQ(x[2].value(), 2.0);
+}
+
+TEST_F(CsvReadTest, small_chunks_match_a_single_chunk)
+{
+    std::string text = "t [ms],v [mm/s]\n";
+    for (int i = 0; i < 5000; ++i)
+    {
+        text += std::to_string(i) + "," + std::to_string(i * 3) + "\n";
+    }
+
+    csv::options chunked;
+    chunked.chunk_bytes = 64;
+    auto parallel = csv::read(text, chunked, csv::column<second_t<double>>{"t"}, csv::column<meter_per_second_t<double>>{"v"});
+    csv::options serial;
+    serial.parallel = false;
+    auto single = csv::read(text, serial, csv::column<second_t<double>>{"t"}, csv::column<meter_per_second_t<double>>{"v"});
+    ASSERT_TRUE(parallel);
+    ASSERT_TRUE(single);
+
+    const auto& [t, v] = *parallel;
+    ASSERT_EQ(t.size(), 5000u);
+    for (std::size_t i = 0; i < t.size(); ++i)
+    {
+        EXPECT_EQ(t[i].value(), std::get<0>(*single)[i].value());
+        EXPECT_EQ(v[i].value(), std::get<1>(*single)[i].value());
+    }
+    EXPECT_DOUBLE_EQ(t[4999].value(), 4.999);
+    EXPECT_DOUBLE_EQ(v[10].value(), 0.03);
+}
+
+TEST_F(CsvReadTest, reports_errors_with_line_and_column)
+{
+    auto bad_number = csv::read(std::string_view{"a,b\n1,2\n3,4x\n"}, csv::column<meter_t<double>>{"b"});
+    ASSERT_FALSE(bad_number);
+    EXPECT_EQ(bad_number.error().code, csv::error_code::numeric_parse_error);
+    EXPECT_EQ(bad_number.error().line, 3u);
+    EXPECT_EQ(bad_number.error().column, 1u);
+
+    auto short_row = csv::read(std::string_view{"a,b\n1,2\n3\n"}, csv::column<meter_t<double>>{"b"});
+    ASSERT_FALSE(short_row);
+    EXPECT_EQ(short_row.error().code, csv::error_code::missing_field);
+    EXPECT_EQ(short_row.error().line, 3u);
+
+    auto missing = csv::read(std::string_view{"a,b\n1,2\n"}, csv::column<meter_t<double>>{"c"});
+    ASSERT_FALSE(missing);
+    EXPECT_EQ(missing.error().code, csv::error_code::missing_column);
+
+    auto wrong_dimension = csv::read(std::string_view{"a [s]\n1\n"}, csv::column<meter_t<double>>{"a"});
+    ASSERT_FALSE(wrong_dimension);
+    EXPECT_EQ(wrong_dimension.error().code, csv::error_code::dimension_mismatch);
+
+    auto unknown = csv::read(std::string_view{"a [cubit]\n1\n"}, csv::column<meter_t<double>>{"a"});
+    ASSERT_FALSE(unknown);
+    EXPECT_EQ(unknown.error().code, csv::error_code::unknown_unit);
+}
+
+TEST_F(CsvReadTest, reads_mapped_files)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "pkr_units_test_csv_read.csv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "\xEF\xBB\xBF" << "length [km],mass [g]\n1.5,250\n";
+    }
+    auto table = csv::read_file(path, csv::column<meter_t<double>>{"length"}, csv::column<kilogram_t<double>>{"mass"});
+    std::filesystem::remove(path);
+    ASSERT_TRUE(table);
+    EXPECT_DOUBLE_EQ(std::get<0>(*table)[0].value(), 1500.0);
+    EXPECT_DOUBLE_EQ(std::get<1>(*table)[0].value(), 0.25);
+
+    EXPECT_THROW(static_cast<void>(csv::read_file(path, csv::column<meter_t<double>>{"length"})), std::system_error);
+}
@@ -215,3 +215,13 @@ TEST(FormattingTraitsTest, BuildDimensionSymbolScalarIsEmpty)
     auto w_symbol = pkr::units::impl::build_dimension_symbol<wchar_t>(pkr::units::scalar_dimension);
     EXPECT_TRUE(w_symbol.empty());
 }
+
+TEST(FormattingTraitsTest, CompileTimeDimensionSymbolMatchesRuntimeBuild)
+{
+    constexpr pkr::units::dimension_t energy{2, 1, -2, 0, 0, 0, 0, 0};
+    static_assert(pkr::units::impl::dimension_symbol_v<char, energy> == "kg*m^2*s^-2");
+    static_assert(pkr::units::impl::dimension_symbol_v<char, pkr::units::scalar_dimension>.empty());
+
+    EXPECT_TRUE((pkr::units::impl::dimension_symbol_v<char8_t, energy>) == pkr::units::impl::build_dimension_symbol<char8_t>(energy));
+    EXPECT_EQ((pkr::units::impl::dimension_symbol_v<wchar_t, energy>), pkr::units::impl::build_dimension_symbol<wchar_t>(energy));
+}
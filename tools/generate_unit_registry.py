@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""Generate the unit table used by the runtime unit registry.
+
+Scans the unit headers under sdk/include/pkr_units/units for strong unit types
+(`template <is_unit_value_type_c T> struct NAME_t final : public unit_t<T, RATIO, DIMENSION[, TAG]>`,
+read from their `using _base = unit_t<...>;` line)
+that declare a non-empty `symbol`, and writes
+sdk/include/pkr_units/impl/parsing/unit_registry_table.h containing
+
+ - one include per header that defines a registered unit,
+ - `unit_table`: name, symbol, w_symbol, dimension, scale and offset of every
+   unit, copied from the headers as literals so that building the registry
+   does not instantiate the unit class templates,
+ - `registered_unit_types`: the matching type list, used by the tests to check
+   that the table still agrees with the unit types.
+
+Precedence matters when two units share a symbol ("m" is both meter and the
+hour-angle arcminute): SI headers come first, then temperature scales,
+dimensionless, CGS, imperial, astronomical and computer science units.
+
+Usage:
+    python tools/generate_unit_registry.py
+
+The header is rewritten only if its contents change.
+"""
+
+import re
+from pathlib import Path
+
+REPO = Path(__file__).resolve().parents[1]
+ROOT = REPO / 'sdk' / 'include' / 'pkr_units'
+OUT = ROOT / 'impl' / 'parsing' / 'unit_registry_table.h'
+
+# Directories in precedence order
+GROUPS = [
+    'units/base',
+    'units/derived',
+    'units/temperature',
+    'units/dimensionless',
+    'units/cgs',
+    'units/imperial',
+    'units/astronomical',
+    'units/computer_science',
+]
+
+# Legacy headers that only forward to others
+SKIP = {
+    'units/computer_science/count.h',
+}
+
+struct_re = re.compile(r'template\s*<\s*is_unit_value_type_c\s+\w+\s*>\s*struct\s+(\w+)\s+final\s*:\s*public\s+unit_t\s*<.*?\n\{(.*?)\n\};', re.S)
+base_re = re.compile(r'using\s+_base\s*=\s*unit_t\s*<(.*?)>\s*;', re.S)
+name_re = re.compile(r'static\s+constexpr\s+std::string_view\s+name\s*\{\s*"([^"]*)"\s*\}')
+symbol_re = re.compile(r'static\s+constexpr\s+std::string_view\s+symbol\s*\{\s*"([^"]*)"\s*\}')
+w_symbol_re = re.compile(r'static\s+constexpr\s+std::wstring_view\s+w_symbol\s*\{\s*L"([^"]*)"\s*\}')
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//.*', '', text)
+
+
+def split_template_args(args):
+    parts = []
+    depth = 0
+    current = ''
+    for ch in args:
+        if ch in '<{(':
+            depth += 1
+        elif ch in '>})':
+            depth -= 1
+        if ch == ',' and depth == 0:
+            parts.append(current.strip())
+            current = ''
+        else:
+            current += ch
+    parts.append(current.strip())
+    return parts
+
+
+def literal(regex, body):
+    m = regex.search(body)
+    return m.group(1) if m else ''
+
+
+def collect():
+    headers = []
+    units = []
+    for group in GROUPS:
+        for path in sorted((ROOT / group).rglob('*.h')):
+            rel = path.relative_to(ROOT).as_posix()
+            if rel in SKIP:
+                continue
+            text = strip_comments(path.read_text(encoding='utf-8-sig'))
+            found = []
+            for m in struct_re.finditer(text):
+                body = m.group(2)
+                symbol = literal(symbol_re, body)
+                base = base_re.search(body)
+                if not symbol or not base:
+                    continue
+                args = split_template_args(base.group(1))
+                found.append({
+                    'type': m.group(1),
+                    'ratio': args[1],
+                    'dimension': args[2],
+                    'tag': args[3] if len(args) > 3 else '',
+                    'name': literal(name_re, body),
+                    'symbol': symbol,
+                    'w_symbol': literal(w_symbol_re, body),
+                })
+            # A header redefining types seen earlier is a copy of that header
+            # (computer_science/flops.h duplicates flop.h); including both fails
+            known = {u['type'] for u in units}
+            if any(u['type'] in known for u in found):
+                continue
+            if found:
+                headers.append(rel)
+                units.extend(found)
+    return headers, units
+
+
+def render(headers, units):
+    lines = [
+        '#pragma once',
+        '',
+        '// Auto-generated by tools/generate_unit_registry.py. Do not edit.',
+        '// Re-run the script after adding, removing or renaming a unit type.',
+        '',
+        '#include <array>',
+        '#include <ratio>',
+        '#include <tuple>',
+        '#include <pkr_units/impl/parsing/unit_info.h>',
+    ]
+    lines += [f'#include <pkr_units/{h}>' for h in headers]
+    lines += [
+        '',
+        'namespace pkr::units::impl',
+        '{',
+        '',
+        '// Every unit with a symbol, in lookup precedence order',
+        f'inline constexpr std::array<unit_info, {len(units)}> unit_table{{',
+    ]
+    for i, u in enumerate(units):
+        params = u['ratio'] + (f', {u["tag"]}' if u['tag'] else '')
+        sep = ',' if i + 1 < len(units) else '};'
+        lines.append(f'    registered_unit<{params}>("{u["name"]}", "{u["symbol"]}", L"{u["w_symbol"]}", {u["dimension"]}){sep}')
+    lines += [
+        '',
+        '// The unit types behind unit_table, entry for entry',
+        'using registered_unit_types = std::tuple<',
+    ]
+    lines += [f'    {u["type"]}<double>{"," if i + 1 < len(units) else ">;"}' for i, u in enumerate(units)]
+    lines += [
+        '',
+        '} // namespace pkr::units::impl',
+        '',
+    ]
+    return '\n'.join(lines)
+
+
+def main():
+    headers, units = collect()
+    content = render(headers, units)
+    if OUT.exists() and OUT.read_text(encoding='utf-8') == content:
+        print(f'{OUT} is up to date ({len(units)} units)')
+        return
+    OUT.write_text(content, encoding='utf-8')
+    print(f'Wrote {OUT} with {len(units)} units from {len(headers)} headers')
+
+
+if __name__ == '__main__':
+    main()